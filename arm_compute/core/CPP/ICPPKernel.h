@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, 2025 Arm Limited.
+ * Copyright (c) 2016-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -108,6 +108,33 @@ public:
         return default_mws;
     }
 
+    /** Return the number of operations performed by a run of the kernel on the given tensors
+     *
+     * A multiply-accumulate counts as two operations.
+     *
+     * @param[in] tensors Tensors the kernel runs on.
+     *
+     * @return Number of operations, or 0 if unknown, i.e. the kernel does not provide an analytic count
+     */
+    virtual uint64_t get_flop_count(const ITensorPack &tensors) const
+    {
+        ARM_COMPUTE_UNUSED(tensors);
+
+        return 0;
+    }
+
+    /** Return the total size of the tensors the kernel was configured with
+     *
+     * Used to account for the bytes accessed by the kernels scheduled without a tensor pack, i.e. through
+     * @ref IScheduler::schedule, as their tensors cannot be inspected by the scheduler.
+     *
+     * @return Size in bytes, or 0 if unknown
+     */
+    virtual size_t get_configured_tensors_size() const
+    {
+        return 0;
+    }
+
     /** Name of the kernel
      *
      * @return Kernel name
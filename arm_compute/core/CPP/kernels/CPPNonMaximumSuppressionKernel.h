@@ -31,6 +31,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CPP/ICPPSimpleFunction.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 class ITensor;
@@ -52,11 +54,11 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     CPPNonMaximumSuppressionKernel &operator=(const CPPNonMaximumSuppressionKernel &) = delete;
     /** Allow instances of this class to be moved */
-    CPPNonMaximumSuppressionKernel(CPPNonMaximumSuppressionKernel &&) = default;
+    CPPNonMaximumSuppressionKernel(CPPNonMaximumSuppressionKernel &&);
     /** Allow instances of this class to be moved */
-    CPPNonMaximumSuppressionKernel &operator=(CPPNonMaximumSuppressionKernel &&) = default;
+    CPPNonMaximumSuppressionKernel &operator=(CPPNonMaximumSuppressionKernel &&);
     /** Default destructor */
-    ~CPPNonMaximumSuppressionKernel() = default;
+    ~CPPNonMaximumSuppressionKernel();
 
     /** Configure the kernel to perform non maximal suppression
      *
@@ -104,6 +106,9 @@ private:
     float          _iou_threshold;
 
     unsigned int _num_boxes;
+
+    struct Scratch;
+    std::unique_ptr<Scratch> _scratch;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_CPP_KERNELS_CPPNONMAXIMUMSUPPRESSIONKERNEL_H
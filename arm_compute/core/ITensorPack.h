@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2025 Arm Limited.
+ * Copyright (c) 2020-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -112,6 +112,11 @@ public:
      * @return True if empty else false
      */
     bool empty() const;
+    /** Total size in bytes of the packed tensors
+     *
+     * @return The sum of the total sizes of the packed tensors, tensors without info are ignored
+     */
+    size_t total_size() const;
 
 private:
     std::unordered_map<int, PackElement> _pack{}; /**< Container with the packed tensors */
@@ -57,6 +57,12 @@ struct FFTRadixStageKernelInfo
     bool         is_first_stage{false}; /**< Flags if the FFT kernels is the first stage of a decomposed FFT. */
 };
 
+/** Descriptor for the kernels mapping a real FFT of length 2M onto a complex FFT of length M */
+struct FFTRealKernelInfo
+{
+    bool inverse{false}; /**< Flags if the kernel is part of an inverse (complex-to-real) transform. */
+};
+
 class ITensorInfo;
 /** Descriptor used by the GEMM kernels */
 struct GEMMKernelInfo
@@ -253,5 +259,47 @@ struct MatMulKernelInfo
     int  k0{1};                         /**< Number of inner accumulations */
     bool export_rhs_to_cl_image{false}; /**< Flag to know whether the RHS tensor should be exported to cl_image*/
 };
+
+/** Rows of the per-unit coefficient tensor consumed by the fused LSTM cell kernels */
+enum class LSTMCellCoefficient : unsigned int
+{
+    InputGateBias,   /**< Input gate bias (unused with CIFG) */
+    ForgetGateBias,  /**< Forget gate bias */
+    CellBias,        /**< Cell bias */
+    OutputGateBias,  /**< Output gate bias */
+    CellToInput,     /**< Input gate peephole weights (unused with CIFG or without peephole) */
+    CellToForget,    /**< Forget gate peephole weights (unused without peephole) */
+    CellToOutput,    /**< Output gate peephole weights (unused without peephole) */
+    InputLayerNorm,  /**< Input gate layer normalization weights (unused with CIFG or without layer normalization) */
+    ForgetLayerNorm, /**< Forget gate layer normalization weights (unused without layer normalization) */
+    CellLayerNorm,   /**< Cell gate layer normalization weights (unused without layer normalization) */
+    OutputLayerNorm, /**< Output gate layer normalization weights (unused without layer normalization) */
+    Count            /**< Number of coefficient rows */
+};
+
+/** Descriptor used by the fused LSTM cell kernels */
+struct LSTMCellKernelInfo
+{
+    ActivationLayerInfo act_info{};            /**< Activation applied to the cell gate and to the cell state */
+    float               cell_threshold{0.f};   /**< Cell state clipping threshold. If set to 0.0 then clipping is disabled */
+    float               epsilon{1e-8f};        /**< Lower bound value for the layer normalization */
+    bool                has_cifg_opt{false};   /**< True if the input gate is coupled to the forget gate (CIFG) */
+    bool                has_peephole{false};   /**< True if peephole connections are used */
+    bool                use_layer_norm{false}; /**< True if layer normalization is applied to the gates */
+};
+
+/** Descriptor used by the recurrent step kernel */
+struct RecurrentStepKernelInfo
+{
+    bool               is_lstm{false}; /**< True for an LSTM step, false for a basic RNN step */
+    LSTMCellKernelInfo cell_info{};    /**< Activation and, for LSTM steps, cell description. Layer normalization is not supported */
+};
+
+/** Descriptor used by the layer normalization kernel */
+struct LayerNormKernelInfo
+{
+    bool  rms_norm{false}; /**< True to normalize by the root mean square, without centering nor bias */
+    float epsilon{1e-5f};  /**< Value added to the variance to avoid divisions by zero */
+};
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_KERNELDESCRIPTORS_H
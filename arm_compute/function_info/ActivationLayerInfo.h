@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -105,6 +105,24 @@ public:
     {
         return _enabled;
     }
+    /** Check if the floating-point kernels may use the fast accuracy tier */
+    bool fast_math() const
+    {
+        return _fast_math;
+    }
+    /** Allow the floating-point kernels to use the fast accuracy tier
+     *
+     * The fast tier computes @ref ActivationFunction::LOGISTIC, @ref ActivationFunction::TANH,
+     * @ref ActivationFunction::SWISH, @ref ActivationFunction::ELU and the exponential of
+     * @ref ActivationFunction::SOFT_RELU with an error of about 1e-4 instead of a few ULPs. The kernels based on
+     * lookup tables are exact and not affected, which includes the F16 kernels on AArch64. Disabled by default.
+     *
+     * @param[in] fast_math True to allow the fast accuracy tier
+     */
+    void set_fast_math(bool fast_math)
+    {
+        _fast_math = fast_math;
+    }
 
 #ifdef __aarch64__
     const LookupTable256 &lut() const
@@ -149,6 +167,7 @@ private:
     float              _a       = {};
     float              _b       = {};
     bool               _enabled = {false};
+    bool               _fast_math{false};
 
 #ifdef __aarch64__
     LookupTable256                    _lut = {};
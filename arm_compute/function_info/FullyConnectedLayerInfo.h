@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,6 +46,9 @@ struct FullyConnectedLayerInfo
     bool       enable_fast_math{false};                  /**<  Enable fast math computation. */
     /* Other parameters */
     bool fp_mixed_precision{false}; /**<  Use wider accumulators (32 bit instead of 16 for FP16) to improve accuracy. */
+    /** Quantize F32 inputs and weights to int8 at run time, per row and per output channel, to use the int8 GEMM
+     *  kernels. Ignored if they are not available. */
+    bool dynamic_quantization{false};
 
     /** Sets the weights trained data layout
      *
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_ROPEINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_ROPEINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+/** Rotary position embedding information
+ *
+ * The rotation of the pair (x0, x1) at position p and frequency index i is:
+ * (x0 * cos(p * t_i) - x1 * sin(p * t_i), x1 * cos(p * t_i) + x0 * sin(p * t_i)), with t_i = base^(-2 * i / rotary_dim)
+ */
+struct RoPEInfo
+{
+    /** Default constructor */
+    RoPEInfo() = default;
+    /** Constructor
+     *
+     * @param[in] heads    Number of query heads.
+     * @param[in] kv_heads Number of key and value heads.
+     * @param[in] dim      Number of elements of each head.
+     * @param[in] max_pos  Number of positions of the sin/cos table.
+     * @param[in] theta    (Optional) Base of the rotation frequencies.
+     */
+    RoPEInfo(unsigned int heads, unsigned int kv_heads, unsigned int dim, unsigned int max_pos, float theta = 10000.f)
+        : num_heads(heads), num_kv_heads(kv_heads), head_dim(dim), max_position(max_pos), base(theta)
+    {
+    }
+    unsigned int num_heads{0};       /**< Number of query heads */
+    unsigned int num_kv_heads{0};    /**< Number of key and value heads. Must divide @ref num_heads */
+    unsigned int head_dim{0};        /**< Number of elements of each head. Must be even */
+    unsigned int max_position{0};    /**< Number of positions of the sin/cos table */
+    float        base{10000.f};      /**< Base of the rotation frequencies */
+    unsigned int rotary_dim{0};      /**< Number of leading elements of each head that are rotated. 0 rotates the whole head */
+    bool         interleaved{false}; /**< True to rotate adjacent pairs (GPT-J), false to rotate the two halves (GPT-NeoX) */
+    bool         transpose_k{true};  /**< True to write K as [seq_len, head_dim] for each head, i.e. as the rhs of Q x K^T */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_ROPEINFO_H
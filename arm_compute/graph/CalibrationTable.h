@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_CALIBRATIONTABLE_H
+#define ACL_ARM_COMPUTE_GRAPH_CALIBRATIONTABLE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/graph/Types.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Ranges of the tensors of a graph, collected over calibration executions
+ *
+ * Tensors are identified by their id, so a table can only be applied to a graph built and mutated
+ * the same way as the graph it was collected on.
+ */
+class CalibrationTable final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] method     (Optional) Method deriving the ranges from the observed values
+     * @param[in] percentile (Optional) Percentile of the absolute values kept by @ref CalibrationMethod::Percentile
+     */
+    CalibrationTable(CalibrationMethod method = CalibrationMethod::MinMax, float percentile = 99.99f);
+    /** Accumulates the values of an F32 tensor into its range
+     *
+     * @param[in] tid    Id of the observed tensor
+     * @param[in] tensor Backing memory of the tensor
+     */
+    void observe(TensorID tid, const ITensor &tensor);
+    /** Records the largest absolute value of each channel of an F32 tensor
+     *
+     * @param[in] tid         Id of the observed tensor
+     * @param[in] tensor      Backing memory of the tensor
+     * @param[in] channel_idx Dimension of @p tensor indexing its channels
+     */
+    void observe_channels(TensorID tid, const ITensor &tensor, size_t channel_idx);
+    /** Checks if the range of a tensor has been calibrated
+     *
+     * @param[in] tid Tensor id
+     *
+     * @return True if the tensor has been observed
+     */
+    bool has_range(TensorID tid) const;
+    /** Returns the calibrated range of a tensor
+     *
+     * @param[in] tid Id of an observed tensor
+     *
+     * @return The minimum and maximum values of the tensor, clipped according to the calibration method
+     */
+    std::pair<float, float> range(TensorID tid) const;
+    /** Returns the largest absolute value of each channel of a tensor
+     *
+     * @param[in] tid Tensor id
+     *
+     * @return The per-channel ranges, empty if the channels of the tensor have not been observed
+     */
+    std::vector<float> channel_ranges(TensorID tid) const;
+    /** Loads the calibrated ranges from a file
+     *
+     * @param[in] filename File to load the ranges from
+     */
+    void load_from_file(const std::string &filename);
+    /** Stores the calibrated ranges to a file
+     *
+     * @param[in] filename File to store the ranges to
+     */
+    void save_to_file(const std::string &filename) const;
+
+private:
+    /** Statistics of an observed tensor */
+    struct TensorStats
+    {
+        float                 min{0.f};         /**< Smallest observed value */
+        float                 max{0.f};         /**< Largest observed value */
+        float                 hist_max{0.f};    /**< Upper bound of the histogram of the absolute values */
+        std::vector<uint64_t> histogram{};      /**< Histogram of the absolute values, empty for loaded ranges */
+        std::vector<float>    channel_ranges{}; /**< Largest absolute value of each channel */
+    };
+
+    /** Computes the threshold clipping the absolute values of a histogram */
+    float clipping_threshold(const TensorStats &stats) const;
+
+    CalibrationMethod               _method;
+    float                           _percentile;
+    std::map<TensorID, TensorStats> _stats;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_CALIBRATIONTABLE_H
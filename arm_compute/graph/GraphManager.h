@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,10 +28,13 @@
  * @publicapi
  */
 
+#include "arm_compute/graph/CalibrationTable.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/RuntimeProfiler.h"
 
 #include <map>
+#include <vector>
 
 namespace arm_compute
 {
@@ -72,10 +75,63 @@ public:
      */
     void finalize_graph(Graph &graph, GraphContext &ctx, PassManager &pm, Target target);
     /** Executes a graph
+     *
+     * When the graph was finalized with @ref GraphConfig::use_calibration set, the range of every F32 tensor
+     * is accumulated into the calibration table of the graph after the task producing it has run.
      *
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Binds caller-owned memory to an input or output node of a finalized graph
+     *
+     * The memory is used directly by the graph instead of being filled or drained through the node's accessor,
+     * and can be re-bound between executions without reconfiguring the graph.
+     * When every input and output of a graph has imported memory, @ref execute_graph runs the graph once.
+     *
+     * @note The memory must cover the total size of the node's tensor, follow its strides and stay valid
+     *       while the graph is executed.
+     *
+     * @param[in] graph  Finalized graph
+     * @param[in] nid    Id of an input or output node of @p graph
+     * @param[in] memory Memory to import
+     *
+     * @return An error status if the node is not an input/output node or its tensor can't be backed by @p memory
+     */
+    Status import_memory(Graph &graph, NodeID nid, void *memory);
+    /** Summarizes the profiled executions of a graph
+     *
+     * Each node is profiled as a layer named after the node, or "node_<id>" for unnamed nodes.
+     *
+     * @note Events are only recorded while the @ref RuntimeProfiler is enabled
+     *
+     * @param[in] graph Graph to summarize
+     * @param[in] type  (Optional) Type of the events to summarize, per-layer by default
+     *
+     * @return The statistics of the graph's layers or kernels
+     */
+    std::vector<RuntimeProfiler::Stats>
+    profile_summary(const Graph &graph, RuntimeProfiler::EventType type = RuntimeProfiler::EventType::Layer) const;
+    /** Builds the roofline report of the profiled executions of a graph
+     *
+     * @note Events are only recorded while the @ref RuntimeProfiler is enabled
+     *
+     * @param[in] graph Graph to report
+     * @param[in] info  Peak performance of the machine
+     * @param[in] layer (Optional) Only report the kernels of this layer, all layers by default
+     *
+     * @return The roofline statistics of the graph's kernels
+     */
+    std::vector<RuntimeProfiler::RooflineStats>
+    profile_roofline(const Graph &graph, const RuntimeProfiler::RooflineInfo &info, const char *layer = nullptr) const;
+    /** Returns the ranges collected by the calibration executions of a graph
+     *
+     * @note The graph must have been finalized with @ref GraphConfig::use_calibration set
+     *
+     * @param[in] graph Graph to query
+     *
+     * @return The calibration table of the graph
+     */
+    const CalibrationTable &calibration_table(const Graph &graph) const;
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -83,7 +139,8 @@ public:
     void invalidate_graph(Graph &graph);
 
 private:
-    std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
+    std::map<GraphID, ExecutionWorkload> _workloads    = {}; /**< Graph workloads */
+    std::map<GraphID, CalibrationTable>  _calibrations = {}; /**< Ranges collected on the calibrated graphs */
 };
 } // namespace graph
 } // namespace arm_compute
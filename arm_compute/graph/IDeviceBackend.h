@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,6 +94,22 @@ public:
      */
     virtual std::unique_ptr<ITensorHandle>
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) = 0;
+    /** Checks if the backend function of a node can access sub-tensors that split the rows or planes of their parent
+     *
+     * @note Such sub-tensors are not dense even when their parent is, so functions that collapse their
+     *       execution window or copy whole rows at once can't operate on them.
+     * @note Node types are accepted one at a time, once every kernel their function can run only collapses the
+     *       dimensions of its window, or reinterprets a tensor as a matrix, when the tensors have no holes.
+     *
+     * @param[in] node Node to check
+     *
+     * @return True if the backend function of @p node honours the strides of such sub-tensors else false
+     */
+    virtual bool supports_strided_subtensors(const INode &node)
+    {
+        ARM_COMPUTE_UNUSED(node);
+        return false;
+    }
     /** Configure a backend Node
      *
      * @note This creates an appropriate configured backend function for the given node
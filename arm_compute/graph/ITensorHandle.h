@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/graph/Types.h"
 
@@ -69,6 +70,20 @@ public:
      *          on the other hand if a sub-tensor is marked as unused then the parent tensor won't be released
      */
     virtual void release_if_unused() = 0;
+    /** Imports an external memory as the backing memory of the backend tensor
+     *
+     * @warning Ownership of the memory is not transferred
+     *
+     * @param[in] memory Raw memory pointer to be used as backing memory. Its size and layout must match the strides
+     *                   and padding of the backend tensor.
+     *
+     * @return An error status if the backend tensor does not support memory import
+     */
+    virtual Status import_memory(void *memory)
+    {
+        ARM_COMPUTE_UNUSED(memory);
+        return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Memory import is not supported by the backend");
+    }
     /** Backend tensor object accessor */
     virtual arm_compute::ITensor &tensor() = 0;
     /** Backend tensor object const accessor */
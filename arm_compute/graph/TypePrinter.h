@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,6 +78,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::BoundingBoxTransformLayer:
             os << "BoundingBoxTransformLayer";
             break;
+        case NodeType::CastLayer:
+            os << "CastLayer";
+            break;
         case NodeType::ChannelShuffleLayer:
             os << "ChannelShuffleLayer";
             break;
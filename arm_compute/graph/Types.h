@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -87,21 +87,36 @@ constexpr EdgeID EmptyEdgeID = std::numeric_limits<EdgeID>::max();
 // Forward declarations
 struct TensorDescriptor;
 
+/** Methods deriving the quantization range of a tensor from its calibration statistics */
+enum class CalibrationMethod
+{
+    MinMax,     /**< Observed minimum and maximum values */
+    Percentile, /**< Absolute values clipped to a percentile of their distribution */
+    Entropy,    /**< Absolute values clipped to minimize the KL divergence of their 8-bit distribution */
+};
+
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool        use_function_memory_manager{true};   /**< Use a memory manager to manage per-function auxilary memory */
-    bool        use_function_weights_manager{true};  /**< Use a weights manager to manage transformed weights */
-    bool        use_transition_memory_manager{true}; /**< Use a memory manager to manager transition buffer memory */
-    bool        use_tuner{false};                    /**< Use a tuner in tunable backends */
-    bool        use_synthetic_type{false};           /**< Convert graph to a synthetic graph for a data type */
-    DataType    synthetic_type{DataType::QASYMM8};   /**< The data type of the synthetic graph  */
-    CLTunerMode tuner_mode{CLTunerMode::EXHAUSTIVE}; /**< Tuner mode to be used by the CL tuner */
-    int         num_threads{
+    bool              use_function_memory_manager{true};             /**< Use a memory manager to manage per-function auxilary memory */
+    bool              use_function_weights_manager{true};            /**< Use a weights manager to manage transformed weights */
+    bool              use_transition_memory_manager{true};           /**< Use a memory manager to manager transition buffer memory */
+    bool              use_interval_memory_planner{false};            /**< Plan memory offsets from tensor live intervals (Neon™ only) */
+    bool              use_tuner{false};                              /**< Use a tuner in tunable backends */
+    bool              use_synthetic_type{false};                     /**< Convert graph to a synthetic graph for a data type */
+    DataType          synthetic_type{DataType::QASYMM8};             /**< The data type of the synthetic graph  */
+    bool              use_mixed_precision{false};                    /**< Store chains of F32 convolutions in BFLOAT16 (Neon™ only) */
+    bool              use_calibration{false};                        /**< Record the ranges of the F32 tensors over the executions of the graph */
+    CalibrationMethod calibration_method{CalibrationMethod::MinMax}; /**< Method deriving the quantization ranges of the calibrated tensors */
+    bool              use_quantization{false};                       /**< Quantize the convolutions to 8-bit with the ranges of the calibration file */
+    bool              use_dead_node_elimination{false};              /**< Remove the nodes whose outputs are neither consumed nor accessed */
+    CLTunerMode       tuner_mode{CLTunerMode::EXHAUSTIVE};           /**< Tuner mode to be used by the CL tuner */
+    int               num_threads{
         -1}; /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
-    std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
-    CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    std::string   tuner_file{"acl_tuner.csv"};             /**< File to load/store tuning values from */
+    std::string   mlgo_file{"heuristics.mlgo"};            /**< Filename to load MLGO heuristics from */
+    std::string   calibration_file{"acl_calibration.csv"}; /**< File to store/load the calibrated tensor ranges */
+    CLBackendType backend_type{CLBackendType::Native};     /**< CL backend type to use */
 };
 
 /**< Device target types */
@@ -161,6 +176,7 @@ enum class NodeType
     ArgMinMaxLayer,
     BatchNormalizationLayer,
     BoundingBoxTransformLayer,
+    CastLayer,
     ChannelShuffleLayer,
     ConcatenateLayer,
     ConvolutionLayer,
@@ -209,8 +225,9 @@ enum class NodeType
 /** Backend Memory Manager affinity **/
 enum class MemoryManagerAffinity
 {
-    Buffer, /**< Affinity at buffer level */
-    Offset  /**< Affinity at offset level */
+    Buffer,  /**< Affinity at buffer level */
+    Offset,  /**< Affinity at offset level */
+    Interval /**< Affinity at offset level with offsets planned from the tensor live intervals */
 };
 
 /** NodeID-index struct
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -148,6 +148,46 @@ std::vector<NodeIdxPair> get_driver_nodes(const INode &node);
  * @param[in, out] tensor Tensor to configure
  */
 void configure_tensor(Tensor *tensor);
+/** Checks if a tensor is overwritten by any of its consumers (i.e. used by an in-place operation)
+ *
+ * @param[in] g      Graph the tensor belongs to
+ * @param[in] tensor Tensor to check
+ *
+ * @return True if a consumer of the tensor writes its output back into it else false
+ */
+bool is_written_in_place(const Graph &g, const Tensor &tensor);
+/** Checks if the backend handle of a tensor is the parent of any sub-tensor of the graph
+ *
+ * @note The handle of such a tensor can't be replaced without invalidating the sub-tensors that point to it.
+ *
+ * @param[in] g      Graph the tensor belongs to
+ * @param[in] tensor Tensor to check
+ *
+ * @return True if any sub-tensor handle of the graph has the handle of @p tensor as parent else false
+ */
+bool is_subtensor_parent(Graph &g, Tensor &tensor);
+/** Checks if a sub-tensor keeps whole rows and planes of its parent
+ *
+ * @note Such a sub-tensor only differs from its parent along dimensions 2 and above, so any backend function can
+ *       operate on it.
+ *
+ * @param[in] parent_shape Shape of the parent tensor
+ * @param[in] shape        Shape of the sub-tensor
+ *
+ * @return True if the sub-tensor has the width and height of its parent else false
+ */
+bool keeps_parent_planes(const TensorShape &parent_shape, const TensorShape &shape);
+/** Checks if all the nodes that produce or consume a tensor can operate on it once it splits the rows or planes of
+ *  the tensor it is a view of
+ *
+ * @param[in] g       Graph the tensor belongs to
+ * @param[in] tensor  Tensor to check
+ * @param[in] ignored Node whose access to the tensor is not checked, e.g. the node replaced by the view
+ *
+ * @return True if the backend functions of all the other producers and consumers of @p tensor support strided
+ *         sub-tensors and the tensor has no accessor else false
+ */
+bool supports_strided_access(const Graph &g, Tensor &tensor, const INode &ignored);
 } // namespace graph
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_GRAPH_UTILS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@
 
 #include <functional>
 #include <memory>
+#include <set>
 #include <vector>
 
 namespace arm_compute
@@ -100,11 +101,12 @@ struct ExecutionTask
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};        /**< Input handles */
-    std::vector<Tensor *>      outputs = {};        /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};        /**< Execution workload */
-    Graph                     *graph   = {nullptr}; /**< Graph bound to the workload */
-    GraphContext              *ctx     = {nullptr}; /**< Graph execution context */
+    std::vector<Tensor *>      inputs           = {};        /**< Input handles */
+    std::vector<Tensor *>      outputs          = {};        /**< Output handles */
+    std::vector<ExecutionTask> tasks            = {};        /**< Execution workload */
+    Graph                     *graph            = {nullptr}; /**< Graph bound to the workload */
+    GraphContext              *ctx              = {nullptr}; /**< Graph execution context */
+    std::set<Tensor *>         imported_tensors = {};        /**< Input/output tensors backed by caller-owned memory */
 };
 } // namespace graph
 } // namespace arm_compute
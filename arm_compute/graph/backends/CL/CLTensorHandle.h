@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -60,6 +60,7 @@ public:
     void                        map(bool blocking) override;
     void                        unmap() override;
     void                        release_if_unused() override;
+    Status                      import_memory(void *memory) override;
     arm_compute::ITensor       &tensor() override;
     const arm_compute::ITensor &tensor() const override;
     ITensorHandle              *parent_handle() override;
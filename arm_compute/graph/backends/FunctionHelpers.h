@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -337,6 +337,41 @@ std::unique_ptr<IFunction> create_bounding_box_transform_layer(BoundingBoxTransf
     return std::move(func);
 }
 
+/** Create a backend cast layer function
+ *
+ * @tparam CastLayerFunction Backend cast function
+ * @tparam TargetInfo        Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend cast layer function
+ */
+template <typename CastLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_cast_layer(CastLayerNode &node)
+{
+    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<CastLayerFunction>();
+    func->configure(input, output, node.policy());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Input data Type: "
+                                               << input->info()->data_type() << " Output data Type: "
+                                               << output->info()->data_type() << " Shape: "
+                                               << input->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Create a backend channel shuffle layer function
  *
  * @tparam ChannelShuffleLayerFunction Backend channel shuffle function
@@ -1550,6 +1585,12 @@ std::unique_ptr<IFunction> create_slice_layer(SliceLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the slice is performed through a sub-tensor view
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1620,6 +1661,12 @@ std::unique_ptr<arm_compute::IFunction> create_stack_layer(StackLayerNode &node)
                                                                    << std::endl);
     ARM_COMPUTE_ERROR_ON(node.num_outputs() != 1);
 
+    // Return nullptr if the inputs are already written into sub-tensors of the output
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     std::vector<typename TargetInfo::TensorType *> inputs;
     for (unsigned int i = 0; i < node.num_inputs(); ++i)
@@ -1658,6 +1705,12 @@ std::unique_ptr<IFunction> create_strided_slice_layer(StridedSliceLayerNode &nod
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the slice is performed through a sub-tensor view
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
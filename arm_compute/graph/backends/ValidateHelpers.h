@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -104,6 +104,29 @@ Status validate_bounding_box_transform_layer(BoundingBoxTransformLayerNode &node
     return BoundingBoxTransformLayer::validate(input, output, deltas, bbox_info);
 }
 
+/** Validates a Cast layer node
+ *
+ * @tparam CastLayer Cast layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename CastLayer>
+Status validate_cast_layer(CastLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+        "Validating CastLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    return CastLayer::validate(input, output, node.policy());
+}
+
 /** Validates a Channel Shuffle layer node
  *
  * @tparam ChannelShuffleLayer  Channel Shuffle layer function type
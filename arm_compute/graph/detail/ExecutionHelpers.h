@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,8 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include <functional>
+
 namespace arm_compute
 {
 namespace graph
@@ -111,6 +113,27 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload);
  * @return  True if all the accessors expect more data
  */
 bool call_all_output_node_accessors(ExecutionWorkload &workload);
+/** Binds caller-owned memory as the backing memory of an input or output tensor of a workload
+ *
+ * The memory is used in place of the tensor's own allocation and accessors of the tensor are no longer called.
+ *
+ * @note The memory must cover the tensor's total size, match its strides and outlive any execution of the workload
+ *
+ * @param[in, out] workload Workload the tensor belongs to
+ * @param[in, out] tensor   Input or output tensor of the workload
+ * @param[in]      memory   Memory to import
+ *
+ * @return An error status if the tensor is not an input/output of the workload, is a sub-tensor, has padding,
+ *         @p memory is not aligned to the size of its elements or the tensor can't import memory
+ */
+Status import_tensor_memory(ExecutionWorkload &workload, Tensor *tensor, void *memory);
+/** Checks if all the input and output tensors of a workload are backed by caller-owned memory
+ *
+ * @param[in] workload Workload to check
+ *
+ * @return True if all the input and output tensors have imported memory
+ */
+bool all_io_tensors_imported(const ExecutionWorkload &workload);
 /** Prepares all tasks for execution
  *
  * @param[in] workload Workload to prepare
@@ -119,8 +142,9 @@ void prepare_all_tasks(ExecutionWorkload &workload);
 /** Executes all tasks of a workload
  *
  * @param[in] workload Workload to execute
+ * @param[in] observer (Optional) Function called with the node of each task once the task has run
  */
-void call_all_tasks(ExecutionWorkload &workload);
+void call_all_tasks(ExecutionWorkload &workload, const std::function<void(INode &)> &observer = nullptr);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,31 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Stores the tensor ranges collected by the executions of the stream to @ref GraphConfig::calibration_file
+     *
+     * @note The stream must have been finalized with @ref GraphConfig::use_calibration set
+     */
+    void save_calibration() const;
+    /** Binds caller-owned memory to an input of a finalized stream
+     *
+     * The input accessor is no longer called and the graph reads directly from @p memory.
+     *
+     * @param[in] idx    Index of the input, in the order the input layers were added to the stream
+     * @param[in] memory Memory to import. Must match the size and strides of the input tensor
+     *
+     * @return An error status if the memory can't be imported
+     */
+    Status import_input_memory(size_t idx, void *memory);
+    /** Binds caller-owned memory to an output of a finalized stream
+     *
+     * The output accessor is no longer called and the graph writes directly to @p memory.
+     *
+     * @param[in] idx    Index of the output, in the order the output layers were added to the stream
+     * @param[in] memory Memory to import. Must match the size and strides of the output tensor
+     *
+     * @return An error status if the memory can't be imported
+     */
+    Status import_output_memory(size_t idx, void *memory);
 
     // Inherited overridden methods
     void         add_layer(ILayer &layer) override;
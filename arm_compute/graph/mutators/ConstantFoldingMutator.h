@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_CONSTANTFOLDINGMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_CONSTANTFOLDINGMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to fold constant sub-graphs and remove dead nodes
+ *
+ * Reshape, flatten, permute, dequantization and floating-point element-wise nodes whose inputs are all
+ * exclusively owned constants are replaced by a single constant node. Its accessor evaluates the folded
+ * operation once, when the constant tensors are populated, rather than on every inference.
+ * When requested, nodes whose outputs are not consumed nor accessed are removed afterwards.
+ */
+class ConstantFoldingMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] remove_dead_nodes (Optional) Remove the nodes whose outputs are unused. Defaults to false
+     */
+    explicit ConstantFoldingMutator(bool remove_dead_nodes = false);
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    bool _remove_dead_nodes;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_CONSTANTFOLDINGMUTATOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,10 @@ namespace arm_compute
 namespace graph
 {
 /** Mutation pass to optimize depth concatenation operations by using sub-tensors
+ *
+ * Concatenations along the channel (or any outer) dimension are always optimized, while concatenations along the
+ * width or height are only optimized when the backend functions of all the producers and consumers of the inputs
+ * support strided sub-tensors.
  *
  * @warning Always run as one of the last mutation pass as optimizations might change the parent of sub-tensors.
  **/
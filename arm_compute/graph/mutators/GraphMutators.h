@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,12 +28,17 @@
  * @publicapi
  */
 
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
+#include "arm_compute/graph/mutators/MixedPrecisionMutator.h"
 #include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
+#include "arm_compute/graph/mutators/PostTrainingQuantizationMutator.h"
+#include "arm_compute/graph/mutators/SliceLayerSubTensorMutator.h"
 #include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
+#include "arm_compute/graph/mutators/StackLayerSubTensorMutator.h"
 #include "arm_compute/graph/mutators/SyntheticDataTypeMutator.h"
 
 #endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_GRAPHMUTATORS_H
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to run chains of F32 convolutions with BFLOAT16 storage
+ *
+ * Connected convolution layers whose constant weights and biases are exclusively owned are switched to
+ * BFLOAT16 inputs, weights, biases and outputs, halving the memory traffic of the activations they exchange.
+ * The constants are converted once, when their accessors run, and cast layers are inserted only where a chain
+ * meets a node without BFLOAT16 support, so precision sensitive layers such as softmax, normalization and
+ * reductions keep running in F32.
+ *
+ * @note The pass only applies to Neon™ nodes and does nothing if the CPU does not support BFLOAT16.
+ */
+class MixedPrecisionMutator final : public IGraphMutator
+{
+public:
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
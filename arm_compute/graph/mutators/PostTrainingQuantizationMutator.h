@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_POSTTRAININGQUANTIZATIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_POSTTRAININGQUANTIZATIONMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/CalibrationTable.h"
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to quantize the convolutions of an F32 graph with calibrated ranges
+ *
+ * Convolution and depthwise convolution layers whose input and output ranges have been calibrated are switched to
+ * QASYMM8_SIGNED activations, QSYMM8_PER_CHANNEL weights and S32 biases, so they run on the GEMMLowp and int8
+ * depthwise paths with the requantization and the fused activation applied by their output stage.
+ * Weights and biases are quantized once, when their accessors run, and quantization and dequantization layers are
+ * inserted only where a chain of quantized convolutions meets an F32 node.
+ *
+ * @note The table must have been collected on a graph built the same way, finalized with
+ *       @ref GraphConfig::use_calibration set.
+ */
+class PostTrainingQuantizationMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] table Ranges calibrated on the F32 graph
+     */
+    PostTrainingQuantizationMutator(CalibrationTable table);
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    CalibrationTable _table;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_POSTTRAININGQUANTIZATIONMUTATOR_H
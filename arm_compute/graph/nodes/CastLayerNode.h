@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_CASTLAYERNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_CASTLAYERNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Cast Layer node
+ *
+ * Cast layer converts the elements of a given input to a different data type.
+ */
+class CastLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data_type Data type of the output tensor
+     * @param[in] policy    (Optional) Conversion policy. Defaults to @ref ConvertPolicy::SATURATE
+     */
+    CastLayerNode(DataType data_type, ConvertPolicy policy = ConvertPolicy::SATURATE);
+    /** Output data type accessor
+     *
+     * @return Data type of the output tensor
+     */
+    DataType data_type() const;
+    /** Conversion policy accessor
+     *
+     * @return Conversion policy
+     */
+    ConvertPolicy policy() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+private:
+    DataType      _data_type;
+    ConvertPolicy _policy;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_CASTLAYERNODE_H
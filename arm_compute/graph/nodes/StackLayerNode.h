@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025 Arm Limited.
+ * Copyright (c) 2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,20 @@ public:
      * @return Stack axis
      */
     int axis() const;
+    /** Disables or not the stack node
+     *
+     * @warning This is used when stack is performed using sub-tensors, where this node is used as a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the stack (involves copying),
+     *                       while if false, no function is created and we assume that sub-tensors are properly set to simulate
+     *                       a zero copy operation.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -67,6 +81,7 @@ public:
 private:
     unsigned int _total_nodes;
     int          _axis;
+    bool         _is_enabled;
 };
 } // namespace graph
 } // namespace arm_compute
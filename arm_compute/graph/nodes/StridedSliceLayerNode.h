@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025 Arm Limited.
+ * Copyright (c) 2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -83,6 +83,20 @@ public:
     BiStrides strides() const;
 
     StridedSliceLayerInfo strided_slice_info() const;
+    /** Disables or not the strided slice node
+     *
+     * @warning This is used when strided slice is performed using sub-tensors, where this node is used as a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the strided slice (involves copying),
+     *                       while if false, no function is created and we assume that sub-tensors are properly set to simulate
+     *                       a zero copy operation.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -95,6 +109,7 @@ private:
     Coordinates           _ends;
     BiStrides             _strides;
     StridedSliceLayerInfo _info;
+    bool                  _is_enabled;
 };
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,6 +71,11 @@ protected:
      * @param[in] workloads Workloads to run
      */
     void run_workloads(std::vector<Workload> &workloads) override;
+    /** Will run the kernel workloads in parallel using num_threads
+     *
+     * @param[in] workloads Kernel workloads to run
+     */
+    void run_kernel_workloads(std::vector<KernelWorkload> &workloads) override;
 
 private:
     struct Impl;
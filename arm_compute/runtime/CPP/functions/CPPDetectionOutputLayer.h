@@ -31,6 +31,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CPP/ICPPSimpleFunction.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 class ITensor;
@@ -45,6 +47,8 @@ class CPPDetectionOutputLayer : public IFunction
 public:
     /** Default constructor */
     CPPDetectionOutputLayer();
+    /** Default destructor */
+    ~CPPDetectionOutputLayer();
     /** Configure the detection output layer CPP kernel
      *
      * @param[in]  input_loc      The mbox location input tensor of size [C1, N]. Data types supported: F32.
@@ -98,6 +102,9 @@ private:
     std::vector<std::array<float, 4>>              _all_prior_variances;
     std::vector<LabelBBox>                         _all_decode_bboxes;
     std::vector<std::map<int, std::vector<int>>>   _all_indices;
+
+    struct NMSWorkspace;
+    std::unique_ptr<NMSWorkspace> _nms_workspace;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_CPP_FUNCTIONS_CPPDETECTIONOUTPUTLAYER_H
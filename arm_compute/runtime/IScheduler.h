@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,15 +31,18 @@
 #include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/RuntimeProfiler.h"
 
 #include <functional>
 #include <limits>
+#include <vector>
 
 namespace arm_compute
 {
 class ICPPKernel;
 class ITensor;
-class Window;
+class ITensorPack;
 
 /** Scheduler interface to run kernels */
 class IScheduler
@@ -137,6 +140,26 @@ public:
     };
     /** Signature for the workloads to execute */
     using Workload = std::function<void(const ThreadInfo &)>;
+    /** Descriptor of a kernel sub-window to execute
+     *
+     * Unlike @ref Workload it holds no type-erased callable, so arrays of descriptors can be reused across kernel
+     * launches without any allocation.
+     */
+    struct KernelWorkload
+    {
+        /** Runs the kernel on its sub-window
+         *
+         * @param[in] info Threading and CPU info
+         */
+        void operator()(const ThreadInfo &info) const;
+
+        ICPPKernel                  *kernel{nullptr};    /**< Kernel to execute */
+        ITensorPack                 *tensors{nullptr};   /**< Tensors to operate on, empty if owned by the kernel */
+        Window                       window{};           /**< Sub-window of the kernel to execute */
+        Window                       thread_locator{};   /**< Position of the sub-window in a split over both X and Y */
+        bool                         is_2d_split{false}; /**< True if the window has been split over both X and Y */
+        RuntimeProfiler::Attribution attribution{};      /**< Layer and group of the thread that scheduled the kernel */
+    };
     /** Default constructor. */
     IScheduler();
 
@@ -210,6 +233,28 @@ protected:
      */
     virtual void run_workloads(std::vector<Workload> &workloads) = 0;
 
+    /** Execute all the passed kernel workloads
+     *
+     * The default implementation wraps the descriptors into @ref Workload objects and calls @ref run_workloads.
+     * Schedulers should override it to run the descriptors directly and avoid the allocations.
+     *
+     * @note there is no guarantee regarding the order in which the workloads will be executed or whether or not they will be executed in parallel.
+     *
+     * @param[in] workloads Array of kernel workloads to run
+     */
+    virtual void run_kernel_workloads(std::vector<KernelWorkload> &workloads);
+
+    /** Get the kernel workload array of the calling thread
+     *
+     * The array is preallocated per calling thread, as kernels can be scheduled concurrently from several threads,
+     * and is only reallocated when a kernel is split in more windows than ever before.
+     *
+     * @param[in] num_workloads Number of workloads needed
+     *
+     * @return Kernel workload array of size @p num_workloads
+     */
+    static std::vector<KernelWorkload> &thread_kernel_workloads(size_t num_workloads);
+
     /** Common scheduler logic to execute the given kernel
      *
      * @param[in] kernel  Kernel to execute.
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_INTERVALLIFETIMEMANAGER_H
+#define ACL_ARM_COMPUTE_RUNTIME_INTERVALLIFETIMEMANAGER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <map>
+
+namespace arm_compute
+{
+// Forward declarations
+class IMemoryPool;
+
+/** Concrete class that tracks the live interval of registered tensors and
+ *  calculates the systems memory requirements in terms of a single blob and a list of offsets
+ *
+ * Unlike @ref OffsetLifetimeManager, which lays the reusable blobs out back to back, the offsets are assigned
+ * per tensor with a greedy-by-size best-fit packing of the live intervals, so that tensors which are never
+ * alive at the same time can overlap in the blob.
+ */
+class IntervalLifetimeManager : public ISimpleLifetimeManager
+{
+public:
+    using info_type = BlobInfo;
+
+    /** Memory planning statistics */
+    struct PlanningStats
+    {
+        size_t planned_size{0}; /**< Size of the blob required by the assigned offsets */
+        size_t lower_bound{0};  /**< Peak aggregated size of the tensors alive at the same time */
+    };
+
+public:
+    /** Constructor */
+    IntervalLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    IntervalLifetimeManager(const IntervalLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    IntervalLifetimeManager &operator=(const IntervalLifetimeManager &) = delete;
+    /** Allow instances of this class to be move constructed */
+    IntervalLifetimeManager(IntervalLifetimeManager &&) = default;
+    /** Allow instances of this class to be moved */
+    IntervalLifetimeManager &operator=(IntervalLifetimeManager &&) = default;
+    /** Accessor to the pool internal configuration meta-data
+     *
+     * @return Lifetime manager internal configuration meta-data
+     */
+    const info_type &info() const;
+    /** Accessor to the memory planning statistics
+     *
+     * @note Both sizes are the maximum across all the finalized groups
+     *
+     * @return Planned blob size and its theoretical lower bound
+     */
+    const PlanningStats &stats() const;
+
+    // Inherited methods overridden:
+    void                         start_lifetime(void *obj) override;
+    void                         end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    MappingType                  mapping_type() const override;
+
+private:
+    // Inherited methods overridden:
+    void update_blobs_and_mappings() override;
+
+private:
+    /** Live interval of an element in logical time */
+    struct Interval
+    {
+        size_t start; /**< Time the lifetime started */
+        size_t end;   /**< Time the lifetime ended */
+    };
+
+    BlobInfo                   _blob;      /**< Memory blob size */
+    PlanningStats              _stats;     /**< Planning statistics */
+    std::map<void *, Interval> _intervals; /**< Live intervals of the elements of the active group */
+    size_t                     _time;      /**< Logical time of the active group */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_INTERVALLIFETIMEMANAGER_H
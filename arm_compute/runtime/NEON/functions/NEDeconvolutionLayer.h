@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,9 +39,13 @@
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
+// Forward declarations
+class NEDeconvolutionInterleaveKernel;
+
 /** Function to run the deconvolution layer.
  *
  * Deconvolution Layer is the backward pass of Convolution Layer. First we transform the input depending on the stride and pad info and then perfrom a 1x1
@@ -67,11 +71,18 @@ namespace arm_compute
  * The weights used by Deconvolution are supposed to be the same as the ones used for Convolution. Therefore, it will be necessary to use the weights in the
  * reverse order to perform an actual convolution. This is achieved by using @ref NEReverse.
  *
+ * When the stride is greater than 1, the output elements that share the same position modulo the stride (a phase) only depend on the kernel taps
+ * with the matching position modulo the stride. Each phase is then computed as a unit-stride convolution of the original input with the
+ * corresponding sub-kernel and written to the output with NEDeconvolutionInterleaveKernel, so that the zeros of the upsampled input are
+ * never materialized. The phases that no kernel tap reaches, when the kernel is smaller than the stride, are computed with a single zero tap
+ * so that they only receive the bias. The upsampling path is only used when the decomposition does not apply, e.g. with pre-reshaped weights.
+ *
  * This function calls the following kernels/functions:
  *
  * -# @ref CPPUpsample
  * -# @ref NEConvolutionLayer
  * -# @ref NEReverse
+ * -# NEDeconvolutionInterleaveKernel
  *
  */
 class NEDeconvolutionLayer : public IFunction
@@ -88,7 +99,7 @@ public:
     /** Default move assignment operator */
     NEDeconvolutionLayer &operator=(NEDeconvolutionLayer &&) = default;
     /** Default destructor */
-    ~NEDeconvolutionLayer() = default;
+    ~NEDeconvolutionLayer();
 
     /** Set the input, weights, biases and output tensors.
      *
@@ -156,18 +167,24 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup        _memory_group;
-    NEConvolutionLayer _conv_f;
-    CPPUpsample        _upsample_f;
-    NEReverse          _flip_weights;
-    Tensor             _scaled_output;
-    Tensor             _weights_flipped;
-    Tensor             _flip_axis;
-    const ITensor     *_original_weights;
-    ITensor           *_input;
-    PadStrideInfo      _info;
-    bool               _is_prepared;
-    bool               _do_upsampling;
+    std::shared_ptr<IMemoryManager>                               _memory_manager;
+    MemoryGroup                                                   _memory_group;
+    NEConvolutionLayer                                            _conv_f;
+    CPPUpsample                                                   _upsample_f;
+    NEReverse                                                     _flip_weights;
+    Tensor                                                        _scaled_output;
+    Tensor                                                        _weights_flipped;
+    Tensor                                                        _flip_axis;
+    std::vector<std::unique_ptr<NEConvolutionLayer>>              _phase_conv_f;
+    std::vector<std::unique_ptr<NEDeconvolutionInterleaveKernel>> _phase_interleave_kernels;
+    std::vector<Tensor>                                           _phase_weights;
+    std::vector<Tensor>                                           _phase_outputs;
+    const ITensor                                                *_original_weights;
+    ITensor                                                      *_input;
+    PadStrideInfo                                                 _info;
+    bool                                                          _is_prepared;
+    bool                                                          _do_upsampling;
+    bool                                                          _use_phases;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDECONVOLUTIONLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,8 @@ namespace arm_compute
 class ITensor;
 class NEFFTDigitReverseKernel;
 class NEFFTRadixStageKernel;
+class NEFFTRealPackKernel;
+class NEFFTRealUnpackKernel;
 class NEFFTScaleKernel;
 
 /** Basic function to execute one dimensional FFT. This function calls the following kernels:
@@ -48,6 +50,13 @@ class NEFFTScaleKernel;
  * -# NEFFTDigitReverseKernel Performs digit reverse
  * -# NEFFTRadixStageKernel   A list of FFT kernels depending on the radix decomposition
  * -# NEFFTScaleKernel        Performs output scaling in case of in inverse FFT
+ *
+ * Real transforms of even length N along X that only produce (or consume) the N / 2 + 1 non-redundant bins of the
+ * Hermitian spectrum are computed as complex transforms of length N / 2. In that case the digit reverse kernel is
+ * replaced by:
+ *
+ * -# NEFFTRealPackKernel     Packs the real input (or the half spectrum) into a complex sequence of half length
+ * -# NEFFTRealUnpackKernel   Recovers the half spectrum (or the real output) from the half-length transform
  */
 class NEFFT1D : public IFunction
 {
@@ -77,6 +86,9 @@ public:
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor.  Data types and data layouts supported: Same as @p input.
      *                    Number of channels supported: 1 (real tensor) or 2 (complex tensor).If @p input is real, @p output must be complex.
+     *                    For a transform along X of a real tensor of even length N, @p output can be initialized with
+     *                    N / 2 + 1 complex elements along X to only compute the non-redundant half of the spectrum.
+     *                    Likewise, an inverse transform from such a half spectrum to a real tensor of length N is supported.
      * @param[in]  config FFT related configuration
      */
     void configure(const ITensor *input, ITensor *output, const FFT1DInfo &config);
@@ -98,11 +110,14 @@ protected:
     std::unique_ptr<NEFFTDigitReverseKernel>            _digit_reverse_kernel;
     std::vector<std::unique_ptr<NEFFTRadixStageKernel>> _fft_kernels;
     std::unique_ptr<NEFFTScaleKernel>                   _scale_kernel;
+    std::unique_ptr<NEFFTRealPackKernel>                _real_pack_kernel;
+    std::unique_ptr<NEFFTRealUnpackKernel>              _real_unpack_kernel;
     Tensor                                              _digit_reversed_input;
     Tensor                                              _digit_reverse_indices;
     unsigned int                                        _num_ffts;
     unsigned int                                        _axis;
     bool                                                _run_scale;
+    bool                                                _is_half_spectrum;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFFT1D_H
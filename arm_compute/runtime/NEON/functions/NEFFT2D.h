@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,10 @@ class ITensor;
  *
  * -# @ref NEFFT1D 1D FFT is performed on the first given axis
  * -# @ref NEFFT1D 1D FFT is performed on the second given axis
+ *
+ * When the first axis is X and the real side of the transform has an even width N, the complex side can be
+ * initialized with N / 2 + 1 elements along X to only compute the non-redundant half of the Hermitian spectrum.
+ * In the inverse direction the passes are then swapped, so that the complex-to-real pass along X runs last.
  */
 class NEFFT2D : public IFunction
 {
@@ -71,6 +75,8 @@ public:
      *
      * @param[in]  input  Source tensor. Data types supported: F32.
      * @param[out] output Destination tensor. Data types and data layouts supported: Same as @p input.
+     *                    Can have N / 2 + 1 complex elements along X for a real @p input of even width N.
+     *                    Likewise, a real tensor of even width N can be computed from such a half spectrum input.
      * @param[in]  config FFT related configuration
      */
     void configure(const ITensor *input, ITensor *output, const FFT2DInfo &config);
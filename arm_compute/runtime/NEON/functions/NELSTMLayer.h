@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
  * @publicapi
  */
 
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/KernelDescriptors.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
@@ -41,12 +43,28 @@
 #include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
 #include "arm_compute/runtime/NEON/functions/NETranspose.h"
 
+#include <array>
+#include <memory>
+
 namespace arm_compute
 {
 // Forward declarations
 class ITensor;
+namespace cpu
+{
+namespace kernels
+{
+class CpuLSTMCellKernel;
+} // namespace kernels
+} // namespace cpu
 
-/** Basic function to run @ref NELSTMLayer */
+/** Basic function to run @ref NELSTMLayer
+ *
+ * When the cell activation is supported by @ref cpu::kernels::CpuLSTMCellKernel, the gates are computed by a single
+ * @ref NEFullyConnectedLayer against the concatenation of all the gate weights, followed by a single element-wise
+ * pass that applies biases, peephole connections, layer normalization, activations and the state updates.
+ * Otherwise each gate is computed by its own chain of functions.
+ */
 class NELSTMLayer : public IFunction
 {
 public:
@@ -194,6 +212,28 @@ public:
     void prepare() override;
 
 private:
+    void configure_fused_cell(const ITensor             *input,
+                              const ITensor             *input_to_forget_weights,
+                              const ITensor             *input_to_cell_weights,
+                              const ITensor             *input_to_output_weights,
+                              const ITensor             *recurrent_to_forget_weights,
+                              const ITensor             *recurrent_to_cell_weights,
+                              const ITensor             *recurrent_to_output_weights,
+                              const ITensor             *forget_gate_bias,
+                              const ITensor             *cell_bias,
+                              const ITensor             *output_gate_bias,
+                              const ITensor             *output_state_in,
+                              const ITensor             *cell_state_in,
+                              ITensor                   *scratch_buffer,
+                              ITensor                   *output_state_out,
+                              ITensor                   *cell_state_out,
+                              ITensor                   *output,
+                              const LSTMParams<ITensor> &lstm_params,
+                              const LSTMCellKernelInfo  &cell_info,
+                              float                      projection_threshold);
+    /** Pack the per-unit biases, peephole and layer normalization weights into the coefficients of the fused cell */
+    void pack_cell_coefficients();
+
     MemoryGroup                    _memory_group;
     NEFullyConnectedLayer          _fully_connected_input_gate;
     NEArithmeticAddition           _accum_input_gate1;
@@ -240,6 +280,9 @@ private:
     NEMeanStdDevNormalizationLayer _mean_std_norm_output_gate;
     NEPixelWiseMultiplication      _pixelwise_mul_output_gate_coeff;
     NEArithmeticAddition           _accum_output_gate_bias;
+    NEConcatenateLayer             _concat_weights_cell;
+    NEConcatenateLayer             _concat_weights_gates;
+    NEFullyConnectedLayer          _fully_connected_gates;
     Tensor                         _input_gate_out1;
     Tensor                         _input_gate_out2;
     Tensor                         _input_gate_out3;
@@ -269,6 +312,10 @@ private:
     Tensor                         _cell_layer_norm_out2;
     Tensor                         _output_layer_norm_out1;
     Tensor                         _output_layer_norm_out2;
+    Tensor                         _cell_weights;
+    Tensor                         _gate_weights;
+    Tensor                         _gates;
+    Tensor                         _coefficients;
     bool                           _run_peephole_opt;
     bool                           _run_cifg_opt;
     bool                           _perform_cell_clipping;
@@ -276,6 +323,11 @@ private:
     bool                           _perform_projection_clipping;
     bool                           _is_prepared;
     bool                           _is_layer_norm_lstm;
+    bool                           _use_fused_cell;
+
+    std::unique_ptr<cpu::kernels::CpuLSTMCellKernel>                             _lstm_cell_kernel;
+    ITensorPack                                                                  _lstm_cell_pack;
+    std::array<const ITensor *, static_cast<size_t>(LSTMCellCoefficient::Count)> _coefficient_sources;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELSTMLAYER_H
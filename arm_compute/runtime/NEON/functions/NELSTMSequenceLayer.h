@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELSTMSEQUENCELAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELSTMSEQUENCELAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/common/LSTMParams.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
+#include "arm_compute/runtime/NEON/functions/NECopy.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+namespace cpu
+{
+namespace kernels
+{
+class CpuRecurrentStepKernel;
+} // namespace kernels
+} // namespace cpu
+
+/** Basic function to run an LSTM over a whole sequence
+ *
+ * The input projection of all the gates and all the timesteps is computed up front by a single
+ * @ref NEFullyConnectedLayer against the concatenation of the input weights of every gate. The recurrent part is
+ * then run one step at a time by @ref cpu::kernels::CpuRecurrentStepKernel, which splits the units across the
+ * threads so that each thread keeps the same rows of recurrent weights in its caches for the whole sequence, with
+ * a single scheduler dispatch per step.
+ *
+ * CIFG, peephole connections and cell clipping are supported. Projection and layer normalization are not:
+ * @ref NELSTMLayer should be used for those configurations.
+ */
+class NELSTMSequenceLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NELSTMSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMSequenceLayer(const NELSTMSequenceLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMSequenceLayer &operator=(const NELSTMSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NELSTMSequenceLayer(NELSTMSequenceLayer &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NELSTMSequenceLayer &operator=(NELSTMSequenceLayer &&) = delete;
+    /** Default destructor */
+    ~NELSTMSequenceLayer();
+    /** Initialize function's tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0 - src11 | dst0 - dst2 |
+     * |:------------|:------------|
+     * |F16          |F16          |
+     * |F32          |F32          |
+     *
+     * @param[in]  input                       Source tensor. Input is a 3D tensor with dimensions [input_size, batch_size, num_steps]. Data types supported: F16/F32.
+     * @param[in]  input_to_forget_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in]  input_to_cell_weights       2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in]  input_to_output_weights     2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     * @param[in]  recurrent_to_forget_weights 2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in]  recurrent_to_cell_weights   2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in]  recurrent_to_output_weights 2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     * @param[in]  forget_gate_bias            1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in]  cell_bias                   1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in]  output_gate_bias            1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     * @param[in]  output_state_in             2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[in]  cell_state_in               2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p input.
+     * @param[out] output                      Destination tensor with dimensions [num_units, batch_size, num_steps] holding the output state of every step.
+     *                                         Data types supported: Same as @p input.
+     * @param[out] output_state_out            2D tensor with dimensions [num_units, batch_size] holding the output state of the last step. Data type supported: Same as @p input.
+     * @param[out] cell_state_out              2D tensor with dimensions [num_units, batch_size] holding the cell state of the last step. Data type supported: Same as @p input.
+     * @param[in]  lstm_params                 Weights tensors used in CIFG and peephole optimizations:
+     *                                         input_to_input_weights     (Optional) 2D weights tensor with dimensions [input_size, num_units]. Data type supported: Same as @p input.
+     *                                         recurrent_to_input_weights (Optional) 2D weights tensor with dimensions [num_units, num_units]. Data type supported: Same as @p input.
+     *                                         cell_to_input_weights      (Optional) 1D weights tensor with dimensions [num_units]. Can be nullptr. Data type supported: Same as @p input.
+     *                                         cell_to_forget_weights     (Optional) 1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     *                                         cell_to_output_weights     (Optional) 1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input.
+     *                                         input_gate_bias            (Optional) 1D weights tensor with dimensions [num_units]. Data type supported: Same as @p input
+     * @param[in]  activation_info             Contains activation information described in @ref ActivationLayerInfo.
+     * @param[in]  cell_threshold              (Optional) The clipping threshold for the cell state, such that values are bound within [-cell_clip, cell_clip].
+     *                                         If set to 0.0 then clipping is disabled.
+     */
+    void configure(const ITensor             *input,
+                   const ITensor             *input_to_forget_weights,
+                   const ITensor             *input_to_cell_weights,
+                   const ITensor             *input_to_output_weights,
+                   const ITensor             *recurrent_to_forget_weights,
+                   const ITensor             *recurrent_to_cell_weights,
+                   const ITensor             *recurrent_to_output_weights,
+                   const ITensor             *forget_gate_bias,
+                   const ITensor             *cell_bias,
+                   const ITensor             *output_gate_bias,
+                   const ITensor             *output_state_in,
+                   const ITensor             *cell_state_in,
+                   ITensor                   *output,
+                   ITensor                   *output_state_out,
+                   ITensor                   *cell_state_out,
+                   const LSTMParams<ITensor> &lstm_params,
+                   const ActivationLayerInfo &activation_info,
+                   float                      cell_threshold = 0.f);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMSequenceLayer
+     *
+     * Similar to @ref NELSTMSequenceLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *input,
+                           const ITensorInfo             *input_to_forget_weights,
+                           const ITensorInfo             *input_to_cell_weights,
+                           const ITensorInfo             *input_to_output_weights,
+                           const ITensorInfo             *recurrent_to_forget_weights,
+                           const ITensorInfo             *recurrent_to_cell_weights,
+                           const ITensorInfo             *recurrent_to_output_weights,
+                           const ITensorInfo             *forget_gate_bias,
+                           const ITensorInfo             *cell_bias,
+                           const ITensorInfo             *output_gate_bias,
+                           const ITensorInfo             *output_state_in,
+                           const ITensorInfo             *cell_state_in,
+                           const ITensorInfo             *output,
+                           const ITensorInfo             *output_state_out,
+                           const ITensorInfo             *cell_state_out,
+                           const LSTMParams<ITensorInfo> &lstm_params,
+                           const ActivationLayerInfo     &activation_info,
+                           float                          cell_threshold = 0.f);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                                                                  _memory_group;
+    NEConcatenateLayer                                                           _concat_input_weights;
+    NEConcatenateLayer                                                           _concat_recurrent_weights;
+    NEConcatenateLayer                                                           _concat_biases;
+    NEReshapeLayer                                                               _reshape_input;
+    NEFullyConnectedLayer                                                        _fully_connected;
+    NECopy                                                                       _copy_cell_state;
+    NECopy                                                                       _copy_output_state;
+    std::unique_ptr<cpu::kernels::CpuRecurrentStepKernel>                        _step_kernel;
+    Tensor                                                                       _input_weights;
+    Tensor                                                                       _recurrent_weights;
+    Tensor                                                                       _biases;
+    Tensor                                                                       _coefficients;
+    Tensor                                                                       _input_2d;
+    Tensor                                                                       _pre_gates;
+    std::vector<SubTensor>                                                       _pre_gates_steps;
+    std::vector<SubTensor>                                                       _output_steps;
+    std::vector<ITensorPack>                                                     _step_packs;
+    std::array<const ITensor *, static_cast<size_t>(LSTMCellCoefficient::Count)> _coefficient_sources;
+    bool                                                                         _has_peephole;
+    bool                                                                         _is_prepared;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELSTMSEQUENCELAYER_H
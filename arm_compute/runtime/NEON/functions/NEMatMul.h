@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,11 @@ public:
     {
         return _fixed_format;
     }
+    // get dynamic quantization flag
+    bool dynamic_quantization() const
+    {
+        return _dynamic_quantization;
+    }
     // Set fast math flag
     CpuMatMulSettings &fast_math(bool fmath)
     {
@@ -62,10 +67,18 @@ public:
         _fixed_format = fixed_format;
         return *this;
     }
+    // Set dynamic quantization flag: F32 operands are quantized to int8 at run time, per row of lhs and per column
+    // of rhs, to use the int8 GEMM kernels. Ignored if they are not available.
+    CpuMatMulSettings &dynamic_quantization(bool dynamic_quantization)
+    {
+        _dynamic_quantization = dynamic_quantization;
+        return *this;
+    }
 
 private:
     bool _fast_math{false};
     bool _fixed_format{false};
+    bool _dynamic_quantization{false};
 };
 
 // Forward declarations
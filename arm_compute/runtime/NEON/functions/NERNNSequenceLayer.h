@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERNNSEQUENCELAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERNNSEQUENCELAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NECopy.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
+#include "arm_compute/runtime/NEON/functions/NETranspose.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+namespace cpu
+{
+namespace kernels
+{
+class CpuRecurrentStepKernel;
+} // namespace kernels
+} // namespace cpu
+
+/** Basic function to run a basic RNN over a whole sequence
+ *
+ * The input projection of all the timesteps is computed up front by a single @ref NEFullyConnectedLayer.
+ * The recurrent part is then run one step at a time by @ref cpu::kernels::CpuRecurrentStepKernel, which splits
+ * the units across the threads so that each thread keeps the same rows of recurrent weights in its caches for
+ * the whole sequence, with a single scheduler dispatch per step.
+ */
+class NERNNSequenceLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NERNNSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNSequenceLayer(const NERNNSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains pointers) */
+    NERNNSequenceLayer(NERNNSequenceLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNSequenceLayer &operator=(const NERNNSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains pointers) */
+    NERNNSequenceLayer &operator=(NERNNSequenceLayer &&) = delete;
+    /** Default destructor */
+    ~NERNNSequenceLayer();
+    /** Initialize the function
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0   |src1   |src2   |src3   |dst0   |dst1   |
+     * |:------|:------|:------|:------|:------|:------|
+     * |F16    |F16    |F16    |F16    |F16    |F16    |
+     * |F32    |F32    |F32    |F32    |F32    |F32    |
+     *
+     * @param[in]     input             Input is a 3-D tensor of shape [input_size, batch_size, num_steps]. Data types supported: F16/F32
+     * @param[in]     weights           Weights tensor of shape [input_size, num_units] that multiplies the input. Data types supported: Same as @p input
+     * @param[in]     recurrent_weights Weights tensor of shape [num_units, num_units] that multiplies the current 'state'. Data types supported: Same as @p input
+     * @param[in]     bias              Bias vector of shape [num_units]. Data types supported: Same as @p input
+     * @param[in,out] hidden_state      Tensor of shape [num_units, batch_size] holding the initial state. Updated with the state of the last step.
+     *                                  Data types supported: Same as @p input
+     * @param[out]    output            Output tensor of shape [num_units, batch_size, num_steps]. Data types supported: Same as @p input
+     * @param[in]     info              Activation layer parameter. Supported activation functions: LOGISTIC/TANH/RELU/BOUNDED_RELU/LU_BOUNDED_RELU/IDENTITY
+     */
+    void configure(const ITensor             *input,
+                   const ITensor             *weights,
+                   const ITensor             *recurrent_weights,
+                   const ITensor             *bias,
+                   ITensor                   *hidden_state,
+                   ITensor                   *output,
+                   const ActivationLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERNNSequenceLayer
+     *
+     * Similar to @ref NERNNSequenceLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *input,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *recurrent_weights,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *hidden_state,
+                           const ITensorInfo         *output,
+                           const ActivationLayerInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                                           _memory_group;
+    NEReshapeLayer                                        _reshape_input;
+    NEFullyConnectedLayer                                 _fully_connected;
+    NETranspose                                           _transpose_recurrent_weights;
+    NECopy                                                _copy_hidden_state;
+    std::unique_ptr<cpu::kernels::CpuRecurrentStepKernel> _step_kernel;
+    Tensor                                                _input_2d;
+    Tensor                                                _pre_gates;
+    Tensor                                                _recurrent_weights_transposed;
+    std::vector<SubTensor>                                _pre_gates_steps;
+    std::vector<SubTensor>                                _output_steps;
+    std::vector<ITensorPack>                              _step_packs;
+    const ITensor                                        *_recurrent_weights;
+    bool                                                  _is_prepared;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERNNSEQUENCELAYER_H
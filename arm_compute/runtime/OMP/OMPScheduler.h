@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,13 @@ protected:
      * @param[in] workloads Array of workloads to run
      */
     void run_workloads(std::vector<Workload> &workloads) override;
+    /** Execute all the passed kernel workloads
+     *
+     * @note there is no guarantee regarding the order in which the workloads will be executed or whether or not they will be executed in parallel.
+     *
+     * @param[in] workloads Array of kernel workloads to run
+     */
+    void run_kernel_workloads(std::vector<KernelWorkload> &workloads) override;
 
 private:
     unsigned int _num_threads;
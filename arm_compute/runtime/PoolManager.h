@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2025 Arm Limited.
+ * Copyright (c) 2017-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,17 +33,34 @@
 #include "arm_compute/runtime/IPoolManager.h"
 
 #include "support/Mutex.h"
-#include "support/Semaphore.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
-#include <list>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace arm_compute
 {
-/** Memory pool manager */
+/** Memory pool manager
+ *
+ * Pools are locked and unlocked without taking any lock: a free pool is first reserved through an atomic counter
+ * and then claimed through a per-pool atomic flag, starting from the most recently unlocked pool.
+ * Callers only block, on a condition variable, when all the pools are occupied.
+ */
 class PoolManager : public IPoolManager
 {
+public:
+    /** Contention statistics */
+    struct Stats
+    {
+        uint64_t num_locks{0};           /**< Number of pools locked */
+        uint64_t num_contended_locks{0}; /**< Number of locks that had to wait for a pool to be unlocked */
+        uint64_t num_claim_retries{0};   /**< Number of pools found already claimed by a concurrent lock */
+    };
+
 public:
     /** Default Constructor */
     PoolManager();
@@ -55,6 +72,13 @@ public:
     PoolManager(PoolManager &&) = delete;
     /** Prevent instances of this class from being moved (As this class contains non movable objects) */
     PoolManager &operator=(PoolManager &&) = delete;
+    /** Returns a snapshot of the contention statistics
+     *
+     * @return Contention statistics since construction or the last call to @ref reset_stats
+     */
+    Stats stats() const;
+    /** Resets the contention statistics */
+    void reset_stats();
 
     // Inherited methods overridden:
     IMemoryPool                 *lock_pool() override;
@@ -65,10 +89,26 @@ public:
     size_t                       num_pools() const override;
 
 private:
-    std::list<std::unique_ptr<IMemoryPool>> _free_pools;     /**< List of free pools */
-    std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
-    std::unique_ptr<arm_compute::Semaphore> _sem;            /**< Semaphore to control the queues */
-    mutable arm_compute::Mutex              _mtx;            /**< Mutex to control access to the queues */
+    /** Waits until a free pool can be reserved */
+    void wait_for_pool();
+    /** Resets the pool occupancy after the set of pools changes */
+    void reset_occupancy();
+
+private:
+    std::vector<std::unique_ptr<IMemoryPool>> _pools;               /**< Managed pools */
+    std::unordered_map<IMemoryPool *, size_t> _pool_index;          /**< Index of each managed pool */
+    std::unique_ptr<std::atomic<bool>[]>      _occupied;            /**< Occupancy flag of each managed pool */
+    std::atomic<int>                          _available;           /**< Number of free pools not yet reserved */
+    std::atomic<size_t>                       _last_freed;          /**< Index of the most recently unlocked pool */
+    std::atomic<int>                          _waiters;             /**< Number of callers waiting for a free pool */
+    std::atomic<uint64_t>                     _num_locks;           /**< Number of pools locked */
+    std::atomic<uint64_t>                     _num_contended_locks; /**< Number of locks that had to wait for a pool */
+    std::atomic<uint64_t>                     _num_claim_retries;   /**< Number of pools found already claimed */
+    mutable arm_compute::Mutex                _mtx;                 /**< Mutex to control the registration of pools */
+    arm_compute::Mutex                        _wait_mtx;            /**< Mutex guarding the wait for a free pool */
+#ifndef NO_MULTI_THREADING
+    std::condition_variable                   _cv;                  /**< Condition signalled when a pool is unlocked */
+#endif /* NO_MULTI_THREADING */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_POOLMANAGER_H
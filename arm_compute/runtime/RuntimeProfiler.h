@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_RUNTIMEPROFILER_H
+#define ACL_ARM_COMPUTE_RUNTIME_RUNTIMEPROFILER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ICPPKernel;
+class IFunction;
+class ITensorPack;
+
+/** Low-overhead runtime profiler
+ *
+ * The profiler is always compiled in and toggled at runtime, either with @ref RuntimeProfiler::set_enabled or by
+ * setting the ARM_COMPUTE_RUNTIME_PROFILER environment variable to 1. When disabled, each instrumented scope costs
+ * a single relaxed atomic load.
+ *
+ * Three kinds of events are recorded:
+ * - Layer events, delimited by @ref RuntimeProfiler::LayerScope, e.g. around the execution of a graph node.
+ * - Kernel events, recorded by the CPU schedulers around each scheduled kernel, with the bytes of the tensors it
+ *   accesses and the number of threads it runs on.
+ * - Workload events, recorded by the thread executing each slice of a kernel's window.
+ *
+ * Events are stored in per-thread ring buffers, so recording never takes a lock. When a buffer is full the oldest
+ * events are overwritten.
+ *
+ * Kernel events also carry the number of floating point or integer operations reported by
+ * @ref ICPPKernel::get_flop_count. When the PMU mode is enabled, either with @ref RuntimeProfiler::set_pmu_enabled or
+ * by setting ARM_COMPUTE_RUNTIME_PROFILER to pmu, workload events additionally carry the hardware counters of the
+ * thread that ran them. Both are combined by @ref RuntimeProfiler::roofline into a per-kernel roofline report.
+ *
+ * @note The events must be read, summarized or exported while no workload is running.
+ */
+class RuntimeProfiler final
+{
+public:
+    /** Type of profiled event */
+    enum class EventType : uint8_t
+    {
+        Layer,    /**< Execution of a layer or function */
+        Kernel,   /**< Execution of a kernel by a scheduler */
+        Workload, /**< Execution of a slice of a kernel's window by a thread */
+    };
+
+    /** Maximum length of the names stored in the events, longer names are truncated */
+    static constexpr size_t max_name_length = 63;
+    /** Group of the events recorded outside of a group, e.g. outside of a graph */
+    static constexpr uint32_t no_group = std::numeric_limits<uint32_t>::max();
+
+    /** Hardware counters of the PMU
+     *
+     * The counters not supported by the CPU, or all of them if the PMU cannot be accessed, are left to 0.
+     */
+    struct PmuCounts
+    {
+        uint64_t cycles{0};                /**< CPU cycles */
+        uint64_t instructions{0};          /**< Instructions retired */
+        uint64_t l1d_misses{0};            /**< L1 data cache read misses */
+        uint64_t l2d_misses{0};            /**< L2 data cache refills */
+        uint64_t llc_misses{0};            /**< Last level cache read misses */
+        uint64_t stall_frontend_cycles{0}; /**< Cycles stalled waiting for instructions */
+        uint64_t stall_backend_cycles{0};  /**< Cycles stalled waiting for operands or execution resources */
+    };
+
+    /** Profiled event */
+    struct Event
+    {
+        EventType type{EventType::Kernel};      /**< Type of the event */
+        uint32_t  thread{0};                    /**< Index of the thread that recorded the event */
+        uint32_t  group{no_group};              /**< Group of the event, e.g. the graph id */
+        uint32_t  num_threads{1};               /**< Number of threads a kernel ran on */
+        uint64_t  start_ns{0};                  /**< Start time in nanoseconds since the profiler was created */
+        uint64_t  duration_ns{0};               /**< Wall time in nanoseconds */
+        uint64_t  bytes{0};                     /**< Bytes of the tensors accessed by a kernel */
+        uint64_t  flops{0};                     /**< Operations performed by a kernel, 0 if unknown */
+        PmuCounts pmu{};                        /**< Hardware counters of a workload, if the PMU mode is enabled */
+        char      name[max_name_length + 1]{};  /**< Name of the layer or kernel */
+        char      layer[max_name_length + 1]{}; /**< Name of the enclosing layer, if any */
+    };
+
+    /** Statistics of the events sharing the same type and name */
+    struct Stats
+    {
+        EventType   type{EventType::Kernel}; /**< Type of the events */
+        std::string name{};                  /**< Name of the events */
+        size_t      count{0};                /**< Number of events */
+        uint64_t    total_ns{0};             /**< Accumulated wall time in nanoseconds */
+        uint64_t    min_ns{0};               /**< Shortest wall time in nanoseconds */
+        uint64_t    max_ns{0};               /**< Longest wall time in nanoseconds */
+        uint64_t    bytes{0};                /**< Accumulated bytes accessed */
+        double      utilization{0.0};        /**< Busy time of the threads over the time they were allotted */
+    };
+
+    /** Peak performance of the machine, defining the roofline */
+    struct RooflineInfo
+    {
+        double peak_gflops{0.0};         /**< Peak compute throughput in GFLOP/s for all the threads used */
+        double peak_bandwidth_gbps{0.0}; /**< Peak memory bandwidth in GB/s */
+    };
+
+    /** Bound limiting the performance of a kernel */
+    enum class Bound : uint8_t
+    {
+        Memory,  /**< Arithmetic intensity below the ridge point of the roofline */
+        Compute, /**< Arithmetic intensity at or above the ridge point of the roofline */
+        Unknown, /**< Operations or bytes not reported, the kernels cannot be placed on the roofline */
+    };
+
+    /** Roofline statistics of the kernels sharing the same name */
+    struct RooflineStats
+    {
+        std::string name{};                 /**< Name of the kernels */
+        size_t      count{0};               /**< Number of kernel events */
+        uint64_t    total_ns{0};            /**< Accumulated wall time in nanoseconds */
+        uint64_t    flops{0};               /**< Accumulated operations */
+        uint64_t    bytes{0};               /**< Accumulated bytes of the tensors accessed */
+        PmuCounts   pmu{};                  /**< Accumulated hardware counters of the workloads */
+        double      gflops{0.0};            /**< Achieved throughput in GFLOP/s */
+        double      intensity{0.0};         /**< Arithmetic intensity in operations per tensor byte */
+        double      dram_intensity{0.0};    /**< Operations per byte refilled in the last level cache, if counted */
+        double      attainable_gflops{0.0}; /**< Throughput attainable at this arithmetic intensity in GFLOP/s */
+        double      efficiency{0.0};        /**< Achieved over attainable throughput */
+        Bound       bound{Bound::Memory};   /**< Bound limiting the kernels */
+    };
+
+    /** Layer and group events are attributed to */
+    struct Attribution
+    {
+        const char *layer{nullptr};  /**< Name of the enclosing layer, if any */
+        uint32_t    group{no_group}; /**< Group of the enclosing layer */
+    };
+
+    /** Scope recording a layer event and attributing the kernels scheduled within it to the layer */
+    class LayerScope final
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] name  Name of the layer.
+         * @param[in] group (Optional) Group of the layer, e.g. the graph id.
+         */
+        explicit LayerScope(const char *name, uint32_t group = no_group);
+        /** Prevent instances of this class from being copied */
+        LayerScope(const LayerScope &) = delete;
+        /** Prevent instances of this class from being copied */
+        LayerScope &operator=(const LayerScope &) = delete;
+        /** Destructor recording the event */
+        ~LayerScope();
+
+    private:
+        bool        _enabled;
+        uint64_t    _start{0};
+        uint32_t    _group{no_group};
+        uint32_t    _prev_group{no_group};
+        const char *_prev_layer{nullptr};
+        char        _name[max_name_length + 1]{};
+    };
+
+    /** Scope recording a kernel event */
+    class KernelScope final
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] kernel  Kernel being scheduled.
+         * @param[in] tensors Tensors the kernel runs on. If empty, the bytes accessed are the ones reported by
+         *                    @ref ICPPKernel::get_configured_tensors_size.
+         */
+        KernelScope(const ICPPKernel *kernel, const ITensorPack &tensors);
+        /** Prevent instances of this class from being copied */
+        KernelScope(const KernelScope &) = delete;
+        /** Prevent instances of this class from being copied */
+        KernelScope &operator=(const KernelScope &) = delete;
+        /** Set the number of threads the kernel runs on
+         *
+         * @param[in] num_threads Number of threads.
+         */
+        void set_num_threads(uint32_t num_threads)
+        {
+            _num_threads = num_threads;
+        }
+        /** Destructor recording the event */
+        ~KernelScope();
+
+    private:
+        const ICPPKernel  *_kernel;
+        const ITensorPack *_tensors;
+        bool               _enabled;
+        uint32_t           _num_threads{1};
+        uint64_t           _start{0};
+    };
+
+    /** Scope recording a workload event */
+    class WorkloadScope final
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] kernel      Kernel whose workload is executed.
+         * @param[in] attribution (Optional) Layer and group of the thread that scheduled the kernel. Defaults to the
+         *                        ones of the calling thread.
+         */
+        explicit WorkloadScope(const ICPPKernel *kernel, const Attribution &attribution = current_attribution());
+        /** Prevent instances of this class from being copied */
+        WorkloadScope(const WorkloadScope &) = delete;
+        /** Prevent instances of this class from being copied */
+        WorkloadScope &operator=(const WorkloadScope &) = delete;
+        /** Destructor recording the event */
+        ~WorkloadScope();
+
+    private:
+        const ICPPKernel *_kernel;
+        Attribution       _attribution;
+        bool              _enabled;
+        bool              _pmu{false};
+        uint64_t          _start{0};
+        PmuCounts         _counts{};
+    };
+
+    /** Access the runtime profiler
+     *
+     * @return The runtime profiler
+     */
+    static RuntimeProfiler &get();
+    /** Layer and group the events of the calling thread are attributed to
+     *
+     * Worker threads do not run within the layer scopes of the thread scheduling a kernel, so the schedulers capture
+     * the attribution of the scheduling thread and hand it over to the workloads they dispatch.
+     *
+     * @return The attribution of the innermost @ref LayerScope of the calling thread
+     */
+    static Attribution current_attribution();
+    /** Prevent instances of this class from being copied */
+    RuntimeProfiler(const RuntimeProfiler &) = delete;
+    /** Prevent instances of this class from being copied */
+    RuntimeProfiler &operator=(const RuntimeProfiler &) = delete;
+    /** Enable or disable the recording of events
+     *
+     * @param[in] enabled True to record events.
+     */
+    void set_enabled(bool enabled);
+    /** Check whether events are recorded
+     *
+     * @return True if events are recorded
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Enable or disable the sampling of the PMU counters around each workload
+     *
+     * The counters are opened on each thread the first time it runs a workload with the PMU mode enabled. If the
+     * PMU cannot be accessed, e.g. because of the perf_event_paranoid setting, the counters are left to 0.
+     *
+     * @param[in] enabled True to sample the PMU counters.
+     */
+    void set_pmu_enabled(bool enabled);
+    /** Check whether the PMU counters are sampled
+     *
+     * @return True if the PMU counters are sampled
+     */
+    bool is_pmu_enabled() const
+    {
+        return _pmu_enabled.load(std::memory_order_relaxed);
+    }
+    /** Set the number of events each thread can hold before overwriting the oldest ones
+     *
+     * @note Applies to the buffers created or cleared afterwards.
+     *
+     * @param[in] num_events Number of events per thread.
+     */
+    void set_buffer_size(size_t num_events);
+    /** Discard all the recorded events */
+    void clear();
+    /** Collect the recorded events, sorted by start time
+     *
+     * @return The recorded events
+     */
+    std::vector<Event> events() const;
+    /** Summarize the recorded events by name
+     *
+     * The utilization of a kernel is the time spent by the threads running its workloads over the wall time of
+     * the kernel multiplied by the number of threads it ran on. Both only account for the events matching the group
+     * and layer filters.
+     *
+     * @param[in] type  Type of the events to summarize.
+     * @param[in] group (Optional) Only summarize the events of this group. Defaults to all groups.
+     * @param[in] layer (Optional) Only summarize the events recorded within this layer. Defaults to all layers.
+     *
+     * @return The statistics, sorted by decreasing accumulated time
+     */
+    std::vector<Stats> summary(EventType type, uint32_t group = no_group, const char *layer = nullptr) const;
+    /** Build the roofline report of the recorded kernels
+     *
+     * The arithmetic intensity is derived from the operations reported by the kernels and the bytes of the tensors
+     * they access, so it assumes each tensor is read or written once. The kernels whose intensity is below the ridge
+     * point, i.e. the peak throughput over the peak bandwidth, are memory-bound. Kernels that do not report their
+     * number of operations through @ref ICPPKernel::get_flop_count, e.g. the depthwise convolution, pooling, Winograd
+     * and elementwise kernels, or whose bytes are unknown, are listed with the @ref Bound::Unknown bound and no
+     * derived metric, so the report shows which part of the time cannot be placed on the roofline.
+     *
+     * @param[in] info  Peak performance of the machine.
+     * @param[in] group (Optional) Only report the kernels of this group. Defaults to all groups.
+     * @param[in] layer (Optional) Only report the kernels recorded within this layer. Defaults to all layers.
+     *
+     * @return The roofline statistics, sorted by decreasing accumulated time
+     */
+    std::vector<RooflineStats>
+    roofline(const RooflineInfo &info, uint32_t group = no_group, const char *layer = nullptr) const;
+    /** Run a function and summarize its kernels
+     *
+     * The events are recorded even if the profiler is disabled.
+     *
+     * @param[in] function   Function to run.
+     * @param[in] name       Name of the layer the function's kernels are attributed to.
+     * @param[in] iterations (Optional) Number of times the function is run. Defaults to 1.
+     *
+     * @return The statistics of the kernels run by the function
+     */
+    std::vector<Stats> profile(IFunction &function, const char *name, unsigned int iterations = 1);
+    /** Write the recorded events in the Chrome trace event format
+     *
+     * The output can be loaded in chrome://tracing or Perfetto.
+     *
+     * @param[out] os Output stream.
+     */
+    void write_chrome_trace(std::ostream &os) const;
+    /** Write the recorded events as CSV, one event per line
+     *
+     * @param[out] os Output stream.
+     */
+    void write_csv(std::ostream &os) const;
+    /** Write statistics as CSV, one entry per line
+     *
+     * @param[out] os    Output stream.
+     * @param[in]  stats Statistics to write.
+     */
+    static void write_csv(std::ostream &os, const std::vector<Stats> &stats);
+    /** Write roofline statistics as CSV, one kernel per line
+     *
+     * @param[out] os    Output stream.
+     * @param[in]  stats Roofline statistics to write.
+     */
+    static void write_csv(std::ostream &os, const std::vector<RooflineStats> &stats);
+
+private:
+    struct ThreadBuffer;
+    struct ThreadBufferHandle;
+
+    RuntimeProfiler();
+    ~RuntimeProfiler();
+
+    uint64_t      now() const;
+    ThreadBuffer &thread_buffer();
+    void          record(const Event &event);
+
+    std::atomic<bool>                          _enabled{false};
+    std::atomic<bool>                          _pmu_enabled{false};
+    size_t                                     _buffer_size;
+    uint64_t                                   _epoch;
+    mutable std::mutex                         _mtx{};
+    std::vector<std::unique_ptr<ThreadBuffer>> _buffers{};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_RUNTIMEPROFILER_H
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_OPERATORS_CPULAYERNORM_H
+#define ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_OPERATORS_CPULAYERNORM_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/INEOperator.h"
+
+namespace arm_compute
+{
+namespace experimental
+{
+namespace op
+{
+/** Fused residual addition, layer normalization and affine transformation
+ *
+ * Computes dst = (x - mean(x)) / sqrt(var(x) + epsilon) * gamma + beta over each row along the X axis,
+ * where x = src + residual. The residual sum can also be written out for the next residual connection.
+ *
+ * The tensors are passed to @ref run with the following ids:
+ * ACL_SRC_0 src, ACL_SRC_1 residual, ACL_SRC_2 gamma, ACL_SRC_3 beta, ACL_DST_0 dst and ACL_DST_1 residual_out.
+ */
+class CpuLayerNorm : public INEOperator
+{
+public:
+    /** Default Constructor */
+    CpuLayerNorm();
+    /** Default Destructor */
+    ~CpuLayerNorm();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuLayerNorm(const CpuLayerNorm &) = delete;
+    /** Default move constructor */
+    CpuLayerNorm(CpuLayerNorm &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuLayerNorm &operator=(const CpuLayerNorm &) = delete;
+    /** Default move assignment operator */
+    CpuLayerNorm &operator=(CpuLayerNorm &&) = default;
+    /** Configure the operator.
+     *
+     * Valid data type configurations:
+     * |src - beta  |dst            |residual_out |
+     * |:-----------|:--------------|:------------|
+     * |F32         |F32            |F32          |
+     * |F32         |QASYMM8_SIGNED |F32          |
+     * |F16         |F16            |F16          |
+     * |F16         |QASYMM8_SIGNED |F16          |
+     * |BFLOAT16    |BFLOAT16       |BFLOAT16     |
+     * |BFLOAT16    |QASYMM8_SIGNED |BFLOAT16     |
+     *
+     * @param[in]  src          Source tensor info. Data types supported: F16/F32/BFLOAT16.
+     * @param[in]  residual     (Optional) Tensor info added to @p src before the normalization. Can be nullptr.
+     * @param[in]  gamma        1D tensor info with the scale of each element of a row.
+     * @param[in]  beta         (Optional) 1D tensor info with the bias of each element of a row. Can be nullptr.
+     * @param[out] dst          Destination tensor info. Data types supported: Same as @p src or QASYMM8_SIGNED.
+     * @param[out] residual_out (Optional) Destination tensor info of the residual sum. Can be nullptr.
+     * @param[in]  epsilon      (Optional) Small float added to the variance to avoid division by zero. Defaults to 1e-5.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *residual,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *dst,
+                   ITensorInfo       *residual_out = nullptr,
+                   float              epsilon      = 1e-5f);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuLayerNorm
+     *
+     * Similar to @ref CpuLayerNorm::configure
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *residual,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *dst,
+                           const ITensorInfo *residual_out = nullptr,
+                           float              epsilon      = 1e-5f);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+} // namespace op
+} // namespace experimental
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_OPERATORS_CPULAYERNORM_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_OPERATORS_CPUQKVROPE_H
+#define ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_OPERATORS_CPUQKVROPE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+#include "arm_compute/runtime/NEON/INEOperator.h"
+
+namespace arm_compute
+{
+namespace experimental
+{
+namespace op
+{
+/** Split the output of a fused QKV projection into heads and apply the rotary position embedding to Q and K
+ *
+ * The heads are written in a single pass, in the layout expected by @ref CpuMatMul for the attention, so that
+ * no permutation is needed: Q is the lhs and K the rhs of Q x K^T, and V the rhs of softmax(Q x K^T) x V.
+ * The sin/cos table of all the positions up to @ref RoPEInfo::max_position is computed once at configuration.
+ *
+ * The tensors are passed to @ref run with the following ids:
+ * ACL_SRC_0 qkv, ACL_SRC_1 positions, ACL_DST_0 q, ACL_DST_1 k and ACL_DST_2 v.
+ */
+class CpuQKVRoPE : public INEOperator
+{
+public:
+    /** Default Constructor */
+    CpuQKVRoPE();
+    /** Default Destructor */
+    ~CpuQKVRoPE();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuQKVRoPE(const CpuQKVRoPE &) = delete;
+    /** Default move constructor */
+    CpuQKVRoPE(CpuQKVRoPE &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuQKVRoPE &operator=(const CpuQKVRoPE &) = delete;
+    /** Default move assignment operator */
+    CpuQKVRoPE &operator=(CpuQKVRoPE &&) = default;
+    /** Configure the operator.
+     *
+     * Valid data type configurations:
+     * |qkv    |positions |q - v  |
+     * |:------|:---------|:------|
+     * |F16    |S32       |F16    |
+     * |F32    |S32       |F32    |
+     *
+     * @param[in]  qkv       Output of the fused QKV projection with dimensions
+     *                       [(num_heads + 2 * num_kv_heads) * head_dim, seq_len, batch_size]. Data types supported: F16/F32.
+     * @param[in]  positions (Optional) 1D tensor with the position of each token, or 2D tensor with dimensions
+     *                       [seq_len, batch_size]. Can be nullptr, in which case the position of a token is its index
+     *                       in the sequence. The positions must be in [0, max_position), the run fails
+     *                       otherwise. Data type supported: S32.
+     * @param[out] q         Query heads with dimensions [head_dim, seq_len, num_heads, batch_size].
+     *                       Data type supported: Same as @p qkv.
+     * @param[out] k         Key heads with dimensions [seq_len, head_dim, num_kv_heads, batch_size], or
+     *                       [head_dim, seq_len, num_kv_heads, batch_size] without @ref RoPEInfo::transpose_k.
+     *                       Data type supported: Same as @p qkv.
+     * @param[out] v         Value heads with dimensions [head_dim, seq_len, num_kv_heads, batch_size].
+     *                       Data type supported: Same as @p qkv.
+     * @param[in]  info      Rotary position embedding information.
+     */
+    void configure(const ITensorInfo *qkv,
+                   const ITensorInfo *positions,
+                   ITensorInfo       *q,
+                   ITensorInfo       *k,
+                   ITensorInfo       *v,
+                   const RoPEInfo    &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuQKVRoPE
+     *
+     * Similar to @ref CpuQKVRoPE::configure
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *qkv,
+                           const ITensorInfo *positions,
+                           const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const RoPEInfo    &info);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+} // namespace op
+} // namespace experimental
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_OPERATORS_CPUQKVROPE_H
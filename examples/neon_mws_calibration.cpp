@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/StringUtils.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/NEON/NEFunctions.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include "utils/Utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+
+using namespace arm_compute;
+using namespace utils;
+
+namespace
+{
+/** Scheduler running the kernels in the calling thread and recording their names */
+class KernelNameRecorder final : public IScheduler
+{
+public:
+    void set_num_threads(unsigned int num_threads) override
+    {
+        ARM_COMPUTE_UNUSED(num_threads);
+    }
+    unsigned int num_threads() const override
+    {
+        return 1;
+    }
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ARM_COMPUTE_UNUSED(hints);
+        record(kernel);
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        kernel->run(kernel->window(), info);
+    }
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override
+    {
+        ARM_COMPUTE_UNUSED(hints);
+        record(kernel);
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        kernel->run_op(tensors, window, info);
+    }
+    /** Name of the last kernel scheduled */
+    const std::string &last_kernel() const
+    {
+        return _last_kernel;
+    }
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        for (auto &wl : workloads)
+        {
+            wl(info);
+        }
+    }
+
+private:
+    void record(const ICPPKernel *kernel)
+    {
+        _last_kernel = kernel->name();
+    }
+
+    std::string _last_kernel{};
+};
+
+/** Operator to calibrate */
+struct Operator
+{
+    std::string name;
+    DataType    data_type;
+    /** Configure the function on the given tensors, return nullptr if the configuration is not supported */
+    std::function<std::unique_ptr<IFunction>(Tensor &, Tensor &, Tensor &)> configure;
+    /** Suffix appended to the kernel name to build the key of the table, see CpuMwsTable */
+    std::string key_suffix;
+};
+
+template <typename Function>
+Operator make_binary_operator(const std::string &name, DataType dt, const std::string &key_suffix = "")
+{
+    return Operator{name, dt,
+                    [](Tensor &src0, Tensor &src1, Tensor &dst) -> std::unique_ptr<IFunction>
+                    {
+                        if (!bool(Function::validate(src0.info(), src1.info(), dst.info())))
+                        {
+                            return nullptr;
+                        }
+                        auto fn = std::make_unique<Function>();
+                        fn->configure(&src0, &src1, &dst);
+                        return fn;
+                    },
+                    key_suffix};
+}
+
+template <typename Function>
+Operator make_add_sub_operator(const std::string &name, DataType dt)
+{
+    return Operator{name, dt,
+                    [](Tensor &src0, Tensor &src1, Tensor &dst) -> std::unique_ptr<IFunction>
+                    {
+                        if (!bool(Function::validate(src0.info(), src1.info(), dst.info(), ConvertPolicy::SATURATE)))
+                        {
+                            return nullptr;
+                        }
+                        auto fn = std::make_unique<Function>();
+                        fn->configure(&src0, &src1, &dst, ConvertPolicy::SATURATE);
+                        return fn;
+                    },
+                    ""};
+}
+
+Operator make_mul_operator(DataType dt)
+{
+    const std::string dt_str = lower_string(string_from_data_type(dt));
+    return Operator{"mul", dt,
+                    [](Tensor &src0, Tensor &src1, Tensor &dst) -> std::unique_ptr<IFunction>
+                    {
+                        if (!bool(NEPixelWiseMultiplication::validate(src0.info(), src1.info(), dst.info(), 1.f,
+                                                                      ConvertPolicy::SATURATE,
+                                                                      RoundingPolicy::TO_ZERO)))
+                        {
+                            return nullptr;
+                        }
+                        auto fn = std::make_unique<NEPixelWiseMultiplication>();
+                        fn->configure(&src0, &src1, &dst, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
+                        return fn;
+                    },
+                    ":" + dt_str + "_" + dt_str + "_" + dt_str};
+}
+
+Operator make_activation_operator(DataType dt, ActivationLayerInfo::ActivationFunction act)
+{
+    const std::string act_str = lower_string(string_from_activation_func(act));
+    return Operator{"activation " + act_str, dt,
+                    [act](Tensor &src, Tensor &, Tensor &dst) -> std::unique_ptr<IFunction>
+                    {
+                        const ActivationLayerInfo act_info(act, 1.f, 0.f);
+                        if (!bool(NEActivationLayer::validate(src.info(), dst.info(), act_info)))
+                        {
+                            return nullptr;
+                        }
+                        auto fn = std::make_unique<NEActivationLayer>();
+                        fn->configure(&src, &dst, act_info);
+                        return fn;
+                    },
+                    ":" + act_str};
+}
+
+std::string cpu_model_name(CPUModel model)
+{
+    switch (model)
+    {
+#define X(MODEL)          \
+    case CPUModel::MODEL: \
+        return #MODEL;
+        ARM_COMPUTE_CPU_MODEL_LIST
+#undef X
+        default:
+            return "GENERIC";
+    }
+}
+
+void fill_tensor(Tensor &tensor)
+{
+    switch (tensor.info()->data_type())
+    {
+        case DataType::F32:
+            fill_tensor_value(tensor, 1.5f);
+            break;
+        case DataType::F16:
+            fill_tensor_value(tensor, half(1.5f));
+            break;
+        case DataType::S32:
+            fill_tensor_value(tensor, int32_t(3));
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+}
+} // namespace
+
+/** Example measuring the minimum workload size (MWS) of the element-wise kernels on the running CPU
+ *
+ * For each operator and data type, the 1D problem size is doubled until running on two threads beats running
+ * on a single thread, then the breakeven size is refined by bisection. Half of the breakeven size is the minimum
+ * number of elements a thread has to process for a split to pay off. A size only counts as a speedup if two threads
+ * win by a margin in several consecutive rounds of measurements, so that timing noise does not end the search early.
+ * Activations are calibrated for each function, as their cost per element differs widely.
+ *
+ * The result is printed, and optionally saved, in the format of the table read by the library from the file
+ * pointed to by the ARM_COMPUTE_CPU_MWS_TABLE environment variable.
+ */
+class NEONMwsCalibrationExample : public Example
+{
+public:
+    bool do_setup(int argc, char **argv) override
+    {
+        if (argc > 1)
+        {
+            output_filename = argv[1];
+        }
+        if (argc > 2)
+        {
+            iterations = std::max(1, std::atoi(argv[2]));
+        }
+        std::cout << "Usage: ./build/neon_mws_calibration [output_table.csv] [iterations = " << iterations
+                  << "]\n\n";
+
+        // Let every kernel split its window regardless of its table entry or built-in default while calibrating
+        setenv("ARM_COMPUTE_CPU_MWS_TABLE", "calibrate", 1);
+
+        using ActFn         = ActivationLayerInfo::ActivationFunction;
+        const bool has_fp16 = CPUInfo::get().has_fp16();
+        for (DataType dt : {DataType::F32, DataType::F16, DataType::S32})
+        {
+            if (dt == DataType::F16 && !has_fp16)
+            {
+                continue;
+            }
+            operators.push_back(make_add_sub_operator<NEArithmeticAddition>("add", dt));
+            operators.push_back(make_add_sub_operator<NEArithmeticSubtraction>("sub", dt));
+            operators.push_back(make_mul_operator(dt));
+            operators.push_back(make_binary_operator<NEElementwiseMin>("min", dt, ":min"));
+            operators.push_back(make_binary_operator<NEElementwiseMax>("max", dt, ":max"));
+            operators.push_back(make_binary_operator<NEElementwiseDivision>("div", dt, ":div"));
+            for (ActFn act : {ActFn::RELU, ActFn::BOUNDED_RELU, ActFn::LU_BOUNDED_RELU, ActFn::LEAKY_RELU,
+                              ActFn::LOGISTIC, ActFn::TANH, ActFn::ELU, ActFn::SOFT_RELU, ActFn::HARD_SWISH,
+                              ActFn::SWISH, ActFn::GELU})
+            {
+                operators.push_back(make_activation_operator(dt, act));
+            }
+        }
+        return true;
+    }
+    void do_run() override
+    {
+        const std::string model = cpu_model_name(CPUInfo::get().get_cpu_model());
+        table << "# Minimum workload sizes calibrated on " << model << "\n";
+
+        for (const auto &op : operators)
+        {
+            std::string kernel;
+            size_t      size = min_size;
+            while (size <= max_size && !speeds_up(op, size, kernel))
+            {
+                size *= 2;
+            }
+            if (kernel.empty())
+            {
+                continue;
+            }
+            if (size > max_size)
+            {
+                std::cout << op.name << " " << string_from_data_type(op.data_type) << ": no speedup up to " << max_size
+                          << " elements\n";
+                continue;
+            }
+
+            // Refine the breakeven size between the last two sizes
+            size_t lo = size / 2;
+            size_t hi = size;
+            for (int step = 0; step < refinement_steps && hi - lo > min_size; ++step)
+            {
+                const size_t mid = lo + (hi - lo) / 2;
+                (speeds_up(op, mid, kernel) ? hi : lo) = mid;
+            }
+
+            table << model << "," << kernel << op.key_suffix << "," << hi / 2 << "\n";
+        }
+        std::cout << table.str();
+    }
+    void do_teardown() override
+    {
+        if (!output_filename.empty())
+        {
+            std::ofstream out(output_filename);
+            out << table.str();
+        }
+    }
+
+private:
+    /** Check whether running @p op on two threads is consistently faster than on one thread for @p size elements */
+    bool speeds_up(const Operator &op, size_t size, std::string &kernel)
+    {
+        Tensor           src0{}, src1{}, dst{};
+        const TensorInfo info(TensorShape(size), 1, op.data_type);
+        src0.allocator()->init(info);
+        src1.allocator()->init(info);
+        dst.allocator()->init(info);
+
+        std::unique_ptr<IFunction> fn = op.configure(src0, src1, dst);
+        if (fn == nullptr)
+        {
+            return false;
+        }
+        src0.allocator()->allocate();
+        src1.allocator()->allocate();
+        dst.allocator()->allocate();
+        fill_tensor(src0);
+        fill_tensor(src1);
+
+        // Record the name of the kernel with a single-threaded run
+        auto recorder = std::make_shared<KernelNameRecorder>();
+        const auto type = Scheduler::get_type();
+        Scheduler::set(recorder);
+        fn->run();
+        Scheduler::set(type);
+        kernel = recorder->last_kernel();
+
+        for (int round = 0; round < confirmation_rounds; ++round)
+        {
+            const double single_thread = best_time(*fn, 1);
+            const double multi_thread  = best_time(*fn, 2);
+            if (multi_thread >= single_thread * (1.0 - min_speedup))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Best execution time in seconds out of the configured number of iterations */
+    double best_time(IFunction &fn, unsigned int num_threads)
+    {
+        Scheduler::get().set_num_threads(num_threads);
+        fn.run(); // Warm-up
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < iterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            fn.run();
+            const auto end = std::chrono::steady_clock::now();
+            best           = std::min(best, std::chrono::duration<double>(end - start).count());
+        }
+        return best;
+    }
+
+    static constexpr size_t min_size            = 256;
+    static constexpr size_t max_size            = 1 << 24;
+    static constexpr int    refinement_steps    = 4;
+    static constexpr int    confirmation_rounds = 3;    /**< Consecutive rounds two threads must win */
+    static constexpr double min_speedup         = 0.05; /**< Relative gain two threads must achieve in each round */
+
+    std::vector<Operator> operators{};
+    std::string           output_filename{};
+    std::stringstream     table{};
+    int                   iterations{50};
+};
+
+/** Main program for the MWS calibration example
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( [optional] Path of the output table, [optional] Number of timed iterations )
+ */
+int main(int argc, char **argv)
+{
+    return utils::run_example<NEONMwsCalibrationExample>(argc, argv);
+}
@@ -148,45 +148,38 @@ std::vector<int> NonMaximaSuppression(const ITensor         *proposals,
         areas[i] = (x2[i] - x1[i] + 1.0) * (y2[i] - y1[i] + 1.0);
     }
 
-    while (!sorted_indices.empty())
+    // The remaining candidates are compacted in place after every kept box, preserving their order
+    size_t num_remaining = sorted_indices.size();
+    while (num_remaining > 0)
     {
-        int i = sorted_indices.at(0);
+        const int i = sorted_indices[0];
         keep.push_back(i);
 
-        std::vector<int> sorted_indices_temp = sorted_indices;
-        std::vector<int> new_indices;
-        sorted_indices_temp.erase(sorted_indices_temp.begin());
-
-        for (unsigned int j = 0; j < sorted_indices_temp.size(); ++j)
+        size_t num_kept = 0;
+        for (size_t j = 1; j < num_remaining; ++j)
         {
-            const float xx1 = std::max(x1[sorted_indices_temp.at(j)], x1[i]);
-            const float yy1 = std::max(y1[sorted_indices_temp.at(j)], y1[i]);
-            const float xx2 = std::min(x2[sorted_indices_temp.at(j)], x2[i]);
-            const float yy2 = std::min(y2[sorted_indices_temp.at(j)], y2[i]);
+            const int   idx = sorted_indices[j];
+            const float xx1 = std::max(x1[idx], x1[i]);
+            const float yy1 = std::max(y1[idx], y1[i]);
+            const float xx2 = std::min(x2[idx], x2[i]);
+            const float yy2 = std::min(y2[idx], y2[i]);
 
             const float w     = std::max((xx2 - xx1 + 1.f), 0.f);
             const float h     = std::max((yy2 - yy1 + 1.f), 0.f);
             const float inter = w * h;
-            const float ovr   = inter / (areas[i] + areas[sorted_indices_temp.at(j)] - inter);
+            const float ovr   = inter / (areas[i] + areas[idx] - inter);
             const float ctr_x = xx1 + (w / 2);
             const float ctr_y = yy1 + (h / 2);
 
             // If suppress_size is specified, filter the boxes based on their size and position
             const bool keep_size = !info.suppress_size() || (w >= info.min_size() && h >= info.min_size() &&
                                                              ctr_x < info.im_width() && ctr_y < info.im_height());
-            if (ovr <= info.nms() && keep_size)
-            {
-                new_indices.push_back(j);
-            }
-        }
 
-        const unsigned int new_indices_size = new_indices.size();
-        std::vector<int>   new_sorted_indices(new_indices_size);
-        for (unsigned int i = 0; i < new_indices_size; ++i)
-        {
-            new_sorted_indices[i] = sorted_indices[new_indices[i] + 1];
+            // Branch-free compaction: the candidate is always written and only counted when it survives
+            sorted_indices[num_kept] = idx;
+            num_kept += (ovr <= info.nms() && keep_size) ? 1 : 0;
         }
-        sorted_indices = new_sorted_indices;
+        num_remaining = num_kept;
     }
 
     return keep;
@@ -231,6 +224,10 @@ void CPPBoxWithNonMaximaSuppressionLimitKernel::run_nmslimit()
         }
     }
 
+    // Candidate indices, shared by all the classes
+    std::vector<int> inds;
+    inds.reserve(scores_count);
+
     int cur_start_idx = 0;
     for (int b = 0; b < batch_size; ++b)
     {
@@ -238,12 +235,11 @@ void CPPBoxWithNonMaximaSuppressionLimitKernel::run_nmslimit()
         const int j_start = (num_classes == 1 ? 0 : 1);
         for (int j = j_start; j < num_classes; ++j)
         {
-            std::vector<T>   cur_scores(scores_count);
-            std::vector<int> inds;
+            const std::vector<T> &cur_scores = in_scores[j];
+            inds.clear();
             for (int i = 0; i < scores_count; ++i)
             {
-                const T score = in_scores[j][i];
-                cur_scores[i] = score;
+                const T score = cur_scores[i];
 
                 if (score > _info.score_thresh())
                 {
@@ -266,8 +262,9 @@ void CPPBoxWithNonMaximaSuppressionLimitKernel::run_nmslimit()
 
         if (_info.detections_per_im() > 0 && total_keep_count > _info.detections_per_im())
         {
-            // merge all scores (represented by indices) together and sort
-            auto get_all_scores_sorted = [&in_scores, &keeps, total_keep_count]()
+            // merge all scores (represented by indices) together and select the threshold
+            const int detections_per_im = _info.detections_per_im();
+            auto      get_all_scores_sorted = [&in_scores, &keeps, total_keep_count, detections_per_im]()
             {
                 std::vector<T> ret(total_keep_count);
 
@@ -281,13 +278,14 @@ void CPPBoxWithNonMaximaSuppressionLimitKernel::run_nmslimit()
                     }
                 }
 
-                std::sort(ret.data(), ret.data() + ret.size());
+                // Only the score ranked detections_per_im is needed, which a selection finds in linear time
+                std::nth_element(ret.data(), ret.data() + ret.size() - detections_per_im, ret.data() + ret.size());
 
                 return ret;
             };
 
             auto    all_scores_sorted = get_all_scores_sorted();
-            const T image_thresh      = all_scores_sorted[all_scores_sorted.size() - _info.detections_per_im()];
+            const T image_thresh      = all_scores_sorted[all_scores_sorted.size() - detections_per_im];
             for (int j = 1; j < num_classes; ++j)
             {
                 auto            &cur_keep = keeps[j];
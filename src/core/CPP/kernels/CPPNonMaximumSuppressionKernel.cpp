@@ -28,6 +28,7 @@
 
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/NMSHelpers.h"
 #include "src/core/helpers/WindowHelpers.h"
 
 #include <algorithm>
@@ -63,6 +64,14 @@ Status validate_arguments(const ITensorInfo *bboxes,
 }
 } // namespace
 
+/** Buffers reused across runs so that the suppression doesn't allocate */
+struct CPPNonMaximumSuppressionKernel::Scratch
+{
+    std::vector<nms_helpers::ScoredIndex> candidates{};
+    nms_helpers::BoxArrays                kept_boxes{};
+    std::vector<int>                      kept{};
+};
+
 CPPNonMaximumSuppressionKernel::CPPNonMaximumSuppressionKernel()
     : _input_bboxes(nullptr),
       _input_scores(nullptr),
@@ -70,10 +79,18 @@ CPPNonMaximumSuppressionKernel::CPPNonMaximumSuppressionKernel()
       _max_output_size(0),
       _score_threshold(0.f),
       _iou_threshold(0.f),
-      _num_boxes(0)
+      _num_boxes(0),
+      _scratch(std::make_unique<Scratch>())
 {
 }
 
+CPPNonMaximumSuppressionKernel::CPPNonMaximumSuppressionKernel(CPPNonMaximumSuppressionKernel &&) = default;
+
+CPPNonMaximumSuppressionKernel &
+CPPNonMaximumSuppressionKernel::operator=(CPPNonMaximumSuppressionKernel &&) = default;
+
+CPPNonMaximumSuppressionKernel::~CPPNonMaximumSuppressionKernel() = default;
+
 void CPPNonMaximumSuppressionKernel::configure(const ITensor *input_bboxes,
                                                const ITensor *input_scores,
                                                ITensor       *output_indices,
@@ -95,6 +112,10 @@ void CPPNonMaximumSuppressionKernel::configure(const ITensor *input_bboxes,
     _max_output_size = max_output_size;
     _num_boxes       = input_scores->info()->dimension(0);
 
+    _scratch->candidates.reserve(_num_boxes);
+    _scratch->kept_boxes.reserve(max_output_size);
+    _scratch->kept.reserve(max_output_size);
+
     // Configure kernel window
     Window win = calculate_max_window(*output_indices->info(), Steps());
 
@@ -121,107 +142,32 @@ void CPPNonMaximumSuppressionKernel::run(const Window &window, const ThreadInfo
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICPPKernel::window(), window);
 
-    // Auxiliary tensors
-    std::vector<int>   indices_above_thd;
-    std::vector<float> scores_above_thd;
+    // Gather the candidates above the score threshold
+    std::vector<nms_helpers::ScoredIndex> &candidates = _scratch->candidates;
+    candidates.clear();
+    const auto  *scores       = reinterpret_cast<const float *>(_input_scores->ptr_to_element(Coordinates(0)));
+    const size_t score_stride = _input_scores->info()->strides_in_bytes()[0] / sizeof(float);
     for (unsigned int i = 0; i < _num_boxes; ++i)
     {
-        const float score_i = *(reinterpret_cast<float *>(_input_scores->ptr_to_element(Coordinates(i))));
+        const float score_i = scores[i * score_stride];
         if (score_i >= _score_threshold)
         {
-            scores_above_thd.emplace_back(score_i);
-            indices_above_thd.emplace_back(i);
+            candidates.push_back({score_i, static_cast<int>(i)});
         }
     }
 
-    // Sort selected indices based on scores
-    const unsigned int        num_above_thd = indices_above_thd.size();
-    std::vector<unsigned int> sorted_indices;
-    sorted_indices.resize(num_above_thd);
-    std::iota(sorted_indices.data(), sorted_indices.data() + num_above_thd, 0);
-    std::sort(std::begin(sorted_indices), std::end(sorted_indices),
-              [&](unsigned int first, unsigned int second)
-              { return scores_above_thd[first] > scores_above_thd[second]; });
-
-    // Number of output is the minimum between max_detection and the scores above the threshold
-    const unsigned int num_output = std::min(_max_output_size, num_above_thd);
-    unsigned int       output_idx = 0;
-    std::vector<bool>  visited(num_above_thd, false);
-
-    // Keep only boxes with small IoU
-    for (unsigned int i = 0; i < num_above_thd; ++i)
-    {
-        // Check if the output is full
-        if (output_idx >= num_output)
-        {
-            break;
-        }
-
-        // Check if it was already visited, if not add it to the output and update the indices counter
-        if (!visited[sorted_indices[i]])
-        {
-            *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx)))) =
-                indices_above_thd[sorted_indices[i]];
-            visited[sorted_indices[i]] = true;
-            ++output_idx;
-        }
-        else
-        {
-            continue;
-        }
+    // Box-corner format: xmin, ymin, xmax, ymax
+    const auto  *boxes      = reinterpret_cast<const float *>(_input_bboxes->ptr_to_element(Coordinates(0, 0)));
+    const size_t box_stride = _input_bboxes->info()->strides_in_bytes()[1] / sizeof(float);
+    nms_helpers::greedy_nms(candidates, boxes, box_stride, _iou_threshold, 1.f, _max_output_size,
+                            _scratch->kept_boxes, _scratch->kept);
 
-        // Once added one element at the output check if the next ones overlap and can be skipped
-        for (unsigned int j = i + 1; j < num_above_thd; ++j)
-        {
-            if (!visited[sorted_indices[j]])
-            {
-                // Calculate IoU
-                const unsigned int i_index = indices_above_thd[sorted_indices[i]];
-                const unsigned int j_index = indices_above_thd[sorted_indices[j]];
-                // Box-corner format: xmin, ymin, xmax, ymax
-                const auto box_i_xmin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, i_index))));
-                const auto box_i_ymin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, i_index))));
-                const auto box_i_xmax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, i_index))));
-                const auto box_i_ymax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, i_index))));
-
-                const auto box_j_xmin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, j_index))));
-                const auto box_j_ymin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, j_index))));
-                const auto box_j_xmax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, j_index))));
-                const auto box_j_ymax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, j_index))));
-
-                const float area_i = (box_i_xmax - box_i_xmin) * (box_i_ymax - box_i_ymin);
-                const float area_j = (box_j_xmax - box_j_xmin) * (box_j_ymax - box_j_ymin);
-                float       overlap;
-                if (area_i <= 0 || area_j <= 0)
-                {
-                    overlap = 0.0f;
-                }
-                else
-                {
-                    const auto y_min_intersection = std::max<float>(box_i_ymin, box_j_ymin);
-                    const auto x_min_intersection = std::max<float>(box_i_xmin, box_j_xmin);
-                    const auto y_max_intersection = std::min<float>(box_i_ymax, box_j_ymax);
-                    const auto x_max_intersection = std::min<float>(box_i_xmax, box_j_xmax);
-                    const auto area_intersection  = std::max<float>(y_max_intersection - y_min_intersection, 0.0f) *
-                                                   std::max<float>(x_max_intersection - x_min_intersection, 0.0f);
-                    overlap = area_intersection / (area_i + area_j - area_intersection);
-                }
-
-                if (overlap > _iou_threshold)
-                {
-                    visited[sorted_indices[j]] = true;
-                }
-            }
-        }
+    unsigned int output_idx = 0;
+    for (const int kept_idx : _scratch->kept)
+    {
+        *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx++)))) = kept_idx;
     }
+
     // The output could be full but not the output indices tensor
     // Instead return values not valid we put -1
     for (; output_idx < _max_output_size; ++output_idx)
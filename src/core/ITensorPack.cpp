@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,4 +80,18 @@ bool ITensorPack::empty() const
 {
     return _pack.empty();
 }
+
+size_t ITensorPack::total_size() const
+{
+    size_t total = 0;
+    for (const auto &e : _pack)
+    {
+        const ITensor *tensor = e.second.ctensor != nullptr ? e.second.ctensor : e.second.tensor;
+        if (tensor != nullptr && tensor->info() != nullptr)
+        {
+            total += tensor->info()->total_size();
+        }
+    }
+    return total;
+}
 } // namespace arm_compute
@@ -124,6 +124,53 @@ float32x4_t vlogq_f32(float32x4_t x);
  */
 float32x4_t vtanhq_f32(float32x4_t val);
 
+/** Calculate logistic function.
+ *
+ * logistic(x) = 1 / (1 + e^-x)
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated logistic function.
+ */
+float32x4_t vlogisticq_f32(float32x4_t x);
+
+/** Calculate exponential using the fast accuracy tier.
+ *
+ * The precise functions, e.g. @ref vexpq_f32, are accurate to a few ULPs over the whole input range.
+ * The fast tier trades accuracy for throughput and is meant for kernels whose results are quantized to 8 bits
+ * or otherwise tolerate an error of about 1e-4.
+ *
+ * e^x is approximated with a degree 3 polynomial after the range reduction, for a maximum relative error of 1.1e-4.
+ *
+ * @note x is clamped to [-86.64, 88.37], so the result saturates instead of overflowing to infinity or underflowing
+ *       to zero.
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated exponent.
+ */
+float32x4_t vexpq_fast_f32(float32x4_t x);
+
+/** Calculate logistic function using the fast accuracy tier.
+ *
+ * logistic(x) = 1 / (1 + e^-x), with a maximum absolute error of 1e-4.
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated logistic function.
+ */
+float32x4_t vlogisticq_fast_f32(float32x4_t x);
+
+/** Calculate hyperbolic tangent using the fast accuracy tier.
+ *
+ * tanh(x) = 2 * logistic(2x) - 1, with a maximum absolute error of 1e-4.
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated Hyperbolic Tangent.
+ */
+float32x4_t vtanhq_fast_f32(float32x4_t x);
+
 /** Calculate n power of a number.
  *
  * pow(x,n) = e^(n*log(x))
@@ -275,6 +322,46 @@ float vreduce(const float32x4_t &v);
  */
 float16x8_t vtanhq_f16(float16x8_t val);
 
+/** Calculate logistic function.
+ *
+ * logistic(x) = 1 / (1 + e^-x)
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated logistic function.
+ */
+float16x8_t vlogisticq_f16(float16x8_t x);
+
+/** Calculate exponential using the fast accuracy tier.
+ *
+ * The input is widened to F32 for @ref vexpq_fast_f32.
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated exponent.
+ */
+float16x8_t vexpq_fast_f16(float16x8_t x);
+
+/** Calculate logistic function using the fast accuracy tier.
+ *
+ * The input is widened to F32 for @ref vlogisticq_fast_f32.
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated logistic function.
+ */
+float16x8_t vlogisticq_fast_f16(float16x8_t x);
+
+/** Calculate hyperbolic tangent using the fast accuracy tier.
+ *
+ * The input is widened to F32 for @ref vtanhq_fast_f32.
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated Hyperbolic Tangent.
+ */
+float16x8_t vtanhq_fast_f16(float16x8_t x);
+
 /** Calculate round value of a vector to nearest with ties to even.
  *
  * @param[in] val Input vector value in F16 format.
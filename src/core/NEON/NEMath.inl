@@ -330,6 +330,57 @@ inline float32x4_t vtanhq_f32(float32x4_t val)
     return tanh;
 }
 
+inline float32x4_t vlogisticq_f32(float32x4_t x)
+{
+    return vinvq_f32(vaddq_f32(vdupq_n_f32(1.f), vexpq_f32(vnegq_f32(x))));
+}
+
+static const uint32_t exp_fast_f32_coeff[] = {
+    0x3f80066a, // x^1: 0x1.000cd4p+0f
+    0x3f010e89, // x^2: 0x1.021d12p-1f
+    0x3e292470, // x^3: 0x1.5248e0p-3f
+};
+
+inline float32x4_t vexpq_fast_f32(float32x4_t x)
+{
+    const auto c1 = vreinterpretq_f32_u32(vdupq_n_u32(exp_fast_f32_coeff[0]));
+    const auto c2 = vreinterpretq_f32_u32(vdupq_n_u32(exp_fast_f32_coeff[1]));
+    const auto c3 = vreinterpretq_f32_u32(vdupq_n_u32(exp_fast_f32_coeff[2]));
+
+    const auto shift   = vreinterpretq_f32_u32(vdupq_n_u32(0x4b00007f)); // 2^23 + 127 = 0x1.0000fep23f
+    const auto inv_ln2 = vreinterpretq_f32_u32(vdupq_n_u32(0x3fb8aa3b)); // 1 / ln(2) = 0x1.715476p+0f
+    const auto neg_ln2 = vreinterpretq_f32_u32(vdupq_n_u32(0xbf317218)); // -ln(2) = -0x1.62e430p-1f
+
+    const auto max_input = vdupq_n_f32(88.37f);  // Approximately ln(2^127.5)
+    const auto min_input = vdupq_n_f32(-86.64f); // Approximately ln(2^-125)
+
+    // Same range reduction as vexpq_f32, see there for the details. Clamping the input keeps n in the range of the
+    // normal exponents, which removes the special cases, and a single step is enough for n * ln(2) at this accuracy.
+    const auto x_clamped = vminq_f32(vmaxq_f32(x, min_input), max_input);
+    const auto z         = prefer_vfmaq_f32(shift, x_clamped, inv_ln2);
+    const auto n         = vsubq_f32(z, shift);
+    const auto scale     = vreinterpretq_f32_u32(vshlq_n_u32(vreinterpretq_u32_f32(z), 23)); // 2^n
+    const auto r         = prefer_vfmaq_f32(x_clamped, n, neg_ln2);
+
+    // poly = scale * (1 + c1 * r + c2 * r^2 + c3 * r^3), with the minimax coefficients of [-ln(2) / 2, ln(2) / 2]
+    const auto p123 = prefer_vfmaq_f32(c1, prefer_vfmaq_f32(c2, c3, r), r);
+    return prefer_vfmaq_f32(scale, vmulq_f32(p123, r), scale);
+}
+
+inline float32x4_t vlogisticq_fast_f32(float32x4_t x)
+{
+    // A single Newton-Raphson step refines the reciprocal estimate to about 16 bits
+    const float32x4_t den   = vaddq_f32(vdupq_n_f32(1.f), vexpq_fast_f32(vnegq_f32(x)));
+    const float32x4_t recip = vrecpeq_f32(den);
+    return vmulq_f32(vrecpsq_f32(den, recip), recip);
+}
+
+inline float32x4_t vtanhq_fast_f32(float32x4_t x)
+{
+    const float32x4_t two = vdupq_n_f32(2.f);
+    return vsubq_f32(vmulq_f32(two, vlogisticq_fast_f32(vmulq_f32(two, x))), vdupq_n_f32(1.f));
+}
+
 inline float32x4_t vpowq_f32(float32x4_t val, float32x4_t n)
 {
     return vexpq_f32(vmulq_f32(n, vlogq_f32(val)));
@@ -705,6 +756,35 @@ inline float16x8_t vexpq_f16(float16x8_t x)
     return res;
 }
 
+inline float16x8_t vlogisticq_f16(float16x8_t x)
+{
+    return vinvq_f16(vaddq_f16(vdupq_n_f16(1.f), vexpq_f16(vnegq_f16(x))));
+}
+
+inline float16x8_t vexpq_fast_f16(float16x8_t x)
+{
+    const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
+    const float32x4_t x_low  = vcvt_f32_f16(vget_low_f16(x));
+
+    return vcombine_f16(vcvt_f16_f32(vexpq_fast_f32(x_low)), vcvt_f16_f32(vexpq_fast_f32(x_high)));
+}
+
+inline float16x8_t vlogisticq_fast_f16(float16x8_t x)
+{
+    const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
+    const float32x4_t x_low  = vcvt_f32_f16(vget_low_f16(x));
+
+    return vcombine_f16(vcvt_f16_f32(vlogisticq_fast_f32(x_low)), vcvt_f16_f32(vlogisticq_fast_f32(x_high)));
+}
+
+inline float16x8_t vtanhq_fast_f16(float16x8_t x)
+{
+    const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
+    const float32x4_t x_low  = vcvt_f32_f16(vget_low_f16(x));
+
+    return vcombine_f16(vcvt_f16_f32(vtanhq_fast_f32(x_low)), vcvt_f16_f32(vtanhq_fast_f32(x_high)));
+}
+
 #ifdef __aarch64__
 inline float16x8_t verfq_f16(float16x8_t x)
 {
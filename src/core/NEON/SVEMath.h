@@ -87,6 +87,64 @@ svfloat32_t svtanh_f32_z(svbool_t pg, svfloat32_t val);
  */
 svfloat16_t svtanh_f16_z(svbool_t pg, svfloat16_t val);
 
+/** Calculate logistic function.
+ *
+ * logistic(x) = 1 / (1 + e^-x)
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F32 format.
+ *
+ * @return The calculated logistic function.
+ */
+svfloat32_t svlogistic_f32_z(svbool_t pg, svfloat32_t x);
+
+/** Calculate logistic function.
+ *
+ * logistic(x) = 1 / (1 + e^-x)
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F16 format.
+ *
+ * @return The calculated logistic function.
+ */
+svfloat16_t svlogistic_f16_z(svbool_t pg, svfloat16_t x);
+
+/** Calculate exponent using the fast accuracy tier.
+ *
+ * SVE counterpart of @ref vexpq_fast_f32, with a maximum relative error of 1.1e-4.
+ *
+ * @note x is clamped to [-86.64, 88.37], so the result saturates instead of overflowing to infinity or underflowing
+ *       to zero.
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F32 format.
+ *
+ * @return The calculated exponent.
+ */
+svfloat32_t svexp_fast_f32_z(svbool_t pg, svfloat32_t x);
+
+/** Calculate logistic function using the fast accuracy tier.
+ *
+ * SVE counterpart of @ref vlogisticq_fast_f32, with a maximum absolute error of 1e-4.
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F32 format.
+ *
+ * @return The calculated logistic function.
+ */
+svfloat32_t svlogistic_fast_f32_z(svbool_t pg, svfloat32_t x);
+
+/** Calculate hyperbolic tangent using the fast accuracy tier.
+ *
+ * SVE counterpart of @ref vtanhq_fast_f32, with a maximum absolute error of 1e-4.
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F32 format.
+ *
+ * @return The calculated Hyperbolic Tangent.
+ */
+svfloat32_t svtanh_fast_f32_z(svbool_t pg, svfloat32_t x);
+
 /** Calculate exponential
  *
  * @param[in] pg Input predicate.
@@ -205,6 +205,61 @@ inline svfloat16_t svtanh_f16_z(svbool_t pg, svfloat16_t val)
     return tanh;
 }
 
+inline svfloat32_t svlogistic_f32_z(svbool_t pg, svfloat32_t x)
+{
+    return svinv_f32_z(pg, svadd_f32_z(pg, svdup_n_f32(1.f), svexp_f32_z(pg, svneg_f32_z(pg, x))));
+}
+
+inline svfloat16_t svlogistic_f16_z(svbool_t pg, svfloat16_t x)
+{
+    return svinv_f16_z(pg, svadd_f16_z(pg, svdup_n_f16(1.f), svexp_f16_z(pg, svneg_f16_z(pg, x))));
+}
+
+static const uint32_t svexp_fast_f32_coeff[] = {
+    0x3f80066a, // x^1: 0x1.000cd4p+0f
+    0x3f010e89, // x^2: 0x1.021d12p-1f
+    0x3e292470, // x^3: 0x1.5248e0p-3f
+};
+
+inline svfloat32_t svexp_fast_f32_z(svbool_t pg, svfloat32_t x)
+{
+    const auto c1 = svreinterpret_f32_u32(svdup_n_u32(svexp_fast_f32_coeff[0]));
+    const auto c2 = svreinterpret_f32_u32(svdup_n_u32(svexp_fast_f32_coeff[1]));
+    const auto c3 = svreinterpret_f32_u32(svdup_n_u32(svexp_fast_f32_coeff[2]));
+
+    const auto shift   = svreinterpret_f32_u32(svdup_n_u32(0x4b00007f)); // 2^23 + 127 = 0x1.0000fep23f
+    const auto inv_ln2 = svreinterpret_f32_u32(svdup_n_u32(0x3fb8aa3b)); // 1 / ln(2) = 0x1.715476p+0f
+    const auto neg_ln2 = svreinterpret_f32_u32(svdup_n_u32(0xbf317218)); // -ln(2) = -0x1.62e430p-1f
+
+    const auto max_input = svdup_n_f32(88.37f);  // Approximately ln(2^127.5)
+    const auto min_input = svdup_n_f32(-86.64f); // Approximately ln(2^-125)
+
+    // Same range reduction as svexp_f32_z, on an input clamped to the range of the normal exponents
+    const auto x_clamped = svmin_f32_z(pg, svmax_f32_z(pg, x, min_input), max_input);
+    const auto z         = svmla_f32_z(pg, shift, x_clamped, inv_ln2);
+    const auto n         = svsub_f32_z(pg, z, shift);
+    const auto scale     = svreinterpret_f32_u32(svlsl_n_u32_z(pg, svreinterpret_u32_f32(z), 23)); // 2^n
+    const auto r         = svmla_f32_z(pg, x_clamped, n, neg_ln2);
+
+    // poly = scale * (1 + c1 * r + c2 * r^2 + c3 * r^3)
+    const auto p123 = svmla_f32_z(pg, c1, svmla_f32_z(pg, c2, c3, r), r);
+    return svmla_f32_z(pg, scale, svmul_f32_z(pg, p123, r), scale);
+}
+
+inline svfloat32_t svlogistic_fast_f32_z(svbool_t pg, svfloat32_t x)
+{
+    // A single Newton-Raphson step refines the reciprocal estimate to about 16 bits
+    const auto den   = svadd_f32_z(pg, svdup_n_f32(1.f), svexp_fast_f32_z(pg, svneg_f32_z(pg, x)));
+    const auto recip = svrecpe_f32(den);
+    return svmul_f32_z(pg, svrecps_f32(den, recip), recip);
+}
+
+inline svfloat32_t svtanh_fast_f32_z(svbool_t pg, svfloat32_t x)
+{
+    const auto two = svdup_n_f32(2.f);
+    return svsub_f32_z(pg, svmul_f32_z(pg, two, svlogistic_fast_f32_z(pg, svmul_f32_z(pg, two, x))), svdup_n_f32(1.f));
+}
+
 inline svfloat32_t svlog_f32_z(svbool_t pg, svfloat32_t x)
 {
     /** Logarithm polynomial coefficients */
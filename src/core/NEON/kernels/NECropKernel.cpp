@@ -33,6 +33,7 @@
 #include "src/core/common/Registrars.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/Utils.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/core/utils/helpers/bit_ops.h"
@@ -249,7 +250,7 @@ Status NECropKernel::validate(const ITensorInfo *input,
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(output, DataType::F32);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() != 3);
-        ARM_COMPUTE_RETURN_ERROR_ON(output->has_padding());
+        ARM_COMPUTE_RETURN_ERROR_ON(has_holes(*output));
     }
     else
     {
@@ -328,8 +329,8 @@ void NECropKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    ARM_COMPUTE_ERROR_ON(_input->info()->has_padding());
-    ARM_COMPUTE_ERROR_ON(_output->info()->has_padding());
+    ARM_COMPUTE_ERROR_ON(has_holes(*_input->info()));
+    ARM_COMPUTE_ERROR_ON(has_holes(*_output->info()));
 
     const auto *uk = get_implementation(CropSelectorData{_input->info()->data_type()});
 
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEDeconvolutionInterleaveKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+/** Number of elements of the phase along a dimension of the output */
+size_t phase_size(size_t output_size, size_t stride, size_t offset)
+{
+    return offset < output_size ? (output_size - 1 - offset) / stride + 1 : 0;
+}
+
+Status validate_arguments(const ITensorInfo *input,
+                          const ITensorInfo *output,
+                          const Size2D      &stride,
+                          const Size2D      &output_offset,
+                          const Size2D      &input_offset)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(input, output);
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use CPU FP16 instructions.
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() == DataType::UNKNOWN);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() == DataLayout::UNKNOWN);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(stride.x() == 0 || stride.y() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_offset.x() >= stride.x() || output_offset.y() >= stride.y());
+
+    const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
+    const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
+
+    const size_t size_x = phase_size(output->dimension(idx_w), stride.x(), output_offset.x());
+    const size_t size_y = phase_size(output->dimension(idx_h), stride.y(), output_offset.y());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input_offset.x() + size_x > input->dimension(idx_w) ||
+                                        input_offset.y() + size_y > input->dimension(idx_h),
+                                    "The phase does not cover its output elements");
+    for (size_t d = 0; d < TensorShape::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(d != idx_w && d != idx_h && input->dimension(d) != output->dimension(d));
+    }
+
+    return Status{};
+}
+
+template <typename T>
+void scatter_row(const uint8_t *src, uint8_t *dst, size_t num_elements, size_t dst_step)
+{
+    const T *src_ptr = reinterpret_cast<const T *>(src);
+    T       *dst_ptr = reinterpret_cast<T *>(dst);
+    for (size_t x = 0; x < num_elements; ++x)
+    {
+        dst_ptr[x * dst_step] = src_ptr[x];
+    }
+}
+} // namespace
+
+NEDeconvolutionInterleaveKernel::NEDeconvolutionInterleaveKernel()
+    : _input(nullptr), _output(nullptr), _stride(), _output_offset(), _input_offset()
+{
+}
+
+void NEDeconvolutionInterleaveKernel::configure(const ITensor *input,
+                                                ITensor       *output,
+                                                const Size2D  &stride,
+                                                const Size2D  &output_offset,
+                                                const Size2D  &input_offset)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), stride, output_offset, input_offset));
+
+    _input         = input;
+    _output        = output;
+    _stride        = stride;
+    _output_offset = output_offset;
+    _input_offset  = input_offset;
+
+    const DataLayout data_layout = input->info()->data_layout();
+    const size_t     idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     size_x      = phase_size(output->info()->dimension(idx_w), stride.x(), output_offset.x());
+    const size_t     size_y      = phase_size(output->info()->dimension(idx_h), stride.y(), output_offset.y());
+
+    // Configure kernel window over the elements of the phase, each row along the X dimension is copied at once
+    Window win = calculate_max_window(*input->info(), Steps());
+    win.set(idx_w, Window::Dimension(input_offset.x(), input_offset.x() + size_x));
+    win.set(idx_h, Window::Dimension(input_offset.y(), input_offset.y() + size_y));
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // The NEDeconvolutionInterleaveKernel doesn't need padding so update_window_and_padding() can be skipped
+
+    ICPPKernel::configure(win);
+}
+
+Status NEDeconvolutionInterleaveKernel::validate(const ITensorInfo *input,
+                                                 const ITensorInfo *output,
+                                                 const Size2D      &stride,
+                                                 const Size2D      &output_offset,
+                                                 const Size2D      &input_offset)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, stride, output_offset, input_offset));
+    return Status{};
+}
+
+void NEDeconvolutionInterleaveKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICPPKernel::window(), window);
+
+    const DataLayout data_layout  = _input->info()->data_layout();
+    const size_t     idx_w        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_h        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     element_size = _input->info()->element_size();
+    const bool       is_nchw      = data_layout == DataLayout::NCHW;
+
+    // In NCHW each row holds the phase elements along the width, in NHWC all the channels of a single element
+    const size_t row_size =
+        is_nchw ? phase_size(_output->info()->dimension(idx_w), _stride.x(), _output_offset.x())
+                : _input->info()->dimension(Window::DimX);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            Coordinates in_id  = id;
+            Coordinates out_id = id;
+            if (is_nchw)
+            {
+                in_id.set(idx_w, _input_offset.x());
+                out_id.set(idx_w, _output_offset.x());
+            }
+            else
+            {
+                out_id.set(idx_w, _output_offset.x() + (id[idx_w] - _input_offset.x()) * _stride.x());
+            }
+            out_id.set(idx_h, _output_offset.y() + (id[idx_h] - _input_offset.y()) * _stride.y());
+
+            const uint8_t *src = _input->buffer() + _input->info()->offset_element_in_bytes(in_id);
+            uint8_t       *dst = _output->buffer() + _output->info()->offset_element_in_bytes(out_id);
+            if (!is_nchw)
+            {
+                std::memcpy(dst, src, row_size * element_size);
+                return;
+            }
+
+            switch (element_size)
+            {
+                case 1:
+                    scatter_row<uint8_t>(src, dst, row_size, _stride.x());
+                    break;
+                case 2:
+                    scatter_row<uint16_t>(src, dst, row_size, _stride.x());
+                    break;
+                case 4:
+                    scatter_row<uint32_t>(src, dst, row_size, _stride.x());
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Element size not supported");
+                    break;
+            }
+        });
+}
+} // namespace arm_compute
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEDECONVOLUTIONINTERLEAVEKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEDECONVOLUTIONINTERLEAVEKERNEL_H
+
+#include "arm_compute/core/Size2D.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Kernel to write the result of a deconvolution stride phase into the deconvolution output
+ *
+ * The phase element (input_offset.x() + x, input_offset.y() + y) is written to the output element
+ * (output_offset.x() + x * stride.x(), output_offset.y() + y * stride.y()) for every output element that
+ * belongs to the phase. The remaining output elements are left untouched.
+ */
+class NEDeconvolutionInterleaveKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDeconvolutionInterleaveKernel";
+    }
+    /** Default constructor */
+    NEDeconvolutionInterleaveKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionInterleaveKernel(const NEDeconvolutionInterleaveKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionInterleaveKernel &operator=(const NEDeconvolutionInterleaveKernel &) = delete;
+    /** Default Move Constructor. */
+    NEDeconvolutionInterleaveKernel(NEDeconvolutionInterleaveKernel &&) = default;
+    /** Default move assignment operator */
+    NEDeconvolutionInterleaveKernel &operator=(NEDeconvolutionInterleaveKernel &&) = default;
+    /** Default destructor */
+    ~NEDeconvolutionInterleaveKernel() = default;
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input         Output of the phase sub-convolution. Data type supported: All
+     * @param[out] output        Deconvolution output. Data type supported: Same as @p input
+     * @param[in]  stride        Deconvolution stride
+     * @param[in]  output_offset Position of the first element of the phase in @p output. Must be smaller than @p stride
+     * @param[in]  input_offset  Position of the first element of the phase in @p input
+     */
+    void configure(const ITensor *input,
+                   ITensor       *output,
+                   const Size2D  &stride,
+                   const Size2D  &output_offset,
+                   const Size2D  &input_offset);
+
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref NEDeconvolutionInterleaveKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *output,
+                           const Size2D      &stride,
+                           const Size2D      &output_offset,
+                           const Size2D      &input_offset);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    Size2D         _stride;
+    Size2D         _output_offset;
+    Size2D         _input_offset;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEDECONVOLUTIONINTERLEAVEKERNEL_H
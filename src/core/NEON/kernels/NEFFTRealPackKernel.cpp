@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTRealPackKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/wrapper/traits.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+// PI constant (from cmath)
+constexpr float kPi = float(M_PI);
+
+float32x2_t c_mul_neon(float32x2_t a, float32x2_t b)
+{
+    using ExactTagType = typename wrapper::traits::neon_vector<float, 2>::tag_type;
+
+    const float32x2_t mask = {-1.0, 1.0};
+    const float32x2_t tmp0 = wrapper::vdup_n(wrapper::vgetlane(a, 0), ExactTagType{});
+    const float32x2_t tmp1 = wrapper::vdup_n(wrapper::vgetlane(a, 1), ExactTagType{});
+
+    float32x2_t res = wrapper::vmul(tmp0, b);
+
+    b   = wrapper::vrev64(b);
+    b   = wrapper::vmul(b, mask);
+    res = wrapper::vmla(res, tmp1, b);
+
+    return res;
+}
+
+float32x2_t c_mul_neon_img(float32x2_t a)
+{
+    return wrapper::vmul(wrapper::vrev64(a), float32x2_t{-1.0f, 1.0f});
+}
+
+float32x2_t c_conj_neon(float32x2_t a)
+{
+    return wrapper::vmul(a, float32x2_t{1.0f, -1.0f});
+}
+
+void pack_real_pairs(const float *in, float *out, const unsigned int *idx, unsigned int M)
+{
+    // z[n] = x[2n] + i * x[2n + 1], so every complex value is a pair of consecutive real values
+    for (unsigned int x = 0; x < M; ++x)
+    {
+        wrapper::vstore(out + 2 * x, wrapper::vload(in + 2 * idx[x]));
+    }
+}
+
+void pack_half_spectrum(const float *in, float *out, const unsigned int *idx, const float *twiddles, unsigned int M)
+{
+    const float32x2_t half = {0.5f, 0.5f};
+
+    for (unsigned int x = 0; x < M; ++x)
+    {
+        const unsigned int k = idx[x];
+        const float32x2_t  a = wrapper::vload(in + 2 * k);
+        const float32x2_t  b = c_conj_neon(wrapper::vload(in + 2 * (M - k)));
+
+        // Spectra of the even and odd samples: Fe[k] = (X[k] + X*[M - k]) / 2, Fo[k] = (X[k] - X*[M - k]) * W^-k / 2
+        const float32x2_t fe = wrapper::vmul(wrapper::vadd(a, b), half);
+        const float32x2_t fo = c_mul_neon(wrapper::vmul(wrapper::vsub(a, b), half), wrapper::vload(twiddles + 2 * k));
+
+        // Store the conjugate of Z[k] = Fe[k] + i * Fo[k], as the radix stages only compute forward transforms
+        wrapper::vstore(out + 2 * x, c_conj_neon(wrapper::vadd(fe, c_mul_neon_img(fo))));
+    }
+}
+
+TensorShape compute_packed_shape(const ITensorInfo &input, const FFTRealKernelInfo &config)
+{
+    const size_t dim_x = input.dimension(0);
+
+    TensorShape packed_shape = input.tensor_shape();
+    packed_shape.set(0, config.inverse ? dim_x - 1 : dim_x / 2);
+    return packed_shape;
+}
+
+Status validate_arguments(const ITensorInfo       *input,
+                          const ITensorInfo       *output,
+                          const ITensorInfo       *idx,
+                          const FFTRealKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output, idx);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, config.inverse ? 2 : 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(idx, 1, DataType::U32);
+    ARM_COMPUTE_RETURN_ERROR_ON(!config.inverse && (input->dimension(0) % 2) != 0);
+
+    const TensorShape packed_shape = compute_packed_shape(*input, config);
+    ARM_COMPUTE_RETURN_ERROR_ON(packed_shape.x() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(idx->tensor_shape().x() != packed_shape.x());
+    ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(input, idx);
+
+    // Checks performed when output is configured
+    if (output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), packed_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window>
+validate_and_configure_window(const ITensorInfo *input, ITensorInfo *output, const FFTRealKernelInfo &config)
+{
+    auto_init_if_empty(*output,
+                       input->clone()->set_tensor_shape(compute_packed_shape(*input, config)).set_num_channels(2));
+
+    // Each row is processed as a whole
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEFFTRealPackKernel::NEFFTRealPackKernel()
+    : _input(nullptr), _output(nullptr), _idx(nullptr), _twiddles(), _inverse(false)
+{
+}
+
+void NEFFTRealPackKernel::configure(const ITensor           *input,
+                                    ITensor                 *output,
+                                    const ITensor           *idx,
+                                    const FFTRealKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, idx);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), idx->info(), config));
+
+    _input   = input;
+    _output  = output;
+    _idx     = idx;
+    _inverse = config.inverse;
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), config);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+
+    // Precompute the twiddle factors W^-k = exp(2 * pi * i * k / N) used to rebuild the odd spectrum
+    if (_inverse)
+    {
+        const unsigned int M = output->info()->dimension(0);
+        _twiddles.resize(2 * M);
+        for (unsigned int k = 0; k < M; ++k)
+        {
+            const float alpha    = kPi * float(k) / float(M);
+            _twiddles[2 * k]     = std::cos(alpha);
+            _twiddles[2 * k + 1] = std::sin(alpha);
+        }
+    }
+}
+
+Status NEFFTRealPackKernel::validate(const ITensorInfo       *input,
+                                     const ITensorInfo       *output,
+                                     const ITensorInfo       *idx,
+                                     const FFTRealKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, idx, config));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input, output->clone().get(), config).first);
+    return Status{};
+}
+
+void NEFFTRealPackKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const unsigned int  M   = _output->info()->dimension(0);
+    const unsigned int *idx = reinterpret_cast<const unsigned int *>(_idx->buffer());
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    if (_inverse)
+    {
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                pack_half_spectrum(reinterpret_cast<const float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()), idx,
+                                   _twiddles.data(), M);
+            },
+            in, out);
+    }
+    else
+    {
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                pack_real_pairs(reinterpret_cast<const float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()), idx,
+                                M);
+            },
+            in, out);
+    }
+}
+} // namespace arm_compute
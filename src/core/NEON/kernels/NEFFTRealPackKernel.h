@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEFFTREALPACKKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEFFTREALPACKKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Kernel preparing the input of a half-length complex FFT used to compute a real FFT along the X axis.
+ *
+ * A real sequence x of length N = 2M is transformed as the complex sequence z[n] = x[2n] + i * x[2n + 1] of length M:
+ *
+ * -# Forward (real-to-complex): packs pairs of consecutive real values into complex values.
+ * -# Inverse (complex-to-real): rebuilds Z[k] = Fe[k] + i * Fo[k] from the half spectrum X[0..M] using the
+ *    Hermitian symmetry of X, where Fe and Fo are the spectra of the even and odd samples of x, and conjugates
+ *    it so that the inverse transform can be computed by the forward radix stages.
+ *
+ * In both cases the result is stored in digit reverse order, so no separate @ref NEFFTDigitReverseKernel pass
+ * is needed.
+ */
+class NEFFTRealPackKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTRealPackKernel";
+    }
+    /** Constructor */
+    NEFFTRealPackKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealPackKernel(const NEFFTRealPackKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealPackKernel &operator=(const NEFFTRealPackKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTRealPackKernel(NEFFTRealPackKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTRealPackKernel &operator=(NEFFTRealPackKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTRealPackKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32.
+     *                    Forward: real tensor with an even length N along X. Inverse: complex tensor with length N / 2 + 1 along X.
+     * @param[out] output Destination tensor with length N / 2 along X. Data type supported: same as @p input.
+     *                    Number of channels supported: 2 (complex tensor).
+     * @param[in]  idx    Digit reverse index tensor of length N / 2. Data type supported: U32
+     * @param[in]  config Kernel configuration.
+     */
+    void configure(const ITensor *input, ITensor *output, const ITensor *idx, const FFTRealKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTRealPackKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32.
+     * @param[in] output Destination tensor info. Data type supported: same as @p input.
+     * @param[in] idx    Digit reverse index tensor info. Data type supported: U32
+     * @param[in] config Kernel configuration
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo       *input,
+                           const ITensorInfo       *output,
+                           const ITensorInfo       *idx,
+                           const FFTRealKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor     *_input;
+    ITensor           *_output;
+    const ITensor     *_idx;
+    std::vector<float> _twiddles;
+    bool               _inverse;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEFFTREALPACKKERNEL_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTRealUnpackKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/wrapper/traits.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+// PI constant (from cmath)
+constexpr float kPi = float(M_PI);
+
+float32x2_t c_mul_neon(float32x2_t a, float32x2_t b)
+{
+    using ExactTagType = typename wrapper::traits::neon_vector<float, 2>::tag_type;
+
+    const float32x2_t mask = {-1.0, 1.0};
+    const float32x2_t tmp0 = wrapper::vdup_n(wrapper::vgetlane(a, 0), ExactTagType{});
+    const float32x2_t tmp1 = wrapper::vdup_n(wrapper::vgetlane(a, 1), ExactTagType{});
+
+    float32x2_t res = wrapper::vmul(tmp0, b);
+
+    b   = wrapper::vrev64(b);
+    b   = wrapper::vmul(b, mask);
+    res = wrapper::vmla(res, tmp1, b);
+
+    return res;
+}
+
+float32x2_t c_mul_neon_img(float32x2_t a)
+{
+    return wrapper::vmul(wrapper::vrev64(a), float32x2_t{-1.0f, 1.0f});
+}
+
+float32x2_t c_conj_neon(float32x2_t a)
+{
+    return wrapper::vmul(a, float32x2_t{1.0f, -1.0f});
+}
+
+void unpack_half_spectrum(const float *in, float *out, const float *twiddles, unsigned int M)
+{
+    const float32x2_t half = {0.5f, 0.5f};
+
+    for (unsigned int k = 0; k <= M; ++k)
+    {
+        // Z is periodic with period M
+        const float32x2_t a = wrapper::vload(in + 2 * (k == M ? 0 : k));
+        const float32x2_t b = c_conj_neon(wrapper::vload(in + 2 * (k == 0 ? 0 : M - k)));
+
+        // Spectra of the even and odd samples: Fe[k] = (Z[k] + Z*[M - k]) / 2, Fo[k] = (Z[k] - Z*[M - k]) / 2i
+        const float32x2_t fe = wrapper::vmul(wrapper::vadd(a, b), half);
+        const float32x2_t fo = c_mul_neon_img(wrapper::vmul(wrapper::vsub(b, a), half));
+
+        // X[k] = Fe[k] + W^k * Fo[k]
+        wrapper::vstore(out + 2 * k, wrapper::vadd(fe, c_mul_neon(fo, wrapper::vload(twiddles + 2 * k))));
+    }
+}
+
+void unpack_real_pairs(const float *in, float *out, unsigned int M)
+{
+    // x[2n] + i * x[2n + 1] = conj(z[n]) / M
+    const float       scale  = 1.0f / float(M);
+    const float32x4_t vscale = {scale, -scale, scale, -scale};
+
+    unsigned int x = 0;
+    for (; x + 2 <= M; x += 2)
+    {
+        wrapper::vstore(out + 2 * x, wrapper::vmul(wrapper::vloadq(in + 2 * x), vscale));
+    }
+    for (; x < M; ++x)
+    {
+        out[2 * x]     = in[2 * x] * scale;
+        out[2 * x + 1] = -in[2 * x + 1] * scale;
+    }
+}
+
+TensorShape compute_unpacked_shape(const ITensorInfo &input, const FFTRealKernelInfo &config)
+{
+    const size_t dim_x = input.dimension(0);
+
+    TensorShape unpacked_shape = input.tensor_shape();
+    unpacked_shape.set(0, config.inverse ? 2 * dim_x : dim_x + 1);
+    return unpacked_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTRealKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(input);
+
+    // Checks performed when output is configured
+    if (output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != (config.inverse ? 1 : 2));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                           compute_unpacked_shape(*input, config));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window>
+validate_and_configure_window(const ITensorInfo *input, ITensorInfo *output, const FFTRealKernelInfo &config)
+{
+    auto_init_if_empty(*output, input->clone()
+                                    ->set_tensor_shape(compute_unpacked_shape(*input, config))
+                                    .set_num_channels(config.inverse ? 1 : 2));
+
+    // Each row is processed as a whole
+    Window win = calculate_max_window(*input, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEFFTRealUnpackKernel::NEFFTRealUnpackKernel() : _input(nullptr), _output(nullptr), _twiddles(), _inverse(false)
+{
+}
+
+void NEFFTRealUnpackKernel::configure(const ITensor *input, ITensor *output, const FFTRealKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), config));
+
+    _input   = input;
+    _output  = output;
+    _inverse = config.inverse;
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), config);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+
+    // Precompute the twiddle factors W^k = exp(-2 * pi * i * k / N) used to combine the even and odd spectra
+    if (!_inverse)
+    {
+        const unsigned int M = input->info()->dimension(0);
+        _twiddles.resize(2 * (M + 1));
+        for (unsigned int k = 0; k <= M; ++k)
+        {
+            const float alpha    = kPi * float(k) / float(M);
+            _twiddles[2 * k]     = std::cos(alpha);
+            _twiddles[2 * k + 1] = -std::sin(alpha);
+        }
+    }
+}
+
+Status NEFFTRealUnpackKernel::validate(const ITensorInfo       *input,
+                                       const ITensorInfo       *output,
+                                       const FFTRealKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input, output->clone().get(), config).first);
+    return Status{};
+}
+
+void NEFFTRealUnpackKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const unsigned int M = _input->info()->dimension(0);
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    if (_inverse)
+    {
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            { unpack_real_pairs(reinterpret_cast<const float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()), M); },
+            in, out);
+    }
+    else
+    {
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                unpack_half_spectrum(reinterpret_cast<const float *>(in.ptr()), reinterpret_cast<float *>(out.ptr()),
+                                     _twiddles.data(), M);
+            },
+            in, out);
+    }
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, 2025 Arm Limited.
+ * Copyright (c) 2019-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/Utils.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 
@@ -230,9 +231,9 @@ void NEPadLayerKernel::configure(ITensor           *input,
         switch (_input->info()->element_size())
         {
             case 1:
-                if (_input->info()->num_dimensions() == 3 &&                           // Is 3D
-                    padding.size() <= 3 &&                                             // Has 3D padding
-                    !_input->info()->has_padding() && !_output->info()->has_padding()) // Input & Output have no padding
+                if (_input->info()->num_dimensions() == 3 &&                       // Is 3D
+                    padding.size() <= 3 &&                                         // Has 3D padding
+                    !has_holes(*_input->info()) && !has_holes(*_output->info()))   // Input & Output are dense
                 {
                     _func = &NEPadLayerKernel::run_pad_constant_uint8_3Dinput_3Dpad;
                 }
@@ -29,6 +29,10 @@
 
 #ifdef __aarch64__
 #ifdef ARM_COMPUTE_ENABLE_BF16
+#include "kernels/a64_interleaved_bf16fp32_mmla_8x12.hpp"
+#ifdef ARM_COMPUTE_ENABLE_SVE
+#include "kernels/sve_interleaved_bf16fp32_mmla_8x3VL.hpp"
+#endif // ARM_COMPUTE_ENABLE_SVE
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
 #include "kernels/a64_ffinterleaved_bf16fp32_mmla_8x12.hpp"
 #ifdef ARM_COMPUTE_ENABLE_SVE
@@ -62,6 +66,20 @@ GemmImplementation<bfloat16, bfloat16, bfloat16>::with_estimate(
 ),
 #endif // ARM_COMPUTE_ENABLE_SVE
 #endif // ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
+#ifdef ARM_COMPUTE_ENABLE_SVE
+GemmImplementation<bfloat16, bfloat16, bfloat16>::with_estimate(
+    "sve_interleaved_bf16fp32_mmla_8x3VL",
+    [](const GemmArgs &args) { return args._ci->has_svebf16() && (args._Ksize>4) && !args._accumulate; },
+    [](const GemmArgs &args) { return GemmInterleaved<cls_sve_interleaved_bf16fp32_mmla_8x3VL, bfloat16, bfloat16, bfloat16>::estimate_cycles<bfloat16>(args); },
+    [](const GemmArgs &args) { return new GemmInterleaved<cls_sve_interleaved_bf16fp32_mmla_8x3VL, bfloat16, bfloat16, bfloat16>(args); }
+),
+#endif // ARM_COMPUTE_ENABLE_SVE
+GemmImplementation<bfloat16, bfloat16, bfloat16>::with_estimate(
+    "a64_interleaved_bf16fp32_mmla_8x12",
+    [](const GemmArgs &args) { return args._ci->has_bf16() && (args._Ksize>4) && !args._accumulate; },
+    [](const GemmArgs &args) { return GemmInterleaved<cls_a64_interleaved_bf16fp32_mmla_8x12, bfloat16, bfloat16, bfloat16>::estimate_cycles<bfloat16>(args); },
+    [](const GemmArgs &args) { return new GemmInterleaved<cls_a64_interleaved_bf16fp32_mmla_8x12, bfloat16, bfloat16, bfloat16>(args); }
+),
 #endif // ARM_COMPUTE_ENABLE_BF16
 #endif // __aarch64__
 {
@@ -23,7 +23,7 @@
  */
 #pragma once
 
-#if defined(ARM_COMPUTE_ENABLE_BF16) && defined(ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS) && defined(__aarch64__)
+#if defined(ARM_COMPUTE_ENABLE_BF16) && defined(__aarch64__)
 template<>
 void MergeResults<12, 8, false>(
     bfloat16 *out_ptr,
@@ -2803,5 +2803,5 @@ void MergeResults<12, 8, false>(
     );
 }
 
-#endif // defined(ARM_COMPUTE_ENABLE_BF16) && defined(ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS) && defined(__aarch64__)
+#endif // defined(ARM_COMPUTE_ENABLE_BF16) && defined(__aarch64__)
 
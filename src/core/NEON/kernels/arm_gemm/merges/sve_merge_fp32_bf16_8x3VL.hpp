@@ -23,7 +23,7 @@
  */
 #pragma once
 
-#if defined(ARM_COMPUTE_ENABLE_BF16) && defined(ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__aarch64__)
+#if defined(ARM_COMPUTE_ENABLE_BF16) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__aarch64__)
 template<>
 void MergeResults<3, 8, true>(
     bfloat16 *out_ptr,
@@ -2132,5 +2132,5 @@ void MergeResults<3, 8, true>(
     );
 }
 
-#endif // defined(ARM_COMPUTE_ENABLE_BF16) && defined(ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__aarch64__)
+#endif // defined(ARM_COMPUTE_ENABLE_BF16) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__aarch64__)
 
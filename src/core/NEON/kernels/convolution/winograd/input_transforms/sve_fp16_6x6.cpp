@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+#include <arm_sve.h>
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace input_transform {
+
+namespace {
+
+/* Apply the FP16 6-point input transform (the same scaled transform used by
+ * a64_fp16_6x6) to six vectors of channels.
+ */
+inline void sve_fp16_6x6_transform_1d(const svbool_t pg,
+                                      const svfloat16_t x0, const svfloat16_t x1, const svfloat16_t x2,
+                                      const svfloat16_t x3, const svfloat16_t x4, const svfloat16_t x5,
+                                      svfloat16_t &u0, svfloat16_t &u1, svfloat16_t &u2,
+                                      svfloat16_t &u3, svfloat16_t &u4, svfloat16_t &u5)
+{
+  // u0 = (1/8)*(x0 + x4) + (3/16)*(x1 - x3) - (1/4)*x2
+  u0 = svmla_n_f16_x(pg, svmul_n_f16_x(pg, svadd_f16_x(pg, x0, x4), 1.0f / 8.0f), svsub_f16_x(pg, x1, x3), 3.0f / 16.0f);
+  u0 = svmls_n_f16_x(pg, u0, x2, 1.0f / 4.0f);
+
+  // u1 = (1/8)*(x1 + x4) + (1/16)*x2 - (5/16)*x3
+  u1 = svmla_n_f16_x(pg, svmul_n_f16_x(pg, svadd_f16_x(pg, x1, x4), 1.0f / 8.0f), x2, 1.0f / 16.0f);
+  u1 = svmls_n_f16_x(pg, u1, x3, 5.0f / 16.0f);
+
+  // u2 = (1/8)*(x4 - x1) - (5/16)*x2 - (1/16)*x3
+  u2 = svmls_n_f16_x(pg, svmul_n_f16_x(pg, svsub_f16_x(pg, x4, x1), 1.0f / 8.0f), x2, 5.0f / 16.0f);
+  u2 = svmls_n_f16_x(pg, u2, x3, 1.0f / 16.0f);
+
+  // u3 = (1/4)*(x1 - x3) + (1/8)*(x4 - x2)
+  u3 = svmla_n_f16_x(pg, svmul_n_f16_x(pg, svsub_f16_x(pg, x1, x3), 1.0f / 4.0f), svsub_f16_x(pg, x4, x2), 1.0f / 8.0f);
+
+  // u4 = (1/8)*(x3 - x1) + (1/4)*(x4 - x2)
+  u4 = svmla_n_f16_x(pg, svmul_n_f16_x(pg, svsub_f16_x(pg, x3, x1), 1.0f / 8.0f), svsub_f16_x(pg, x4, x2), 1.0f / 4.0f);
+
+  // u5 = (1/8)*(x1 + x5) + (3/16)*(x2 - x4) - (1/4)*x3
+  u5 = svmla_n_f16_x(pg, svmul_n_f16_x(pg, svadd_f16_x(pg, x1, x5), 1.0f / 8.0f), svsub_f16_x(pg, x2, x4), 3.0f / 16.0f);
+  u5 = svmls_n_f16_x(pg, u5, x3, 1.0f / 4.0f);
+}
+
+/* Store one column of the transformed tile. */
+inline void sve_fp16_6x6_store_column(const svbool_t pg, __fp16 *outptr, const size_t matrix_stride, const int j,
+                                      const svfloat16_t u0, const svfloat16_t u1, const svfloat16_t u2,
+                                      const svfloat16_t u3, const svfloat16_t u4, const svfloat16_t u5)
+{
+  svst1_f16(pg, outptr + (0 * 6 + j) * matrix_stride, u0);
+  svst1_f16(pg, outptr + (1 * 6 + j) * matrix_stride, u1);
+  svst1_f16(pg, outptr + (2 * 6 + j) * matrix_stride, u2);
+  svst1_f16(pg, outptr + (3 * 6 + j) * matrix_stride, u3);
+  svst1_f16(pg, outptr + (4 * 6 + j) * matrix_stride, u4);
+  svst1_f16(pg, outptr + (5 * 6 + j) * matrix_stride, u5);
+}
+
+}  // namespace
+
+void sve_fp16_6x6(
+  const unsigned int n_channels,
+  const __fp16 *input_base,
+  const size_t input_row_stride,
+  const size_t input_col_stride,
+  __fp16 *outptr,
+  const size_t matrix_stride
+)
+{
+  constexpr int inner_tile_rows = 6, inner_tile_cols = 6;
+
+  // Get pointers into the input tile
+  const __fp16 *x_ptrs[inner_tile_rows][inner_tile_cols];
+  for (int i = 0; i < inner_tile_rows; i++)
+  {
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      x_ptrs[i][j] = input_base + i * input_row_stride + j * input_col_stride;
+    }
+  }
+
+  // Predicated loads and stores remove the need for the 4-wide and scalar
+  // tails of the NEON implementation.
+  const unsigned int vl = svcnth();
+  for (unsigned int c = 0; c < n_channels; c += vl)
+  {
+    const svbool_t pg = svwhilelt_b16(c, n_channels);
+
+    // Compute x . X, one row of the input tile at a time
+    svfloat16_t t00, t01, t02, t03, t04, t05;
+    svfloat16_t t10, t11, t12, t13, t14, t15;
+    svfloat16_t t20, t21, t22, t23, t24, t25;
+    svfloat16_t t30, t31, t32, t33, t34, t35;
+    svfloat16_t t40, t41, t42, t43, t44, t45;
+    svfloat16_t t50, t51, t52, t53, t54, t55;
+    sve_fp16_6x6_transform_1d(pg,
+                              svld1_f16(pg, x_ptrs[0][0] + c), svld1_f16(pg, x_ptrs[0][1] + c), svld1_f16(pg, x_ptrs[0][2] + c),
+                              svld1_f16(pg, x_ptrs[0][3] + c), svld1_f16(pg, x_ptrs[0][4] + c), svld1_f16(pg, x_ptrs[0][5] + c),
+                              t00, t01, t02, t03, t04, t05);
+    sve_fp16_6x6_transform_1d(pg,
+                              svld1_f16(pg, x_ptrs[1][0] + c), svld1_f16(pg, x_ptrs[1][1] + c), svld1_f16(pg, x_ptrs[1][2] + c),
+                              svld1_f16(pg, x_ptrs[1][3] + c), svld1_f16(pg, x_ptrs[1][4] + c), svld1_f16(pg, x_ptrs[1][5] + c),
+                              t10, t11, t12, t13, t14, t15);
+    sve_fp16_6x6_transform_1d(pg,
+                              svld1_f16(pg, x_ptrs[2][0] + c), svld1_f16(pg, x_ptrs[2][1] + c), svld1_f16(pg, x_ptrs[2][2] + c),
+                              svld1_f16(pg, x_ptrs[2][3] + c), svld1_f16(pg, x_ptrs[2][4] + c), svld1_f16(pg, x_ptrs[2][5] + c),
+                              t20, t21, t22, t23, t24, t25);
+    sve_fp16_6x6_transform_1d(pg,
+                              svld1_f16(pg, x_ptrs[3][0] + c), svld1_f16(pg, x_ptrs[3][1] + c), svld1_f16(pg, x_ptrs[3][2] + c),
+                              svld1_f16(pg, x_ptrs[3][3] + c), svld1_f16(pg, x_ptrs[3][4] + c), svld1_f16(pg, x_ptrs[3][5] + c),
+                              t30, t31, t32, t33, t34, t35);
+    sve_fp16_6x6_transform_1d(pg,
+                              svld1_f16(pg, x_ptrs[4][0] + c), svld1_f16(pg, x_ptrs[4][1] + c), svld1_f16(pg, x_ptrs[4][2] + c),
+                              svld1_f16(pg, x_ptrs[4][3] + c), svld1_f16(pg, x_ptrs[4][4] + c), svld1_f16(pg, x_ptrs[4][5] + c),
+                              t40, t41, t42, t43, t44, t45);
+    sve_fp16_6x6_transform_1d(pg,
+                              svld1_f16(pg, x_ptrs[5][0] + c), svld1_f16(pg, x_ptrs[5][1] + c), svld1_f16(pg, x_ptrs[5][2] + c),
+                              svld1_f16(pg, x_ptrs[5][3] + c), svld1_f16(pg, x_ptrs[5][4] + c), svld1_f16(pg, x_ptrs[5][5] + c),
+                              t50, t51, t52, t53, t54, t55);
+
+    // Compute U = XT . (x . X), one column at a time, and store the result
+    svfloat16_t u0, u1, u2, u3, u4, u5;
+    sve_fp16_6x6_transform_1d(pg, t00, t10, t20, t30, t40, t50, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_store_column(pg, outptr + c, matrix_stride, 0, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_transform_1d(pg, t01, t11, t21, t31, t41, t51, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_store_column(pg, outptr + c, matrix_stride, 1, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_transform_1d(pg, t02, t12, t22, t32, t42, t52, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_store_column(pg, outptr + c, matrix_stride, 2, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_transform_1d(pg, t03, t13, t23, t33, t43, t53, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_store_column(pg, outptr + c, matrix_stride, 3, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_transform_1d(pg, t04, t14, t24, t34, t44, t54, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_store_column(pg, outptr + c, matrix_stride, 4, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_transform_1d(pg, t05, t15, t25, t35, t45, t55, u0, u1, u2, u3, u4, u5);
+    sve_fp16_6x6_store_column(pg, outptr + c, matrix_stride, 5, u0, u1, u2, u3, u4, u5);
+  }
+}
+
+}  // namespace input_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif // defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
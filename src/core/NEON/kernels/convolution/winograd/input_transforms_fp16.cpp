@@ -34,7 +34,12 @@ namespace arm_conv {
 namespace winograd {
 namespace input_transform {
 
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+void sve_fp16_6x6(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 void a64_fp16_6x6(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+void a64_fp16_4x4(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+void a64_fp16_1x8(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
 
 #define IMPL(HEIGHT, WIDTH, FUNC, DRIVER) new Transform ## DRIVER <__fp16, __fp16>(#FUNC, HEIGHT, WIDTH, FUNC)
 
@@ -42,7 +47,13 @@ template <>
 const TransformImplementation<__fp16> *implementation_list(void)
 {
   static const TransformImplementation<__fp16> transforms_fp16[] = {
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+    { IMPL(6, 6, sve_fp16_6x6, Unpadded), MethodConstraints::RequiresSVE },
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE)
     { IMPL(6, 6, a64_fp16_6x6, Unpadded) },
+    { IMPL(4, 4, a64_fp16_4x4, Unpadded) },
+    { IMPL(1, 8, a64_fp16_1x8, Unpadded) },
+    { new TransformUnpadded<__fp16, __fp16>("a64_fp16_1x8", 8, 1, TransformUnpadded<__fp16, __fp16>::get_transposed_kernel(a64_fp16_1x8)) },
     { nullptr },
   };
   return transforms_fp16;
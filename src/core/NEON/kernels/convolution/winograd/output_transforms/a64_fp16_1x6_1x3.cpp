@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+#include <algorithm>
+#include <cstddef>
+
+#include <arm_neon.h>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+void a64_fp16_1x6_1x3(
+  unsigned int n_channels,
+  const __fp16* inptr,
+  const size_t matrix_stride,
+  const __fp16* bptr,
+  __fp16 *outptr,
+  size_t,  // No need to stride across rows
+  const size_t output_col_stride,
+  const __fp16 output_min,
+  const __fp16 output_max
+)
+{
+  constexpr unsigned int inner_tile_cols = 8, output_tile_cols = 6;
+
+  // For each channel of the output
+  for (; n_channels >= 8; n_channels -= 8)
+  {
+    // Matrices used and computed during this transform
+    float16x8_t F[inner_tile_cols], f[output_tile_cols], b = vdupq_n_f16(0.0f);
+
+    // Read a 1x8 tile in the Winograd domain
+    for (auto j = 0u; j < inner_tile_cols; j++)
+    {
+      F[j] = vld1q_f16(inptr + j*matrix_stride);
+    }
+    inptr += 8;
+
+    f[0] = vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vmulq_n_f16(F[6], 1), F[5], 1), F[4], 1), F[3], 1), F[2], 1), F[1], 1), F[0], 1);
+    f[1] = vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vmulq_n_f16(F[2], 1), F[6], 3), F[4], 2), F[3], -2), F[5], -3), F[1], -1);
+    f[2] = vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vmulq_n_f16(F[2], 1), F[1], 1), F[6], 9), F[5], 9), F[4], 4), F[3], 4);
+    f[3] = vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vmulq_n_f16(F[2], 1), F[6], 27), F[4], 8), F[3], -8), F[5], -27), F[1], -1);
+    f[4] = vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vmulq_n_f16(F[2], 1), F[1], 1), F[6], 81), F[5], 81), F[4], 16), F[3], 16);
+    f[5] = vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vfmaq_n_f16(vmulq_n_f16(F[7], 1), F[2], 1), F[6], 243), F[4], 32), F[3], -32), F[5], -243), F[1], -1);
+
+    // Write out the output tile
+    if (bptr != 0)
+    {
+      b = vld1q_f16(bptr);
+      bptr += 8;
+    }
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      const auto y = vminq_f16(vmaxq_f16(f[j] + b, vdupq_n_f16(output_min)),
+                               vdupq_n_f16(output_max));
+      vst1q_f16(outptr + j*output_col_stride, y);
+    }
+    outptr += 8;
+  }
+  for (; n_channels >= 4; n_channels -= 4)
+  {
+    // Matrices used and computed during this transform
+    float16x4_t F[inner_tile_cols], f[output_tile_cols], b = vdup_n_f16(0.0f);
+
+    // Read a 1x8 tile in the Winograd domain
+    for (auto j = 0u; j < inner_tile_cols; j++)
+    {
+      F[j] = vld1_f16(inptr + j*matrix_stride);
+    }
+    inptr += 4;
+
+    f[0] = vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vmul_n_f16(F[6], 1), F[5], 1), F[4], 1), F[3], 1), F[2], 1), F[1], 1), F[0], 1);
+    f[1] = vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vmul_n_f16(F[2], 1), F[6], 3), F[4], 2), F[3], -2), F[5], -3), F[1], -1);
+    f[2] = vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vmul_n_f16(F[2], 1), F[1], 1), F[6], 9), F[5], 9), F[4], 4), F[3], 4);
+    f[3] = vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vmul_n_f16(F[2], 1), F[6], 27), F[4], 8), F[3], -8), F[5], -27), F[1], -1);
+    f[4] = vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vmul_n_f16(F[2], 1), F[1], 1), F[6], 81), F[5], 81), F[4], 16), F[3], 16);
+    f[5] = vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vfma_n_f16(vmul_n_f16(F[7], 1), F[2], 1), F[6], 243), F[4], 32), F[3], -32), F[5], -243), F[1], -1);
+
+    // Write out the output tile
+    if (bptr != 0)
+    {
+      b = vld1_f16(bptr);
+      bptr += 4;
+    }
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      const auto y = vmin_f16(vmax_f16(f[j] + b, vdup_n_f16(output_min)),
+                              vdup_n_f16(output_max));
+      vst1_f16(outptr + j*output_col_stride, y);
+    }
+    outptr += 4;
+  }
+  for (; n_channels; n_channels--)
+  {
+    // Matrices used and computed during this transform
+    __fp16 F[inner_tile_cols], f[output_tile_cols], b = 0.0f;
+
+    // Read a 1x8 tile in the Winograd domain
+    for (auto j = 0u; j < inner_tile_cols; j++)
+    {
+      F[j] = *(inptr + j*matrix_stride);
+    }
+    inptr++;
+
+    f[0] = F[0]*1 + F[1]*1 + F[2]*1 + F[3]*1 + F[4]*1 + F[5]*1 + F[6]*1;
+    f[1] = F[1]*-1 + F[5]*-3 + F[3]*-2 + F[4]*2 + F[6]*3 + F[2]*1;
+    f[2] = F[3]*4 + F[4]*4 + F[5]*9 + F[6]*9 + F[1]*1 + F[2]*1;
+    f[3] = F[1]*-1 + F[5]*-27 + F[3]*-8 + F[4]*8 + F[6]*27 + F[2]*1;
+    f[4] = F[3]*16 + F[4]*16 + F[5]*81 + F[6]*81 + F[1]*1 + F[2]*1;
+    f[5] = F[1]*-1 + F[5]*-243 + F[3]*-32 + F[4]*32 + F[6]*243 + F[2]*1 + F[7]*1;
+
+    // Write out the output tile
+    if (bptr != 0)
+    {
+      b = *(bptr++);
+    }
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      *(outptr + j*output_col_stride) = std::max<__fp16>(std::min<__fp16>(f[j] + b, output_max), output_min);
+    }
+    outptr++;
+  }
+}
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif // defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+#include <arm_sve.h>
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+namespace {
+
+/* Reduce six Winograd-domain vectors to four outputs using the same scaled
+ * transform as a64_fp16_4x4_3x3.
+ */
+inline void sve_fp16_4x4_3x3_transform_1d(const svbool_t pg,
+                                          const svfloat16_t F0, const svfloat16_t F1, const svfloat16_t F2,
+                                          const svfloat16_t F3, const svfloat16_t F4, const svfloat16_t F5,
+                                          svfloat16_t &f0, svfloat16_t &f1, svfloat16_t &f2, svfloat16_t &f3)
+{
+  const float16_t scale_factor = 16.0f;
+
+  // f0 = 16 * (0.5*(F0 + F1 + F2) + F3 + 0.125*F4)
+  auto tmp = svmla_n_f16_x(pg, F3, svadd_f16_x(pg, svadd_f16_x(pg, F0, F1), F2), 1.0f / 2.0f);
+  f0       = svmul_n_f16_x(pg, svmla_n_f16_x(pg, tmp, F4, 1.0f / 8.0f), scale_factor);
+
+  // f1 = 16 * (-0.5*(F1 + F3 - F2) + 0.25*F4)
+  tmp = svmul_n_f16_x(pg, svsub_f16_x(pg, F2, svadd_f16_x(pg, F1, F3)), 1.0f / 2.0f);
+  f1  = svmul_n_f16_x(pg, svmla_n_f16_x(pg, tmp, F4, 1.0f / 4.0f), scale_factor);
+
+  // f2 = 16 * (0.5*(F1 + F2 + F4) + 0.25*F3)
+  tmp = svmul_n_f16_x(pg, svadd_f16_x(pg, svadd_f16_x(pg, F1, F2), F4), 1.0f / 2.0f);
+  f2  = svmul_n_f16_x(pg, svmla_n_f16_x(pg, tmp, F3, 1.0f / 4.0f), scale_factor);
+
+  // f3 = 16 * (0.5*(F5 + F2 - F1) + (F4 - 0.125*F3))
+  tmp = svmla_n_f16_x(pg, F4, svsub_f16_x(pg, svadd_f16_x(pg, F5, F2), F1), 1.0f / 2.0f);
+  f3  = svmul_n_f16_x(pg, svmls_n_f16_x(pg, tmp, F3, 1.0f / 8.0f), scale_factor);
+}
+
+}  // namespace
+
+void sve_fp16_4x4_3x3(unsigned int n_channels,
+        const __fp16 * inptr, size_t matrix_stride, const __fp16 * bptr, __fp16 *output,
+        size_t output_row_stride, size_t output_col_stride, __fp16 output_min, __fp16 output_max)
+{
+  constexpr int output_tile_rows = 4, output_tile_cols = 4;
+
+  // Construct a map to the output cells
+  __fp16 *outptrs[output_tile_rows][output_tile_cols];
+  for (int i = 0; i < output_tile_rows; i++)
+  {
+    for (int j = 0; j < output_tile_cols; j++)
+    {
+      outptrs[i][j] = output + i*output_row_stride + j*output_col_stride;
+    }
+  }
+
+  const svfloat16_t vmin = svdup_n_f16(output_min);
+  const svfloat16_t vmax = svdup_n_f16(output_max);
+
+  const unsigned int vl = svcnth();
+  for (unsigned int c = 0; c < n_channels; c += vl)
+  {
+    const svbool_t pg = svwhilelt_b16(c, n_channels);
+    const __fp16 *F = inptr + c;
+
+    // Compute F Z, one row of the Winograd-domain tile at a time
+    svfloat16_t z00, z01, z02, z03;
+    svfloat16_t z10, z11, z12, z13;
+    svfloat16_t z20, z21, z22, z23;
+    svfloat16_t z30, z31, z32, z33;
+    svfloat16_t z40, z41, z42, z43;
+    svfloat16_t z50, z51, z52, z53;
+    sve_fp16_4x4_3x3_transform_1d(pg,
+                                  svld1_f16(pg, F + 0 * matrix_stride), svld1_f16(pg, F + 1 * matrix_stride), svld1_f16(pg, F + 2 * matrix_stride),
+                                  svld1_f16(pg, F + 3 * matrix_stride), svld1_f16(pg, F + 4 * matrix_stride), svld1_f16(pg, F + 5 * matrix_stride),
+                                  z00, z01, z02, z03);
+    sve_fp16_4x4_3x3_transform_1d(pg,
+                                  svld1_f16(pg, F + 6 * matrix_stride), svld1_f16(pg, F + 7 * matrix_stride), svld1_f16(pg, F + 8 * matrix_stride),
+                                  svld1_f16(pg, F + 9 * matrix_stride), svld1_f16(pg, F + 10 * matrix_stride), svld1_f16(pg, F + 11 * matrix_stride),
+                                  z10, z11, z12, z13);
+    sve_fp16_4x4_3x3_transform_1d(pg,
+                                  svld1_f16(pg, F + 12 * matrix_stride), svld1_f16(pg, F + 13 * matrix_stride), svld1_f16(pg, F + 14 * matrix_stride),
+                                  svld1_f16(pg, F + 15 * matrix_stride), svld1_f16(pg, F + 16 * matrix_stride), svld1_f16(pg, F + 17 * matrix_stride),
+                                  z20, z21, z22, z23);
+    sve_fp16_4x4_3x3_transform_1d(pg,
+                                  svld1_f16(pg, F + 18 * matrix_stride), svld1_f16(pg, F + 19 * matrix_stride), svld1_f16(pg, F + 20 * matrix_stride),
+                                  svld1_f16(pg, F + 21 * matrix_stride), svld1_f16(pg, F + 22 * matrix_stride), svld1_f16(pg, F + 23 * matrix_stride),
+                                  z30, z31, z32, z33);
+    sve_fp16_4x4_3x3_transform_1d(pg,
+                                  svld1_f16(pg, F + 24 * matrix_stride), svld1_f16(pg, F + 25 * matrix_stride), svld1_f16(pg, F + 26 * matrix_stride),
+                                  svld1_f16(pg, F + 27 * matrix_stride), svld1_f16(pg, F + 28 * matrix_stride), svld1_f16(pg, F + 29 * matrix_stride),
+                                  z40, z41, z42, z43);
+    sve_fp16_4x4_3x3_transform_1d(pg,
+                                  svld1_f16(pg, F + 30 * matrix_stride), svld1_f16(pg, F + 31 * matrix_stride), svld1_f16(pg, F + 32 * matrix_stride),
+                                  svld1_f16(pg, F + 33 * matrix_stride), svld1_f16(pg, F + 34 * matrix_stride), svld1_f16(pg, F + 35 * matrix_stride),
+                                  z50, z51, z52, z53);
+
+    // Load the bias vector
+    svfloat16_t b = svdup_n_f16(0.0f);
+    if (bptr != nullptr)
+    {
+      b = svld1_f16(pg, bptr + c);
+    }
+
+    // Compute the output tile f = ZT F Z, one column at a time, and write it out
+    svfloat16_t f0, f1, f2, f3;
+    sve_fp16_4x4_3x3_transform_1d(pg, z00, z10, z20, z30, z40, z50, f0, f1, f2, f3);
+    svst1_f16(pg, outptrs[0][0] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f0, b), vmax), vmin));
+    svst1_f16(pg, outptrs[1][0] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f1, b), vmax), vmin));
+    svst1_f16(pg, outptrs[2][0] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f2, b), vmax), vmin));
+    svst1_f16(pg, outptrs[3][0] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f3, b), vmax), vmin));
+    sve_fp16_4x4_3x3_transform_1d(pg, z01, z11, z21, z31, z41, z51, f0, f1, f2, f3);
+    svst1_f16(pg, outptrs[0][1] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f0, b), vmax), vmin));
+    svst1_f16(pg, outptrs[1][1] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f1, b), vmax), vmin));
+    svst1_f16(pg, outptrs[2][1] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f2, b), vmax), vmin));
+    svst1_f16(pg, outptrs[3][1] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f3, b), vmax), vmin));
+    sve_fp16_4x4_3x3_transform_1d(pg, z02, z12, z22, z32, z42, z52, f0, f1, f2, f3);
+    svst1_f16(pg, outptrs[0][2] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f0, b), vmax), vmin));
+    svst1_f16(pg, outptrs[1][2] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f1, b), vmax), vmin));
+    svst1_f16(pg, outptrs[2][2] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f2, b), vmax), vmin));
+    svst1_f16(pg, outptrs[3][2] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f3, b), vmax), vmin));
+    sve_fp16_4x4_3x3_transform_1d(pg, z03, z13, z23, z33, z43, z53, f0, f1, f2, f3);
+    svst1_f16(pg, outptrs[0][3] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f0, b), vmax), vmin));
+    svst1_f16(pg, outptrs[1][3] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f1, b), vmax), vmin));
+    svst1_f16(pg, outptrs[2][3] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f2, b), vmax), vmin));
+    svst1_f16(pg, outptrs[3][3] + c, svmax_f16_x(pg, svmin_f16_x(pg, svadd_f16_x(pg, f3, b), vmax), vmin));
+  }
+}
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif // defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
@@ -31,17 +31,38 @@ namespace arm_conv {
 namespace winograd {
 namespace output_transform {
 
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+void sve_fp16_4x4_3x3(unsigned int, const __fp16 *, size_t, const __fp16 *, __fp16 *, size_t, size_t, __fp16, __fp16);
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 void a64_fp16_4x4_3x3(unsigned int, const __fp16 *, size_t, const __fp16 *, __fp16 *, size_t, size_t, __fp16, __fp16);
+void a64_fp16_2x2_3x3(unsigned int, const __fp16 *, size_t, const __fp16 *, __fp16 *, size_t, size_t, __fp16, __fp16);
+void a64_fp16_2x2_5x5(unsigned int, const __fp16 *, size_t, const __fp16 *, __fp16 *, size_t, size_t, __fp16, __fp16);
+void a64_fp16_1x6_1x3(unsigned int, const __fp16 *, size_t, const __fp16 *, __fp16 *, size_t, size_t, __fp16, __fp16);
+void a64_fp16_1x4_1x5(unsigned int, const __fp16 *, size_t, const __fp16 *, __fp16 *, size_t, size_t, __fp16, __fp16);
+void a64_fp16_1x2_1x7(unsigned int, const __fp16 *, size_t, const __fp16 *, __fp16 *, size_t, size_t, __fp16, __fp16);
 
 #define IMPL(OUT_HEIGHT, OUT_WIDTH, KERN_HEIGHT, KERN_WIDTH, FUNC, DRIVER) \
   new Transform ## DRIVER <__fp16, __fp16>(#FUNC, OUT_HEIGHT, OUT_WIDTH, KERN_HEIGHT, KERN_WIDTH, FUNC)
 
+#define IMPL_T(OUT_HEIGHT, OUT_WIDTH, KERN_HEIGHT, KERN_WIDTH, FUNC, DRIVER) \
+  new Transform ## DRIVER <__fp16, __fp16>(#FUNC, OUT_HEIGHT, OUT_WIDTH, KERN_HEIGHT, KERN_WIDTH, Transform ## DRIVER <__fp16, __fp16>::get_transposed_kernel(FUNC))
 
 template <>
 const TransformImplementation<__fp16> *implementation_list(void)
 {
   static const TransformImplementation<__fp16> transforms_fp16[] = {
-    { IMPL(4, 4, 3, 3, a64_fp16_4x4_3x3, Unpadded) },
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+    { IMPL(4, 4, 3, 3, sve_fp16_4x4_3x3, Unpadded), MethodConstraints::RequiresSVE | MethodConstraints::LargerShape },
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE)
+    { IMPL(4, 4, 3, 3, a64_fp16_4x4_3x3, Unpadded), MethodConstraints::LargerShape },
+    { IMPL(2, 2, 3, 3, a64_fp16_2x2_3x3, Unpadded) },
+    { IMPL(2, 2, 5, 5, a64_fp16_2x2_5x5, Unpadded) },
+    { IMPL(1, 6, 1, 3, a64_fp16_1x6_1x3, Unpadded) },
+    { IMPL_T(6, 1, 3, 1, a64_fp16_1x6_1x3, Unpadded) },
+    { IMPL(1, 4, 1, 5, a64_fp16_1x4_1x5, Unpadded) },
+    { IMPL_T(4, 1, 5, 1, a64_fp16_1x4_1x5, Unpadded) },
+    { IMPL(1, 2, 1, 7, a64_fp16_1x2_1x7, Unpadded) },
+    { IMPL_T(2, 1, 7, 1, a64_fp16_1x2_1x7, Unpadded) },
     { nullptr }
   };
   return transforms_fp16;
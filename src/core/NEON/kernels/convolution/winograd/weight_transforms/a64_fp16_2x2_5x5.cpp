@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+#include <arm_neon.h>
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace weight_transform {
+
+/* Weight transform for a 5x5 kernel and 2x2 output tile using the same
+ * interpolation points, {0, -1, 1, -1/2, 2, inf}, as the FP16 6x6 input
+ * transform (see a64_fp16_6x6 and output_transform::a64_fp16_2x2_5x5).
+ */
+void a64_fp16_2x2_5x5(unsigned int n_channels, const __fp16 * inptr,
+                      size_t ld_weight_row, size_t ld_weight_col, __fp16 * outptr,
+                      size_t matrix_stride)
+{
+    for (; n_channels >= 8; n_channels -= 8)
+    {
+      // Matrices used and computed in this kernel
+      float16x8_t w[5][5], Ww[6][5], V[6][6];
+
+      // Read weights
+      for (int i = 0; i < 5; i++)
+      {
+        for (int j = 0; j < 5; j++)
+        {
+          w[i][j] = vld1q_f16(inptr + i*ld_weight_row + j*ld_weight_col);
+        }
+      }
+
+      const auto _1over3q = vdupq_n_f16(1.0f/3.0f);
+      const auto minus_1over3q = vdupq_n_f16(-1.0f/3.0f);
+
+      // Compute the matrix W w
+      for (int j = 0; j < 5; j++)
+      {
+        // Ww[0][j] = w[0][j]
+        Ww[0][j] = w[0][j];
+
+        // Ww[1][j] = (w[0][j] - w[1][j] + w[2][j] - w[3][j] + w[4][j]) * (1/3)
+        auto tmp1 = vaddq_f16(vaddq_f16(w[0][j], w[2][j]), w[4][j]);
+        auto tmp2 = vaddq_f16(w[1][j], w[3][j]);
+        Ww[1][j] = vmulq_f16(vsubq_f16(tmp1, tmp2), _1over3q);
+
+        // Ww[2][j] = (w[0][j] + w[1][j] + w[2][j] + w[3][j] + w[4][j]) * (-1/3)
+        Ww[2][j] = vmulq_f16(vaddq_f16(tmp1, tmp2), minus_1over3q);
+
+        // Ww[3][j] = -8/15*w[0][j] + 4/15*w[1][j] - 2/15*w[2][j] + 1/15*w[3][j] - 1/30*w[4][j]
+        tmp1 = vaddq_f16(vmulq_n_f16(w[1][j], 4.0f/15.0f), vmulq_n_f16(w[3][j], 1.0f/15.0f));
+        tmp2 = vaddq_f16(vaddq_f16(vmulq_n_f16(w[0][j], 8.0f/15.0f), vmulq_n_f16(w[2][j], 2.0f/15.0f)),
+                         vmulq_n_f16(w[4][j], 1.0f/30.0f));
+        Ww[3][j] = vsubq_f16(tmp1, tmp2);
+
+        // Ww[4][j] = 2/15*w[0][j] + 4/15*w[1][j] + 8/15*w[2][j] + 16/15*w[3][j] + 32/15*w[4][j]
+        tmp1 = vaddq_f16(vmulq_n_f16(w[0][j], 2.0f/15.0f), vmulq_n_f16(w[1][j], 4.0f/15.0f));
+        tmp2 = vaddq_f16(vaddq_f16(vmulq_n_f16(w[2][j], 8.0f/15.0f), vmulq_n_f16(w[3][j], 16.0f/15.0f)),
+                         vmulq_n_f16(w[4][j], 32.0f/15.0f));
+        Ww[4][j] = vaddq_f16(tmp1, tmp2);
+
+        // Ww[5][j] = w[4][j]
+        Ww[5][j] = w[4][j];
+      }
+
+      // Compute V = W w WT
+      for (int i = 0; i < 6; i++)
+      {
+        V[i][0] = Ww[i][0];
+
+        auto tmp1 = vaddq_f16(vaddq_f16(Ww[i][0], Ww[i][2]), Ww[i][4]);
+        auto tmp2 = vaddq_f16(Ww[i][1], Ww[i][3]);
+        V[i][1] = vmulq_f16(vsubq_f16(tmp1, tmp2), _1over3q);
+        V[i][2] = vmulq_f16(vaddq_f16(tmp1, tmp2), minus_1over3q);
+
+        tmp1 = vaddq_f16(vmulq_n_f16(Ww[i][1], 4.0f/15.0f), vmulq_n_f16(Ww[i][3], 1.0f/15.0f));
+        tmp2 = vaddq_f16(vaddq_f16(vmulq_n_f16(Ww[i][0], 8.0f/15.0f), vmulq_n_f16(Ww[i][2], 2.0f/15.0f)),
+                         vmulq_n_f16(Ww[i][4], 1.0f/30.0f));
+        V[i][3] = vsubq_f16(tmp1, tmp2);
+
+        tmp1 = vaddq_f16(vmulq_n_f16(Ww[i][0], 2.0f/15.0f), vmulq_n_f16(Ww[i][1], 4.0f/15.0f));
+        tmp2 = vaddq_f16(vaddq_f16(vmulq_n_f16(Ww[i][2], 8.0f/15.0f), vmulq_n_f16(Ww[i][3], 16.0f/15.0f)),
+                         vmulq_n_f16(Ww[i][4], 32.0f/15.0f));
+        V[i][4] = vaddq_f16(tmp1, tmp2);
+
+        V[i][5] = Ww[i][4];
+      }
+
+      // Store the transformed weights
+      for (int i = 0, m = 0; i < 6; i++)
+      {
+        for (int j = 0; j < 6; j++, m++)
+        {
+          vst1q_f16(outptr + m*matrix_stride, V[i][j]);
+        }
+      }
+      inptr += 8;
+      outptr += 8;
+    }
+    for (; n_channels; n_channels--)
+    {
+      // Matrices used and computed in this kernel. The scalar tail accumulates
+      // in FP32 as the 32/15 coefficient would otherwise lose precision.
+      float w[5][5], Ww[6][5], V[6][6];
+
+      // Read weights
+      for (int i = 0; i < 5; i++)
+      {
+        for (int j = 0; j < 5; j++)
+        {
+          w[i][j] = *(inptr + i*ld_weight_row + j*ld_weight_col);
+        }
+      }
+
+      // Compute the matrix W w
+      for (int j = 0; j < 5; j++)
+      {
+        Ww[0][j] = w[0][j];
+        Ww[1][j] = (w[0][j] - w[1][j] + w[2][j] - w[3][j] + w[4][j]) * (1.0f / 3.0f);
+        Ww[2][j] = -(w[0][j] + w[1][j] + w[2][j] + w[3][j] + w[4][j]) * (1.0f / 3.0f);
+        Ww[3][j] = (4.0f / 15.0f) * w[1][j] + (1.0f / 15.0f) * w[3][j] -
+                   ((8.0f / 15.0f) * w[0][j] + (2.0f / 15.0f) * w[2][j] + (1.0f / 30.0f) * w[4][j]);
+        Ww[4][j] = (2.0f / 15.0f) * w[0][j] + (4.0f / 15.0f) * w[1][j] + (8.0f / 15.0f) * w[2][j] +
+                   (16.0f / 15.0f) * w[3][j] + (32.0f / 15.0f) * w[4][j];
+        Ww[5][j] = w[4][j];
+      }
+
+      // Compute V = W w WT
+      for (int i = 0; i < 6; i++)
+      {
+        V[i][0] = Ww[i][0];
+        V[i][1] = (Ww[i][0] - Ww[i][1] + Ww[i][2] - Ww[i][3] + Ww[i][4]) * (1.0f / 3.0f);
+        V[i][2] = -(Ww[i][0] + Ww[i][1] + Ww[i][2] + Ww[i][3] + Ww[i][4]) * (1.0f / 3.0f);
+        V[i][3] = (4.0f / 15.0f) * Ww[i][1] + (1.0f / 15.0f) * Ww[i][3] -
+                  ((8.0f / 15.0f) * Ww[i][0] + (2.0f / 15.0f) * Ww[i][2] + (1.0f / 30.0f) * Ww[i][4]);
+        V[i][4] = (2.0f / 15.0f) * Ww[i][0] + (4.0f / 15.0f) * Ww[i][1] + (8.0f / 15.0f) * Ww[i][2] +
+                  (16.0f / 15.0f) * Ww[i][3] + (32.0f / 15.0f) * Ww[i][4];
+        V[i][5] = Ww[i][4];
+      }
+
+      // Store the transformed weights
+      for (int i = 0, m = 0; i < 6; i++)
+      {
+        for (int j = 0; j < 6; j++, m++)
+        {
+          *(outptr + m*matrix_stride) = V[i][j];
+        }
+      }
+
+      inptr++;
+      outptr++;
+    }
+}
+
+}  // namespace weight_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif // defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
@@ -32,15 +32,31 @@ namespace winograd {
 namespace weight_transform {
 
 void a64_fp16_4x4_3x3(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+void a64_fp16_2x2_3x3(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+void a64_fp16_2x2_5x5(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+void cpp_fp16_1x6_1x3(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+void cpp_fp16_1x4_1x5(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
+void cpp_fp16_1x2_1x7(unsigned int, const __fp16 *, size_t, size_t, __fp16 *, size_t);
 
 #define IMPL(KERN_ROWS, KERN_COLS, TRANS_ROWS, TRANS_COLS, KERN) \
   new Transform<__fp16>(#KERN, KERN_ROWS, KERN_COLS, TRANS_ROWS, TRANS_COLS, KERN)
 
+#define IMPL_T(KERN_ROWS, KERN_COLS, TRANS_ROWS, TRANS_COLS, KERN) \
+  new Transform<__fp16>(#KERN, KERN_ROWS, KERN_COLS, TRANS_ROWS, TRANS_COLS, Transform<__fp16>::get_transposed_kernel(KERN))
+
 template <>
 const TransformImplementation<__fp16> *implementation_list(void)
 {
   static const TransformImplementation<__fp16> transforms_fp16[] = {
     { IMPL(3, 3, 6, 6, a64_fp16_4x4_3x3) },
+    { IMPL(3, 3, 4, 4, a64_fp16_2x2_3x3) },
+    { IMPL(5, 5, 6, 6, a64_fp16_2x2_5x5) },
+    { IMPL(1, 3, 1, 8, cpp_fp16_1x6_1x3) },
+    { IMPL_T(3, 1, 8, 1, cpp_fp16_1x6_1x3) },
+    { IMPL(1, 5, 1, 8, cpp_fp16_1x4_1x5) },
+    { IMPL_T(5, 1, 8, 1, cpp_fp16_1x4_1x5) },
+    { IMPL(1, 7, 1, 8, cpp_fp16_1x2_1x7) },
+    { IMPL_T(7, 1, 8, 1, cpp_fp16_1x2_1x7) },
     { nullptr }
   };
   return transforms_fp16;
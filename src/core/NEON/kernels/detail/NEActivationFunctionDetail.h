@@ -159,7 +159,7 @@ struct logistic
      *
      * @param[in] act_info Activation layer information.
      */
-    explicit logistic(ActivationLayerInfo act_info) : vone(wrapper::vdup_n(static_cast<T>(1), ExactTagType{}))
+    explicit logistic(ActivationLayerInfo act_info)
     {
         ARM_COMPUTE_UNUSED(act_info);
     }
@@ -170,7 +170,7 @@ struct logistic
      */
     void operator()(ExactType &vval)
     {
-        vval = wrapper::vinv(wrapper::vadd(vone, wrapper::vexpq(wrapper::vneg(vval))));
+        vval = wrapper::vlogistic(vval);
     }
 
     /** Run activation function.
@@ -181,9 +181,6 @@ struct logistic
     {
         val = 1 / (1 + std::exp(-val));
     }
-
-    /** Vector of ones. */
-    const ExactType vone;
 };
 /** RELU activation object */
 template <typename T, int S>
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,10 +32,14 @@ namespace arm_compute
 {
 namespace wrapper
 {
-#define VEXPQ_IMPL(vtype, postfix)     \
-    inline vtype vexpq(const vtype &a) \
-    {                                  \
-        return vexpq_##postfix(a);     \
+#define VEXPQ_IMPL(vtype, postfix)          \
+    inline vtype vexpq(const vtype &a)      \
+    {                                       \
+        return vexpq_##postfix(a);          \
+    }                                       \
+    inline vtype vexpq_fast(const vtype &a) \
+    {                                       \
+        return vexpq_fast_##postfix(a);     \
     }
 
 #define VEXPQ_IMPL_INT(vtype, postfix)      \
@@ -49,6 +49,7 @@
 #include "src/core/NEON/wrapper/intrinsics/invsqrt.h"
 #include "src/core/NEON/wrapper/intrinsics/load.h"
 #include "src/core/NEON/wrapper/intrinsics/log.h"
+#include "src/core/NEON/wrapper/intrinsics/logistic.h"
 #include "src/core/NEON/wrapper/intrinsics/max.h"
 #include "src/core/NEON/wrapper/intrinsics/min.h"
 #include "src/core/NEON/wrapper/intrinsics/mla.h"
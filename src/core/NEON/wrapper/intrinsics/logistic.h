@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_WRAPPER_INTRINSICS_LOGISTIC_H
+#define ACL_SRC_CORE_NEON_WRAPPER_INTRINSICS_LOGISTIC_H
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace wrapper
+{
+#define VLOGISTIC_IMPL(vtype, prefix, postfix)  \
+    inline vtype vlogistic(const vtype &a)      \
+    {                                           \
+        return prefix##_##postfix(a);           \
+    }                                           \
+    inline vtype vlogistic_fast(const vtype &a) \
+    {                                           \
+        return prefix##_fast_##postfix(a);      \
+    }
+
+VLOGISTIC_IMPL(float32x4_t, vlogisticq, f32)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+VLOGISTIC_IMPL(float16x8_t, vlogisticq, f16)
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+#undef VLOGISTIC_IMPL
+} // namespace wrapper
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_WRAPPER_INTRINSICS_LOGISTIC_H
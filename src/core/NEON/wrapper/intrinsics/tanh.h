@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,10 +32,14 @@ namespace arm_compute
 {
 namespace wrapper
 {
-#define VTANH_IMPL(vtype, prefix, postfix) \
-    inline vtype vtanh(const vtype &a)     \
-    {                                      \
-        return prefix##_##postfix(a);      \
+#define VTANH_IMPL(vtype, prefix, postfix)  \
+    inline vtype vtanh(const vtype &a)      \
+    {                                       \
+        return prefix##_##postfix(a);       \
+    }                                       \
+    inline vtype vtanh_fast(const vtype &a) \
+    {                                       \
+        return prefix##_fast_##postfix(a);  \
     }
 
 VTANH_IMPL(float32x4_t, vtanhq, f32)
@@ -27,6 +27,9 @@
 #include "src/common/utils/Validate.h"
 #include "support/Bfloat16.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace arm_compute
 {
 #ifdef __aarch64__
@@ -39,19 +42,33 @@ union Element
     float16_t fp;
 };
 
-inline float16_t activation(float16_t x, const LUTInfo &info)
+// Activations are evaluated in fp32 so every table entry is the correctly rounded result
+inline float activation(float x, const LUTInfo &info)
 {
-    float16_t out = 0.f;
+    float out = 0.f;
     switch (info.act)
     {
         case ActivationLayerInfo::ActivationFunction::LOGISTIC:
             out = 1.f / (1.f + std::exp(-x));
             break;
         case ActivationLayerInfo::ActivationFunction::TANH:
-        {
-            out = static_cast<float16_t>(info.alpha * std::tanh(info.beta * x));
+            out = info.alpha * std::tanh(info.beta * x);
+            break;
+        case ActivationLayerInfo::ActivationFunction::GELU:
+            out = x * (0.5f * (1.0f + std::erf(x / 1.41421356237f)));
+            break;
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+            out = x / (1.f + std::exp(-info.alpha * x));
+            break;
+        case ActivationLayerInfo::ActivationFunction::ELU:
+            out = (x >= 0.f) ? x : info.alpha * (std::exp(x) - 1.f);
+            break;
+        case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
+            out = (x > 12.f) ? x : std::log(1.f + std::exp(x));
+            break;
+        case ActivationLayerInfo::ActivationFunction::HARD_SWISH:
+            out = x * (std::min(std::max(x + 3.f, 0.f), 6.f) * 0.166666667f);
             break;
-        }
         default:
             ARM_COMPUTE_ERROR("Unsupported Activation for 16-bit LUT table");
             break;
@@ -59,6 +76,42 @@ inline float16_t activation(float16_t x, const LUTInfo &info)
     return out;
 }
 
+inline float elementwise_unary(float x, const LUTInfo &info)
+{
+    float out = 0.f;
+    switch (info.op)
+    {
+        case ElementWiseUnary::EXP:
+            out = std::exp(x);
+            break;
+        case ElementWiseUnary::LOG:
+            out = std::log(x);
+            break;
+        case ElementWiseUnary::RSQRT:
+            out = 1.f / std::sqrt(x);
+            break;
+        case ElementWiseUnary::SIN:
+            out = std::sin(x);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported Elementwise Unary operation for 16-bit LUT table");
+            break;
+    }
+    return out;
+}
+
+// Dequantize the qsymm16 value held in x, apply the activation and requantize.
+// Only activations with the fixed [-1, 1] output range are supported, see CpuActivationKernel
+inline uint16_t activation_qsymm16(uint16_t x, const LUTInfo &info)
+{
+    ARM_COMPUTE_ASSERT(info.act == ActivationLayerInfo::ActivationFunction::LOGISTIC ||
+                       info.act == ActivationLayerInfo::ActivationFunction::TANH);
+    const UniformQuantizationInfo out_qinfo(1.f / 32768.f, 0);
+
+    const float deq = dequantize_qsymm16(static_cast<int16_t>(x), info.qinfo);
+    return static_cast<uint16_t>(quantize_qsymm16(activation(deq, info), out_qinfo));
+}
+
 inline float exponential(float fp, const LUTInfo &info)
 {
     return std::exp(fp * info.beta);
@@ -91,17 +144,33 @@ void init_lut(LookupTable65536 &lut, const LUTInfo &info)
 {
     // assert lut is valid config.
     ARM_COMPUTE_ASSERT((info.type == LUTType::Activation && info.dt == DataType::F16) ||
-                       (info.type == LUTType::Exponential && info.dt == DataType::BFLOAT16));
+                       (info.type == LUTType::Activation && info.dt == DataType::QSYMM16) ||
+                       (info.type == LUTType::Exponential && info.dt == DataType::BFLOAT16) ||
+                       (info.type == LUTType::ElementwiseUnary && info.dt == DataType::F16));
 
     Element item = {0}; // Fill lut by iterating over all 16 bit values using the union.
     Element bf16 = {0}; // Temporary object used to store bf16 values as fp16 in lut
+    Element q16  = {0}; // Temporary object used to store qsymm16 values as fp16 in lut
     while (true)
     {
         switch (info.type)
         {
             case LUTType::Activation:
             {
-                lut[item.i] = activation(item.fp, info);
+                if (info.dt == DataType::QSYMM16)
+                {
+                    q16.i       = activation_qsymm16(item.i, info);
+                    lut[item.i] = q16.fp;
+                }
+                else
+                {
+                    lut[item.i] = static_cast<float16_t>(activation(static_cast<float>(item.fp), info));
+                }
+                break;
+            }
+            case LUTType::ElementwiseUnary:
+            {
+                lut[item.i] = static_cast<float16_t>(elementwise_unary(static_cast<float>(item.fp), info));
                 break;
             }
             case LUTType::Exponential:
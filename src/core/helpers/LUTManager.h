@@ -27,6 +27,7 @@
 
 #include "arm_compute/core/CoreTypes.h"
 #include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
 #include <map>
@@ -41,36 +42,43 @@ using LookupTable65536 = std::array<float16_t, 65536>;
 
 enum class LUTType
 {
-    Activation,  // Determined by activation type
-    Exponential, // e^(beta * x)
+    Activation,       // Determined by activation type
+    Exponential,      // e^(beta * x)
+    ElementwiseUnary, // Determined by elementwise unary operation
 };
 
 struct LUTInfo
 {
     // For exponential lookup
     LUTInfo(LUTType lut, float b, DataType type, UniformQuantizationInfo info)
-        : act(), alpha(1.0f), beta(b), dt(type), qinfo(info), type(lut)
+        : act(), alpha(1.0f), beta(b), dt(type), qinfo(info), type(lut), op()
     {
     }
 
     // For activation functions
     LUTInfo(ActivationFunction func, float a, float b, DataType type, UniformQuantizationInfo info)
-        : act(func), alpha(a), beta(b), dt(type), qinfo(info), type(LUTType::Activation)
+        : act(func), alpha(a), beta(b), dt(type), qinfo(info), type(LUTType::Activation), op()
+    {
+    }
+
+    // For elementwise unary operations
+    LUTInfo(ElementWiseUnary unary_op, DataType type, UniformQuantizationInfo info)
+        : act(), alpha(1.0f), beta(1.0f), dt(type), qinfo(info), type(LUTType::ElementwiseUnary), op(unary_op)
     {
     }
 
     // Operators enable use of map with Lutinfo as key
     friend bool operator<(const LUTInfo &l, const LUTInfo &r)
     {
-        const auto l_tup = std::make_tuple(l.type, l.act, l.alpha, l.beta, l.dt, l.qinfo.scale, l.qinfo.offset);
-        const auto r_tup = std::make_tuple(r.type, r.act, r.alpha, r.beta, r.dt, r.qinfo.scale, r.qinfo.offset);
+        const auto l_tup = std::make_tuple(l.type, l.act, l.op, l.alpha, l.beta, l.dt, l.qinfo.scale, l.qinfo.offset);
+        const auto r_tup = std::make_tuple(r.type, r.act, r.op, r.alpha, r.beta, r.dt, r.qinfo.scale, r.qinfo.offset);
 
         return l_tup < r_tup;
     }
     bool operator==(const LUTInfo &l) const
     {
-        return this->type == l.type && this->act == l.act && this->alpha == l.alpha && this->beta == l.beta &&
-               this->dt == l.dt && this->qinfo == l.qinfo;
+        return this->type == l.type && this->act == l.act && this->op == l.op && this->alpha == l.alpha &&
+               this->beta == l.beta && this->dt == l.dt && this->qinfo == l.qinfo;
     }
 
     ActivationLayerInfo::ActivationFunction act;
@@ -79,6 +87,7 @@ struct LUTInfo
     DataType                                dt; // What datatype the table is indexed with.
     UniformQuantizationInfo                 qinfo;
     LUTType                                 type; // Default is Activation.
+    ElementWiseUnary                        op;   // Only used by elementwise unary tables.
 };
 
 /* Class to handle getting look up table */
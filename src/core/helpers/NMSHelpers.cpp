@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/helpers/NMSHelpers.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace nms_helpers
+{
+namespace
+{
+/** Heap order: the candidate visited first is at the top of the heap */
+bool visited_after(const ScoredIndex &lhs, const ScoredIndex &rhs)
+{
+    return (lhs.score < rhs.score) || (lhs.score == rhs.score && lhs.index > rhs.index);
+}
+
+bool visited_before(const ScoredIndex &lhs, const ScoredIndex &rhs)
+{
+    return visited_after(rhs, lhs);
+}
+} // namespace
+
+void BoxArrays::reserve(size_t capacity)
+{
+    _xmin.reserve(capacity);
+    _ymin.reserve(capacity);
+    _xmax.reserve(capacity);
+    _ymax.reserve(capacity);
+    _area.reserve(capacity);
+}
+
+void BoxArrays::clear()
+{
+    _xmin.clear();
+    _ymin.clear();
+    _xmax.clear();
+    _ymax.clear();
+    _area.clear();
+}
+
+void BoxArrays::push_back(float xmin, float ymin, float xmax, float ymax)
+{
+    _xmin.push_back(xmin);
+    _ymin.push_back(ymin);
+    _xmax.push_back(xmax);
+    _ymax.push_back(ymax);
+    _area.push_back((xmax - xmin) * (ymax - ymin));
+}
+
+size_t BoxArrays::size() const
+{
+    return _xmin.size();
+}
+
+float BoxArrays::max_overlap(float xmin, float ymin, float xmax, float ymax) const
+{
+    const float  area      = (xmax - xmin) * (ymax - ymin);
+    const size_t num_boxes = _xmin.size();
+    const float *set_xmin  = _xmin.data();
+    const float *set_ymin  = _ymin.data();
+    const float *set_xmax  = _xmax.data();
+    const float *set_ymax  = _ymax.data();
+    const float *set_area  = _area.data();
+    float        largest   = 0.f;
+
+    // Branch-free on purpose: a positive intersection implies both areas are positive, so the union can't be zero
+    for (size_t i = 0; i < num_boxes; ++i)
+    {
+        const float inter_w = std::max(std::min(xmax, set_xmax[i]) - std::max(xmin, set_xmin[i]), 0.f);
+        const float inter_h = std::max(std::min(ymax, set_ymax[i]) - std::max(ymin, set_ymin[i]), 0.f);
+        const float inter   = inter_w * inter_h;
+        const float overlap = inter > 0.f ? inter / (area + set_area[i] - inter) : 0.f;
+        largest             = std::max(largest, overlap);
+    }
+    return largest;
+}
+
+void keep_top_k(std::vector<ScoredIndex> &candidates, int top_k)
+{
+    if (top_k < 0 || static_cast<size_t>(top_k) >= candidates.size())
+    {
+        return;
+    }
+    std::nth_element(candidates.begin(), candidates.begin() + top_k, candidates.end(), visited_before);
+    candidates.resize(top_k);
+}
+
+void greedy_nms(std::vector<ScoredIndex> &candidates,
+                const float              *boxes,
+                size_t                    box_stride,
+                float                     iou_threshold,
+                float                     eta,
+                size_t                    max_kept,
+                BoxArrays                &kept_boxes,
+                std::vector<int>         &kept)
+{
+    kept_boxes.clear();
+    kept.clear();
+
+    float threshold = iou_threshold;
+    auto  heap_end  = candidates.end();
+    std::make_heap(candidates.begin(), heap_end, visited_after);
+
+    while (heap_end != candidates.begin() && kept.size() < max_kept)
+    {
+        std::pop_heap(candidates.begin(), heap_end, visited_after);
+        --heap_end;
+
+        const int    index = heap_end->index;
+        const float *box   = boxes + index * box_stride;
+        if (kept_boxes.max_overlap(box[0], box[1], box[2], box[3]) <= threshold)
+        {
+            kept_boxes.push_back(box[0], box[1], box[2], box[3]);
+            kept.push_back(index);
+            if (eta < 1.f && threshold > 0.5f)
+            {
+                threshold *= eta;
+            }
+        }
+    }
+}
+} // namespace nms_helpers
+} // namespace arm_compute
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_HELPERS_NMSHELPERS_H
+#define ACL_SRC_CORE_HELPERS_NMSHELPERS_H
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+namespace nms_helpers
+{
+/** Candidate box of a non maximum suppression */
+struct ScoredIndex
+{
+    float score; /**< Confidence of the box */
+    int   index; /**< Index of the box */
+};
+
+/** Boxes in corner format [xmin, ymin, xmax, ymax] stored as a structure of arrays
+ *
+ * Keeping every coordinate contiguous lets the overlap of a box against the whole set be computed by a single
+ * branch-free loop that the compiler vectorizes.
+ */
+class BoxArrays
+{
+public:
+    /** Reserve the storage for @p capacity boxes so that adding up to @p capacity boxes doesn't allocate
+     *
+     * @param[in] capacity Maximum number of boxes the set is expected to hold.
+     */
+    void reserve(size_t capacity);
+    /** Remove all the boxes, keeping the storage */
+    void clear();
+    /** Add a box to the set
+     *
+     * @param[in] xmin Left coordinate of the box.
+     * @param[in] ymin Top coordinate of the box.
+     * @param[in] xmax Right coordinate of the box.
+     * @param[in] ymax Bottom coordinate of the box.
+     */
+    void push_back(float xmin, float ymin, float xmax, float ymax);
+    /** Number of boxes in the set */
+    size_t size() const;
+    /** Largest intersection over union between a box and the boxes of the set
+     *
+     * Boxes that do not intersect have an overlap of 0, so degenerate boxes never suppress or get suppressed.
+     *
+     * @param[in] xmin Left coordinate of the box.
+     * @param[in] ymin Top coordinate of the box.
+     * @param[in] xmax Right coordinate of the box.
+     * @param[in] ymax Bottom coordinate of the box.
+     *
+     * @return The largest overlap, 0 if the set is empty
+     */
+    float max_overlap(float xmin, float ymin, float xmax, float ymax) const;
+
+private:
+    std::vector<float> _xmin{};
+    std::vector<float> _ymin{};
+    std::vector<float> _xmax{};
+    std::vector<float> _ymax{};
+    std::vector<float> _area{};
+};
+
+/** Reduce the candidates to the @p top_k ones with the highest score, without sorting them
+ *
+ * @param[in,out] candidates Candidates to filter.
+ * @param[in]     top_k      Number of candidates to keep. A negative value keeps all the candidates.
+ */
+void keep_top_k(std::vector<ScoredIndex> &candidates, int top_k);
+
+/** Greedy non maximum suppression
+ *
+ * Candidates are visited by decreasing score (lowest index first for equal scores) and a candidate is kept if its
+ * overlap with every kept box is not greater than the threshold. Candidates are extracted from a binary heap, so
+ * only the visited candidates get ordered and the cost is linear in the number of candidates when few boxes are kept.
+ *
+ * @param[in,out] candidates    Candidates to visit. Their order is modified by the call.
+ * @param[in]     boxes         Boxes in corner format [xmin, ymin, xmax, ymax] indexed by @ref ScoredIndex::index.
+ * @param[in]     box_stride    Distance in elements between two consecutive boxes of @p boxes.
+ * @param[in]     iou_threshold Overlap above which a candidate is suppressed.
+ * @param[in]     eta           Adaptation rate of the threshold after each kept box, as long as it is greater than 0.5.
+ *                              A value of 1 keeps the threshold constant.
+ * @param[in]     max_kept      Maximum number of boxes to keep.
+ * @param[out]    kept_boxes    Scratch set holding the kept boxes. Cleared by the call.
+ * @param[out]    kept          Indices of the kept boxes in visiting order. Cleared by the call.
+ */
+void greedy_nms(std::vector<ScoredIndex> &candidates,
+                const float              *boxes,
+                size_t                    box_stride,
+                float                     iou_threshold,
+                float                     eta,
+                size_t                    max_kept,
+                BoxArrays                &kept_boxes,
+                std::vector<int>         &kept);
+} // namespace nms_helpers
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_HELPERS_NMSHELPERS_H
@@ -23,6 +23,8 @@
  */
 #include "src/core/helpers/WindowHelpers.h"
 
+#include "src/core/helpers/Utils.h"
+
 namespace arm_compute
 {
 Window
@@ -346,4 +348,12 @@ std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &sr
     return std::make_pair(win, split_dimension);
 }
 
+Window collapse_window_if_no_holes(const Window &window, size_t first, const ITensorInfo &src, const ITensorInfo &dst)
+{
+    if (has_holes(src) || has_holes(dst))
+    {
+        return window;
+    }
+    return window.collapse_if_possible(window, first);
+}
 } // namespace arm_compute
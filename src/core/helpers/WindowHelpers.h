@@ -212,6 +212,20 @@ std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &sr
  */
 std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &src0, const ITensorInfo &src1);
 
+/** Collapse the dimensions of a window from a given dimension upwards, if the tensors it iterates have no holes
+ *
+ * The collapsed dimensions are iterated with the stride of the first one. This is wrong for tensors whose higher
+ * dimensions are not contiguous, e.g. sub-tensors that split the planes of their parent.
+ *
+ * @param[in] window Window to collapse.
+ * @param[in] first  First dimension to collapse.
+ * @param[in] src    Tensor info object of the source tensor.
+ * @param[in] dst    Tensor info object of the destination tensor.
+ *
+ * @return The collapsed window if neither tensor has holes, else @p window
+ */
+Window collapse_window_if_no_holes(const Window &window, size_t first, const ITensorInfo &src, const ITensorInfo &dst);
+
 /** Function to compute the shape of output and window for the given inputs
  *
  * @param[in] infos Input tensor informations
@@ -23,7 +23,11 @@
  */
 #include "src/core/utils/helpers/fft.h"
 
+#include "support/Mutex.h"
+
+#include <map>
 #include <numeric>
+#include <utility>
 
 namespace arm_compute
 {
@@ -120,6 +124,32 @@ std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vecto
 
     return idx_digit_reverse;
 }
+
+std::shared_ptr<const FFTPlan> get_plan(unsigned int N, const std::set<unsigned int> &supported_factors)
+{
+    using PlanKey = std::pair<unsigned int, std::set<unsigned int>>;
+
+    static arm_compute::Mutex                                plans_mtx;
+    static std::map<PlanKey, std::shared_ptr<const FFTPlan>> plans;
+
+    const PlanKey                                     key{N, supported_factors};
+    const arm_compute::lock_guard<arm_compute::Mutex> lock(plans_mtx);
+
+    auto it = plans.find(key);
+    if (it == plans.end())
+    {
+        auto plan    = std::make_shared<FFTPlan>();
+        plan->N      = N;
+        plan->stages = decompose_stages(N, supported_factors);
+        if (!plan->stages.empty())
+        {
+            plan->digit_reverse_indices = digit_reverse_indices(N, plan->stages);
+        }
+        it = plans.emplace(key, std::move(plan)).first;
+    }
+
+    return it->second;
+}
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
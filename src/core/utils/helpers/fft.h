@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_UTILS_HELPERS_FFT_H
 #define ARM_COMPUTE_UTILS_HELPERS_FFT_H
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -49,6 +50,26 @@ std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsign
  * @return A vector with the digit reverse indices. Will be empty if it failed.
  */
 std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vector<unsigned int> &fft_stages);
+
+/** Per-size FFT plan holding the data that only depends on the transform length */
+struct FFTPlan
+{
+    unsigned int              N{0};                    /**< Length of the transform. */
+    std::vector<unsigned int> stages{};                /**< Radix decomposition of @p N. Empty if not decomposable. */
+    std::vector<unsigned int> digit_reverse_indices{}; /**< Digit reverse indices matching @p stages. */
+};
+/** Get the plan of a 1D FFT of a given size
+ *
+ * Plans are computed once per (size, supported factors) pair and cached for the lifetime of the process,
+ * so that functions configured several times for the same size do not recompute the decomposition and
+ * the digit reverse look-up table.
+ *
+ * @param[in] N                 Input size of the transform.
+ * @param[in] supported_factors Supported factors that can be used for decomposition.
+ *
+ * @return The cached plan. The stages of the plan will be empty if the decomposition failed.
+ */
+std::shared_ptr<const FFTPlan> get_plan(unsigned int N, const std::set<unsigned int> &supported_factors);
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
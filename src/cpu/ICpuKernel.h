@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 
 #include "src/cpu/kernels/CpuKernelSelectionTypes.h"
+#include "src/cpu/utils/CpuMwsTable.h"
 
 namespace arm_compute
 {
@@ -67,6 +68,40 @@ public:
 
         return static_cast<kernel_type *>(nullptr);
     }
+
+    /** Return minimum workload size of the relevant kernel
+     *
+     * The value comes from the @ref CpuMwsTable entry resolved when the kernel was configured.
+     *
+     * @param[in] platform     The CPU platform used to create the context.
+     * @param[in] thread_count Number of threads in the execution.
+     *
+     * @return Minimum workload size for requested configuration.
+     */
+    size_t get_mws(const CPUInfo &platform, size_t thread_count) const override
+    {
+        ARM_COMPUTE_UNUSED(thread_count);
+
+        size_t mws = ICPPKernel::default_mws;
+        lookup_mws(_mws_entry, platform, this->window(), mws);
+        return mws;
+    }
+
+protected:
+    /** Configure the kernel's window and resolve the kernel's entry in the @ref CpuMwsTable
+     *
+     * Kernels only updating their window at run time should call ICPPKernel::configure() to keep the resolved entry.
+     *
+     * @param[in] window  The maximum window which will be returned by window()
+     * @param[in] mws_key (Optional) Identifier of the kernel in the table. Defaults to the kernel's name.
+     */
+    void configure(const Window &window, const char *mws_key = nullptr)
+    {
+        ICPPKernel::configure(window);
+        _mws_entry = resolve_mws(CPUInfo::get(), mws_key != nullptr ? mws_key : this->name());
+    }
+
+    CpuMwsEntry _mws_entry{}; /**< Entry of the kernel in the minimum workload size table */
 };
 } // namespace cpu
 } // namespace arm_compute
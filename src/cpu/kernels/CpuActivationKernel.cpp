@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -197,7 +197,21 @@ void init_lut(ActivationLayerInfo::ActivationFunction act_func,
             (data_type == DataType::QASYMM8) ? quantize_qasymm8(tmp_f, qi_out) : quantize_qasymm8_signed(tmp_f, qi_out);
     }
 }
+
+/* Micro-kernels reading the full-range 16-bit table shared through LUTManager */
+bool uses_lut_65536(const char *kernel_name)
+{
+    const std::string name(kernel_name);
+    return name == "sve_fp16_activation_lut" || name == "neon_fp16_activation_lut" ||
+           name == "neon_qs16_activation_lut";
+}
 #endif // __aarch64__
+
+/* Identifier in the MWS table, the cost per element and so the breakeven size depend on the activation function */
+std::string mws_key(const char *kernel_name, ActivationLayerInfo::ActivationFunction act)
+{
+    return std::string(kernel_name) + ":" + lower_string(string_from_activation_func(act));
+}
 } // namespace
 
 void CpuActivationKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ActivationLayerInfo activation_info)
@@ -239,7 +253,7 @@ void CpuActivationKernel::configure(const ITensorInfo *src, ITensorInfo *dst, Ac
     }
 
     // Kernel specific logic should be mirrored in prepare()
-    if (std::string(uk->name) == "sve_fp16_activation_lut")
+    if (uses_lut_65536(uk->name))
     {
         // Create info using init list.
         const LUTInfo info = {activation_info.activation(), activation_info.a(), activation_info.b(), src->data_type(),
@@ -250,6 +264,7 @@ void CpuActivationKernel::configure(const ITensorInfo *src, ITensorInfo *dst, Ac
     _act_info = activation_info;
 
     ICPPKernel::configure(_heuristics.window());
+    _mws_entry = resolve_mws(CPUInfo::get(), mws_key(name(), _act_info.activation()).c_str());
 }
 
 Status
@@ -264,8 +279,13 @@ CpuActivationKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, co
 size_t CpuActivationKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
 {
     ARM_COMPUTE_UNUSED(thread_count);
-    ARM_COMPUTE_UNUSED(platform);
 
+    // Calibrated values take precedence over the built-in heuristics
+    size_t mws = ICPPKernel::default_mws;
+    if (lookup_mws(_mws_entry, platform, window(), mws))
+    {
+        return mws;
+    }
     return _heuristics.mws();
 }
 
@@ -297,7 +317,7 @@ void CpuActivationKernel::prepare(ITensorPack &tensors)
             _name = std::string("CpuActivationKernel").append("/").append(uk->name);
 
 #ifdef __aarch64__
-            if (std::string(uk->name) == "sve_fp16_activation_lut")
+            if (uses_lut_65536(uk->name))
             {
                 // Create info using init list.
                 LUTManager   &lut_manager = LUTManager::get_instance();
@@ -308,8 +328,9 @@ void CpuActivationKernel::prepare(ITensorPack &tensors)
 #endif // __aarch64__
         }
 
-        // Re-register the window
+        // Re-register the window, the micro-kernel and so its table entry may have changed
         ICPPKernel::configure(_heuristics.window());
+        _mws_entry = resolve_mws(CPUInfo::get(), mws_key(name(), _act_info.activation()).c_str());
     }
 }
 
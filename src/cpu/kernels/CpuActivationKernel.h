@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -101,6 +101,7 @@ private:
     PaddingSize                               _src_padding{};
     PaddingSize                               _dst_padding{};
     bool                                      _inplace{};
+    CpuMwsEntry                               _mws_entry{};
 };
 } // namespace kernels
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Arm Limited.
+ * Copyright (c) 2016-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -82,15 +82,6 @@ public:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
 
-    /** Return minimum workload size of the relevant kernel
-     *
-     * @param[in] platform     The CPU platform used to create the context.
-     * @param[in] thread_count Number of threads in the execution.
-     *
-     * @return[out] mws Minimum workload size for requested configuration.
-     */
-    size_t get_mws(const CPUInfo &platform, size_t thread_count) const override;
-
     static const std::vector<AddKernel> &get_available_kernels();
 
     size_t get_split_dimension() const
@@ -38,6 +38,7 @@
 #include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/kernels/cast/list.h"
+#include "support/Bfloat16.h"
 #include "support/SaturateCast.h"
 
 namespace arm_compute
@@ -80,25 +81,29 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
     ARM_COMPUTE_RETURN_ERROR_ON_SIZE_UNSUPPORTED(src);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(dst);
     ARM_COMPUTE_UNUSED(policy);
     ARM_COMPUTE_RETURN_ERROR_ON(src == dst);
 #ifdef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
-                                                         DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::F32, DataType::S32, DataType::S64, DataType::U64);
+                                                         DataType::U8, DataType::S16, DataType::U16, DataType::BFLOAT16,
+                                                         DataType::F16, DataType::F32, DataType::S32, DataType::S64,
+                                                         DataType::U64);
 
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
-                                                         DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::U32, DataType::S32, DataType::F32, DataType::S64);
+                                                         DataType::U8, DataType::S16, DataType::U16, DataType::BFLOAT16,
+                                                         DataType::F16, DataType::U32, DataType::S32, DataType::F32,
+                                                         DataType::S64);
 
 #else  // __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
-                                                         DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::F32, DataType::S32);
+                                                         DataType::U8, DataType::S16, DataType::U16, DataType::BFLOAT16,
+                                                         DataType::F16, DataType::F32, DataType::S32);
 
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
-                                                         DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::U32, DataType::S32, DataType::F32);
+                                                         DataType::U8, DataType::S16, DataType::U16, DataType::BFLOAT16,
+                                                         DataType::F16, DataType::U32, DataType::S32, DataType::F32);
 #endif // __aarch64__
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::QASYMM8_SIGNED &&
@@ -133,11 +138,15 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
                                          dst->data_type() != DataType::F32 && dst->data_type() != DataType::S32),
                                     "Only data_types supported [in] F16 ->  [out] QASYMM8, F32, S32, U8");
 
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::BFLOAT16 && dst->data_type() != DataType::F32,
+                                    "Only data_types supported [in] BFLOAT16 ->  [out] F32");
+
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::F32 &&
                                         (dst->data_type() != DataType::QASYMM8_SIGNED &&
                                          dst->data_type() != DataType::QASYMM8 && dst->data_type() != DataType::F16 &&
-                                         dst->data_type() != DataType::S32 && dst->data_type() != DataType::U8),
-                                    "Only data_types supported [in] F32 ->  [out] QASYMM8, F16, S32, U8");
+                                         dst->data_type() != DataType::BFLOAT16 && dst->data_type() != DataType::S32 &&
+                                         dst->data_type() != DataType::U8),
+                                    "Only data_types supported [in] F32 ->  [out] QASYMM8, BFLOAT16, F16, S32, U8");
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::S32 &&
                                         (dst->data_type() != DataType::QASYMM8_SIGNED &&
@@ -185,7 +194,7 @@ void CpuCastKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ConvertP
     // Configure kernel window
     Window win = calculate_max_window(*src, Steps());
 
-    ICPPKernel::configure(win);
+    ICpuKernel::configure(win);
 }
 
 Status CpuCastKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy)
@@ -858,6 +867,48 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
             uk->ukernel(_src, _dst, info, _policy, window);
             break;
         }
+        case DataType::BFLOAT16:
+            switch (_dst->info()->data_type())
+            {
+                case DataType::F32:
+                {
+                    /* Up-conversion BFLOAT16 -> F32 */
+                    execute_window_loop(
+                        win,
+                        [&](const Coordinates &)
+                        {
+                            const auto src_ptr = reinterpret_cast<const uint16_t *>(src.ptr());
+                            const auto dst_ptr = reinterpret_cast<float *>(dst.ptr());
+
+                            int x = window_start_x;
+                            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+                            {
+                                const uint16x8x2_t texels = {{vld1q_u16(src_ptr + x), vld1q_u16(src_ptr + x + 8)}};
+
+                                // A bfloat16 is the upper half of the corresponding float
+                                vst1q_f32(dst_ptr + x,
+                                          vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(texels.val[0]), 16)));
+                                vst1q_f32(dst_ptr + x + 4,
+                                          vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(texels.val[0]), 16)));
+                                vst1q_f32(dst_ptr + x + 8,
+                                          vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(texels.val[1]), 16)));
+                                vst1q_f32(dst_ptr + x + 12,
+                                          vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(texels.val[1]), 16)));
+                            }
+
+                            // Compute left-over elements
+                            for (; x < window_end_x; ++x)
+                            {
+                                *(dst_ptr + x) = bf16_to_float(*(src_ptr + x));
+                            }
+                        },
+                        src, dst);
+                    break;
+                }
+                default:
+                    ARM_COMPUTE_ERROR("dst data type not supported");
+            }
+            break;
         case DataType::F32:
             switch (_dst->info()->data_type())
             {
@@ -868,6 +919,34 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     uk->ukernel(_src, _dst, info, _policy, window);
                     break;
                 }
+                case DataType::BFLOAT16:
+                {
+                    /* Down-conversion F32 -> BFLOAT16 */
+                    execute_window_loop(
+                        win,
+                        [&](const Coordinates &)
+                        {
+                            const auto src_ptr = reinterpret_cast<const float *>(src.ptr());
+                            const auto dst_ptr = reinterpret_cast<uint16_t *>(dst.ptr());
+
+                            int x = window_start_x;
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+                            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+                            {
+                                wrapper::vcvt_bf16_f32(src_ptr + x, dst_ptr + x);
+                                wrapper::vcvt_bf16_f32(src_ptr + x + 8, dst_ptr + x + 8);
+                            }
+#endif /* defined(ARM_COMPUTE_ENABLE_BF16) */
+
+                            // Compute left-over elements
+                            for (; x < window_end_x; ++x)
+                            {
+                                *(dst_ptr + x) = float_to_bf16(*(src_ptr + x));
+                            }
+                        },
+                        src, dst);
+                    break;
+                }
                 case DataType::S32:
                 {
                     /* Conversion F32 -> S32 */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -170,6 +170,21 @@ void CpuDirectConv2dKernel::run_op(ITensorPack &tensors, const Window &window, c
 
     uk->ukernel(window, src, weights, dst, _conv_info);
 }
+
+uint64_t CpuDirectConv2dKernel::get_flop_count(const ITensorPack &tensors) const
+{
+    const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *dst     = tensors.get_const_tensor(TensorType::ACL_DST);
+    if (weights == nullptr || dst == nullptr)
+    {
+        return 0;
+    }
+
+    // Each output element accumulates one kernel volume, i.e. all the weights of its output feature map
+    const uint64_t macs_per_element = weights->info()->tensor_shape().total_size_lower(3);
+    return 2 * macs_per_element * dst->info()->tensor_shape().total_size();
+}
+
 const char *CpuDirectConv2dKernel::name() const
 {
     return "CpuDirectConvolutionLayerKernel";
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuDynamicDequantizeOutputStageKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+constexpr int window_step_x = 16;
+
+Status validate_arguments(const ITensorInfo         *dst,
+                          const ITensorInfo         *row_scales,
+                          const ITensorInfo         *col_scales,
+                          const ITensorInfo         *bias,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst, row_scales, col_scales);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(dst, row_scales, col_scales);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->tensor_shape().total_size() == 0);
+
+    const size_t num_cols    = dst->dimension(0);
+    const size_t num_rows    = dst->tensor_shape().total_size_upper(1);
+    const size_t num_batches = col_scales->tensor_shape().total_size() / num_cols;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(row_scales->tensor_shape().total_size() != num_rows,
+                                    "Row scales must hold one value per row of the destination");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_batches == 0 || col_scales->tensor_shape().total_size() % num_cols != 0 ||
+                                        num_rows % num_batches != 0,
+                                    "Column scales must hold one value per column of each batch of the destination");
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(dst, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != num_cols);
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!CpuDynamicDequantizeOutputStageKernel::is_activation_supported(act_info),
+                                    "Activation function not supported");
+
+    return Status{};
+}
+} // namespace
+
+void CpuDynamicDequantizeOutputStageKernel::configure(ITensorInfo               *dst,
+                                                      const ITensorInfo         *row_scales,
+                                                      const ITensorInfo         *col_scales,
+                                                      const ITensorInfo         *bias,
+                                                      const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDynamicDequantizeOutputStageKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst, row_scales, col_scales);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(dst, row_scales, col_scales, bias, act_info));
+
+    const size_t num_batches = col_scales->tensor_shape().total_size() / dst->dimension(0);
+    _rows_per_batch          = dst->tensor_shape().total_size_upper(1) / num_batches;
+
+    _min_bound = std::numeric_limits<float>::lowest();
+    _max_bound = std::numeric_limits<float>::max();
+    if (act_info.enabled())
+    {
+        switch (act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                _min_bound = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                _min_bound = 0.f;
+                _max_bound = act_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                _min_bound = act_info.b();
+                _max_bound = act_info.a();
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Each row is processed as a whole
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuDynamicDequantizeOutputStageKernel::validate(const ITensorInfo         *dst,
+                                                       const ITensorInfo         *row_scales,
+                                                       const ITensorInfo         *col_scales,
+                                                       const ITensorInfo         *bias,
+                                                       const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDynamicDequantizeOutputStageKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(dst, row_scales, col_scales, bias, act_info));
+    return Status{};
+}
+
+bool CpuDynamicDequantizeOutputStageKernel::is_activation_supported(const ActivationLayerInfo &act_info)
+{
+    return !act_info.enabled() || act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU ||
+           act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU ||
+           act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU;
+}
+
+void CpuDynamicDequantizeOutputStageKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU,
+                            "CpuDynamicDequantizeOutputStageKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const auto row_scales = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto col_scales = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto bias       = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto       dst        = tensors.get_tensor(TensorType::ACL_DST);
+
+    const int   window_end_x   = static_cast<int>(dst->info()->dimension(0));
+    const auto *row_scales_ptr = reinterpret_cast<const float *>(row_scales->ptr_to_element(Coordinates{}));
+    const auto *col_scales_ptr = reinterpret_cast<const float *>(col_scales->ptr_to_element(Coordinates{}));
+    const auto *bias_ptr =
+        bias != nullptr ? reinterpret_cast<const float *>(bias->ptr_to_element(Coordinates{})) : nullptr;
+
+    const float32x4_t vmin  = vdupq_n_f32(_min_bound);
+    const float32x4_t vmax  = vdupq_n_f32(_max_bound);
+    const float32x4_t vzero = vdupq_n_f32(0.f);
+
+    Iterator dst_it(dst, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            // Linear index of the row, all the dimensions above the first one being flattened
+            size_t row    = 0;
+            size_t stride = 1;
+            for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+            {
+                row += id[d] * stride;
+                stride *= dst->info()->dimension(d);
+            }
+
+            const float  row_scale = row_scales_ptr[row];
+            const float *cs        = col_scales_ptr + window_end_x * (row / _rows_per_batch);
+            const auto   out       = reinterpret_cast<float *>(dst_it.ptr());
+
+            int x = 0;
+            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                for (int i = 0; i < window_step_x; i += 4)
+                {
+                    const float32x4_t vbias = bias_ptr != nullptr ? vld1q_f32(bias_ptr + x + i) : vzero;
+                    const float32x4_t vres =
+                        vmlaq_f32(vbias, vld1q_f32(out + x + i), vmulq_n_f32(vld1q_f32(cs + x + i), row_scale));
+                    vst1q_f32(out + x + i, vminq_f32(vmaxq_f32(vres, vmin), vmax));
+                }
+            }
+            for (; x < window_end_x; ++x)
+            {
+                const float res = out[x] * cs[x] * row_scale + (bias_ptr != nullptr ? bias_ptr[x] : 0.f);
+                out[x]          = std::min(std::max(res, _min_bound), _max_bound);
+            }
+        },
+        dst_it);
+}
+
+const char *CpuDynamicDequantizeOutputStageKernel::name() const
+{
+    return "CpuDynamicDequantizeOutputStageKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUDYNAMICDEQUANTIZEOUTPUTSTAGEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUDYNAMICDEQUANTIZEOUTPUTSTAGEKERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to dequantize in place the F32 result of a GEMM between operands quantized by @ref CpuDynamicQuantizeKernel
+ *
+ * Each element of the destination is multiplied by the scale of its row of the LHS and by the scale of its column of
+ * the RHS, and then the bias and the fused activation, if any, are applied:
+ *
+ * dst[m, n] = act(dst[m, n] * row_scales[m] * col_scales[n] + bias[n])
+ */
+class CpuDynamicDequantizeOutputStageKernel : public ICpuKernel<CpuDynamicDequantizeOutputStageKernel>
+{
+public:
+    /** Default constructor */
+    CpuDynamicDequantizeOutputStageKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicDequantizeOutputStageKernel);
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in, out] dst        Source and destination tensor info, holding the unscaled GEMM result. Data types supported: F32.
+     * @param[in]      row_scales 1D tensor info with one scale per row of @p dst. Data types supported: F32.
+     * @param[in]      col_scales 1D tensor info with one scale per column of each batch of the RHS. The number of rows
+     *                            of @p dst must be a multiple of the number of batches. Data types supported: F32.
+     * @param[in]      bias       (Optional) 1D bias tensor info with one value per column of @p dst. Can be nullptr.
+     *                            Data types supported: F32.
+     * @param[in]      act_info   (Optional) Fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     */
+    void configure(ITensorInfo               *dst,
+                   const ITensorInfo         *row_scales,
+                   const ITensorInfo         *col_scales,
+                   const ITensorInfo         *bias,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDynamicDequantizeOutputStageKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *dst,
+                           const ITensorInfo         *row_scales,
+                           const ITensorInfo         *col_scales,
+                           const ITensorInfo         *bias,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Checks if an activation can be fused in the kernel
+     *
+     * @param[in] act_info Activation to check
+     *
+     * @return True if the activation is disabled or can be applied by the kernel
+     */
+    static bool is_activation_supported(const ActivationLayerInfo &act_info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    size_t _rows_per_batch{1};
+    float  _min_bound{0.f};
+    float  _max_bound{0.f};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUDYNAMICDEQUANTIZEOUTPUTSTAGEKERNEL_H
@@ -62,7 +62,7 @@ void CpuDynamicGemmKernel::configure(const ITensorInfo *a,
     _aux_mem.reserve(Count);
 
     Window window = _heuristics.get_window()(d);
-    ICPPKernel::configure(window);
+    ICpuKernel::configure(window);
 }
 
 Status CpuDynamicGemmKernel::validate(const ITensorInfo *a,
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuDynamicQuantizeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "support/ToolchainSupport.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+constexpr int window_step_x = 16;
+
+size_t num_scales(const ITensorInfo &src, bool per_column)
+{
+    return per_column ? src.dimension(0) * src.tensor_shape().total_size_upper(2)
+                      : src.tensor_shape().total_size_upper(1);
+}
+
+/** Linear index of the row, or of the 2D slice, at the given coordinates
+ *
+ * @param[in] src       Tensor info the coordinates refer to
+ * @param[in] id        Coordinates
+ * @param[in] first_dim First dimension taken into account: 1 for rows, 2 for 2D slices
+ *
+ * @return The index of the row or the slice, dimensions from @p first_dim upward being flattened
+ */
+size_t linear_index(const ITensorInfo &src, const Coordinates &id, size_t first_dim)
+{
+    size_t index  = 0;
+    size_t stride = 1;
+    for (size_t d = first_dim; d < Coordinates::num_max_dimensions; ++d)
+    {
+        index += id[d] * stride;
+        stride *= src.dimension(d);
+    }
+    return index;
+}
+
+inline float scale_from_absmax(float absmax)
+{
+    // Rows or columns of zeros get a unit scale so that they still dequantize to zero
+    return absmax > 0.f ? absmax / 127.f : 1.f;
+}
+
+inline int8x16_t quantize_symmetric(const float32x4x4_t &v, const float32x4x4_t &inv_scale)
+{
+#ifdef __aarch64__
+    const int32x4_t q0 = vcvtnq_s32_f32(vmulq_f32(v.val[0], inv_scale.val[0]));
+    const int32x4_t q1 = vcvtnq_s32_f32(vmulq_f32(v.val[1], inv_scale.val[1]));
+    const int32x4_t q2 = vcvtnq_s32_f32(vmulq_f32(v.val[2], inv_scale.val[2]));
+    const int32x4_t q3 = vcvtnq_s32_f32(vmulq_f32(v.val[3], inv_scale.val[3]));
+#else  // __aarch64__
+    const int32x4_t q0 = vcvtq_s32_f32(vmulq_f32(v.val[0], inv_scale.val[0]));
+    const int32x4_t q1 = vcvtq_s32_f32(vmulq_f32(v.val[1], inv_scale.val[1]));
+    const int32x4_t q2 = vcvtq_s32_f32(vmulq_f32(v.val[2], inv_scale.val[2]));
+    const int32x4_t q3 = vcvtq_s32_f32(vmulq_f32(v.val[3], inv_scale.val[3]));
+#endif // __aarch64__
+    const int8x8_t lo = vqmovn_s16(vcombine_s16(vqmovn_s32(q0), vqmovn_s32(q1)));
+    const int8x8_t hi = vqmovn_s16(vcombine_s16(vqmovn_s32(q2), vqmovn_s32(q3)));
+    return vcombine_s8(lo, hi);
+}
+
+inline int8_t quantize_symmetric(float v, float inv_scale)
+{
+    return static_cast<int8_t>(
+        utility::clamp<int32_t, int8_t>(static_cast<int32_t>(support::cpp11::nearbyint(v * inv_scale))));
+}
+
+inline float32x4x4_t load_f32x4x4(const float *ptr)
+{
+    return {{vld1q_f32(ptr), vld1q_f32(ptr + 4), vld1q_f32(ptr + 8), vld1q_f32(ptr + 12)}};
+}
+
+void quantize_per_row(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+{
+    const int window_end_x = static_cast<int>(src->info()->dimension(0));
+    auto     *scales_ptr   = reinterpret_cast<float *>(scales->ptr_to_element(Coordinates{}));
+
+    Iterator src_it(src, window);
+    Iterator dst_it(dst, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const auto in  = reinterpret_cast<const float *>(src_it.ptr());
+            const auto out = reinterpret_cast<int8_t *>(dst_it.ptr());
+
+            // Reduce the row to its largest absolute value
+            float32x4_t vmax = vdupq_n_f32(0.f);
+            int         x    = 0;
+            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                const float32x4x4_t v = load_f32x4x4(in + x);
+                vmax = vmaxq_f32(vmax, vmaxq_f32(vmaxq_f32(vabsq_f32(v.val[0]), vabsq_f32(v.val[1])),
+                                                 vmaxq_f32(vabsq_f32(v.val[2]), vabsq_f32(v.val[3]))));
+            }
+#ifdef __aarch64__
+            float absmax = vmaxvq_f32(vmax);
+#else  // __aarch64__
+            float32x2_t tmp = vpmax_f32(vget_high_f32(vmax), vget_low_f32(vmax));
+            tmp             = vpmax_f32(tmp, tmp);
+            float absmax    = vget_lane_f32(tmp, 0);
+#endif // __aarch64__
+            for (; x < window_end_x; ++x)
+            {
+                absmax = std::max(absmax, std::abs(in[x]));
+            }
+
+            const float scale     = scale_from_absmax(absmax);
+            const float inv_scale = 1.f / scale;
+            scales_ptr[linear_index(*src->info(), id, 1)] = scale;
+
+            // Quantize the row while it is still in cache
+            const float32x4_t   vinv      = vdupq_n_f32(inv_scale);
+            const float32x4x4_t vinv_x4x4 = {{vinv, vinv, vinv, vinv}};
+            for (x = 0; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                vst1q_s8(out + x, quantize_symmetric(load_f32x4x4(in + x), vinv_x4x4));
+            }
+            for (; x < window_end_x; ++x)
+            {
+                out[x] = quantize_symmetric(in[x], inv_scale);
+            }
+        },
+        src_it, dst_it);
+}
+
+void quantize_per_column(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+{
+    const int    window_start_x = window.x().start();
+    const int    window_end_x   = window.x().end();
+    const int    num_rows       = static_cast<int>(src->info()->dimension(1));
+    const int    num_cols       = static_cast<int>(src->info()->dimension(0));
+    const size_t src_stride     = src->info()->strides_in_bytes()[1];
+    const size_t dst_stride     = dst->info()->strides_in_bytes()[1];
+    auto        *scales_ptr     = reinterpret_cast<float *>(scales->ptr_to_element(Coordinates{}));
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator src_it(src, win);
+    Iterator dst_it(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            float *slice_scales = scales_ptr + num_cols * linear_index(*src->info(), id, 2);
+
+            // Columns are processed in blocks, each block being reduced and then quantized while it is in cache
+            int x = window_start_x;
+            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                float32x4x4_t vmax = {{vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f)}};
+                for (int y = 0; y < num_rows; ++y)
+                {
+                    const float32x4x4_t v =
+                        load_f32x4x4(reinterpret_cast<const float *>(src_it.ptr() + y * src_stride) + x);
+                    vmax.val[0] = vmaxq_f32(vmax.val[0], vabsq_f32(v.val[0]));
+                    vmax.val[1] = vmaxq_f32(vmax.val[1], vabsq_f32(v.val[1]));
+                    vmax.val[2] = vmaxq_f32(vmax.val[2], vabsq_f32(v.val[2]));
+                    vmax.val[3] = vmaxq_f32(vmax.val[3], vabsq_f32(v.val[3]));
+                }
+
+                float absmax[window_step_x];
+                float inv_scale[window_step_x];
+                vst1q_f32(absmax, vmax.val[0]);
+                vst1q_f32(absmax + 4, vmax.val[1]);
+                vst1q_f32(absmax + 8, vmax.val[2]);
+                vst1q_f32(absmax + 12, vmax.val[3]);
+                for (int i = 0; i < window_step_x; ++i)
+                {
+                    slice_scales[x + i] = scale_from_absmax(absmax[i]);
+                    inv_scale[i]        = 1.f / slice_scales[x + i];
+                }
+
+                const float32x4x4_t vinv = load_f32x4x4(inv_scale);
+                for (int y = 0; y < num_rows; ++y)
+                {
+                    const auto in  = reinterpret_cast<const float *>(src_it.ptr() + y * src_stride) + x;
+                    const auto out = reinterpret_cast<int8_t *>(dst_it.ptr() + y * dst_stride) + x;
+                    vst1q_s8(out, quantize_symmetric(load_f32x4x4(in), vinv));
+                }
+            }
+
+            // Left-over columns
+            for (; x < window_end_x; ++x)
+            {
+                float absmax = 0.f;
+                for (int y = 0; y < num_rows; ++y)
+                {
+                    const auto in = reinterpret_cast<const float *>(src_it.ptr() + y * src_stride);
+                    absmax        = std::max(absmax, std::abs(in[x]));
+                }
+
+                slice_scales[x]       = scale_from_absmax(absmax);
+                const float inv_scale = 1.f / slice_scales[x];
+                for (int y = 0; y < num_rows; ++y)
+                {
+                    const auto in = reinterpret_cast<const float *>(src_it.ptr() + y * src_stride) + x;
+                    *(reinterpret_cast<int8_t *>(dst_it.ptr() + y * dst_stride) + x) =
+                        quantize_symmetric(*in, inv_scale);
+                }
+            }
+        },
+        src_it, dst_it);
+}
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales, bool per_column)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst, scales);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->tensor_shape().total_size() == 0);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    if (scales->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(scales->tensor_shape().total_size() != num_scales(*src, per_column),
+                                        "Scales must hold one value per row or per column of the source");
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuDynamicQuantizeKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales, bool per_column)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizeKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, scales);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, scales, per_column));
+
+    _per_column = per_column;
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(
+        *dst, src->clone()->set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo(1.f, 0)));
+    auto_init_if_empty(*scales, TensorShape(num_scales(*src, per_column)), 1, DataType::F32);
+
+    // Each row is processed as a whole when quantizing per row, each 2D slice when quantizing per column
+    Window win = calculate_max_window(*src, Steps());
+    win.set(per_column ? Window::DimY : Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuDynamicQuantizeKernel::validate(const ITensorInfo *src,
+                                          const ITensorInfo *dst,
+                                          const ITensorInfo *scales,
+                                          bool               per_column)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizeKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, scales, per_column));
+    return Status{};
+}
+
+size_t CpuDynamicQuantizeKernel::split_dimension() const
+{
+    return _per_column ? Window::DimX : Window::DimY;
+}
+
+void CpuDynamicQuantizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizeKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const auto src    = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst    = tensors.get_tensor(TensorType::ACL_DST_0);
+    auto       scales = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    if (_per_column)
+    {
+        quantize_per_column(src, dst, scales, window);
+    }
+    else
+    {
+        quantize_per_row(src, dst, scales, window);
+    }
+}
+
+const char *CpuDynamicQuantizeKernel::name() const
+{
+    return "CpuDynamicQuantizeKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
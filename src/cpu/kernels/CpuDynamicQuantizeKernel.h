@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUDYNAMICQUANTIZEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUDYNAMICQUANTIZEKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to quantize an F32 tensor to QASYMM8_SIGNED with scales computed at run time
+ *
+ * Each row, or each column, of the source is quantized symmetrically with its own scale, chosen so that its largest
+ * absolute value maps to 127. The largest absolute value and the quantization are computed in a single pass over the
+ * source, and the scales are written to a separate tensor so the consumer of the quantized data can dequantize it.
+ *
+ * @note The quantization info of the destination is not updated: all its values have to be read with the scales.
+ */
+class CpuDynamicQuantizeKernel : public ICpuKernel<CpuDynamicQuantizeKernel>
+{
+public:
+    /** Default constructor */
+    CpuDynamicQuantizeKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicQuantizeKernel);
+    /** Set the input, output and scales.
+     *
+     * @param[in]  src        Source tensor info. Data types supported: F32.
+     * @param[out] dst        Destination tensor info with the same shape as @p src. Data types supported: QASYMM8_SIGNED.
+     * @param[out] scales     1D destination tensor info of the scales. Data types supported: F32.
+     *                        Holds one scale per row of @p src, or one scale per column of each 2D slice of @p src
+     *                        when @p per_column is true.
+     * @param[in]  per_column (Optional) Compute one scale per column instead of one scale per row. Defaults to false.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales, bool per_column = false);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDynamicQuantizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales, bool per_column = false);
+
+    /** Dimension along which the kernel window has to be split
+     *
+     * @return Window::DimX when quantizing per column, Window::DimY otherwise
+     */
+    size_t split_dimension() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    bool _per_column{false};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUDYNAMICQUANTIZEKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,16 +35,6 @@
 
 #include <arm_neon.h>
 
-#if defined(ENABLE_FP32_KERNELS)
-namespace
-{
-static constexpr size_t default_min_max_mws_N1_fp32_neon = 25308;
-static constexpr size_t default_min_max_mws_V1_fp32_neon = 34772;
-static constexpr size_t default_div_mws_N1_fp32_neon     = 19043;
-static constexpr size_t default_div_mws_V1_fp32_neon     = 25511;
-} // namespace
-#endif /* ENABLE_FP32_KERNELS */
-
 namespace arm_compute
 {
 namespace cpu
@@ -172,6 +162,32 @@ const std::vector<CpuElementwiseKernel<CpuComparisonKernel>::ElementwiseKernel>
      { return data.dt == DataType::F16 && data.isa.fp16 && static_cast<ComparisonOperation>(data.op) == op; },
      REGISTER_FP16_NEON(neon_fp16_comparison_elementwise_binary<op>)},
 };
+
+/** Short tag of an arithmetic operation used to key the minimum workload size table */
+const char *arithmetic_operation_tag(ArithmeticOperation op)
+{
+    switch (op)
+    {
+        case ArithmeticOperation::ADD:
+            return "add";
+        case ArithmeticOperation::SUB:
+            return "sub";
+        case ArithmeticOperation::DIV:
+            return "div";
+        case ArithmeticOperation::MIN:
+            return "min";
+        case ArithmeticOperation::MAX:
+            return "max";
+        case ArithmeticOperation::SQUARED_DIFF:
+            return "squared_diff";
+        case ArithmeticOperation::POWER:
+            return "power";
+        case ArithmeticOperation::PRELU:
+            return "prelu";
+        default:
+            ARM_COMPUTE_ERROR("Unsupported arithmetic operation");
+    }
+}
 } // namespace
 
 const std::vector<CpuElementwiseKernel<CpuArithmeticKernel>::ElementwiseKernel> &
@@ -272,7 +288,10 @@ void CpuArithmeticKernel::configure_common(const ITensorInfo *src0, const ITenso
 
     auto shape_and_window = compute_output_shape_and_window(src0->tensor_shape(), src1->tensor_shape());
     auto_init_if_empty(*dst, shape_and_window.first, 1, src0->data_type());
-    ICpuKernel::configure(shape_and_window.second);
+
+    // The same micro-kernel serves several operations, so the minimum workload sizes are keyed by operation too
+    const std::string mws_key = _name + ":" + arithmetic_operation_tag(_op);
+    ICpuKernel::configure(shape_and_window.second, mws_key.c_str());
 }
 
 void CpuComparisonKernel::configure_common(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst)
@@ -373,42 +392,9 @@ size_t CpuArithmeticKernel::get_mws(const CPUInfo &platform, size_t thread_count
 {
     ARM_COMPUTE_UNUSED(thread_count);
 
-#if defined(ENABLE_FP32_KERNELS)
-    if (this->_run_method == &neon_fp32_elementwise_binary<ArithmeticOperation::MIN> ||
-        this->_run_method == &neon_fp32_elementwise_binary<ArithmeticOperation::MAX>)
-    {
-        size_t mws = ICPPKernel::default_mws;
-        if (platform.get_cpu_model() == CPUModel::N1)
-        {
-            mws = default_min_max_mws_N1_fp32_neon;
-        }
-        else if (platform.get_cpu_model() == CPUModel::V1)
-        {
-            mws = default_min_max_mws_V1_fp32_neon;
-        }
-        else
-        {
-            return ICPPKernel::default_mws;
-        }
-
-        // tensor is 1D or was re-interpreted as 1D
-        if (this->window().shape().num_dimensions() == 1)
-        {
-            return mws;
-        }
-        else
-        {
-            // scale mws down by the number of elements along all the dimensions (x, z, w, etc) except the one
-            // that we parallelize along (the y dimension). This allows for parallelization when the Y_SIZE is small
-            // but the other sizes are large, which boosts performance.
-            mws = static_cast<size_t>(mws / (this->window().num_iterations_total() / this->window().num_iterations(1)));
-            return std::max(static_cast<size_t>(1), mws);
-        }
-    }
-#else  /* ENABLE_FP32_KERNELS */
-    ARM_COMPUTE_UNUSED(platform);
-#endif /* ENABLE_FP32_KERNELS */
-    return ICPPKernel::default_mws;
+    size_t mws = ICPPKernel::default_mws;
+    lookup_mws(_mws_entry, platform, window(), mws);
+    return mws;
 }
 
 /** The division operator */
@@ -421,47 +407,6 @@ void CpuDivisionKernel::configure(const ITensorInfo *src0, const ITensorInfo *sr
     CpuArithmeticKernel::configure_common(src0, src1, dst);
 }
 
-size_t CpuDivisionKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
-{
-    ARM_COMPUTE_UNUSED(thread_count);
-
-#if defined(ENABLE_FP32_KERNELS)
-    if (this->_run_method == &neon_fp32_elementwise_binary<ArithmeticOperation::DIV>)
-    {
-        size_t mws = ICPPKernel::default_mws;
-        if (platform.get_cpu_model() == CPUModel::N1)
-        {
-            mws = default_div_mws_N1_fp32_neon;
-        }
-        else if (platform.get_cpu_model() == CPUModel::V1)
-        {
-            mws = default_div_mws_V1_fp32_neon;
-        }
-        else
-        {
-            return ICPPKernel::default_mws;
-        }
-
-        // tensor is 1D or was re-interpreted as 1D
-        if (this->window().shape().num_dimensions() == 1)
-        {
-            return mws;
-        }
-        else
-        {
-            // scale mws down by the number of elements along all the dimensions (x, z, w, etc) except the one
-            // that we parallelize along (the y dimension). This allows for parallelization when the Y_SIZE is small
-            // but the other sizes are large, which boosts performance.
-            mws = static_cast<size_t>(mws / (this->window().num_iterations_total() / this->window().num_iterations(1)));
-            return std::max(static_cast<size_t>(1), mws);
-        }
-    }
-#else  /* ENABLE_FP32_KERNELS */
-    ARM_COMPUTE_UNUSED(platform);
-#endif /* ENABLE_FP32_KERNELS */
-    return ICPPKernel::default_mws;
-}
-
 Status CpuDivisionKernel::validate_arguments(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo &dst)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&src0, 1, DataType::S32, DataType::F16, DataType::F32);
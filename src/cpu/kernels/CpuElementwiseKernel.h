@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2025 Arm Limited.
+ * Copyright (c) 2021-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -106,6 +106,9 @@ public:
     static const std::vector<CpuElementwiseKernel<CpuArithmeticKernel>::ElementwiseKernel> &get_available_kernels();
 
     /** Return minimum workload size of the relevant kernel
+     *
+     * The value comes from the @ref CpuMwsTable entry of the kernel name and operation, e.g.
+     * "CpuArithmeticKernel/neon_fp32_arithmetic:min", resolved when the kernel was configured.
      *
      * @param[in] platform     The CPU platform used to create the context.
      * @param[in] thread_count Number of threads in the execution.
@@ -145,15 +148,6 @@ public:
      */
     static Status validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst);
 
-    /** Return minimum workload size of the relevant kernel
-     *
-     * @param[in] platform     The CPU platform used to create the context.
-     * @param[in] thread_count Number of threads in the execution.
-     *
-     * @return[out] mws Minimum workload size for requested configuration.
-     */
-    size_t get_mws(const CPUInfo &platform, size_t thread_count) const override;
-
 protected:
     // Inherited methods overridden:
     static Status validate_arguments(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo &dst);
@@ -112,6 +112,13 @@ std::unique_ptr<uint8_t[]> q8_prepare_lut(ElementWiseUnary op, const ITensorInfo
     return lut;
 }
 
+/* Operations evaluated through a full-range table for FP16, the remaining ones are cheaper to compute directly */
+bool is_fp16_lut_supported(ElementWiseUnary op)
+{
+    return op == ElementWiseUnary::EXP || op == ElementWiseUnary::LOG || op == ElementWiseUnary::RSQRT ||
+           op == ElementWiseUnary::SIN;
+}
+
 #endif // __aarch64__
 
 static const std::vector<CpuElementwiseUnaryKernel::ElementwiseUnaryKernel> available_kernels = {
@@ -201,6 +208,16 @@ void CpuElementwiseUnaryKernel::configure(ElementWiseUnary op, const ITensorInfo
         _lut = uk->prepare_func(op, &src, &dst);
     }
 
+#ifdef __aarch64__
+    // FP16 tables are shared through LUTManager across all the kernels using the same operation
+    _lut_fp16 = nullptr;
+    if (std::string(uk->name) == "neon_fp16_elementwise_unary" && is_fp16_lut_supported(op))
+    {
+        const LUTInfo info = {op, src.data_type(), src.quantization_info().uniform()};
+        _lut_fp16          = LUTManager::get_instance().get_lut_table<LookupTable65536>(info);
+    }
+#endif // __aarch64__
+
     // If input shape is dynamic, expect a configured window and dst at run-time.
     if (src.is_dynamic())
     {
@@ -277,7 +294,15 @@ void CpuElementwiseUnaryKernel::run_op(ITensorPack &tensors, const Window &windo
         ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(src, dst);
     }
 
-    _run_method(src, dst, window, _op, _lut.get());
+    const uint8_t *lut = _lut.get();
+#ifdef __aarch64__
+    if (_lut_fp16 != nullptr)
+    {
+        lut = reinterpret_cast<const uint8_t *>(_lut_fp16->data());
+    }
+#endif // __aarch64__
+
+    _run_method(src, dst, window, _op, lut);
 }
 
 const char *CpuElementwiseUnaryKernel::name() const
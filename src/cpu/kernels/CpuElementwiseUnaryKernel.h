@@ -27,6 +27,7 @@
 #include "arm_compute/core/Types.h"
 
 #include "src/core/common/Macros.h"
+#include "src/core/helpers/LUTManager.h"
 #include "src/cpu/ICpuKernel.h"
 
 namespace arm_compute
@@ -86,6 +87,9 @@ private:
     ElementwiseUnaryUkernelPtr _run_method{nullptr};
     std::string                _name{};
     std::unique_ptr<uint8_t[]> _lut{};
+#ifdef __aarch64__
+    std::shared_ptr<LookupTable65536> _lut_fp16{nullptr};
+#endif // __aarch64__
 };
 } // namespace kernels
 } // namespace cpu
@@ -93,7 +93,7 @@ void CpuFloorKernel::configure(const ITensorInfo *src, ITensorInfo *dst)
     // Configure kernel window
     const Window win = calculate_max_window(*src, Steps());
 
-    ICPPKernel::configure(win);
+    ICpuKernel::configure(win);
 }
 
 Window CpuFloorKernel::infer_window(const ITensorInfo *src, const ITensorInfo *dst)
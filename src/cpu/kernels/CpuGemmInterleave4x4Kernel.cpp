@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,7 +57,7 @@ void CpuGemmInterleave4x4Kernel::configure(const ITensorInfo *src, ITensorInfo *
     ARM_COMPUTE_ERROR_THROW_ON(CpuGemmInterleave4x4Kernel::validate(src, dst));
 
     Window win = calculate_max_window(*src, Steps(1, 4));
-    ICPPKernel::configure(win);
+    ICpuKernel::configure(win);
 }
 
 Status CpuGemmInterleave4x4Kernel::validate(const ITensorInfo *src, const ITensorInfo *dst)
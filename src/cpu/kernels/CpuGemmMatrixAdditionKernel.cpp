@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, 2025 Arm Limited.
+ * Copyright (c) 2016-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -69,7 +69,7 @@ void CpuGemmMatrixAdditionKernel::configure(const ITensorInfo *src, ITensorInfo
     _func = uk->ukernel;
     // Configure kernel window
     Window win = calculate_max_window(*src, Steps());
-    ICPPKernel::configure(win);
+    ICpuKernel::configure(win);
 }
 
 Status CpuGemmMatrixAdditionKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, float beta)
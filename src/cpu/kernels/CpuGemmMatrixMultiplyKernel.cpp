@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -188,7 +188,7 @@ void CpuGemmMatrixMultiplyKernel::configure(const ITensorInfo     *lhs,
     ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
     _func = uk->ukernel;
 
-    ICPPKernel::configure(win);
+    ICpuKernel::configure(win);
 }
 
 Status CpuGemmMatrixMultiplyKernel::validate(const ITensorInfo     *lhs,
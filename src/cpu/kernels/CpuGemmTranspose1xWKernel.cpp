@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,7 +59,7 @@ void CpuGemmTranspose1xWKernel::configure(const ITensorInfo *src, ITensorInfo *d
 
     // Configure kernel window
     Window win = calculate_max_window(*src, Steps(vector_size));
-    ICPPKernel::configure(win);
+    ICpuKernel::configure(win);
 }
 
 Status CpuGemmTranspose1xWKernel::validate(const ITensorInfo *src, const ITensorInfo *dst)
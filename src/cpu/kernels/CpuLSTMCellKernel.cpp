@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuLSTMCellKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/lstm_cell/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuLSTMCellKernel::LSTMCellKernel> available_kernels = {
+    {"neon_fp32_lstm_cell", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_lstm_cell)},
+    {"neon_fp16_lstm_cell",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_lstm_cell)},
+};
+
+Status validate_arguments(const ITensorInfo        *gates,
+                          const ITensorInfo        *cell_state_in,
+                          const ITensorInfo        *coefficients,
+                          const ITensorInfo        *cell_state_out,
+                          const ITensorInfo        *output_state,
+                          const ITensorInfo        *scratch_buffer,
+                          const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(gates, cell_state_in, coefficients, cell_state_out, output_state,
+                                        scratch_buffer);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(gates);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gates, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, cell_state_in, coefficients);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(gates, cell_state_in, coefficients);
+
+    using ActFunction          = ActivationLayerInfo::ActivationFunction;
+    const ActFunction act_func = info.act_info.activation();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(act_func != ActFunction::LOGISTIC && act_func != ActFunction::TANH &&
+                                        act_func != ActFunction::RELU && act_func != ActFunction::BOUNDED_RELU &&
+                                        act_func != ActFunction::LU_BOUNDED_RELU &&
+                                        act_func != ActFunction::IDENTITY,
+                                    "Activation function not supported by the fused LSTM cell");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.cell_threshold < 0.f);
+
+    const size_t num_gates   = info.has_cifg_opt ? 3 : 4;
+    const size_t num_units   = cell_state_in->dimension(0);
+    const size_t num_batches = cell_state_in->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(0) != num_units * num_gates);
+    ARM_COMPUTE_RETURN_ERROR_ON(gates->dimension(1) != num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON(coefficients->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(coefficients->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(coefficients->dimension(1) != static_cast<size_t>(LSTMCellCoefficient::Count));
+
+    const ITensorInfo *state_outputs[] = {cell_state_out, output_state};
+    for (const ITensorInfo *dst : state_outputs)
+    {
+        if (dst->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(cell_state_in, dst);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, dst);
+        }
+    }
+    if (scratch_buffer->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(gates, scratch_buffer);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(gates, scratch_buffer);
+    }
+
+    const auto uk = CpuLSTMCellKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{gates->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuLSTMCellKernel::configure(const ITensorInfo        *gates,
+                                  const ITensorInfo        *cell_state_in,
+                                  const ITensorInfo        *coefficients,
+                                  ITensorInfo              *cell_state_out,
+                                  ITensorInfo              *output_state,
+                                  ITensorInfo              *scratch_buffer,
+                                  const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuLSTMCellKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(gates, cell_state_in, coefficients, cell_state_out, output_state, scratch_buffer);
+    ARM_COMPUTE_ERROR_THROW_ON(
+        validate_arguments(gates, cell_state_in, coefficients, cell_state_out, output_state, scratch_buffer, info));
+
+    const auto uk = CpuLSTMCellKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{gates->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuLSTMCellKernel/").append(uk->name);
+
+    // Auto initialize outputs if not initialized
+    auto_init_if_empty(*cell_state_out, *cell_state_in->clone());
+    auto_init_if_empty(*output_state, *cell_state_in->clone());
+    auto_init_if_empty(*scratch_buffer, *gates->clone());
+
+    // Each batch row is processed as a whole, so only the Y dimension can be split across threads
+    Window win = calculate_max_window(*output_state, Steps());
+    ICpuKernel::configure(win);
+}
+
+Status CpuLSTMCellKernel::validate(const ITensorInfo        *gates,
+                                   const ITensorInfo        *cell_state_in,
+                                   const ITensorInfo        *coefficients,
+                                   const ITensorInfo        *cell_state_out,
+                                   const ITensorInfo        *output_state,
+                                   const ITensorInfo        *scratch_buffer,
+                                   const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuLSTMCellKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        validate_arguments(gates, cell_state_in, coefficients, cell_state_out, output_state, scratch_buffer, info));
+    return Status{};
+}
+
+void CpuLSTMCellKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuLSTMCellKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *gates          = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *cell_state_in  = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *coefficients   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *cell_state_out = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *output_state   = tensors.get_tensor(TensorType::ACL_DST_1);
+    ITensor       *scratch_buffer = tensors.get_tensor(TensorType::ACL_DST_2);
+
+    _run_method(gates, cell_state_in, coefficients, cell_state_out, output_state, scratch_buffer, _info, window);
+}
+
+const char *CpuLSTMCellKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuLSTMCellKernel::LSTMCellKernel> &CpuLSTMCellKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
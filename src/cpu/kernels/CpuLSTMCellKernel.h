@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPULSTMCELLKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPULSTMCELLKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute the element-wise part of an LSTM cell in a single pass
+ *
+ * The kernel consumes the output of a single GEMM computed against the concatenation of all the gate
+ * weights and, for every batch row, applies the biases, the peephole connections, the layer normalization
+ * and the gate activations before updating the cell and output states.
+ *
+ * The gate slices of @p gates are laid out as [input, forget, cell, output] (or [forget, cell, output] with CIFG),
+ * while the scratch buffer follows the layout produced by @ref NELSTMLayer, i.e. [input, cell, forget, output]
+ * (or [cell, forget, output] with CIFG).
+ */
+class CpuLSTMCellKernel : public ICpuKernel<CpuLSTMCellKernel>
+{
+private:
+    using LSTMCellKernelPtr = std::add_pointer<void(const ITensor *,
+                                                    const ITensor *,
+                                                    const ITensor *,
+                                                    ITensor *,
+                                                    ITensor *,
+                                                    ITensor *,
+                                                    const LSTMCellKernelInfo &,
+                                                    const Window &)>::type;
+
+public:
+    struct LSTMCellKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LSTMCellKernelPtr            ukernel;
+    };
+
+    CpuLSTMCellKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLSTMCellKernel);
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * Valid data type configurations:
+     * |src0 - src2 |dst0 - dst2 |
+     * |:-----------|:-----------|
+     * |F16         |F16         |
+     * |F32         |F32         |
+     *
+     * @param[in]  gates          Output of the fused gate GEMM with dimensions [num_units * 4, batch_size],
+     *                            or [num_units * 3, batch_size] with CIFG. Data types supported: F16/F32.
+     * @param[in]  cell_state_in  2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[in]  coefficients   2D tensor with dimensions [num_units, @ref LSTMCellCoefficient::Count] holding the
+     *                            per-unit biases, peephole and layer normalization weights. Data type supported: Same as @p gates.
+     * @param[out] cell_state_out 2D tensor with dimensions [num_units, batch_size]. Data type supported: Same as @p gates.
+     * @param[out] output_state   2D tensor with dimensions [num_units, batch_size] holding the output state before the
+     *                            optional projection. Data type supported: Same as @p gates.
+     * @param[out] scratch_buffer 2D tensor with the same dimensions as @p gates. Data type supported: Same as @p gates.
+     * @param[in]  info           Descriptor of the LSTM cell.
+     */
+    void configure(const ITensorInfo        *gates,
+                   const ITensorInfo        *cell_state_in,
+                   const ITensorInfo        *coefficients,
+                   ITensorInfo              *cell_state_out,
+                   ITensorInfo              *output_state,
+                   ITensorInfo              *scratch_buffer,
+                   const LSTMCellKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLSTMCellKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *gates,
+                           const ITensorInfo        *cell_state_in,
+                           const ITensorInfo        *coefficients,
+                           const ITensorInfo        *cell_state_out,
+                           const ITensorInfo        *output_state,
+                           const ITensorInfo        *scratch_buffer,
+                           const LSTMCellKernelInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<LSTMCellKernel> &get_available_kernels();
+
+private:
+    LSTMCellKernelInfo _info{};
+    LSTMCellKernelPtr  _run_method{nullptr};
+    std::string        _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPULSTMCELLKERNEL_H
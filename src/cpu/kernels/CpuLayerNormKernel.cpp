@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuLayerNormKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/Utils.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/layernorm/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuLayerNormKernel::LayerNormKernel> available_kernels = {
+    {"sve_fp32_layer_norm",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32 && data.isa.sve; },
+     REGISTER_FP32_SVE(arm_compute::cpu::sve_fp32_layer_norm)},
+    {"sve_fp16_layer_norm",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.sve && data.isa.fp16; },
+     REGISTER_FP16_SVE(arm_compute::cpu::sve_fp16_layer_norm)},
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+    {"sve_bf16_layer_norm",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16 && data.isa.sve; },
+     REGISTER_BF16_SVE(arm_compute::cpu::sve_bf16_layer_norm)},
+#endif // defined(ARM_COMPUTE_ENABLE_SVE)
+#endif // defined(ARM_COMPUTE_ENABLE_BF16)
+    {"neon_fp32_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_layer_norm)},
+    {"neon_fp16_layer_norm",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_layer_norm)},
+    // BF16 values are widened and narrowed with integer instructions, so FEAT_BF16 is not required
+    {"neon_bf16_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16; },
+     REGISTER_BF16_NEON(arm_compute::cpu::neon_bf16_layer_norm)},
+};
+
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *residual,
+                          const ITensorInfo         *gamma,
+                          const ITensorInfo         *beta,
+                          const ITensorInfo         *dst,
+                          const ITensorInfo         *residual_out,
+                          const LayerNormKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, gamma, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32, DataType::BFLOAT16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src, gamma);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->tensor_shape().total_size() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.epsilon < 0.f);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, gamma);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gamma->num_dimensions() > 1, "Gamma must be a 1D tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON(gamma->dimension(0) != src->dimension(0));
+    if (beta != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.rms_norm, "RMS normalization does not have a beta tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, beta);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(gamma, beta);
+    }
+
+    if (residual != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, residual);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, residual);
+    }
+    if (residual_out != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(residual == nullptr, "The residual sum can only be written with a residual");
+        if (residual_out->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, residual_out);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, residual_out);
+        }
+    }
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+        if (dst->data_type() == DataType::QASYMM8_SIGNED)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(dst->quantization_info().uniform().scale <= 0.f);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        }
+    }
+
+    const auto uk = CpuLayerNormKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+/** Whether the rows of an optional tensor can be addressed across the collapsed dimensions above Y */
+bool can_collapse(const ITensorInfo *info)
+{
+    return info == nullptr || !has_holes(*info, info->num_dimensions() - 1);
+}
+} // namespace
+
+void CpuLayerNormKernel::configure(const ITensorInfo         *src,
+                                   const ITensorInfo         *residual,
+                                   const ITensorInfo         *gamma,
+                                   const ITensorInfo         *beta,
+                                   ITensorInfo               *dst,
+                                   ITensorInfo               *residual_out,
+                                   const LayerNormKernelInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuLayerNormKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, gamma, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, residual, gamma, beta, dst, residual_out, info));
+
+    const auto uk = CpuLayerNormKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuLayerNormKernel/").append(uk->name);
+
+    // Auto initialize outputs if not initialized
+    auto_init_if_empty(*dst, *src->clone());
+    if (residual_out != nullptr)
+    {
+        auto_init_if_empty(*residual_out, *src->clone());
+    }
+
+    // Each row is processed as a whole and addressed through its coordinates, so the dimensions above Y can only be
+    // collapsed into Y when none of the tensors has holes, e.g. padding or the strides of a sub-tensor
+    Window win = calculate_max_window(*src, Steps());
+    if (can_collapse(src) && can_collapse(residual) && can_collapse(dst) && can_collapse(residual_out))
+    {
+        win = win.collapse(win, Window::DimY);
+    }
+    ICpuKernel::configure(win);
+}
+
+Status CpuLayerNormKernel::validate(const ITensorInfo         *src,
+                                    const ITensorInfo         *residual,
+                                    const ITensorInfo         *gamma,
+                                    const ITensorInfo         *beta,
+                                    const ITensorInfo         *dst,
+                                    const ITensorInfo         *residual_out,
+                                    const LayerNormKernelInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuLayerNormKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, residual, gamma, beta, dst, residual_out, info));
+    return Status{};
+}
+
+void CpuLayerNormKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuLayerNormKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src          = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *residual     = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *gamma        = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *beta         = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst          = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *residual_out = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(src, residual, gamma, beta, dst, residual_out, _info, window);
+}
+
+uint64_t CpuLayerNormKernel::get_flop_count(const ITensorPack &tensors) const
+{
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    if (src == nullptr)
+    {
+        return 0;
+    }
+
+    // Statistics and normalization, i.e. about 3 multiply-accumulates per element, plus the residual addition
+    const bool     has_residual = tensors.get_const_tensor(TensorType::ACL_SRC_1) != nullptr;
+    const uint64_t num_elements = src->info()->tensor_shape().total_size();
+    return num_elements * (has_residual ? 7 : 6);
+}
+
+const char *CpuLayerNormKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuLayerNormKernel::LayerNormKernel> &CpuLayerNormKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
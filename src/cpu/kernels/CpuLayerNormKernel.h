@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPULAYERNORMKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPULAYERNORMKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute a layer or RMS normalization, optionally preceded by a residual addition
+ *
+ * Each row along the X axis is processed in a single pass over its elements to accumulate the statistics,
+ * followed by a second pass that normalizes them, applies the affine parameters and writes the destination.
+ * The optional residual sum is written while accumulating the statistics. All arithmetic is done in F32.
+ *
+ * Layer normalization: dst = (x - mean(x)) / sqrt(var(x) + epsilon) * gamma + beta
+ * RMS normalization:   dst = x / sqrt(mean(x^2) + epsilon) * gamma
+ *
+ * where x = src + residual, or x = src without residual.
+ */
+class CpuLayerNormKernel : public ICpuKernel<CpuLayerNormKernel>
+{
+private:
+    using LayerNormKernelPtr = std::add_pointer<void(const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     ITensor *,
+                                                     ITensor *,
+                                                     const LayerNormKernelInfo &,
+                                                     const Window &)>::type;
+
+public:
+    struct LayerNormKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LayerNormKernelPtr           ukernel;
+    };
+
+    CpuLayerNormKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLayerNormKernel);
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * Valid data type configurations:
+     * |src - beta  |dst            |residual_out |
+     * |:-----------|:--------------|:------------|
+     * |F32         |F32            |F32          |
+     * |F32         |QASYMM8_SIGNED |F32          |
+     * |F16         |F16            |F16          |
+     * |F16         |QASYMM8_SIGNED |F16          |
+     * |BFLOAT16    |BFLOAT16       |BFLOAT16     |
+     * |BFLOAT16    |QASYMM8_SIGNED |BFLOAT16     |
+     *
+     * @param[in]  src          Source tensor info. Rows are normalized along the X axis. Data types supported: F16/F32/BFLOAT16.
+     * @param[in]  residual     (Optional) Tensor info added to @p src before the normalization. Can be nullptr.
+     *                          Data type supported: Same as @p src. Shape supported: Same as @p src.
+     * @param[in]  gamma        1D tensor info with the scale of each element of a row. Data type supported: Same as @p src.
+     * @param[in]  beta         (Optional) 1D tensor info with the bias of each element of a row. Must be nullptr for
+     *                          RMS normalization. Data type supported: Same as @p src.
+     * @param[out] dst          Destination tensor info. Data types supported: Same as @p src or QASYMM8_SIGNED.
+     * @param[out] residual_out (Optional) Destination tensor info of the residual sum. Can be nullptr, and must be
+     *                          nullptr without @p residual. Data type supported: Same as @p src.
+     * @param[in]  info         Descriptor of the normalization.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *residual,
+                   const ITensorInfo         *gamma,
+                   const ITensorInfo         *beta,
+                   ITensorInfo               *dst,
+                   ITensorInfo               *residual_out,
+                   const LayerNormKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLayerNormKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *residual,
+                           const ITensorInfo         *gamma,
+                           const ITensorInfo         *beta,
+                           const ITensorInfo         *dst,
+                           const ITensorInfo         *residual_out,
+                           const LayerNormKernelInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    uint64_t    get_flop_count(const ITensorPack &tensors) const override;
+    const char *name() const override;
+
+    static const std::vector<LayerNormKernel> &get_available_kernels();
+
+private:
+    LayerNormKernelInfo _info{};
+    LayerNormKernelPtr  _run_method{nullptr};
+    std::string         _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPULAYERNORMKERNEL_H
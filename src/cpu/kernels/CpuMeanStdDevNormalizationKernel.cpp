@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -114,7 +114,7 @@ void CpuMeanStdDevNormalizationKernel::configure(ITensorInfo *input, ITensorInfo
     // Configure kernel window
     auto win_config = validate_and_configure_window(input, (output == nullptr) ? nullptr : output);
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
-    ICPPKernel::configure(win_config.second);
+    ICpuKernel::configure(win_config.second);
 }
 
 Status CpuMeanStdDevNormalizationKernel::validate(const ITensorInfo *input, const ITensorInfo *output, float epsilon)
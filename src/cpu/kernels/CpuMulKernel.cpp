@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/StringUtils.h"
 
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/common/Registrars.h"
@@ -41,10 +43,6 @@
 
 namespace
 {
-#if defined(ENABLE_FP32_KERNELS)
-static constexpr size_t default_mws_N1_fp32_neon = 22447;
-static constexpr size_t default_mws_V1_fp32_neon = 38982;
-#endif /* ENABLE_FP32_KERNELS */
 static constexpr size_t default_mws_other_platforms_1d_tensor = 10240;
 } // namespace
 namespace arm_compute
@@ -1723,53 +1721,23 @@ void CpuMulKernel::configure(ITensorInfo   *src1,
     Window win;
     std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src1, *src2);
 
-    ICpuKernel::configure(win);
+    // The micro-kernels are selected by data types, so are the minimum workload sizes, e.g. "CpuMulKernel:f32_f32_f32"
+    const std::string mws_key = std::string(name()) + ":" + lower_string(string_from_data_type(dt_input1)) + "_" +
+                                lower_string(string_from_data_type(dt_input2)) + "_" +
+                                lower_string(string_from_data_type(dt_output));
+
+    ICpuKernel::configure(win, mws_key.c_str());
 }
 
 size_t CpuMulKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
 {
     ARM_COMPUTE_UNUSED(thread_count);
 
-#if defined(ENABLE_FP32_KERNELS)
-    if (this->_func_float == &mul_F32_F32_F32)
+    size_t mws = ICPPKernel::default_mws;
+    if (lookup_mws(_mws_entry, platform, window(), mws))
     {
-        size_t mws = ICPPKernel::default_mws;
-        if (platform.get_cpu_model() == CPUModel::N1)
-        {
-            mws = default_mws_N1_fp32_neon;
-        }
-        else if (platform.get_cpu_model() == CPUModel::V1)
-        {
-            mws = default_mws_V1_fp32_neon;
-        }
-        else
-        {
-            if (_split_dimension == Window::DimX)
-            {
-                // Don't split the work load too small if the tensor has been reinterpreted as 1D.
-                // This number is loosely chosen as threading overhead in each platform varies wildly.
-                return default_mws_other_platforms_1d_tensor;
-            }
-            return default_mws;
-        }
-
-        // tensor is 1D or was re-interpreted as 1D
-        if (this->window().shape().num_dimensions() == 1)
-        {
-            return mws;
-        }
-        else
-        {
-            // scale mws down by the number of elements along all the dimensions (x, z, w, etc) except the one
-            // that we parallelize along (the y dimension). This allows for parallelization when the Y_SIZE is small
-            // but the other sizes are large, which boosts performance.
-            mws = static_cast<size_t>(mws / (this->window().num_iterations_total() / this->window().num_iterations(1)));
-            return std::max(static_cast<size_t>(1), mws);
-        }
+        return mws;
     }
-#else  /* ENABLE_FP32_KERNELS */
-    ARM_COMPUTE_UNUSED(platform);
-#endif /* ENABLE_FP32_KERNELS */
     if (_split_dimension == Window::DimX)
     {
         // Don't split the work load too small if the tensor has been reinterpreted as 1D.
@@ -36,10 +36,9 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
-namespace
-{
-#include "src/core/NEON/kernels/convolution/common/shims.hpp"
-} // namespace
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstring>
 
 namespace arm_compute
 {
@@ -49,33 +48,21 @@ namespace kernels
 {
 namespace
 {
+/** Number of elements along each of the two transposed dimensions in a cache block */
+constexpr size_t permute_block_size = 32;
+
 inline bool is_permutation_supported(const PermutationVector &v)
 {
-    static const std::array<PermutationVector, 2>  permutations2 = {{
-         PermutationVector(0U, 1U),
-         PermutationVector(1U, 0U),
-    }};
-    static const std::array<PermutationVector, 6>  permutations3 = {{
-         PermutationVector(2U, 0U, 1U),
-         PermutationVector(1U, 2U, 0U),
-         PermutationVector(0U, 1U, 2U),
-         PermutationVector(0U, 2U, 1U),
-         PermutationVector(1U, 0U, 2U),
-         PermutationVector(2U, 1U, 0U),
-    }};
-    static const std::array<PermutationVector, 24> permutations4 = {
-        {PermutationVector(0U, 1U, 2U, 3U), PermutationVector(1U, 0U, 2U, 3U), PermutationVector(2U, 0U, 1U, 3U),
-         PermutationVector(0U, 2U, 1U, 3U), PermutationVector(1U, 2U, 0U, 3U), PermutationVector(2U, 1U, 0U, 3U),
-         PermutationVector(2U, 1U, 3U, 0U), PermutationVector(1U, 2U, 3U, 0U), PermutationVector(3U, 2U, 1U, 0U),
-         PermutationVector(2U, 3U, 1U, 0U), PermutationVector(1U, 3U, 2U, 0U), PermutationVector(3U, 1U, 2U, 0U),
-         PermutationVector(3U, 0U, 2U, 1U), PermutationVector(0U, 3U, 2U, 1U), PermutationVector(2U, 3U, 0U, 1U),
-         PermutationVector(3U, 2U, 0U, 1U), PermutationVector(0U, 2U, 3U, 1U), PermutationVector(2U, 0U, 3U, 1U),
-         PermutationVector(1U, 0U, 3U, 2U), PermutationVector(0U, 1U, 3U, 2U), PermutationVector(3U, 1U, 0U, 2U),
-         PermutationVector(1U, 3U, 0U, 2U), PermutationVector(0U, 3U, 1U, 2U), PermutationVector(3U, 0U, 1U, 2U)}};
-
-    return (permutations2.end() != std::find(permutations2.begin(), permutations2.end(), v)) ||
-           (permutations3.end() != std::find(permutations3.begin(), permutations3.end(), v)) ||
-           (permutations4.end() != std::find(permutations4.begin(), permutations4.end(), v));
+    std::array<bool, Coordinates::num_max_dimensions> used{};
+    for (size_t i = 0; i < v.num_dimensions(); ++i)
+    {
+        if (v[i] >= v.num_dimensions() || used[v[i]])
+        {
+            return false;
+        }
+        used[v[i]] = true;
+    }
+    return true;
 }
 
 Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const PermutationVector &perm)
@@ -103,110 +90,239 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const
     return Status{};
 }
 
+// Register-blocked transposes of a micro tile: the rows of the tile are read from the source with stride
+// src_stride and written as columns of the destination with stride dst_stride (both in bytes).
 template <typename T>
-void run_permute(const Window &window, const ITensor *src, const ITensor *dst, const PermutationVector &perm)
+struct MicroTile;
+
+template <>
+struct MicroTile<uint32_t>
 {
-    // Source window
-    Window window_src = window;
+    static constexpr size_t size = 4;
 
-    // we only support these two configs in src/core/NEON/kernels/convolution/common/shims.hpp, for all others
-    // we have to fall back to C++
-    if (perm == PermutationVector{2U, 0U, 1U} || perm == PermutationVector{1U, 2U, 0U})
+    static inline void transpose(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
     {
-        window_src.set(Window::DimX,
-                       Window::Dimension(window.x().start(), window.x().end(), window.x().end() - window.x().start()));
-        window_src.set(Window::DimY,
-                       Window::Dimension(window.y().start(), window.y().end(), window.y().end() - window.y().start()));
-        window_src.set(Window::DimZ,
-                       Window::Dimension(window.z().start(), window.z().end(), window.z().end() - window.z().start()));
-        window_src.set(3, Window::Dimension(window[3].start(), window[3].end(), window[3].end() - window[3].start()));
+        const uint32x4_t r0 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 0 * src_stride));
+        const uint32x4_t r1 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 1 * src_stride));
+        const uint32x4_t r2 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 2 * src_stride));
+        const uint32x4_t r3 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 3 * src_stride));
+
+        const uint32x4x2_t t01 = vtrnq_u32(r0, r1);
+        const uint32x4x2_t t23 = vtrnq_u32(r2, r3);
+
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 0 * dst_stride),
+                  vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0])));
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 1 * dst_stride),
+                  vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1])));
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 2 * dst_stride),
+                  vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0])));
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 3 * dst_stride),
+                  vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1])));
     }
+};
+
+template <>
+struct MicroTile<uint16_t>
+{
+    static constexpr size_t size = 8;
 
-    // Destination window
-    Window                  window_dst(window);
-    const Window::Dimension zero_window = Window::Dimension(0, 0, 0);
-    for (size_t d = 0; d <= dst->info()->num_dimensions(); ++d)
+    static inline void transpose(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
     {
-        window_dst.set(d, zero_window);
+        uint16x8_t r[8];
+        for (size_t i = 0; i < 8; ++i)
+        {
+            r[i] = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i * src_stride));
+        }
+
+        const uint16x8x2_t t0 = vtrnq_u16(r[0], r[1]);
+        const uint16x8x2_t t1 = vtrnq_u16(r[2], r[3]);
+        const uint16x8x2_t t2 = vtrnq_u16(r[4], r[5]);
+        const uint16x8x2_t t3 = vtrnq_u16(r[6], r[7]);
+
+        const uint32x4x2_t u0 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[0]), vreinterpretq_u32_u16(t1.val[0]));
+        const uint32x4x2_t u1 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[1]), vreinterpretq_u32_u16(t1.val[1]));
+        const uint32x4x2_t u2 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[0]), vreinterpretq_u32_u16(t3.val[0]));
+        const uint32x4x2_t u3 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[1]), vreinterpretq_u32_u16(t3.val[1]));
+
+        // Row i of the destination gathers the i-th column of the 8 source rows
+        const uint32x4_t out[8] = {
+            vcombine_u32(vget_low_u32(u0.val[0]), vget_low_u32(u2.val[0])),
+            vcombine_u32(vget_low_u32(u1.val[0]), vget_low_u32(u3.val[0])),
+            vcombine_u32(vget_low_u32(u0.val[1]), vget_low_u32(u2.val[1])),
+            vcombine_u32(vget_low_u32(u1.val[1]), vget_low_u32(u3.val[1])),
+            vcombine_u32(vget_high_u32(u0.val[0]), vget_high_u32(u2.val[0])),
+            vcombine_u32(vget_high_u32(u1.val[0]), vget_high_u32(u3.val[0])),
+            vcombine_u32(vget_high_u32(u0.val[1]), vget_high_u32(u2.val[1])),
+            vcombine_u32(vget_high_u32(u1.val[1]), vget_high_u32(u3.val[1])),
+        };
+        for (size_t i = 0; i < 8; ++i)
+        {
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst + i * dst_stride), vreinterpretq_u16_u32(out[i]));
+        }
     }
+};
 
-    // Create iterators
-    Iterator src_it(src, window_src);
-    Iterator dst_it(dst, window_dst);
+template <>
+struct MicroTile<uint8_t>
+{
+    static constexpr size_t size = 8;
 
-    // CHW -> HWC
-    if (perm == PermutationVector{2U, 0U, 1U})
+    static inline void transpose(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
     {
-        const int in_row_stride      = src->info()->strides_in_bytes().y() / sizeof(T);
-        const int in_channel_stride  = src->info()->strides_in_bytes().z() / sizeof(T);
-        const int in_batch_stride    = src->info()->strides_in_bytes()[3] / sizeof(T);
-        const int n_cols             = src->info()->tensor_shape().x();
-        const int n_rows             = window_src.y().step();
-        const int n_channels         = src->info()->tensor_shape().z();
-        const int n_batches          = src->info()->tensor_shape()[3];
-        const int out_channel_stride = dst->info()->strides_in_bytes().x() / sizeof(T);
-        const int out_col_stride     = dst->info()->strides_in_bytes().y() / sizeof(T);
-        const int out_row_stride     = dst->info()->strides_in_bytes().z() / sizeof(T);
-        const int out_batch_stride   = dst->info()->strides_in_bytes()[3] / sizeof(T);
-        execute_window_loop(
-            window_src,
-            [&](const Coordinates &id)
-            {
-                const int idx = id[0] * out_col_stride + id[1] * out_row_stride + id[2] * out_channel_stride;
-                reorder::nchw_to_nhwc(reinterpret_cast<const T *>(src_it.ptr()),
-                                      reinterpret_cast<T *>(dst_it.ptr()) + idx, n_batches, n_channels, n_rows, n_cols,
-                                      in_batch_stride, in_channel_stride, in_row_stride, out_batch_stride,
-                                      out_row_stride, out_col_stride);
-            },
-            src_it, dst_it);
+        uint8x8_t r[8];
+        for (size_t i = 0; i < 8; ++i)
+        {
+            r[i] = vld1_u8(src + i * src_stride);
+        }
+
+        const uint8x8x2_t t0 = vtrn_u8(r[0], r[1]);
+        const uint8x8x2_t t1 = vtrn_u8(r[2], r[3]);
+        const uint8x8x2_t t2 = vtrn_u8(r[4], r[5]);
+        const uint8x8x2_t t3 = vtrn_u8(r[6], r[7]);
+
+        const uint16x4x2_t u0 = vtrn_u16(vreinterpret_u16_u8(t0.val[0]), vreinterpret_u16_u8(t1.val[0]));
+        const uint16x4x2_t u1 = vtrn_u16(vreinterpret_u16_u8(t0.val[1]), vreinterpret_u16_u8(t1.val[1]));
+        const uint16x4x2_t u2 = vtrn_u16(vreinterpret_u16_u8(t2.val[0]), vreinterpret_u16_u8(t3.val[0]));
+        const uint16x4x2_t u3 = vtrn_u16(vreinterpret_u16_u8(t2.val[1]), vreinterpret_u16_u8(t3.val[1]));
+
+        const uint32x2x2_t v0 = vtrn_u32(vreinterpret_u32_u16(u0.val[0]), vreinterpret_u32_u16(u2.val[0]));
+        const uint32x2x2_t v1 = vtrn_u32(vreinterpret_u32_u16(u0.val[1]), vreinterpret_u32_u16(u2.val[1]));
+        const uint32x2x2_t v2 = vtrn_u32(vreinterpret_u32_u16(u1.val[0]), vreinterpret_u32_u16(u3.val[0]));
+        const uint32x2x2_t v3 = vtrn_u32(vreinterpret_u32_u16(u1.val[1]), vreinterpret_u32_u16(u3.val[1]));
+
+        const uint32x2_t out[8] = {v0.val[0], v2.val[0], v1.val[0], v3.val[0],
+                                   v0.val[1], v2.val[1], v1.val[1], v3.val[1]};
+        for (size_t i = 0; i < 8; ++i)
+        {
+            vst1_u8(dst + i * dst_stride, vreinterpret_u8_u32(out[i]));
+        }
     }
-    // HWC -> CHW
-    else if (perm == PermutationVector{1U, 2U, 0U})
+};
+
+/** Transpose a block of @p rows x @p cols elements
+ *
+ * Element (i, j) is read at src + i * src_stride + j * sizeof(T) and written at dst + j * dst_stride + i * sizeof(T).
+ */
+template <typename T>
+void transpose_block(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride, size_t rows, size_t cols)
+{
+    constexpr size_t tile = MicroTile<T>::size;
+
+    size_t i = 0;
+    for (; i + tile <= rows; i += tile)
     {
-        const int in_col_stride      = src->info()->strides_in_bytes().y() / sizeof(T);
-        const int in_row_stride      = src->info()->strides_in_bytes().z() / sizeof(T);
-        const int in_batch_stride    = src->info()->strides_in_bytes()[3] / sizeof(T);
-        const int n_channels         = src->info()->tensor_shape().x();
-        const int n_cols             = window_src.y().step();
-        const int n_rows             = src->info()->tensor_shape().z();
-        const int n_batches          = src->info()->tensor_shape()[3];
-        const int out_col_stride     = dst->info()->strides_in_bytes().x() / sizeof(T);
-        const int out_row_stride     = dst->info()->strides_in_bytes().y() / sizeof(T);
-        const int out_channel_stride = dst->info()->strides_in_bytes().z() / sizeof(T);
-        const int out_batch_stride   = dst->info()->strides_in_bytes()[3] / sizeof(T);
-        execute_window_loop(
-            window_src,
-            [&](const Coordinates &id)
+        size_t j = 0;
+        for (; j + tile <= cols; j += tile)
+        {
+            MicroTile<T>::transpose(src + i * src_stride + j * sizeof(T), src_stride, dst + j * dst_stride + i * sizeof(T),
+                                    dst_stride);
+        }
+        // Left-over columns
+        for (; j < cols; ++j)
+        {
+            T *dst_row = reinterpret_cast<T *>(dst + j * dst_stride);
+            for (size_t ii = i; ii < i + tile; ++ii)
             {
-                const int idx = id[0] * out_channel_stride + id[1] * out_col_stride + id[2] * out_row_stride;
-                reorder::nhwc_to_nchw(reinterpret_cast<const T *>(src_it.ptr()),
-                                      reinterpret_cast<T *>(dst_it.ptr()) + idx, n_batches, n_rows, n_cols, n_channels,
-                                      in_batch_stride, in_row_stride, in_col_stride, out_batch_stride,
-                                      out_channel_stride, out_row_stride);
-            },
-            src_it, dst_it);
+                dst_row[ii] = *reinterpret_cast<const T *>(src + ii * src_stride + j * sizeof(T));
+            }
+        }
     }
-    else
+    // Left-over rows
+    if (i < rows)
     {
-        // All other cases fall back to C++
-        // Permute strides
-        Strides strides      = dst->info()->strides_in_bytes();
-        Strides perm_strides = strides;
-        permute_strides(perm_strides, perm);
-        const int perm_stride_3 = src->info()->num_dimensions() >= 4 ? perm_strides[3] : 0;
-        execute_window_loop(
-            window,
-            [&](const Coordinates &id)
+        for (size_t j = 0; j < cols; ++j)
+        {
+            T *dst_row = reinterpret_cast<T *>(dst + j * dst_stride);
+            for (size_t ii = i; ii < rows; ++ii)
             {
-                const int idx =
-                    id[0] * perm_strides[0] + id[1] * perm_strides[1] + id[2] * perm_strides[2] + id[3] * perm_stride_3;
-                *(reinterpret_cast<T *>(dst_it.ptr() + idx)) = *(reinterpret_cast<const T *>(src_it.ptr()));
-            },
-            src_it, dst_it);
+                dst_row[ii] = *reinterpret_cast<const T *>(src + ii * src_stride + j * sizeof(T));
+            }
+        }
     }
 }
 } // namespace
 
+template <typename T>
+void CpuPermuteKernel::run_permute(const ITensor *src, ITensor *dst, const Window &window) const
+{
+    const uint8_t *src_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    const auto  &shape       = _plan.shape;
+    const auto  &src_strides = _plan.src_strides;
+    const auto  &dst_strides = _plan.dst_strides;
+    const size_t outer_start = _plan.tiled ? 2 : 1;
+
+    // Each work item is a row of the destination or, in tiled mode, a block of rows along dimension 1
+    std::array<size_t, max_dims> id{};
+    size_t                       item = window.y().start();
+    if (_plan.tiled)
+    {
+        id[1] = item % _plan.num_blocks;
+        item /= _plan.num_blocks;
+    }
+    for (size_t d = outer_start; d < _plan.num_dims; ++d)
+    {
+        id[d] = item % shape[d];
+        item /= shape[d];
+    }
+
+    for (int it = window.y().start(); it < window.y().end(); ++it)
+    {
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        for (size_t d = outer_start; d < _plan.num_dims; ++d)
+        {
+            src_offset += id[d] * src_strides[d];
+            dst_offset += id[d] * dst_strides[d];
+        }
+
+        if (_plan.tiled)
+        {
+            const size_t j0   = id[1] * permute_block_size;
+            const size_t cols = std::min(permute_block_size, shape[1] - j0);
+            for (size_t i0 = 0; i0 < shape[0]; i0 += permute_block_size)
+            {
+                const size_t rows = std::min(permute_block_size, shape[0] - i0);
+                transpose_block<T>(src_base + src_offset + i0 * src_strides[0] + j0 * sizeof(T), src_strides[0],
+                                   dst_base + dst_offset + j0 * dst_strides[1] + i0 * sizeof(T), dst_strides[1], rows,
+                                   cols);
+            }
+
+            // Move to the next block
+            if (++id[1] < _plan.num_blocks)
+            {
+                continue;
+            }
+            id[1] = 0;
+        }
+        else if (src_strides[0] == sizeof(T) && dst_strides[0] == sizeof(T))
+        {
+            std::memcpy(dst_base + dst_offset, src_base + src_offset, shape[0] * sizeof(T));
+        }
+        else
+        {
+            const uint8_t *src_ptr = src_base + src_offset;
+            uint8_t       *dst_ptr = dst_base + dst_offset;
+            for (size_t x = 0; x < shape[0]; ++x)
+            {
+                *reinterpret_cast<T *>(dst_ptr + x * dst_strides[0]) =
+                    *reinterpret_cast<const T *>(src_ptr + x * src_strides[0]);
+            }
+        }
+
+        // Move to the next row
+        for (size_t d = outer_start; d < _plan.num_dims; ++d)
+        {
+            if (++id[d] < shape[d])
+            {
+                break;
+            }
+            id[d] = 0;
+        }
+    }
+}
+
 void CpuPermuteKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const PermutationVector &perm)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuPermuteKernel::configure");
@@ -218,10 +334,70 @@ void CpuPermuteKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const
     // Perform validation step
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, perm));
 
-    _perm = perm;
+    const size_t element_size = src->element_size();
+
+    // Walk the destination dimensions, dropping unit dimensions and merging the ones that are adjacent in memory
+    // both in the source and in the destination
+    _plan = PermutePlan{};
+    for (size_t d = 0; d < max_dims; ++d)
+    {
+        const size_t size = dst->dimension(d);
+        if (size == 1)
+        {
+            continue;
+        }
+
+        const size_t src_stride = src->strides_in_bytes()[d < perm.num_dimensions() ? perm[d] : d];
+        const size_t dst_stride = dst->strides_in_bytes()[d];
+        const size_t last       = _plan.num_dims - 1;
+        if (_plan.num_dims > 0 && _plan.src_strides[last] * _plan.shape[last] == src_stride &&
+            _plan.dst_strides[last] * _plan.shape[last] == dst_stride)
+        {
+            _plan.shape[last] *= size;
+        }
+        else
+        {
+            _plan.shape[_plan.num_dims]       = size;
+            _plan.src_strides[_plan.num_dims] = src_stride;
+            _plan.dst_strides[_plan.num_dims] = dst_stride;
+            ++_plan.num_dims;
+        }
+    }
+    if (_plan.num_dims == 0)
+    {
+        _plan.num_dims       = 1;
+        _plan.shape[0]       = 1;
+        _plan.src_strides[0] = element_size;
+        _plan.dst_strides[0] = element_size;
+    }
+
+    // When the innermost destination dimension is strided in the source, transpose it in blocks against the
+    // dimension that is contiguous in the source
+    if (_plan.dst_strides[0] == element_size && _plan.src_strides[0] != element_size)
+    {
+        for (size_t d = 1; d < _plan.num_dims; ++d)
+        {
+            if (_plan.src_strides[d] == element_size)
+            {
+                std::swap(_plan.shape[1], _plan.shape[d]);
+                std::swap(_plan.src_strides[1], _plan.src_strides[d]);
+                std::swap(_plan.dst_strides[1], _plan.dst_strides[d]);
+                _plan.tiled      = true;
+                _plan.num_blocks = DIV_CEIL(_plan.shape[1], permute_block_size);
+                break;
+            }
+        }
+    }
+
+    size_t num_items = _plan.tiled ? _plan.num_blocks : 1;
+    for (size_t d = _plan.tiled ? 2 : 1; d < _plan.num_dims; ++d)
+    {
+        num_items *= _plan.shape[d];
+    }
 
-    // Configure kernel window
-    Window win = calculate_max_window(*src, Steps());
+    // Configure kernel window: threads are split across destination rows or blocks
+    Window win;
+    win.set(Window::DimY, Window::Dimension(0, num_items, 1));
 
     // This kernel doesn't need padding so update_window_and_padding() can be skipped
 
@@ -248,13 +424,13 @@ void CpuPermuteKernel::run_op(ITensorPack &tensors, const Window &window, const
     switch (src->info()->element_size())
     {
         case 1:
-            run_permute<uint8_t>(window, src, dst, _perm);
+            run_permute<uint8_t>(src, dst, window);
             break;
         case 2:
-            run_permute<uint16_t>(window, src, dst, _perm);
+            run_permute<uint16_t>(src, dst, window);
             break;
         case 4:
-            run_permute<uint32_t>(window, src, dst, _perm);
+            run_permute<uint32_t>(src, dst, window);
             break;
         default:
             ARM_COMPUTE_ERROR("Element size not supported");
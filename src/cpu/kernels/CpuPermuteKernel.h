@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,13 +27,21 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuKernel.h"
 
+#include <array>
+
 namespace arm_compute
 {
 namespace cpu
 {
 namespace kernels
 {
-/** Kernel to perform tensor permutation given a permutation vector */
+/** Kernel to perform tensor permutation given a permutation vector
+ *
+ * Dimensions that stay adjacent in both the source and the destination are collapsed at configuration time.
+ * When the innermost destination dimension is also contiguous in the source, the kernel copies whole rows,
+ * otherwise it transposes cache-sized blocks of the two dimensions that are contiguous in the source and in the
+ * destination respectively. Work is split across threads by blocks of the destination.
+ */
 class CpuPermuteKernel : public ICpuKernel<CpuPermuteKernel>
 {
 public:
@@ -41,7 +49,7 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPermuteKernel);
     /** Configure kernel for a given list of arguments
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
+     * @note Arbitrary permutation vectors are supported with rank not greater than 6
      *
      * @param[in]  src  Srouce tensor to permute. Data types supported: All
      * @param[out] dst  Destination tensor. Data types supported: Same as @p src
@@ -61,7 +69,27 @@ public:
     const char *name() const override;
 
 private:
-    PermutationVector _perm{};
+    static constexpr size_t max_dims = Coordinates::num_max_dimensions;
+
+    /** Traversal of the permutation once the dimensions have been collapsed
+     *
+     * Dimensions are stored in destination order, except in tiled mode where the dimension that is contiguous in
+     * the source is moved to index 1.
+     */
+    struct PermutePlan
+    {
+        size_t                       num_dims{0};
+        std::array<size_t, max_dims> shape{};
+        std::array<size_t, max_dims> src_strides{};
+        std::array<size_t, max_dims> dst_strides{};
+        bool                         tiled{false};
+        size_t                       num_blocks{1};
+    };
+
+    template <typename T>
+    void run_permute(const ITensor *src, ITensor *dst, const Window &window) const;
+
+    PermutePlan _plan{};
 };
 } // namespace kernels
 } // namespace cpu
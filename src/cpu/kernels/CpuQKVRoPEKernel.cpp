@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuQKVRoPEKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/rope/list.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuQKVRoPEKernel::QKVRoPEKernel> available_kernels = {
+    {"neon_fp32_qkv_rope", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_qkv_rope)},
+    {"neon_fp16_qkv_rope",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_qkv_rope)},
+};
+
+TensorShape compute_q_shape(const ITensorInfo &qkv, const RoPEInfo &info)
+{
+    return TensorShape(info.head_dim, qkv.dimension(1), info.num_heads, qkv.dimension(2));
+}
+
+TensorShape compute_k_shape(const ITensorInfo &qkv, const RoPEInfo &info)
+{
+    return info.transpose_k ? TensorShape(qkv.dimension(1), info.head_dim, info.num_kv_heads, qkv.dimension(2))
+                            : TensorShape(info.head_dim, qkv.dimension(1), info.num_kv_heads, qkv.dimension(2));
+}
+
+TensorShape compute_v_shape(const ITensorInfo &qkv, const RoPEInfo &info)
+{
+    return TensorShape(info.head_dim, qkv.dimension(1), info.num_kv_heads, qkv.dimension(2));
+}
+
+Status validate_output(const ITensorInfo *qkv, const ITensorInfo *dst, const TensorShape &shape)
+{
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(qkv, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->tensor_shape() != shape, "Wrong shape of the Q, K or V heads");
+    }
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo *qkv,
+                          const ITensorInfo *positions,
+                          const ITensorInfo *q,
+                          const ITensorInfo *k,
+                          const ITensorInfo *v,
+                          const RoPEInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(qkv, q, k, v);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(qkv);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(qkv, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(qkv);
+    ARM_COMPUTE_RETURN_ERROR_ON(qkv->num_dimensions() > 3);
+
+    const unsigned int rotary_dim = info.rotary_dim == 0 ? info.head_dim : info.rotary_dim;
+    ARM_COMPUTE_RETURN_ERROR_ON(info.num_heads == 0 || info.num_kv_heads == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_heads % info.num_kv_heads != 0,
+                                    "The number of query heads must be a multiple of the number of key/value heads");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.head_dim == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rotary_dim % 2 != 0 || rotary_dim > info.head_dim,
+                                    "The number of rotated elements must be even and not larger than the head");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.max_position == 0 || info.base <= 0.f);
+    ARM_COMPUTE_RETURN_ERROR_ON(qkv->dimension(0) != (info.num_heads + 2 * info.num_kv_heads) * info.head_dim);
+
+    if (positions != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(positions, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(positions->num_dimensions() > 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(positions->dimension(0) != qkv->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(positions->dimension(1) != 1 && positions->dimension(1) != qkv->dimension(2));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(qkv->dimension(1) > info.max_position,
+                                        "The sequence is longer than the sin/cos table");
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_output(qkv, q, compute_q_shape(*qkv, info)));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_output(qkv, k, compute_k_shape(*qkv, info)));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_output(qkv, v, compute_v_shape(*qkv, info)));
+
+    const auto uk = CpuQKVRoPEKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{qkv->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuQKVRoPEKernel::configure(const ITensorInfo *qkv,
+                                 const ITensorInfo *positions,
+                                 ITensorInfo       *q,
+                                 ITensorInfo       *k,
+                                 ITensorInfo       *v,
+                                 const RoPEInfo    &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuQKVRoPEKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(qkv, q, k, v);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(qkv, positions, q, k, v, info));
+
+    const auto uk = CpuQKVRoPEKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{qkv->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuQKVRoPEKernel/").append(uk->name);
+
+    // Auto initialize outputs if not initialized
+    auto_init_if_empty(*q, qkv->clone()->set_tensor_shape(compute_q_shape(*qkv, info)));
+    auto_init_if_empty(*k, qkv->clone()->set_tensor_shape(compute_k_shape(*qkv, info)));
+    auto_init_if_empty(*v, qkv->clone()->set_tensor_shape(compute_v_shape(*qkv, info)));
+
+    // Cache the cosines followed by the sines of every position, computed in double precision so that the angles
+    // of the large positions stay accurate
+    const unsigned int rotary_dim = info.rotary_dim == 0 ? info.head_dim : info.rotary_dim;
+    const unsigned int half       = rotary_dim / 2;
+    _cos_sin.resize(static_cast<size_t>(info.max_position) * rotary_dim);
+    for (unsigned int p = 0; p < info.max_position; ++p)
+    {
+        float *cos = _cos_sin.data() + static_cast<size_t>(p) * rotary_dim;
+        float *sin = cos + half;
+        for (unsigned int i = 0; i < half; ++i)
+        {
+            const double angle = p * std::pow(static_cast<double>(info.base), -2.0 * i / rotary_dim);
+            cos[i]             = static_cast<float>(std::cos(angle));
+            sin[i]             = static_cast<float>(std::sin(angle));
+        }
+    }
+
+    // Each work item is a head of a token, so that both the prefill and the decoding of a single token can be
+    // split across threads
+    Window win = calculate_max_window(*q, Steps());
+    ICpuKernel::configure(win);
+}
+
+Status CpuQKVRoPEKernel::validate(const ITensorInfo *qkv,
+                                  const ITensorInfo *positions,
+                                  const ITensorInfo *q,
+                                  const ITensorInfo *k,
+                                  const ITensorInfo *v,
+                                  const RoPEInfo    &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuQKVRoPEKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(qkv, positions, q, k, v, info));
+    return Status{};
+}
+
+void CpuQKVRoPEKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuQKVRoPEKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *qkv       = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *positions = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *q         = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *k         = tensors.get_tensor(TensorType::ACL_DST_1);
+    ITensor       *v         = tensors.get_tensor(TensorType::ACL_DST_2);
+
+    _run_method(qkv, positions, q, k, v, _cos_sin.data(), _info, window);
+}
+
+uint64_t CpuQKVRoPEKernel::get_flop_count(const ITensorPack &tensors) const
+{
+    const ITensor *qkv = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    if (qkv == nullptr)
+    {
+        return 0;
+    }
+
+    // Two multiplications and one addition for every rotated element of Q and K
+    const uint64_t rotary_dim = _info.rotary_dim == 0 ? _info.head_dim : _info.rotary_dim;
+    const uint64_t num_tokens = qkv->info()->tensor_shape().total_size_upper(1);
+    return num_tokens * (_info.num_heads + _info.num_kv_heads) * rotary_dim * 3;
+}
+
+const char *CpuQKVRoPEKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuQKVRoPEKernel::QKVRoPEKernel> &CpuQKVRoPEKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
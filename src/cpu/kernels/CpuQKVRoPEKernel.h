@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUQKVROPEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUQKVROPEKERNEL_H
+
+#include "arm_compute/function_info/RoPEInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to split the output of a fused QKV projection into heads and apply the rotary position embedding
+ *
+ * Each row of @p qkv holds the query heads, followed by the key heads and the value heads. The heads are written
+ * in the layout consumed by @ref CpuMatMul for the attention:
+ * - Q: [head_dim, seq_len, num_heads, batch_size], the lhs of Q x K^T.
+ * - K: [seq_len, head_dim, num_kv_heads, batch_size] with @ref RoPEInfo::transpose_k, the rhs of Q x K^T,
+ *      or [head_dim, seq_len, num_kv_heads, batch_size] otherwise.
+ * - V: [head_dim, seq_len, num_kv_heads, batch_size], the rhs of softmax(Q x K^T) x V.
+ *
+ * The sines and cosines of all the positions up to @ref RoPEInfo::max_position are computed once at configuration.
+ */
+class CpuQKVRoPEKernel : public ICpuKernel<CpuQKVRoPEKernel>
+{
+private:
+    using QKVRoPEKernelPtr = std::add_pointer<void(const ITensor *,
+                                                   const ITensor *,
+                                                   ITensor *,
+                                                   ITensor *,
+                                                   ITensor *,
+                                                   const float *,
+                                                   const RoPEInfo &,
+                                                   const Window &)>::type;
+
+public:
+    struct QKVRoPEKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        QKVRoPEKernelPtr             ukernel;
+    };
+
+    CpuQKVRoPEKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuQKVRoPEKernel);
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * Valid data type configurations:
+     * |qkv    |positions |q - v  |
+     * |:------|:---------|:------|
+     * |F16    |S32       |F16    |
+     * |F32    |S32       |F32    |
+     *
+     * @param[in]  qkv       Output of the fused QKV projection with dimensions
+     *                       [(num_heads + 2 * num_kv_heads) * head_dim, seq_len, batch_size]. Data types supported: F16/F32.
+     * @param[in]  positions (Optional) 1D tensor with the position of each token, or 2D tensor with dimensions
+     *                       [seq_len, batch_size]. Can be nullptr, in which case the position of a token is its index
+     *                       in the sequence. The positions must be in [0, max_position), the run fails
+     *                       otherwise. Data type supported: S32.
+     * @param[out] q         Query heads. Data type supported: Same as @p qkv.
+     * @param[out] k         Key heads. Data type supported: Same as @p qkv.
+     * @param[out] v         Value heads. Data type supported: Same as @p qkv.
+     * @param[in]  info      Rotary position embedding information.
+     */
+    void configure(const ITensorInfo *qkv,
+                   const ITensorInfo *positions,
+                   ITensorInfo       *q,
+                   ITensorInfo       *k,
+                   ITensorInfo       *v,
+                   const RoPEInfo    &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuQKVRoPEKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *qkv,
+                           const ITensorInfo *positions,
+                           const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const RoPEInfo    &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    uint64_t    get_flop_count(const ITensorPack &tensors) const override;
+    const char *name() const override;
+
+    static const std::vector<QKVRoPEKernel> &get_available_kernels();
+
+private:
+    RoPEInfo           _info{};
+    std::vector<float> _cos_sin{};
+    QKVRoPEKernelPtr   _run_method{nullptr};
+    std::string        _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUQKVROPEKERNEL_H
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuRecurrentStepKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/recurrent_step/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuRecurrentStepKernel::RecurrentStepKernel> available_kernels = {
+    {"neon_fp32_recurrent_step", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_recurrent_step)},
+    {"neon_fp16_recurrent_step",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_recurrent_step)},
+};
+
+Status validate_arguments(const ITensorInfo             *pre_gates,
+                          const ITensorInfo             *recurrent_weights,
+                          const ITensorInfo             *state_in,
+                          const ITensorInfo             *coefficients,
+                          const ITensorInfo             *cell_state,
+                          const ITensorInfo             *state_out,
+                          const RecurrentStepKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(pre_gates, recurrent_weights, state_in, state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(pre_gates);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(pre_gates, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(pre_gates, recurrent_weights, state_in);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(pre_gates, recurrent_weights, state_in);
+
+    const LSTMCellKernelInfo &cell_info = info.cell_info;
+    using ActFunction                   = ActivationLayerInfo::ActivationFunction;
+    const ActFunction act_func          = cell_info.act_info.activation();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(act_func != ActFunction::LOGISTIC && act_func != ActFunction::TANH &&
+                                        act_func != ActFunction::RELU && act_func != ActFunction::BOUNDED_RELU &&
+                                        act_func != ActFunction::LU_BOUNDED_RELU &&
+                                        act_func != ActFunction::IDENTITY,
+                                    "Activation function not supported by the recurrent step");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(cell_info.use_layer_norm, "Layer normalization is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_info.cell_threshold < 0.f);
+
+    const size_t num_gates   = info.is_lstm ? (cell_info.has_cifg_opt ? 3 : 4) : 1;
+    const size_t num_units   = state_in->dimension(0);
+    const size_t num_batches = state_in->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON(state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(pre_gates->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(pre_gates->dimension(0) != num_units * num_gates);
+    ARM_COMPUTE_RETURN_ERROR_ON(pre_gates->dimension(1) != num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->dimension(1) != num_units * num_gates);
+
+    if (info.is_lstm)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(cell_state);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(state_in, cell_state);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(state_in, cell_state);
+        if (cell_info.has_peephole)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(coefficients);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(pre_gates, coefficients);
+            ARM_COMPUTE_RETURN_ERROR_ON(coefficients->num_dimensions() > 2);
+            ARM_COMPUTE_RETURN_ERROR_ON(coefficients->dimension(0) != num_units);
+            ARM_COMPUTE_RETURN_ERROR_ON(coefficients->dimension(1) != static_cast<size_t>(LSTMCellCoefficient::Count));
+        }
+    }
+
+    if (state_out->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(state_in, state_out);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(state_in, state_out);
+    }
+
+    const auto uk = CpuRecurrentStepKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{pre_gates->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuRecurrentStepKernel::configure(const ITensorInfo             *pre_gates,
+                                       const ITensorInfo             *recurrent_weights,
+                                       const ITensorInfo             *state_in,
+                                       const ITensorInfo             *coefficients,
+                                       ITensorInfo                   *cell_state,
+                                       ITensorInfo                   *state_out,
+                                       const RecurrentStepKernelInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuRecurrentStepKernel::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(pre_gates, recurrent_weights, state_in, state_out);
+    ARM_COMPUTE_ERROR_THROW_ON(
+        validate_arguments(pre_gates, recurrent_weights, state_in, coefficients, cell_state, state_out, info));
+
+    const auto uk = CpuRecurrentStepKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{pre_gates->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuRecurrentStepKernel/").append(uk->name);
+
+    // Auto initialize output if not initialized
+    auto_init_if_empty(*state_out, *state_in->clone());
+
+    // Only the units are part of the window, so that each thread keeps the same slice of recurrent weights
+    Window win = calculate_max_window(TensorShape(state_out->dimension(0)), Steps());
+    ICpuKernel::configure(win);
+}
+
+Status CpuRecurrentStepKernel::validate(const ITensorInfo             *pre_gates,
+                                        const ITensorInfo             *recurrent_weights,
+                                        const ITensorInfo             *state_in,
+                                        const ITensorInfo             *coefficients,
+                                        const ITensorInfo             *cell_state,
+                                        const ITensorInfo             *state_out,
+                                        const RecurrentStepKernelInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuRecurrentStepKernel::validate");
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        validate_arguments(pre_gates, recurrent_weights, state_in, coefficients, cell_state, state_out, info));
+    return Status{};
+}
+
+void CpuRecurrentStepKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuRecurrentStepKernel::run_op");
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *pre_gates         = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *recurrent_weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *state_in          = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *coefficients      = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *cell_state        = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *state_out         = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(pre_gates, recurrent_weights, state_in, coefficients, cell_state, state_out, _info, window);
+}
+
+const char *CpuRecurrentStepKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuRecurrentStepKernel::RecurrentStepKernel> &CpuRecurrentStepKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
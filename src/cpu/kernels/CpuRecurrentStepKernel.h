@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPURECURRENTSTEPKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPURECURRENTSTEPKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute a single timestep of a RNN or LSTM sequence
+ *
+ * The input projection of every timestep is computed up front, so for each unit the kernel only has to add
+ * the product between the recurrent weights and the previous state before applying the cell update.
+ *
+ * The execution window spans the units of the layer: when split along X, each thread always processes the
+ * same units and therefore the same rows of recurrent weights, which stay resident in its caches across steps.
+ *
+ * The gate slices of @p pre_gates and @p recurrent_weights are laid out as [input, forget, cell, output]
+ * (or [forget, cell, output] with CIFG) for LSTM steps.
+ */
+class CpuRecurrentStepKernel : public ICpuKernel<CpuRecurrentStepKernel>
+{
+private:
+    using RecurrentStepKernelPtr = std::add_pointer<void(const ITensor *,
+                                                         const ITensor *,
+                                                         const ITensor *,
+                                                         const ITensor *,
+                                                         ITensor *,
+                                                         ITensor *,
+                                                         const RecurrentStepKernelInfo &,
+                                                         const Window &)>::type;
+
+public:
+    struct RecurrentStepKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        RecurrentStepKernelPtr       ukernel;
+    };
+
+    CpuRecurrentStepKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuRecurrentStepKernel);
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * Valid data type configurations:
+     * |src0 - src3 |dst0 - dst1 |
+     * |:-----------|:-----------|
+     * |F16         |F16         |
+     * |F32         |F32         |
+     *
+     * @param[in]     pre_gates         Input projection of the current step, biases included, with dimensions [num_units * num_gates, batch_size].
+     *                                  num_gates is 1 for RNN steps, 4 for LSTM steps and 3 for LSTM steps with CIFG. Data types supported: F16/F32.
+     * @param[in]     recurrent_weights 2D tensor with dimensions [num_units, num_units * num_gates]. Data type supported: Same as @p pre_gates.
+     * @param[in]     state_in          Output state of the previous step with dimensions [num_units, batch_size]. Data type supported: Same as @p pre_gates.
+     * @param[in]     coefficients      2D tensor with dimensions [num_units, @ref LSTMCellCoefficient::Count] holding the peephole weights.
+     *                                  Only used by LSTM steps with peephole connections, can be nullptr otherwise. Data type supported: Same as @p pre_gates.
+     * @param[in,out] cell_state        Cell state with dimensions [num_units, batch_size], updated in place. Only used by LSTM steps, can be nullptr otherwise.
+     *                                  Data type supported: Same as @p pre_gates.
+     * @param[out]    state_out         Output state with dimensions [num_units, batch_size]. Must not alias @p state_in. Data type supported: Same as @p pre_gates.
+     * @param[in]     info              Descriptor of the recurrent step.
+     */
+    void configure(const ITensorInfo             *pre_gates,
+                   const ITensorInfo             *recurrent_weights,
+                   const ITensorInfo             *state_in,
+                   const ITensorInfo             *coefficients,
+                   ITensorInfo                   *cell_state,
+                   ITensorInfo                   *state_out,
+                   const RecurrentStepKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuRecurrentStepKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *pre_gates,
+                           const ITensorInfo             *recurrent_weights,
+                           const ITensorInfo             *state_in,
+                           const ITensorInfo             *coefficients,
+                           const ITensorInfo             *cell_state,
+                           const ITensorInfo             *state_out,
+                           const RecurrentStepKernelInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<RecurrentStepKernel> &get_available_kernels();
+
+private:
+    RecurrentStepKernelInfo _info{};
+    RecurrentStepKernelPtr  _run_method{nullptr};
+    std::string             _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPURECURRENTSTEPKERNEL_H
@@ -30,6 +30,7 @@
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/common/Registrars.h"
 #include "src/core/CPP/Validate.h"
+#include "src/core/helpers/Utils.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/scatter/list.h"
 
@@ -136,7 +137,7 @@ Status CpuScatterKernel::validate(const ITensorInfo *updates,
     const int32_t index_len = ind_shape[0];
 
     bool unsupported_padding_config =
-        (dst_dims == index_len) && index_len > 1 && (dst->has_padding() || updates->has_padding());
+        (dst_dims == index_len) && index_len > 1 && (has_holes(*dst) || has_holes(*updates));
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(unsupported_padding_config, "Padding is not supported with these shapes.");
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(updates, dst);
@@ -195,7 +196,7 @@ void CpuScatterKernel::run_op(ITensorPack &tensors, const Window &window, const
     const int          index_len = indices->info()->dimension(0);
 
     bool unsupported_padding_config =
-        num_dims == index_len && index_len > 1 && (dst_info->has_padding() || upd_info->has_padding());
+        num_dims == index_len && index_len > 1 && (has_holes(*dst_info) || has_holes(*upd_info));
     if (unsupported_padding_config)
     {
         ARM_COMPUTE_ERROR("Unsupported Configuration! Padding not supported with these shapes.");
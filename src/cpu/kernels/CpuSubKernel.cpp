@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,14 +35,6 @@
 #include "src/cpu/kernels/sub/neon/impl.h"
 #include "src/cpu/kernels/sub/neon/list.h"
 
-#if defined(ENABLE_FP32_KERNELS)
-namespace
-{
-static constexpr size_t default_mws_N1_fp32_neon = 24385;
-static constexpr size_t default_mws_V1_fp32_neon = 40520;
-} // namespace
-#endif /* ENABLE_FP32_KERNELS */
-
 namespace arm_compute
 {
 namespace cpu
@@ -157,47 +149,6 @@ void CpuSubKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, I
     ICpuKernel::configure(win);
 }
 
-size_t CpuSubKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
-{
-    ARM_COMPUTE_UNUSED(thread_count);
-
-#if defined(ENABLE_FP32_KERNELS)
-    if (this->_run_method == &sub_same_neon<float>)
-    {
-        size_t mws = ICPPKernel::default_mws;
-        if (platform.get_cpu_model() == CPUModel::N1)
-        {
-            mws = default_mws_N1_fp32_neon;
-        }
-        else if (platform.get_cpu_model() == CPUModel::V1)
-        {
-            mws = default_mws_V1_fp32_neon;
-        }
-        else
-        {
-            return ICPPKernel::default_mws;
-        }
-
-        // tensor is 1D or was re-interpreted as 1D
-        if (this->window().shape().num_dimensions() == 1)
-        {
-            return mws;
-        }
-        else
-        {
-            // scale mws down by the number of elements along all the dimensions (x, z, w, etc) except the one
-            // that we parallelize along (the y dimension). This allows for parallelization when the Y_SIZE is small
-            // but the other sizes are large, which boosts performance.
-            mws = static_cast<size_t>(mws / (this->window().num_iterations_total() / this->window().num_iterations(1)));
-            return std::max(static_cast<size_t>(1), mws);
-        }
-    }
-#else  /* ENABLE_FP32_KERNELS */
-    ARM_COMPUTE_UNUSED(platform);
-#endif /* ENABLE_FP32_KERNELS */
-    return ICPPKernel::default_mws;
-}
-
 Status
 CpuSubKernel::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst, ConvertPolicy policy)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, 2025 Arm Limited.
+ * Copyright (c) 2020-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
 #include "src/core/NEON/wrapper/wrapper.h"
+#include "src/core/helpers/WindowHelpers.h"
 namespace arm_compute
 {
 namespace cpu
@@ -94,8 +95,16 @@ void dispatch_fp_neon_activation_function(ActivationLayerInfo::ActivationFunctio
             fn([&](auto vin) { return wrapper::vmla(vb, va, vin); }, [&](auto in) { return a * in + b; });
             break;
         case ActivationLayerInfo::ActivationFunction::LOGISTIC:
-            fn([&](auto vin) { return wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(vin)))); },
-               [](auto in) { return static_cast<T>(1) / (static_cast<T>(1) + std::exp(-in)); });
+            if (act_info.fast_math())
+            {
+                fn([](auto vin) { return wrapper::vlogistic_fast(vin); },
+                   [](auto in) { return static_cast<T>(1) / (static_cast<T>(1) + std::exp(-in)); });
+            }
+            else
+            {
+                fn([](auto vin) { return wrapper::vlogistic(vin); },
+                   [](auto in) { return static_cast<T>(1) / (static_cast<T>(1) + std::exp(-in)); });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::RELU:
             fn([&](auto vin) { return wrapper::vmax(const_0, vin); },
@@ -114,22 +123,50 @@ void dispatch_fp_neon_activation_function(ActivationLayerInfo::ActivationFunctio
                [&](auto in) { return (in > 0) ? in : a * in; });
             break;
         case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
-            fn(
-                [&](auto vin)
-                {
-                    return wrapper::vbsl(wrapper::vcgt(vin, vsoft_relu_thresh), vin,
-                                         wrapper::vlog(wrapper::vadd(const_1, wrapper::vexpq(vin))));
-                },
-                [](auto in) { return (in > soft_relu_thresh) ? in : std::log(static_cast<T>(1) + std::exp(in)); });
+            if (act_info.fast_math())
+            {
+                fn(
+                    [&](auto vin)
+                    {
+                        return wrapper::vbsl(wrapper::vcgt(vin, vsoft_relu_thresh), vin,
+                                             wrapper::vlog(wrapper::vadd(const_1, wrapper::vexpq_fast(vin))));
+                    },
+                    [](auto in)
+                    { return (in > soft_relu_thresh) ? in : std::log(static_cast<T>(1) + std::exp(in)); });
+            }
+            else
+            {
+                fn(
+                    [&](auto vin)
+                    {
+                        return wrapper::vbsl(wrapper::vcgt(vin, vsoft_relu_thresh), vin,
+                                             wrapper::vlog(wrapper::vadd(const_1, wrapper::vexpq(vin))));
+                    },
+                    [](auto in)
+                    { return (in > soft_relu_thresh) ? in : std::log(static_cast<T>(1) + std::exp(in)); });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::ELU:
-            fn(
-                [&](auto vin)
-                {
-                    return wrapper::vbsl(wrapper::vcge(vin, const_0), vin,
-                                         wrapper::vmul(va, wrapper::vsub(wrapper::vexpq(vin), const_1)));
-                },
-                [&](auto in) { return (in >= 0) ? in : a * (std::exp(in) - 1); });
+            if (act_info.fast_math())
+            {
+                fn(
+                    [&](auto vin)
+                    {
+                        return wrapper::vbsl(wrapper::vcge(vin, const_0), vin,
+                                             wrapper::vmul(va, wrapper::vsub(wrapper::vexpq_fast(vin), const_1)));
+                    },
+                    [&](auto in) { return (in >= 0) ? in : a * (std::exp(in) - 1); });
+            }
+            else
+            {
+                fn(
+                    [&](auto vin)
+                    {
+                        return wrapper::vbsl(wrapper::vcge(vin, const_0), vin,
+                                             wrapper::vmul(va, wrapper::vsub(wrapper::vexpq(vin), const_1)));
+                    },
+                    [&](auto in) { return (in >= 0) ? in : a * (std::exp(in) - 1); });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::SQRT:
             fn(
@@ -149,8 +186,16 @@ void dispatch_fp_neon_activation_function(ActivationLayerInfo::ActivationFunctio
             fn([](auto vin) { return wrapper::vmul(vin, vin); }, [](auto in) { return in * in; });
             break;
         case ActivationLayerInfo::ActivationFunction::TANH:
-            fn([&](auto vin) { return wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, vin))); },
-               [&](auto in) { return a * std::tanh(b * in); });
+            if (act_info.fast_math())
+            {
+                fn([&](auto vin) { return wrapper::vmul(va, wrapper::vtanh_fast(wrapper::vmul(vb, vin))); },
+                   [&](auto in) { return a * std::tanh(b * in); });
+            }
+            else
+            {
+                fn([&](auto vin) { return wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, vin))); },
+                   [&](auto in) { return a * std::tanh(b * in); });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::IDENTITY:
             fn([](auto vin) { return vin; }, [](auto in) { return in; });
@@ -167,13 +212,16 @@ void dispatch_fp_neon_activation_function(ActivationLayerInfo::ActivationFunctio
                 [](auto in) { return in * ((std::min(std::max((in + 3), 0.0f), 6.0f)) * 0.166666667f); });
             break;
         case ActivationLayerInfo::ActivationFunction::SWISH:
-            fn(
-                [&](auto vin)
-                {
-                    return wrapper::vmul(vin, wrapper::vinv(wrapper::vadd(
-                                                  const_1, wrapper::vexpq(wrapper::vneg(wrapper::vmul(va, vin))))));
-                },
-                [&](auto in) { return in / (static_cast<T>(1) + std::exp(-a * in)); });
+            if (act_info.fast_math())
+            {
+                fn([&](auto vin) { return wrapper::vmul(vin, wrapper::vlogistic_fast(wrapper::vmul(va, vin))); },
+                   [&](auto in) { return in / (static_cast<T>(1) + std::exp(-a * in)); });
+            }
+            else
+            {
+                fn([&](auto vin) { return wrapper::vmul(vin, wrapper::vlogistic(wrapper::vmul(va, vin))); },
+                   [&](auto in) { return in / (static_cast<T>(1) + std::exp(-a * in)); });
+            }
             break;
 #ifdef __aarch64__
         case ActivationLayerInfo::ActivationFunction::GELU:
@@ -207,7 +255,7 @@ void fp_neon_activation_impl(const ITensor             *src,
     const auto                                    window_start_x = static_cast<int>(window.x().start());
     const auto                                    window_end_x   = static_cast<int>(window.x().end());
     const ActivationLayerInfo::ActivationFunction act            = act_info.activation();
-    Window                                        win_collapsed  = window.collapse_if_possible(window, Window::DimZ);
+    Window win_collapsed = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
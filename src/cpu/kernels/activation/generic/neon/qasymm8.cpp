@@ -27,6 +27,7 @@
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/WindowHelpers.h"
 
 #include "qasymm8_impl.h"
 
@@ -45,7 +46,7 @@ void neon_qasymm8_activation(const ITensor             *src,
     const auto                                    window_end_x   = static_cast<int>(window.x().end());
     const ActivationLayerInfo::ActivationFunction act            = act_info.activation();
 
-    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    Window win_collapsed = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(src, win_collapsed);
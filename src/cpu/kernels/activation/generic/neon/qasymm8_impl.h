@@ -55,10 +55,10 @@ void dispatch_qasymm8_activation_function(ActivationLayerInfo::ActivationFunctio
     const qasymm8_t    const_0  = quantize_qasymm8(0.f, qi_in);
     const qasymm8x16_t vconst_0 = vdupq_n_u8(const_0);
 
-    const auto vconst_1 = vdupq_n_f32(1.f);
 #ifndef __aarch64__
     const auto vconst_0_f32 = vdupq_n_f32(0);
 #else  // __aarch64__
+    const auto vconst_1         = vdupq_n_f32(1.f);
     const auto const_inv_2      = vdupq_n_f32(0.5f);
     const auto const_inv_sqrt_2 = vdupq_n_f32(0.70710678118f);
 #endif // __aarch64__
@@ -137,12 +137,12 @@ void dispatch_qasymm8_activation_function(ActivationLayerInfo::ActivationFunctio
                 {
                     // De-quantize
                     const auto vin_deq = vdequantize(vin, qi_in);
-                    // Perform activation
+                    // Perform activation, the fast tier is accurate well below the quantization step
                     const float32x4x4_t tmp_dep = {{
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[0])))),
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[1])))),
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[2])))),
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[3])))),
+                        vlogisticq_fast_f32(vin_deq.val[0]),
+                        vlogisticq_fast_f32(vin_deq.val[1]),
+                        vlogisticq_fast_f32(vin_deq.val[2]),
+                        vlogisticq_fast_f32(vin_deq.val[3]),
                     }};
                     // Re-quantize to new output space
                     return vquantize(tmp_dep, qi_out);
@@ -161,12 +161,12 @@ void dispatch_qasymm8_activation_function(ActivationLayerInfo::ActivationFunctio
                 {
                     // De-quantize
                     const auto vin_deq = vdequantize(vin, qi_in);
-                    // Perform activation
+                    // Perform activation, the fast tier is accurate well below the quantization step
                     const float32x4x4_t tmp_dep = {{
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[0], vb_f32))),
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[1], vb_f32))),
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[2], vb_f32))),
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[3], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[0], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[1], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[2], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[3], vb_f32))),
                     }};
                     // Re-quantize to new output space
                     return vquantize(tmp_dep, qi_out);
@@ -52,7 +52,6 @@ void dispatch_qasymm8_signed_activation_function(ActivationLayerInfo::Activation
     const qasymm8_signed_t    const_0  = quantize_qasymm8_signed(0.f, qi_in);
     const qasymm8x16_signed_t vconst_0 = vdupq_n_s8(const_0);
 #ifndef __aarch64__
-    const auto vconst_1     = vdupq_n_f32(1.f);
     const auto vconst_0_f32 = vdupq_n_f32(0.f);
 #endif // __aarch64__
     const float32x4_t va_f32          = vdupq_n_f32(act_info.a());
@@ -124,12 +123,12 @@ void dispatch_qasymm8_signed_activation_function(ActivationLayerInfo::Activation
                 {
                     // De-quantize
                     const auto vin_deq = vdequantize(vin, qi_in);
-                    // Perform activation
+                    // Perform activation, the fast tier is accurate well below the quantization step
                     const float32x4x4_t tmp_dep = {{
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[0])))),
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[1])))),
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[2])))),
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[3])))),
+                        vlogisticq_fast_f32(vin_deq.val[0]),
+                        vlogisticq_fast_f32(vin_deq.val[1]),
+                        vlogisticq_fast_f32(vin_deq.val[2]),
+                        vlogisticq_fast_f32(vin_deq.val[3]),
                     }};
                     // Re-quantize to new output space
                     return vquantize_signed(tmp_dep, qi_out);
@@ -148,12 +147,12 @@ void dispatch_qasymm8_signed_activation_function(ActivationLayerInfo::Activation
                 {
                     // De-quantize
                     const auto vin_deq = vdequantize(vin, qi_in);
-                    // Perform activation
+                    // Perform activation, the fast tier is accurate well below the quantization step
                     const float32x4x4_t tmp_dep = {{
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[0], vb_f32))),
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[1], vb_f32))),
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[2], vb_f32))),
-                        wrapper::vmul(va_f32, wrapper::vtanh(wrapper::vmul(vin_deq.val[3], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[0], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[1], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[2], vb_f32))),
+                        wrapper::vmul(va_f32, vtanhq_fast_f32(wrapper::vmul(vin_deq.val[3], vb_f32))),
                     }};
                     // Re-quantize to new output space
                     return vquantize_signed(tmp_dep, qi_out);
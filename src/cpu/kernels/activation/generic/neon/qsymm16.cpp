@@ -28,6 +28,8 @@
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/lut/list.h"
 
 #include "qsymm16_impl.h"
 
@@ -46,7 +48,7 @@ void neon_qsymm16_activation(const ITensor             *src,
     const auto                                    window_end_x   = static_cast<int>(window.x().end());
     const ActivationLayerInfo::ActivationFunction act            = act_info.activation();
 
-    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    Window win_collapsed = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(src, win_collapsed);
@@ -88,5 +90,35 @@ void neon_qsymm16_activation(const ITensor             *src,
                 input, output);
         });
 }
+
+#ifdef __aarch64__
+void neon_qsymm16_activation_lut(const ITensor             *src,
+                                 ITensor                   *dst,
+                                 const ActivationLayerInfo &act_info,
+                                 const Window              &window)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "neon_qsymm16_activation_lut");
+    ARM_COMPUTE_ERROR_ON(src->info()->data_type() != DataType::QSYMM16);
+    const auto window_start_x = window.x().start();
+    const auto window_end_x   = window.x().end();
+    const auto size           = window_end_x - window_start_x;
+    Window     win_collapsed  = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win_collapsed);
+    Iterator output(dst, win_collapsed);
+    execute_window_loop(
+        win_collapsed,
+        [&](const Coordinates &)
+        {
+            // The table is indexed with the raw 16-bit pattern of the quantized input
+            const auto input_ptr  = reinterpret_cast<const uint16_t *>(input.ptr());
+            auto       output_ptr = reinterpret_cast<uint16_t *>(output.ptr());
+            lut_u16_neon(reinterpret_cast<const uint16_t *>(act_info.lut_fp16().data()), 1U /* num_strings (UNUSED) */,
+                         size, input_ptr + window_start_x, output_ptr + window_start_x);
+        },
+        input, output);
+}
+#endif // __aarch64__
 } // namespace cpu
 } // namespace arm_compute
@@ -47,11 +47,10 @@ void dispatch_neon_qsymm16_activation_function(ActivationLayerInfo::ActivationFu
                                                const UniformQuantizationInfo          &qi_out,
                                                F                                     &&fn)
 {
-    const auto        vconst_1 = vdupq_n_f32(1.f);
-    const float32x4_t va_f32   = vdupq_n_f32(act_info.a());
-    const float32x4_t vb_f32   = vdupq_n_f32(act_info.b());
-    const float       a_f32    = act_info.a();
-    const float       b_f32    = act_info.b();
+    const float32x4_t va_f32 = vdupq_n_f32(act_info.a());
+    const float32x4_t vb_f32 = vdupq_n_f32(act_info.b());
+    const float       a_f32  = act_info.a();
+    const float       b_f32  = act_info.b();
 
     switch (act)
     {
@@ -63,8 +62,8 @@ void dispatch_neon_qsymm16_activation_function(ActivationLayerInfo::ActivationFu
                     const auto vin_deq = vdequantize_int16(vin, qi_in.scale);
                     // Perform activation
                     const float32x4x2_t tmp_dep = {{
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[0])))),
-                        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(vin_deq.val[1])))),
+                        wrapper::vlogistic(vin_deq.val[0]),
+                        wrapper::vlogistic(vin_deq.val[1]),
                     }};
                     // Re-quantize to new output space
                     return vquantize_int16(tmp_dep, qi_out.scale);
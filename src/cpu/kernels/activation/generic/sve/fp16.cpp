@@ -31,6 +31,7 @@
 
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/NEON/SVEMath.h"
+#include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/lut/list.h"
 
 #include "fp16_impl.h"
@@ -49,7 +50,7 @@ void sve_fp16_activation(const ITensor *src, ITensor *dst, const ActivationLayer
     const auto                                    window_end_x   = static_cast<int>(window.x().end());
     const ActivationLayerInfo::ActivationFunction act            = act_info.activation();
 
-    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    Window win_collapsed = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(src, win_collapsed);
@@ -95,7 +96,7 @@ void sve_fp16_activation_lut(const ITensor             *src,
     const auto window_start_x = window.x().start();
     const auto window_end_x   = window.x().end();
     const auto size           = window_end_x - window_start_x;
-    Window     win_collapsed  = window.collapse_if_possible(window, Window::DimZ);
+    Window     win_collapsed  = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(src, win_collapsed);
@@ -62,8 +62,7 @@ void dispatch_sve_fp16_activation_function(ActivationLayerInfo::ActivationFuncti
             fn([&](auto vin, svbool_t pg) { return svmla_f16_z(pg, vb, va, vin); });
             break;
         case ActivationLayerInfo::ActivationFunction::LOGISTIC:
-            fn([&](auto vin, svbool_t pg)
-               { return svinv_f16_z(pg, svadd_f16_z(pg, const_1, svexp_f16_z(pg, svneg_f16_z(pg, vin)))); });
+            fn([&](auto vin, svbool_t pg) { return svlogistic_f16_z(pg, vin); });
             break;
         case ActivationLayerInfo::ActivationFunction::RELU:
             fn([&](auto vin, svbool_t pg) { return svmax_f16_z(pg, const_0, vin); });
@@ -115,14 +114,8 @@ void dispatch_sve_fp16_activation_function(ActivationLayerInfo::ActivationFuncti
                 });
             break;
         case ActivationLayerInfo::ActivationFunction::SWISH:
-            fn(
-                [&](auto vin, svbool_t pg)
-                {
-                    return svmul_f16_z(
-                        pg, vin,
-                        svinv_f16_z(
-                            pg, svadd_f16_z(pg, const_1, svexp_f16_z(pg, svneg_f16_z(pg, svmul_f16_z(pg, va, vin))))));
-                });
+            fn([&](auto vin, svbool_t pg)
+               { return svmul_f16_z(pg, vin, svlogistic_f16_z(pg, svmul_f16_z(pg, va, vin))); });
             break;
         default:
             ARM_COMPUTE_ERROR("Unsupported activation function");
@@ -29,6 +29,7 @@
 
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/NEON/SVEMath.h"
+#include "src/core/helpers/WindowHelpers.h"
 
 #include "fp32_impl.h"
 #include <arm_sve.h>
@@ -46,7 +47,7 @@ void sve_fp32_activation(const ITensor *src, ITensor *dst, const ActivationLayer
     const auto                                    window_end_x   = static_cast<int>(window.x().end());
     const ActivationLayerInfo::ActivationFunction act            = act_info.activation();
 
-    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    Window win_collapsed = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(src, win_collapsed);
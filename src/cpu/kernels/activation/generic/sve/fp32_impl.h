@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, 2025 Arm Limited.
+ * Copyright (c) 2020-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,8 +59,14 @@ void dispatch_sve_fp32_activation_function(ActivationLayerInfo::ActivationFuncti
             fn([&](auto vin, svbool_t pg) { return svmla_f32_z(pg, vb, va, vin); });
             break;
         case ActivationLayerInfo::ActivationFunction::LOGISTIC:
-            fn([&](auto vin, svbool_t pg)
-               { return svinv_f32_z(pg, svadd_f32_z(pg, const_1, svexp_f32_z(pg, svneg_f32_z(pg, vin)))); });
+            if (act_info.fast_math())
+            {
+                fn([&](auto vin, svbool_t pg) { return svlogistic_fast_f32_z(pg, vin); });
+            }
+            else
+            {
+                fn([&](auto vin, svbool_t pg) { return svlogistic_f32_z(pg, vin); });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::RELU:
             fn([&](auto vin, svbool_t pg) { return svmax_f32_z(pg, const_0, vin); });
@@ -79,20 +85,44 @@ void dispatch_sve_fp32_activation_function(ActivationLayerInfo::ActivationFuncti
                 });
             break;
         case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
-            fn(
-                [&](auto vin, svbool_t pg)
-                {
-                    return svsel_f32(svcmpgt_f32(pg, vin, soft_relu_thresh), vin,
-                                     svlog_f32_z(pg, svadd_f32_z(pg, const_1, svexp_f32_z(pg, vin))));
-                });
+            if (act_info.fast_math())
+            {
+                fn(
+                    [&](auto vin, svbool_t pg)
+                    {
+                        return svsel_f32(svcmpgt_f32(pg, vin, soft_relu_thresh), vin,
+                                         svlog_f32_z(pg, svadd_f32_z(pg, const_1, svexp_fast_f32_z(pg, vin))));
+                    });
+            }
+            else
+            {
+                fn(
+                    [&](auto vin, svbool_t pg)
+                    {
+                        return svsel_f32(svcmpgt_f32(pg, vin, soft_relu_thresh), vin,
+                                         svlog_f32_z(pg, svadd_f32_z(pg, const_1, svexp_f32_z(pg, vin))));
+                    });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::ELU:
-            fn(
-                [&](auto vin, svbool_t pg)
-                {
-                    return svsel_f32(svcmpgt_f32(pg, vin, const_0), vin,
-                                     svmul_f32_z(pg, va, svsub_f32_z(pg, svexp_f32_z(pg, vin), const_1)));
-                });
+            if (act_info.fast_math())
+            {
+                fn(
+                    [&](auto vin, svbool_t pg)
+                    {
+                        return svsel_f32(svcmpgt_f32(pg, vin, const_0), vin,
+                                         svmul_f32_z(pg, va, svsub_f32_z(pg, svexp_fast_f32_z(pg, vin), const_1)));
+                    });
+            }
+            else
+            {
+                fn(
+                    [&](auto vin, svbool_t pg)
+                    {
+                        return svsel_f32(svcmpgt_f32(pg, vin, const_0), vin,
+                                         svmul_f32_z(pg, va, svsub_f32_z(pg, svexp_f32_z(pg, vin), const_1)));
+                    });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::SQRT:
             fn([&](auto vin, svbool_t pg) { return svsqrt_f32_z(pg, vin); });
@@ -101,7 +131,16 @@ void dispatch_sve_fp32_activation_function(ActivationLayerInfo::ActivationFuncti
             fn([&](auto vin, svbool_t pg) { return svmul_f32_z(pg, vin, vin); });
             break;
         case ActivationLayerInfo::ActivationFunction::TANH:
-            fn([&](auto vin, svbool_t pg) { return svmul_f32_z(pg, va, svtanh_f32_z(pg, svmul_f32_z(pg, vb, vin))); });
+            if (act_info.fast_math())
+            {
+                fn([&](auto vin, svbool_t pg)
+                   { return svmul_f32_z(pg, va, svtanh_fast_f32_z(pg, svmul_f32_z(pg, vb, vin))); });
+            }
+            else
+            {
+                fn([&](auto vin, svbool_t pg)
+                   { return svmul_f32_z(pg, va, svtanh_f32_z(pg, svmul_f32_z(pg, vb, vin))); });
+            }
             break;
         case ActivationLayerInfo::ActivationFunction::IDENTITY:
             fn([&](auto vin, svbool_t) { return vin; });
@@ -117,14 +156,16 @@ void dispatch_sve_fp32_activation_function(ActivationLayerInfo::ActivationFuncti
                 });
             break;
         case ActivationLayerInfo::ActivationFunction::SWISH:
-            fn(
-                [&](auto vin, svbool_t pg)
-                {
-                    return svmul_f32_z(
-                        pg, vin,
-                        svinv_f32_z(
-                            pg, svadd_f32_z(pg, const_1, svexp_f32_z(pg, svneg_f32_z(pg, svmul_f32_z(pg, va, vin))))));
-                });
+            if (act_info.fast_math())
+            {
+                fn([&](auto vin, svbool_t pg)
+                   { return svmul_f32_z(pg, vin, svlogistic_fast_f32_z(pg, svmul_f32_z(pg, va, vin))); });
+            }
+            else
+            {
+                fn([&](auto vin, svbool_t pg)
+                   { return svmul_f32_z(pg, vin, svlogistic_f32_z(pg, svmul_f32_z(pg, va, vin))); });
+            }
             break;
         default:
             ARM_COMPUTE_ERROR("Unsupported activation function");
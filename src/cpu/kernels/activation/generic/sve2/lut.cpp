@@ -26,6 +26,7 @@
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/lut/list.h"
 
 namespace arm_compute
@@ -40,7 +41,7 @@ void sve2_q8_activation_lut(const ITensor *src, ITensor *dst, const ActivationLa
         (src->info()->data_type() != DataType::QASYMM8 && src->info()->data_type() != DataType::QASYMM8_SIGNED) ||
         act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU);
     const auto window_end_x  = window.x().end();
-    Window     win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    Window     win_collapsed = collapse_window_if_no_holes(window, Window::DimZ, *src->info(), *dst->info());
     win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
@@ -51,7 +51,6 @@ void dispatch_sve2_qasymm8_signed_activation_function(ActivationLayerInfo::Activ
     const auto vb              = svdup_n_s8(quantize_qasymm8_signed(act_info.b(), qi_in));
     const auto const_0         = quantize_qasymm8_signed(0.f, qi_in);
     const auto vconst_0        = svdup_n_s8(const_0);
-    const auto vconst_1        = svdup_n_f32(1.f);
     const auto va_f32          = svdup_n_f32(act_info.a());
     const auto vb_f32          = svdup_n_f32(act_info.b());
     const auto const_6_f32     = svdup_n_f32(6.f);
@@ -122,20 +121,12 @@ void dispatch_sve2_qasymm8_signed_activation_function(ActivationLayerInfo::Activ
                 {
                     // De-quantize
                     const auto vin_deq = svdequantize_z(pg, vin, qi_in);
-                    // Perform activation
+                    // Perform activation, the fast tier is accurate well below the quantization step
                     const svfloat32x4_t tmp_dep = svcreate4_f32(
-                        svdiv_f32_z(
-                            pg, vconst_1,
-                            svadd_f32_z(pg, vconst_1, svexp_f32_z(pg, svneg_f32_z(pg, svget4_f32(vin_deq, 0))))),
-                        svdiv_f32_z(
-                            pg, vconst_1,
-                            svadd_f32_z(pg, vconst_1, svexp_f32_z(pg, svneg_f32_z(pg, svget4_f32(vin_deq, 1))))),
-                        svdiv_f32_z(
-                            pg, vconst_1,
-                            svadd_f32_z(pg, vconst_1, svexp_f32_z(pg, svneg_f32_z(pg, svget4_f32(vin_deq, 2))))),
-                        svdiv_f32_z(
-                            pg, vconst_1,
-                            svadd_f32_z(pg, vconst_1, svexp_f32_z(pg, svneg_f32_z(pg, svget4_f32(vin_deq, 3))))));
+                        svlogistic_fast_f32_z(pg, svget4_f32(vin_deq, 0)),
+                        svlogistic_fast_f32_z(pg, svget4_f32(vin_deq, 1)),
+                        svlogistic_fast_f32_z(pg, svget4_f32(vin_deq, 2)),
+                        svlogistic_fast_f32_z(pg, svget4_f32(vin_deq, 3)));
                     // Re-quantize to new output space
                     return svquantize_signed_z(pg, tmp_dep, qi_out);
                 });
@@ -146,12 +137,13 @@ void dispatch_sve2_qasymm8_signed_activation_function(ActivationLayerInfo::Activ
                 {
                     // De-quantize
                     const auto vin_deq = svdequantize_z(pg, vin, qi_in);
-                    // Perform activation
+                    // Perform activation, the fast tier is accurate well below the quantization step
                     const svfloat32x4_t tmp_dep = svcreate4_f32(
-                        svmul_f32_z(pg, va_f32, svtanh_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 0), vb_f32))),
-                        svmul_f32_z(pg, va_f32, svtanh_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 1), vb_f32))),
-                        svmul_f32_z(pg, va_f32, svtanh_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 2), vb_f32))),
-                        svmul_f32_z(pg, va_f32, svtanh_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 3), vb_f32))));
+                        svmul_f32_z(pg, va_f32, svtanh_fast_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 0), vb_f32))),
+                        svmul_f32_z(pg, va_f32, svtanh_fast_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 1), vb_f32))),
+                        svmul_f32_z(pg, va_f32, svtanh_fast_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 2), vb_f32))),
+                        svmul_f32_z(pg, va_f32,
+                                    svtanh_fast_f32_z(pg, svmul_f32_z(pg, svget4_f32(vin_deq, 3), vb_f32))));
                     // Re-quantize to new output space
                     return svquantize_signed_z(pg, tmp_dep, qi_out);
                 });
@@ -45,9 +45,8 @@ void dispatch_sve2_qasymm16_activation_function(ActivationLayerInfo::ActivationF
                                                 const UniformQuantizationInfo          &qi_out,
                                                 F                                     &&fn)
 {
-    const auto vconst_1 = svdup_n_f32(1.f);
-    const auto va_f32   = svdup_n_f32(act_info.a());
-    const auto vb_f32   = svdup_n_f32(act_info.b());
+    const auto va_f32 = svdup_n_f32(act_info.a());
+    const auto vb_f32 = svdup_n_f32(act_info.b());
 
     switch (act)
     {
@@ -58,13 +57,8 @@ void dispatch_sve2_qasymm16_activation_function(ActivationLayerInfo::ActivationF
                     // De-quantize
                     auto vin_deq = svdequantize_qsymm16_z(pg, vin, qi_in.scale);
                     // Perform activation
-                    const svfloat32x2_t tmp_dep = svcreate2_f32(
-                        svdiv_f32_z(
-                            pg, vconst_1,
-                            svadd_f32_z(pg, vconst_1, svexp_f32_z(pg, svneg_f32_z(pg, svget2_f32(vin_deq, 0))))),
-                        svdiv_f32_z(
-                            pg, vconst_1,
-                            svadd_f32_z(pg, vconst_1, svexp_f32_z(pg, svneg_f32_z(pg, svget2_f32(vin_deq, 1))))));
+                    const svfloat32x2_t tmp_dep = svcreate2_f32(svlogistic_f32_z(pg, svget2_f32(vin_deq, 0)),
+                                                                svlogistic_f32_z(pg, svget2_f32(vin_deq, 1)));
                     // Re-quantize to new output space
                     return svquantize_qsymm16_z(pg, tmp_dep, qi_out.scale);
                 });
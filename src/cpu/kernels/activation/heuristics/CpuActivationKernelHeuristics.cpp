@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/core/common/Registrars.h"
+#include "src/core/helpers/Utils.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/activation/list.h"
 #include "src/cpu/kernels/logistic/list.h"
@@ -48,6 +49,18 @@ namespace
 {
 
 bool is_fp16_lut_supported(ActivationLayerInfo::ActivationFunction func)
+{
+    return func == ActivationLayerInfo::ActivationFunction::LOGISTIC ||
+           func == ActivationLayerInfo::ActivationFunction::TANH ||
+           func == ActivationLayerInfo::ActivationFunction::GELU ||
+           func == ActivationLayerInfo::ActivationFunction::SWISH ||
+           func == ActivationLayerInfo::ActivationFunction::ELU ||
+           func == ActivationLayerInfo::ActivationFunction::SOFT_RELU ||
+           func == ActivationLayerInfo::ActivationFunction::HARD_SWISH;
+}
+
+// The output quantization of the 16-bit table is only fixed for the activations bounded to [-1, 1]
+bool is_qsymm16_lut_supported(ActivationLayerInfo::ActivationFunction func)
 {
     return func == ActivationLayerInfo::ActivationFunction::LOGISTIC ||
            func == ActivationLayerInfo::ActivationFunction::TANH;
@@ -79,6 +92,11 @@ static const KernelList fp16_kernels = {
      [](const ActivationDataTypeISASelectorData &data)
      { return data.isa.fp16 && data.isa.sve && is_fp16_lut_supported(data.f); },
      REGISTER_FP16_SVE(arm_compute::cpu::sve_fp16_activation_lut)},
+#ifdef __aarch64__
+    {"neon_fp16_activation_lut",
+     [](const ActivationDataTypeISASelectorData &data) { return data.isa.fp16 && is_fp16_lut_supported(data.f); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_activation_lut)},
+#endif // __aarch64__
     {"sve_fp16_activation",
      [](const ActivationDataTypeISASelectorData &data)
      { return data.isa.sve && data.isa.fp16 && data.f != ActivationLayerInfo::ActivationFunction::GELU; },
@@ -142,6 +160,12 @@ static const KernelList qasymm8_signed_kernels = {
 };
 
 static const KernelList qsymm16_kernels = {
+#ifdef __aarch64__
+    {// Neon LUT implementantion takes precedence
+     "neon_qs16_activation_lut",
+     [](const ActivationDataTypeISASelectorData &data) { return is_qsymm16_lut_supported(data.f); },
+     REGISTER_QSYMM16_NEON(arm_compute::cpu::neon_qsymm16_activation_lut)},
+#endif // __aarch64__
     {"sve2_qs16_activation",
      [](const ActivationDataTypeISASelectorData &data)
      { return data.isa.sve2 && data.f != ActivationLayerInfo::ActivationFunction::GELU; },
@@ -325,6 +349,15 @@ CpuActivationKernelHeuristics::CpuActivationKernelHeuristics(const ITensorInfo
     const CPUModel                    cpu_model = CPUInfo::get().get_cpu_model();
     choose_kernel(selector);
 
+    // The SME kernel processes the higher dimensions as the rows of a 2D tensor, so they must be contiguous
+    if (std::string(_kernel->name) == "sme2_fp32_logistic" && (has_holes(*src) || (dst != nullptr && has_holes(*dst))))
+    {
+        cpuinfo::CpuIsaInfo isa = CPUInfo::get().get_isa();
+        isa.sme2                = false;
+        ActivationDataTypeISASelectorData fallback_selector{dtype, cpu_model, isa, activation_info.activation()};
+        choose_kernel(fallback_selector);
+    }
+
     // Set window and scheduling hint
     int split_dim;
     std::tie(_window, split_dim) =
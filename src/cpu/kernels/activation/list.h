@@ -33,6 +33,8 @@ namespace cpu
 
 #ifdef __aarch64__
 DECLARE_ACTIVATION_KERNEL(neon_q8_activation_lut);
+DECLARE_ACTIVATION_KERNEL(neon_fp16_activation_lut);
+DECLARE_ACTIVATION_KERNEL(neon_qsymm16_activation_lut);
 #endif // __aarch64__
 DECLARE_ACTIVATION_KERNEL(sve2_q8_activation_lut);
 DECLARE_ACTIVATION_KERNEL(neon_qasymm8_activation);
@@ -172,9 +172,41 @@ public:
         return ICPPKernel::default_mws;
     }
 
+    /** Set the number of operations performed by a run of the kernel
+     *
+     * @param[in] flop_count Number of operations, i.e. twice the number of multiply-accumulates.
+     */
+    void set_flop_count(uint64_t flop_count)
+    {
+        _flop_count = flop_count;
+    }
+
+    uint64_t get_flop_count(const ITensorPack &tensors) const override
+    {
+        ARM_COMPUTE_UNUSED(tensors);
+
+        return _flop_count;
+    }
+
+    /** Set the total size of the tensors the kernel was configured with
+     *
+     * @param[in] tensors_size Size in bytes of the lhs, rhs, bias and destination tensors.
+     */
+    void set_configured_tensors_size(size_t tensors_size)
+    {
+        _tensors_size = tensors_size;
+    }
+
+    size_t get_configured_tensors_size() const override
+    {
+        return _tensors_size;
+    }
+
 private:
     arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *_kernel;
     std::string                                              _name;
+    uint64_t                                                 _flop_count{0};
+    size_t                                                   _tensors_size{0};
 };
 } // namespace kernel
 } // namespace cpu
@@ -26,6 +26,7 @@
 
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/cpu/kernels/elementwise_unary/generic/neon/impl.h"
+#include "src/cpu/kernels/lut/list.h"
 
 namespace arm_compute
 {
@@ -35,6 +36,32 @@ void neon_fp16_elementwise_unary(
     const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "neon_fp16_elementwise_unary");
+#ifdef __aarch64__
+    // Transcendental operations are read from the full-range table provided by the kernel
+    if (lut != nullptr)
+    {
+        const auto window_start_x = window.x().start();
+        const auto window_end_x   = window.x().end();
+        const auto size           = window_end_x - window_start_x;
+
+        Window win = window;
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        Iterator input(in, win);
+        Iterator output(out, win);
+        execute_window_loop(
+            win,
+            [&](const Coordinates &)
+            {
+                const auto input_ptr  = reinterpret_cast<const uint16_t *>(input.ptr());
+                auto       output_ptr = reinterpret_cast<uint16_t *>(output.ptr());
+                lut_u16_neon(reinterpret_cast<const uint16_t *>(lut), 1U /* num_strings (UNUSED) */, size,
+                             input_ptr + window_start_x, output_ptr + window_start_x);
+            },
+            input, output);
+        return;
+    }
+#endif // __aarch64__
     ARM_COMPUTE_UNUSED(lut);
     elementwise_op<__fp16>(in, out, window, op);
 }
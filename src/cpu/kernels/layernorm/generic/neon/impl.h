@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/cpu/CpuTypes.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace layer_norm
+{
+/** Number of elements processed by each iteration of the vector loops */
+constexpr int vector_size = 8;
+
+inline float32x4x2_t load(const float *ptr)
+{
+    return {{vld1q_f32(ptr), vld1q_f32(ptr + 4)}};
+}
+
+inline float load_scalar(const float *ptr)
+{
+    return *ptr;
+}
+
+inline void store(float *ptr, const float32x4x2_t &v)
+{
+    vst1q_f32(ptr, v.val[0]);
+    vst1q_f32(ptr + 4, v.val[1]);
+}
+
+inline void store_scalar(float *ptr, float v)
+{
+    *ptr = v;
+}
+
+inline float32x4x2_t load(const bfloat16 *ptr)
+{
+    const uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t *>(ptr));
+    return {{vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(v), 16)),
+             vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(v), 16))}};
+}
+
+inline float load_scalar(const bfloat16 *ptr)
+{
+    return static_cast<float>(*ptr);
+}
+
+/** Narrow F32 values to BF16 with round to nearest even, as done by the portable conversion of @ref bfloat16 */
+inline uint16x4_t narrow_bf16(float32x4_t v)
+{
+    const uint32x4_t bits = vreinterpretq_u32_f32(v);
+    const uint32x4_t lsb  = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    return vshrn_n_u32(vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7fff))), 16);
+}
+
+inline void store(bfloat16 *ptr, const float32x4x2_t &v)
+{
+    vst1q_u16(reinterpret_cast<uint16_t *>(ptr), vcombine_u16(narrow_bf16(v.val[0]), narrow_bf16(v.val[1])));
+}
+
+inline void store_scalar(bfloat16 *ptr, float v)
+{
+    *ptr = bfloat16(v, true);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4x2_t load(const float16_t *ptr)
+{
+    const float16x8_t v = vld1q_f16(ptr);
+    return {{vcvt_f32_f16(vget_low_f16(v)), vcvt_f32_f16(vget_high_f16(v))}};
+}
+
+inline float load_scalar(const float16_t *ptr)
+{
+    return static_cast<float>(*ptr);
+}
+
+inline void store(float16_t *ptr, const float32x4x2_t &v)
+{
+    vst1q_f16(ptr, vcombine_f16(vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])));
+}
+
+inline void store_scalar(float16_t *ptr, float v)
+{
+    *ptr = static_cast<float16_t>(v);
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Write normalized values to a destination of the source data type */
+template <typename T>
+inline void store_dst(T *ptr, const float32x4x2_t &v, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    store(ptr, v);
+}
+
+template <typename T>
+inline void store_dst_scalar(T *ptr, float v, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    store_scalar(ptr, v);
+}
+
+/** Quantize normalized values to a QASYMM8_SIGNED destination */
+template <>
+inline void store_dst(int8_t *ptr, const float32x4x2_t &v, const UniformQuantizationInfo &qinfo)
+{
+    vst1_s8(ptr, vquantize_signed(v, qinfo));
+}
+
+template <>
+inline void store_dst_scalar(int8_t *ptr, float v, const UniformQuantizationInfo &qinfo)
+{
+    *ptr = quantize_qasymm8_signed(v, qinfo);
+}
+
+inline float32x4x2_t add(const float32x4x2_t &a, const float32x4x2_t &b)
+{
+    return {{vaddq_f32(a.val[0], b.val[0]), vaddq_f32(a.val[1], b.val[1])}};
+}
+
+inline float reduce(float32x4_t v)
+{
+    const float32x2_t tmp = vadd_f32(vget_high_f32(v), vget_low_f32(v));
+    return vget_lane_f32(vpadd_f32(tmp, tmp), 0);
+}
+
+/** Normalize the rows of @p src, written to a destination of type @p TOut
+ *
+ * @note All the tensors are accessed through the coordinates of the rows, so the kernel window can only collapse
+ *       the dimensions above Y when none of the tensors has holes.
+ */
+template <typename T, typename TOut>
+void layer_norm_rows(const ITensor             *src,
+                     const ITensor             *residual,
+                     const ITensor             *gamma,
+                     const ITensor             *beta,
+                     ITensor                   *dst,
+                     ITensor                   *residual_out,
+                     const LayerNormKernelInfo &info,
+                     const Window              &window)
+{
+    const int                     width = static_cast<int>(src->info()->dimension(0));
+    const UniformQuantizationInfo qinfo = dst->info()->quantization_info().uniform();
+
+    const auto *gamma_ptr = reinterpret_cast<const T *>(gamma->ptr_to_element(Coordinates()));
+    const auto *beta_ptr =
+        beta != nullptr ? reinterpret_cast<const T *>(beta->ptr_to_element(Coordinates())) : nullptr;
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto *src_ptr = reinterpret_cast<const T *>(src->ptr_to_element(id));
+            const auto *res_ptr =
+                residual != nullptr ? reinterpret_cast<const T *>(residual->ptr_to_element(id)) : nullptr;
+            auto *res_out_ptr =
+                residual_out != nullptr ? reinterpret_cast<T *>(residual_out->ptr_to_element(id)) : nullptr;
+            auto *dst_ptr = reinterpret_cast<TOut *>(dst->ptr_to_element(id));
+
+            // Add the residual, write the sum and accumulate the statistics of the row
+            float32x4_t vsum    = vdupq_n_f32(0.f);
+            float32x4_t vsum_sq = vdupq_n_f32(0.f);
+            int         x       = 0;
+            for (; x <= width - vector_size; x += vector_size)
+            {
+                float32x4x2_t v = load(src_ptr + x);
+                if (res_ptr != nullptr)
+                {
+                    v = add(v, load(res_ptr + x));
+                    if (res_out_ptr != nullptr)
+                    {
+                        store(res_out_ptr + x, v);
+                    }
+                }
+                vsum    = vaddq_f32(vsum, vaddq_f32(v.val[0], v.val[1]));
+                vsum_sq = vmlaq_f32(vmlaq_f32(vsum_sq, v.val[0], v.val[0]), v.val[1], v.val[1]);
+            }
+            float sum    = reduce(vsum);
+            float sum_sq = reduce(vsum_sq);
+            for (; x < width; ++x)
+            {
+                float v = load_scalar(src_ptr + x);
+                if (res_ptr != nullptr)
+                {
+                    v += load_scalar(res_ptr + x);
+                    if (res_out_ptr != nullptr)
+                    {
+                        store_scalar(res_out_ptr + x, v);
+                    }
+                }
+                sum += v;
+                sum_sq += v * v;
+            }
+
+            const float mean       = info.rms_norm ? 0.f : sum / width;
+            const float var        = std::max(sum_sq / width - mean * mean, 0.f);
+            const float inv_stddev = 1.f / std::sqrt(var + info.epsilon);
+
+            // Normalize the row and apply the affine parameters
+            const float32x4_t vmean       = vdupq_n_f32(mean);
+            const float32x4_t vinv_stddev = vdupq_n_f32(inv_stddev);
+            for (x = 0; x <= width - vector_size; x += vector_size)
+            {
+                float32x4x2_t v = load(src_ptr + x);
+                if (res_ptr != nullptr)
+                {
+                    v = add(v, load(res_ptr + x));
+                }
+                const float32x4x2_t g = load(gamma_ptr + x);
+                for (int i = 0; i < 2; ++i)
+                {
+                    v.val[i] = vmulq_f32(vmulq_f32(vsubq_f32(v.val[i], vmean), vinv_stddev), g.val[i]);
+                }
+                if (beta_ptr != nullptr)
+                {
+                    v = add(v, load(beta_ptr + x));
+                }
+                store_dst(dst_ptr + x, v, qinfo);
+            }
+            for (; x < width; ++x)
+            {
+                float v = load_scalar(src_ptr + x);
+                if (res_ptr != nullptr)
+                {
+                    v += load_scalar(res_ptr + x);
+                }
+                v = (v - mean) * inv_stddev * load_scalar(gamma_ptr + x);
+                if (beta_ptr != nullptr)
+                {
+                    v += load_scalar(beta_ptr + x);
+                }
+                store_dst_scalar(dst_ptr + x, v, qinfo);
+            }
+        });
+}
+
+template <typename T>
+void neon_layer_norm(const ITensor             *src,
+                     const ITensor             *residual,
+                     const ITensor             *gamma,
+                     const ITensor             *beta,
+                     ITensor                   *dst,
+                     ITensor                   *residual_out,
+                     const LayerNormKernelInfo &info,
+                     const Window              &window)
+{
+    if (dst->info()->data_type() == DataType::QASYMM8_SIGNED)
+    {
+        layer_norm_rows<T, int8_t>(src, residual, gamma, beta, dst, residual_out, info, window);
+    }
+    else
+    {
+        layer_norm_rows<T, T>(src, residual, gamma, beta, dst, residual_out, info, window);
+    }
+}
+} // namespace layer_norm
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_SVE_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_SVE_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/CpuTypes.h"
+
+#include <algorithm>
+#include <arm_sve.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace layer_norm
+{
+/* All the computations are done in F32: narrower data types are widened into 32-bit lanes when loaded
+ * and narrowed back when stored, so that a single predicate drives every loop. */
+inline svfloat32_t load(svbool_t pg, const float *ptr)
+{
+    return svld1_f32(pg, ptr);
+}
+
+inline void store(svbool_t pg, float *ptr, svfloat32_t v)
+{
+    svst1_f32(pg, ptr, v);
+}
+
+inline svfloat32_t load(svbool_t pg, const bfloat16 *ptr)
+{
+    const svuint32_t v = svld1uh_u32(pg, reinterpret_cast<const uint16_t *>(ptr));
+    return svreinterpret_f32_u32(svlsl_n_u32_x(pg, v, 16));
+}
+
+/** Narrow F32 values to BF16 with round to nearest even, as done by the portable conversion of @ref bfloat16 */
+inline void store(svbool_t pg, bfloat16 *ptr, svfloat32_t v)
+{
+    const svuint32_t bits    = svreinterpret_u32_f32(v);
+    const svuint32_t lsb     = svand_n_u32_x(pg, svlsr_n_u32_x(pg, bits, 16), 1);
+    const svuint32_t rounded = svadd_u32_x(pg, bits, svadd_n_u32_x(pg, lsb, 0x7fff));
+    svst1h_u32(pg, reinterpret_cast<uint16_t *>(ptr), svlsr_n_u32_x(pg, rounded, 16));
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline svfloat32_t load(svbool_t pg, const float16_t *ptr)
+{
+    const svuint32_t v = svld1uh_u32(pg, reinterpret_cast<const uint16_t *>(ptr));
+    return svcvt_f32_f16_x(pg, svreinterpret_f16_u32(v));
+}
+
+inline void store(svbool_t pg, float16_t *ptr, svfloat32_t v)
+{
+    const svfloat16_t h = svcvt_f16_f32_x(pg, v);
+    svst1h_u32(pg, reinterpret_cast<uint16_t *>(ptr), svreinterpret_u32_f16(h));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Write normalized values to a destination of the source data type */
+template <typename T>
+inline void store_dst(svbool_t pg, T *ptr, svfloat32_t v, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    store(pg, ptr, v);
+}
+
+/** Quantize normalized values to a QASYMM8_SIGNED destination */
+template <>
+inline void store_dst(svbool_t pg, int8_t *ptr, svfloat32_t v, const UniformQuantizationInfo &qinfo)
+{
+    const svfloat32_t scaled = svrintn_f32_x(pg, svmul_n_f32_x(pg, v, 1.f / qinfo.scale));
+    svint32_t         q      = svadd_n_s32_x(pg, svcvt_s32_f32_x(pg, scaled), qinfo.offset);
+    q                        = svmin_n_s32_x(pg, svmax_n_s32_x(pg, q, -128), 127);
+    svst1b_s32(pg, ptr, q);
+}
+
+/** Normalize the rows of @p src, written to a destination of type @p TOut
+ *
+ * @note All the tensors are accessed through the coordinates of the rows, so the kernel window can collapse
+ *       the dimensions above X.
+ */
+template <typename T, typename TOut>
+void layer_norm_rows(const ITensor             *src,
+                     const ITensor             *residual,
+                     const ITensor             *gamma,
+                     const ITensor             *beta,
+                     ITensor                   *dst,
+                     ITensor                   *residual_out,
+                     const LayerNormKernelInfo &info,
+                     const Window              &window)
+{
+    const int                     width = static_cast<int>(src->info()->dimension(0));
+    const UniformQuantizationInfo qinfo = dst->info()->quantization_info().uniform();
+    const int                     step  = static_cast<int>(svcntw());
+    const svbool_t                all   = svptrue_b32();
+
+    const auto *gamma_ptr = reinterpret_cast<const T *>(gamma->ptr_to_element(Coordinates()));
+    const auto *beta_ptr =
+        beta != nullptr ? reinterpret_cast<const T *>(beta->ptr_to_element(Coordinates())) : nullptr;
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto *src_ptr = reinterpret_cast<const T *>(src->ptr_to_element(id));
+            const auto *res_ptr =
+                residual != nullptr ? reinterpret_cast<const T *>(residual->ptr_to_element(id)) : nullptr;
+            auto *res_out_ptr =
+                residual_out != nullptr ? reinterpret_cast<T *>(residual_out->ptr_to_element(id)) : nullptr;
+            auto *dst_ptr = reinterpret_cast<TOut *>(dst->ptr_to_element(id));
+
+            // Add the residual, write the sum and accumulate the statistics of the row
+            svfloat32_t vsum    = svdup_n_f32(0.f);
+            svfloat32_t vsum_sq = svdup_n_f32(0.f);
+            int         x       = 0;
+            svbool_t    pg      = svwhilelt_b32(x, width);
+            do
+            {
+                svfloat32_t v = load(pg, src_ptr + x);
+                if (res_ptr != nullptr)
+                {
+                    v = svadd_f32_m(pg, v, load(pg, res_ptr + x));
+                    if (res_out_ptr != nullptr)
+                    {
+                        store(pg, res_out_ptr + x, v);
+                    }
+                }
+                vsum    = svadd_f32_m(pg, vsum, v);
+                vsum_sq = svmla_f32_m(pg, vsum_sq, v, v);
+
+                x += step;
+                pg = svwhilelt_b32(x, width);
+            } while (svptest_any(all, pg));
+
+            const float sum        = svaddv_f32(all, vsum);
+            const float sum_sq     = svaddv_f32(all, vsum_sq);
+            const float mean       = info.rms_norm ? 0.f : sum / width;
+            const float var        = std::max(sum_sq / width - mean * mean, 0.f);
+            const float inv_stddev = 1.f / std::sqrt(var + info.epsilon);
+
+            // Normalize the row and apply the affine parameters
+            x  = 0;
+            pg = svwhilelt_b32(x, width);
+            do
+            {
+                svfloat32_t v = load(pg, src_ptr + x);
+                if (res_ptr != nullptr)
+                {
+                    v = svadd_f32_x(pg, v, load(pg, res_ptr + x));
+                }
+                v = svmul_n_f32_x(pg, svsub_n_f32_x(pg, v, mean), inv_stddev);
+                v = svmul_f32_x(pg, v, load(pg, gamma_ptr + x));
+                if (beta_ptr != nullptr)
+                {
+                    v = svadd_f32_x(pg, v, load(pg, beta_ptr + x));
+                }
+                store_dst(pg, dst_ptr + x, v, qinfo);
+
+                x += step;
+                pg = svwhilelt_b32(x, width);
+            } while (svptest_any(all, pg));
+        });
+}
+
+template <typename T>
+void sve_layer_norm(const ITensor             *src,
+                    const ITensor             *residual,
+                    const ITensor             *gamma,
+                    const ITensor             *beta,
+                    ITensor                   *dst,
+                    ITensor                   *residual_out,
+                    const LayerNormKernelInfo &info,
+                    const Window              &window)
+{
+    if (dst->info()->data_type() == DataType::QASYMM8_SIGNED)
+    {
+        layer_norm_rows<T, int8_t>(src, residual, gamma, beta, dst, residual_out, info, window);
+    }
+    else
+    {
+        layer_norm_rows<T, T>(src, residual, gamma, beta, dst, residual_out, info, window);
+    }
+}
+} // namespace layer_norm
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_SVE_IMPL_H
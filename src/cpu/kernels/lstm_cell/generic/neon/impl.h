@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LSTM_CELL_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LSTM_CELL_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "src/cpu/CpuTypes.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace lstm_cell
+{
+/** Gate indices used to address the per-row pointers */
+enum Gate
+{
+    Input  = 0,
+    Forget = 1,
+    Cell   = 2,
+    Output = 3
+};
+
+/** Pointers and normalization statistics of a single batch row
+ *
+ * @note Gate pre-activations are read from @p gate and staged into @p scratch, which is also the
+ *       final destination of the activated gates. All intermediate arithmetic is done in F32.
+ */
+template <typename T>
+struct Row
+{
+    const T *gate[4];       /**< GEMM output slices (input slice is nullptr with CIFG) */
+    const T *bias[4];       /**< Gate biases */
+    const T *peephole[4];   /**< Peephole weights (nullptr when unused) */
+    const T *ln_weights[4]; /**< Layer normalization weights (nullptr when unused) */
+    const T *cell_in;       /**< Previous cell state */
+    T       *scratch[4];    /**< Scratch buffer slices (input slice is nullptr with CIFG) */
+    T       *cell_out;      /**< New cell state */
+    T       *output_state;  /**< Output state before the optional projection */
+    float    mean[4];       /**< Per gate mean used by the layer normalization */
+    float    inv_stddev[4]; /**< Per gate inverse standard deviation used by the layer normalization */
+};
+
+template <typename V, typename T>
+V load(const T *ptr);
+
+template <>
+inline float32x4_t load<float32x4_t, float>(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+template <>
+inline float load<float, float>(const float *ptr)
+{
+    return *ptr;
+}
+
+inline void store(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+inline void store(float *ptr, float v)
+{
+    *ptr = v;
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline float32x4_t load<float32x4_t, float16_t>(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+template <>
+inline float load<float, float16_t>(const float16_t *ptr)
+{
+    return static_cast<float>(*ptr);
+}
+
+inline void store(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+
+inline void store(float16_t *ptr, float v)
+{
+    *ptr = static_cast<float16_t>(v);
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+template <typename V>
+V dup(float v);
+
+template <>
+inline float32x4_t dup<float32x4_t>(float v)
+{
+    return vdupq_n_f32(v);
+}
+
+template <>
+inline float dup<float>(float v)
+{
+    return v;
+}
+
+inline float32x4_t add(float32x4_t a, float32x4_t b)
+{
+    return vaddq_f32(a, b);
+}
+
+inline float add(float a, float b)
+{
+    return a + b;
+}
+
+inline float32x4_t sub(float32x4_t a, float32x4_t b)
+{
+    return vsubq_f32(a, b);
+}
+
+inline float sub(float a, float b)
+{
+    return a - b;
+}
+
+inline float32x4_t mul(float32x4_t a, float32x4_t b)
+{
+    return vmulq_f32(a, b);
+}
+
+inline float mul(float a, float b)
+{
+    return a * b;
+}
+
+/** Compute a + b * c */
+inline float32x4_t mla(float32x4_t a, float32x4_t b, float32x4_t c)
+{
+    return vmlaq_f32(a, b, c);
+}
+
+inline float mla(float a, float b, float c)
+{
+    return a + b * c;
+}
+
+inline float32x4_t clamp(float32x4_t v, float lo, float hi)
+{
+    return vminq_f32(vmaxq_f32(v, vdupq_n_f32(lo)), vdupq_n_f32(hi));
+}
+
+inline float clamp(float v, float lo, float hi)
+{
+    return std::min(std::max(v, lo), hi);
+}
+
+inline float reduce(float32x4_t v)
+{
+    const float32x2_t tmp = vadd_f32(vget_high_f32(v), vget_low_f32(v));
+    return vget_lane_f32(vpadd_f32(tmp, tmp), 0);
+}
+
+inline float reduce(float v)
+{
+    return v;
+}
+
+inline float32x4_t sigmoid(float32x4_t v)
+{
+    return vlogisticq_f32(v);
+}
+
+inline float sigmoid(float v)
+{
+    return 1.f / (1.f + std::exp(-v));
+}
+
+inline float32x4_t tanh(float32x4_t v)
+{
+    return vtanhq_f32(v);
+}
+
+inline float tanh(float v)
+{
+    return std::tanh(v);
+}
+
+/** Apply one of the activations supported by @ref cpu::kernels::CpuLSTMCellKernel */
+template <typename V>
+inline V activate(V v, const ActivationLayerInfo &act_info)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    switch (act_info.activation())
+    {
+        case ActFunction::LOGISTIC:
+            return sigmoid(v);
+        case ActFunction::TANH:
+            return mul(dup<V>(act_info.a()), tanh(mul(v, dup<V>(act_info.b()))));
+        case ActFunction::RELU:
+            return clamp(v, 0.f, std::numeric_limits<float>::max());
+        case ActFunction::BOUNDED_RELU:
+            return clamp(v, 0.f, act_info.a());
+        case ActFunction::LU_BOUNDED_RELU:
+            return clamp(v, act_info.b(), act_info.a());
+        case ActFunction::IDENTITY:
+        default:
+            return v;
+    }
+}
+
+template <typename V, typename T>
+inline V normalize(const Row<T> &row, Gate g, V v, int x)
+{
+    const V norm = mul(sub(v, dup<V>(row.mean[g])), dup<V>(row.inv_stddev[g]));
+    return mla(load<V>(row.bias[g] + x), norm, load<V>(row.ln_weights[g] + x));
+}
+
+/** Stage the pre-activation of gate @p g into its scratch slice and accumulate its statistics */
+template <typename V, typename T>
+inline void stage_gate(const Row<T> &row, Gate g, bool add_bias, int x, V &sum, V &sum_sq)
+{
+    V v = load<V>(row.gate[g] + x);
+    if (row.peephole[g] != nullptr)
+    {
+        v = mla(v, load<V>(row.peephole[g] + x), load<V>(row.cell_in + x));
+    }
+    if (add_bias)
+    {
+        v = add(v, load<V>(row.bias[g] + x));
+    }
+    store(row.scratch[g] + x, v);
+    sum    = add(sum, v);
+    sum_sq = mla(sum_sq, v, v);
+}
+
+/** Compute the input, forget and cell gates, update the cell state and stage the output gate
+ *
+ * Without layer normalization the output gate and the output state are finalized here as well.
+ */
+template <typename V, typename T>
+inline void update_cell(const Row<T> &row, const LSTMCellKernelInfo &info, int x, V &sum, V &sum_sq)
+{
+    V forget_gate = load<V>(row.scratch[Forget] + x);
+    V cell_gate   = load<V>(row.scratch[Cell] + x);
+    if (info.use_layer_norm)
+    {
+        forget_gate = normalize(row, Forget, forget_gate, x);
+        cell_gate   = normalize(row, Cell, cell_gate, x);
+    }
+    forget_gate = sigmoid(forget_gate);
+    cell_gate   = activate(cell_gate, info.act_info);
+
+    V input_gate;
+    if (info.has_cifg_opt)
+    {
+        input_gate = sub(dup<V>(1.f), forget_gate);
+    }
+    else
+    {
+        input_gate = load<V>(row.scratch[Input] + x);
+        if (info.use_layer_norm)
+        {
+            input_gate = normalize(row, Input, input_gate, x);
+        }
+        input_gate = sigmoid(input_gate);
+        store(row.scratch[Input] + x, input_gate);
+    }
+
+    V cell_state = mla(mul(forget_gate, load<V>(row.cell_in + x)), input_gate, cell_gate);
+    if (info.cell_threshold != 0.f)
+    {
+        cell_state = clamp(cell_state, -info.cell_threshold, info.cell_threshold);
+    }
+    store(row.scratch[Forget] + x, forget_gate);
+    store(row.scratch[Cell] + x, cell_state);
+    store(row.cell_out + x, cell_state);
+
+    V output_gate = load<V>(row.gate[Output] + x);
+    if (row.peephole[Output] != nullptr)
+    {
+        output_gate = mla(output_gate, load<V>(row.peephole[Output] + x), cell_state);
+    }
+    if (info.use_layer_norm)
+    {
+        store(row.scratch[Output] + x, output_gate);
+        sum    = add(sum, output_gate);
+        sum_sq = mla(sum_sq, output_gate, output_gate);
+    }
+    else
+    {
+        output_gate = sigmoid(add(output_gate, load<V>(row.bias[Output] + x)));
+        store(row.scratch[Output] + x, output_gate);
+        store(row.output_state + x, mul(output_gate, activate(cell_state, info.act_info)));
+    }
+}
+
+/** Finalize the layer normalized output gate and the output state */
+template <typename V, typename T>
+inline void update_output(const Row<T> &row, const LSTMCellKernelInfo &info, int x)
+{
+    const V output_gate = sigmoid(normalize(row, Output, load<V>(row.scratch[Output] + x), x));
+    store(row.scratch[Output] + x, output_gate);
+    store(row.output_state + x, mul(output_gate, activate(load<V>(row.cell_out + x), info.act_info)));
+}
+
+inline void compute_statistics(float sum, float sum_sq, int num_units, float epsilon, float &mean, float &inv_stddev)
+{
+    mean            = sum / num_units;
+    const float var = (sum_sq / num_units) - (mean * mean);
+    inv_stddev      = 1.f / std::sqrt(var + epsilon);
+}
+
+template <typename T>
+void neon_lstm_cell(const ITensor            *gates,
+                    const ITensor            *cell_state_in,
+                    const ITensor            *coefficients,
+                    ITensor                  *cell_state_out,
+                    ITensor                  *output_state,
+                    ITensor                  *scratch,
+                    const LSTMCellKernelInfo &info,
+                    const Window             &window)
+{
+    constexpr int window_step_x = 4;
+    const int     num_units     = static_cast<int>(output_state->info()->dimension(0));
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    const auto coefficient = [&](LSTMCellCoefficient c)
+    { return reinterpret_cast<const T *>(coefficients->ptr_to_element(Coordinates(0, static_cast<int>(c)))); };
+
+    // Slice offsets inside the fused GEMM output and the scratch buffer
+    const int gate_offset[4]    = {0, info.has_cifg_opt ? 0 : 1, info.has_cifg_opt ? 1 : 2,
+                                   info.has_cifg_opt ? 2 : 3};
+    const int scratch_offset[4] = {0, info.has_cifg_opt ? 1 : 2, info.has_cifg_opt ? 0 : 1,
+                                   info.has_cifg_opt ? 2 : 3};
+
+    Row<T> row{};
+    row.bias[Input]  = info.has_cifg_opt ? nullptr : coefficient(LSTMCellCoefficient::InputGateBias);
+    row.bias[Forget] = coefficient(LSTMCellCoefficient::ForgetGateBias);
+    row.bias[Cell]   = coefficient(LSTMCellCoefficient::CellBias);
+    row.bias[Output] = coefficient(LSTMCellCoefficient::OutputGateBias);
+    if (info.has_peephole)
+    {
+        row.peephole[Input]  = info.has_cifg_opt ? nullptr : coefficient(LSTMCellCoefficient::CellToInput);
+        row.peephole[Forget] = coefficient(LSTMCellCoefficient::CellToForget);
+        row.peephole[Output] = coefficient(LSTMCellCoefficient::CellToOutput);
+    }
+    if (info.use_layer_norm)
+    {
+        row.ln_weights[Input]  = info.has_cifg_opt ? nullptr : coefficient(LSTMCellCoefficient::InputLayerNorm);
+        row.ln_weights[Forget] = coefficient(LSTMCellCoefficient::ForgetLayerNorm);
+        row.ln_weights[Cell]   = coefficient(LSTMCellCoefficient::CellLayerNorm);
+        row.ln_weights[Output] = coefficient(LSTMCellCoefficient::OutputLayerNorm);
+    }
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const Coordinates row_id(0, id.y());
+            const auto        gates_ptr   = reinterpret_cast<const T *>(gates->ptr_to_element(row_id));
+            const auto        scratch_ptr = reinterpret_cast<T *>(scratch->ptr_to_element(row_id));
+            for (int g = Input; g <= Output; ++g)
+            {
+                const bool is_present = !(g == Input && info.has_cifg_opt);
+                row.gate[g]           = is_present ? gates_ptr + gate_offset[g] * num_units : nullptr;
+                row.scratch[g]        = is_present ? scratch_ptr + scratch_offset[g] * num_units : nullptr;
+            }
+            row.cell_in      = reinterpret_cast<const T *>(cell_state_in->ptr_to_element(row_id));
+            row.cell_out     = reinterpret_cast<T *>(cell_state_out->ptr_to_element(row_id));
+            row.output_state = reinterpret_cast<T *>(output_state->ptr_to_element(row_id));
+
+            // Stage the input, forget and cell gate pre-activations. With layer normalization the bias is
+            // applied after the normalization, so it is skipped here.
+            const bool add_bias = !info.use_layer_norm;
+            for (int g = Input; g <= Cell; ++g)
+            {
+                if (row.gate[g] == nullptr)
+                {
+                    continue;
+                }
+                float32x4_t vsum    = vdupq_n_f32(0.f);
+                float32x4_t vsum_sq = vdupq_n_f32(0.f);
+                int         x       = 0;
+                for (; x <= (num_units - window_step_x); x += window_step_x)
+                {
+                    stage_gate(row, static_cast<Gate>(g), add_bias, x, vsum, vsum_sq);
+                }
+                float sum    = reduce(vsum);
+                float sum_sq = reduce(vsum_sq);
+                for (; x < num_units; ++x)
+                {
+                    stage_gate(row, static_cast<Gate>(g), add_bias, x, sum, sum_sq);
+                }
+                if (info.use_layer_norm)
+                {
+                    compute_statistics(sum, sum_sq, num_units, info.epsilon, row.mean[g], row.inv_stddev[g]);
+                }
+            }
+
+            // Activate the gates, update the cell state and stage the output gate
+            float32x4_t vsum    = vdupq_n_f32(0.f);
+            float32x4_t vsum_sq = vdupq_n_f32(0.f);
+            int         x       = 0;
+            for (; x <= (num_units - window_step_x); x += window_step_x)
+            {
+                update_cell(row, info, x, vsum, vsum_sq);
+            }
+            float sum    = reduce(vsum);
+            float sum_sq = reduce(vsum_sq);
+            for (; x < num_units; ++x)
+            {
+                update_cell(row, info, x, sum, sum_sq);
+            }
+
+            if (info.use_layer_norm)
+            {
+                compute_statistics(sum, sum_sq, num_units, info.epsilon, row.mean[Output], row.inv_stddev[Output]);
+                for (x = 0; x <= (num_units - window_step_x); x += window_step_x)
+                {
+                    update_output<float32x4_t>(row, info, x);
+                }
+                for (; x < num_units; ++x)
+                {
+                    update_output<float>(row, info, x);
+                }
+            }
+        });
+}
+} // namespace lstm_cell
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LSTM_CELL_GENERIC_NEON_IMPL_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm_compute/core/Error.h"
+
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/lut/list.h"
+
+#ifdef __aarch64__
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace cpu
+{
+void lut_u16_neon(const uint16_t *table, size_t num_strings, size_t size, const uint16_t *input, uint16_t *output)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "lut_u16_neon");
+    ARM_COMPUTE_UNUSED(num_strings);
+
+    // Neon has no gather load: the indices are loaded a vector at a time and every lane is
+    // fetched with its own load. Two vectors are processed per iteration to keep more loads in flight.
+    size_t x = 0;
+    for (; x + 16 <= size; x += 16)
+    {
+        const uint16x8_t idx0 = vld1q_u16(input + x);
+        const uint16x8_t idx1 = vld1q_u16(input + x + 8);
+
+        uint16x8_t res0 = vdupq_n_u16(0);
+        uint16x8_t res1 = vdupq_n_u16(0);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 0), res0, 0);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 0), res1, 0);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 1), res0, 1);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 1), res1, 1);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 2), res0, 2);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 2), res1, 2);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 3), res0, 3);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 3), res1, 3);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 4), res0, 4);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 4), res1, 4);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 5), res0, 5);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 5), res1, 5);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 6), res0, 6);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 6), res1, 6);
+        res0            = vld1q_lane_u16(table + vgetq_lane_u16(idx0, 7), res0, 7);
+        res1            = vld1q_lane_u16(table + vgetq_lane_u16(idx1, 7), res1, 7);
+
+        vst1q_u16(output + x, res0);
+        vst1q_u16(output + x + 8, res1);
+    }
+
+    for (; x < size; ++x)
+    {
+        output[x] = table[input[x]];
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // __aarch64__
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_RECURRENT_STEP_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_RECURRENT_STEP_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/lstm_cell/generic/neon/impl.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace recurrent_step
+{
+using lstm_cell::Cell;
+using lstm_cell::Forget;
+using lstm_cell::Gate;
+using lstm_cell::Input;
+using lstm_cell::Output;
+
+/** Dot product between a row of recurrent weights and a row of the previous state, accumulated in F32 */
+template <typename T>
+inline float dot(const T *weights, const T *state, int len)
+{
+    constexpr int window_step_x = 4;
+
+    float32x4_t vacc = vdupq_n_f32(0.f);
+    int         x    = 0;
+    for (; x <= (len - window_step_x); x += window_step_x)
+    {
+        vacc = lstm_cell::mla(vacc, lstm_cell::load<float32x4_t>(weights + x), lstm_cell::load<float32x4_t>(state + x));
+    }
+    float acc = lstm_cell::reduce(vacc);
+    for (; x < len; ++x)
+    {
+        acc = lstm_cell::mla(acc, lstm_cell::load<float>(weights + x), lstm_cell::load<float>(state + x));
+    }
+    return acc;
+}
+
+template <typename T>
+void neon_recurrent_step(const ITensor                 *pre_gates,
+                         const ITensor                 *recurrent_weights,
+                         const ITensor                 *state_in,
+                         const ITensor                 *coefficients,
+                         ITensor                       *cell_state,
+                         ITensor                       *state_out,
+                         const RecurrentStepKernelInfo &info,
+                         const Window                  &window)
+{
+    const LSTMCellKernelInfo &cell_info   = info.cell_info;
+    const int                 num_units   = static_cast<int>(state_out->info()->dimension(0));
+    const int                 num_batches = static_cast<int>(state_out->info()->dimension(1));
+    const int                 state_size  = static_cast<int>(state_in->info()->dimension(0));
+
+    const auto weights_row = [&](int row)
+    { return reinterpret_cast<const T *>(recurrent_weights->ptr_to_element(Coordinates(0, row))); };
+    const auto batch_row = [](const ITensor *tensor, int b)
+    { return reinterpret_cast<T *>(tensor->ptr_to_element(Coordinates(0, b))); };
+
+    // Slice offsets inside the input projection and the concatenated recurrent weights
+    const bool has_input_gate = info.is_lstm && !cell_info.has_cifg_opt;
+    const int  gate_offset[4] = {0, has_input_gate ? 1 : 0, has_input_gate ? 2 : 1, has_input_gate ? 3 : 2};
+
+    const T *peephole[4] = {nullptr, nullptr, nullptr, nullptr};
+    if (info.is_lstm && cell_info.has_peephole)
+    {
+        const auto coefficient = [&](LSTMCellCoefficient c)
+        { return reinterpret_cast<const T *>(coefficients->ptr_to_element(Coordinates(0, static_cast<int>(c)))); };
+        peephole[Input]  = has_input_gate ? coefficient(LSTMCellCoefficient::CellToInput) : nullptr;
+        peephole[Forget] = coefficient(LSTMCellCoefficient::CellToForget);
+        peephole[Output] = coefficient(LSTMCellCoefficient::CellToOutput);
+    }
+
+    // Each thread owns a fixed range of units, hence the same rows of recurrent weights at every step
+    for (int u = window.x().start(); u < window.x().end(); ++u)
+    {
+        if (!info.is_lstm)
+        {
+            const T *weights = weights_row(u);
+            for (int b = 0; b < num_batches; ++b)
+            {
+                const float acc = lstm_cell::load<float>(batch_row(pre_gates, b) + u) +
+                                  dot(weights, batch_row(state_in, b), state_size);
+                lstm_cell::store(batch_row(state_out, b) + u, lstm_cell::activate(acc, cell_info.act_info));
+            }
+            continue;
+        }
+
+        const T *weights[4] = {nullptr, nullptr, nullptr, nullptr};
+        for (int g = Input; g <= Output; ++g)
+        {
+            if (g != Input || has_input_gate)
+            {
+                weights[g] = weights_row(gate_offset[g] * num_units + u);
+            }
+        }
+
+        for (int b = 0; b < num_batches; ++b)
+        {
+            const T *pre   = batch_row(pre_gates, b);
+            const T *state = batch_row(state_in, b);
+            T       *cell  = batch_row(cell_state, b) + u;
+
+            const auto gate = [&](Gate g)
+            {
+                return lstm_cell::load<float>(pre + gate_offset[g] * num_units + u) +
+                       dot(weights[g], state, state_size);
+            };
+
+            const float cell_prev   = lstm_cell::load<float>(cell);
+            float       forget_gate = gate(Forget);
+            if (peephole[Forget] != nullptr)
+            {
+                forget_gate = lstm_cell::mla(forget_gate, lstm_cell::load<float>(peephole[Forget] + u), cell_prev);
+            }
+            forget_gate = lstm_cell::sigmoid(forget_gate);
+
+            float input_gate = 1.f - forget_gate;
+            if (has_input_gate)
+            {
+                input_gate = gate(Input);
+                if (peephole[Input] != nullptr)
+                {
+                    input_gate = lstm_cell::mla(input_gate, lstm_cell::load<float>(peephole[Input] + u), cell_prev);
+                }
+                input_gate = lstm_cell::sigmoid(input_gate);
+            }
+
+            const float cell_gate = lstm_cell::activate(gate(Cell), cell_info.act_info);
+            float       cell_next = lstm_cell::mla(forget_gate * cell_prev, input_gate, cell_gate);
+            if (cell_info.cell_threshold != 0.f)
+            {
+                cell_next = lstm_cell::clamp(cell_next, -cell_info.cell_threshold, cell_info.cell_threshold);
+            }
+
+            float output_gate = gate(Output);
+            if (peephole[Output] != nullptr)
+            {
+                output_gate = lstm_cell::mla(output_gate, lstm_cell::load<float>(peephole[Output] + u), cell_next);
+            }
+            output_gate = lstm_cell::sigmoid(output_gate);
+
+            // The cell state is updated in place: every unit is owned by a single thread and read only here
+            lstm_cell::store(cell, cell_next);
+            lstm_cell::store(batch_row(state_out, b) + u,
+                             output_gate * lstm_cell::activate(cell_next, cell_info.act_info));
+        }
+    }
+}
+} // namespace recurrent_step
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_RECURRENT_STEP_GENERIC_NEON_IMPL_H
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ROPE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ROPE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+
+#include "src/cpu/CpuTypes.h"
+
+#include <arm_neon.h>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace rope
+{
+inline float32x4_t load(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline float32x4x2_t load_pairs(const float *ptr)
+{
+    return vld2q_f32(ptr);
+}
+
+inline void store(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+inline void store_pairs(float *ptr, const float32x4x2_t &v)
+{
+    vst2q_f32(ptr, v);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4_t load(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline float32x4x2_t load_pairs(const float16_t *ptr)
+{
+    const float16x4x2_t v = vld2_f16(ptr);
+    return {{vcvt_f32_f16(v.val[0]), vcvt_f32_f16(v.val[1])}};
+}
+
+inline void store(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+
+inline void store_pairs(float16_t *ptr, const float32x4x2_t &v)
+{
+    const float16x4x2_t h = {{vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])}};
+    vst2_f16(ptr, h);
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Store 4 values @p stride elements apart */
+template <typename T>
+inline void store_strided(T *ptr, int stride, float32x4_t v)
+{
+    if (stride == 1)
+    {
+        store(ptr, v);
+    }
+    else
+    {
+        float tmp[4];
+        vst1q_f32(tmp, v);
+        for (int j = 0; j < 4; ++j)
+        {
+            ptr[j * stride] = static_cast<T>(tmp[j]);
+        }
+    }
+}
+
+/** Rotate the leading @p rotary_dim elements of a head and copy the remaining ones
+ *
+ * @param[in]  src         Source head, contiguous.
+ * @param[out] dst         Destination head, with its elements @p dst_stride elements apart.
+ * @param[in]  dst_stride  Distance in elements between two consecutive elements of @p dst.
+ * @param[in]  cos         Cosines of the angles of the position, one per rotated pair.
+ * @param[in]  sin         Sines of the angles of the position, one per rotated pair.
+ * @param[in]  rotary_dim  Number of rotated elements.
+ * @param[in]  head_dim    Number of elements of the head.
+ * @param[in]  interleaved True to rotate adjacent pairs, false to rotate the two halves of the rotated elements.
+ */
+template <typename T>
+void rotate_head(const T     *src,
+                 T           *dst,
+                 int          dst_stride,
+                 const float *cos,
+                 const float *sin,
+                 int          rotary_dim,
+                 int          head_dim,
+                 bool         interleaved)
+{
+    const int half = rotary_dim / 2;
+    int       i    = 0;
+    if (interleaved)
+    {
+        for (; i <= half - 4; i += 4)
+        {
+            const float32x4x2_t x  = load_pairs(src + 2 * i);
+            const float32x4_t   vc = vld1q_f32(cos + i);
+            const float32x4_t   vs = vld1q_f32(sin + i);
+            const float32x4x2_t r  = {{vmlsq_f32(vmulq_f32(x.val[0], vc), x.val[1], vs),
+                                       vmlaq_f32(vmulq_f32(x.val[1], vc), x.val[0], vs)}};
+            if (dst_stride == 1)
+            {
+                store_pairs(dst + 2 * i, r);
+            }
+            else
+            {
+                store_strided(dst + 2 * i * dst_stride, 2 * dst_stride, r.val[0]);
+                store_strided(dst + (2 * i + 1) * dst_stride, 2 * dst_stride, r.val[1]);
+            }
+        }
+        for (; i < half; ++i)
+        {
+            const float x0                = static_cast<float>(src[2 * i]);
+            const float x1                = static_cast<float>(src[2 * i + 1]);
+            dst[2 * i * dst_stride]       = static_cast<T>(x0 * cos[i] - x1 * sin[i]);
+            dst[(2 * i + 1) * dst_stride] = static_cast<T>(x1 * cos[i] + x0 * sin[i]);
+        }
+    }
+    else
+    {
+        for (; i <= half - 4; i += 4)
+        {
+            const float32x4_t x0 = load(src + i);
+            const float32x4_t x1 = load(src + i + half);
+            const float32x4_t vc = vld1q_f32(cos + i);
+            const float32x4_t vs = vld1q_f32(sin + i);
+            store_strided(dst + i * dst_stride, dst_stride, vmlsq_f32(vmulq_f32(x0, vc), x1, vs));
+            store_strided(dst + (i + half) * dst_stride, dst_stride, vmlaq_f32(vmulq_f32(x1, vc), x0, vs));
+        }
+        for (; i < half; ++i)
+        {
+            const float x0               = static_cast<float>(src[i]);
+            const float x1               = static_cast<float>(src[i + half]);
+            dst[i * dst_stride]          = static_cast<T>(x0 * cos[i] - x1 * sin[i]);
+            dst[(i + half) * dst_stride] = static_cast<T>(x1 * cos[i] + x0 * sin[i]);
+        }
+    }
+
+    // Pass through the elements that are not rotated
+    if (dst_stride == 1)
+    {
+        std::memcpy(dst + rotary_dim, src + rotary_dim, (head_dim - rotary_dim) * sizeof(T));
+    }
+    else
+    {
+        for (int j = rotary_dim; j < head_dim; ++j)
+        {
+            dst[j * dst_stride] = src[j];
+        }
+    }
+}
+
+/** Split the fused QKV rows into heads and apply the rotary embedding to Q and K
+ *
+ * The window iterates over the query heads, i.e. [1, seq_len, num_heads, batch_size], and each work item writes
+ * one head of Q and, for the first num_kv_heads heads, one head of K and V.
+ */
+template <typename T>
+void qkv_rope(const ITensor  *qkv,
+              const ITensor  *positions,
+              ITensor        *q,
+              ITensor        *k,
+              ITensor        *v,
+              const float    *cos_sin,
+              const RoPEInfo &info,
+              const Window   &window)
+{
+    const int  num_heads    = static_cast<int>(info.num_heads);
+    const int  num_kv_heads = static_cast<int>(info.num_kv_heads);
+    const int  head_dim     = static_cast<int>(info.head_dim);
+    const int  rotary_dim   = info.rotary_dim == 0 ? head_dim : static_cast<int>(info.rotary_dim);
+    const int  k_stride     = info.transpose_k ? static_cast<int>(k->info()->strides_in_bytes()[1] / sizeof(T)) : 1;
+    const bool batched_pos  = positions != nullptr && positions->info()->num_dimensions() > 1;
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const int s = id.y();
+            const int h = id.z();
+            const int b = id[3];
+
+            int pos = s;
+            if (positions != nullptr)
+            {
+                const Coordinates pos_id = batched_pos ? Coordinates(s, b) : Coordinates(s);
+                pos                      = *reinterpret_cast<const int32_t *>(positions->ptr_to_element(pos_id));
+            }
+            // The positions are runtime data, so they are checked in all builds before indexing the table
+            if (pos < 0 || pos >= static_cast<int>(info.max_position))
+            {
+                ARM_COMPUTE_ERROR_VAR("Position %d is out of the range of the sin/cos table [0, %u)", pos,
+                                      info.max_position);
+            }
+            const float *cos = cos_sin + static_cast<size_t>(pos) * rotary_dim;
+            const float *sin = cos + rotary_dim / 2;
+
+            const auto *row   = reinterpret_cast<const T *>(qkv->ptr_to_element(Coordinates(0, s, b)));
+            auto       *q_ptr = reinterpret_cast<T *>(q->ptr_to_element(Coordinates(0, s, h, b)));
+            rotate_head(row + h * head_dim, q_ptr, 1, cos, sin, rotary_dim, head_dim, info.interleaved);
+
+            if (h < num_kv_heads)
+            {
+                const Coordinates k_id  = info.transpose_k ? Coordinates(s, 0, h, b) : Coordinates(0, s, h, b);
+                auto             *k_ptr = reinterpret_cast<T *>(k->ptr_to_element(k_id));
+                rotate_head(row + (num_heads + h) * head_dim, k_ptr, k_stride, cos, sin, rotary_dim, head_dim,
+                            info.interleaved);
+
+                std::memcpy(v->ptr_to_element(Coordinates(0, s, h, b)),
+                            row + (num_heads + num_kv_heads + h) * head_dim, head_dim * sizeof(T));
+            }
+        });
+}
+} // namespace rope
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ROPE_GENERIC_NEON_IMPL_H
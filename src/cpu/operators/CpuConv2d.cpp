@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,7 +58,6 @@ void CpuConv2d::configure(ITensorInfo               *input,
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuConv2d::configure");
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
                                                    act_info, enable_fast_math, num_groups));
 
@@ -66,8 +65,12 @@ void CpuConv2d::configure(ITensorInfo               *input,
                            enable_fast_math, num_groups);
 
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    // Grouped convolutions run all the groups in a single batched assembly GEMM
+    const ConvolutionMethod method =
+        (num_groups > 1) ? ConvolutionMethod::GEMM_CONV2D
+                         : CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation,
+                                                             act_info, enable_fast_math);
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
@@ -117,11 +120,16 @@ Status CpuConv2d::validate(const ITensorInfo         *input,
                            unsigned int               num_groups)
 {
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuConv2d::validate");
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups == 0, "num_groups must be greater than zero");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (input->data_layout() != DataLayout::NHWC),
+                                    "Grouping (num_groups != 1) is only supported on NHWC");
 
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    const Conv2dInfo        info(conv_info, dilation, act_info, enable_fast_math, num_groups);
+    const ConvolutionMethod method =
+        (num_groups > 1) ? ConvolutionMethod::GEMM_CONV2D
+                         : CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation,
+                                                             act_info, enable_fast_math);
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
             ARM_COMPUTE_RETURN_ON_ERROR(
@@ -163,6 +171,13 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
 
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
 
+    // BFLOAT16 destinations are only produced by the indirect GEMM path, the other methods accumulate into F32
+    if (input->data_type() == DataType::BFLOAT16 && output->data_type() == DataType::BFLOAT16 &&
+        bool(CpuGemmDirectConv2d::validate(input, weights, nullptr, output, info)))
+    {
+        return ConvolutionMethod::GEMM_CONV2D;
+    }
+
     /* Input spatial dims, kernel size, IFM/OFM, conv info*/
     using ConvolutionConfiguration = std::tuple<Size2D, Size2D, Size2D, PadStrideInfo>;
     using ConfigurationMethod      = std::pair<ConvolutionConfiguration, ConvolutionMethod>;
@@ -206,14 +221,17 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
         return (*found).second;
     }
 
+    const bool gemmDirectConv2d_validates =
+        bool(CpuGemmDirectConv2d::validate(input, weights, nullptr, output, info));
+
     if (dilation != Size2D(1U, 1U))
     {
-        return ConvolutionMethod::GEMM;
+        // Dilated convolutions can't run with Winograd. GEMM_CONV2D applies the dilation while walking the input,
+        // so it avoids materialising the (kernel_w * kernel_h) times larger im2col workspace of the GEMM method.
+        return gemmDirectConv2d_validates ? ConvolutionMethod::GEMM_CONV2D : ConvolutionMethod::GEMM;
     }
     else
     {
-        const bool gemmDirectConv2d_validates =
-            bool(CpuGemmDirectConv2d::validate(input, weights, nullptr, output, info));
 
         // SRGAN
         // Output might not be initialized when it is an internal tensor of the layer using the convolution
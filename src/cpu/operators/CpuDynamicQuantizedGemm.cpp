@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+AsmGemmInfo init_assembly_metadata(const ITensorInfo *b)
+{
+    // The scales are applied by the output stage, so the assembly kernels only convert the int32 accumulators to F32
+    AsmGemmInfo asm_info;
+    asm_info.reshape_b_only_on_first_run = b->are_values_constant();
+    return asm_info;
+}
+} // namespace
+
+Status CpuDynamicQuantizedGemm::validate(const ITensorInfo         *a,
+                                         const ITensorInfo         *b,
+                                         const ITensorInfo         *c,
+                                         const ITensorInfo         *d,
+                                         const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizedGemm::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(1),
+                                    "The product AB is defined only if the number of columns in A is equal to the "
+                                    "number of rows in B");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->dimension(0) != b->dimension(0),
+                                    "The output matrix must have the same number of columns as the matrix B");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->tensor_shape().total_size_upper(1) != a->tensor_shape().total_size_upper(1),
+                                    "The output matrix must have the same number of rows as the matrix A");
+    if (c != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, c);
+        ARM_COMPUTE_RETURN_ERROR_ON(c->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(c->dimension(0) != b->dimension(0));
+    }
+
+    TensorInfo quantized_a{};
+    TensorInfo scales_a{};
+    TensorInfo quantized_b{};
+    TensorInfo scales_b{};
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDynamicQuantizeKernel::validate(a, &quantized_a, &scales_a));
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDynamicQuantizeKernel::validate(b, &quantized_b, &scales_b, true));
+
+    auto_init_if_empty(quantized_a, a->clone()->set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(
+                                         QuantizationInfo(1.f, 0)));
+    auto_init_if_empty(quantized_b, b->clone()->set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(
+                                         QuantizationInfo(1.f, 0)));
+    auto_init_if_empty(scales_a, TensorShape(a->tensor_shape().total_size_upper(1)), 1, DataType::F32);
+    auto_init_if_empty(scales_b, TensorShape(b->dimension(0) * b->tensor_shape().total_size_upper(2)), 1,
+                       DataType::F32);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        CpuGemmAssemblyDispatch::validate(&quantized_a, &quantized_b, nullptr, d, init_assembly_metadata(b)));
+
+    const bool fuse_activation = kernels::CpuDynamicDequantizeOutputStageKernel::is_activation_supported(act_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDynamicDequantizeOutputStageKernel::validate(
+        d, &scales_a, &scales_b, c, fuse_activation ? act_info : ActivationLayerInfo()));
+    if (!fuse_activation)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(d, nullptr, act_info));
+    }
+
+    return Status{};
+}
+
+void CpuDynamicQuantizedGemm::configure(const ITensorInfo         *a,
+                                        const ITensorInfo         *b,
+                                        const ITensorInfo         *c,
+                                        ITensorInfo               *d,
+                                        const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizedGemm::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuDynamicQuantizedGemm::validate(a, b, c, d, act_info));
+    ARM_COMPUTE_LOG_PARAMS(a, b, c, d, act_info);
+
+    _is_b_constant  = b->are_values_constant();
+    _run_activation = !kernels::CpuDynamicDequantizeOutputStageKernel::is_activation_supported(act_info);
+    _is_prepared    = false;
+
+    // Quantize a per row, and b per column so that each scale factors out of the dot products
+    _quantize_a_kernel = std::make_unique<kernels::CpuDynamicQuantizeKernel>();
+    _quantize_a_kernel->configure(a, &_quantized_a, &_scales_a);
+    _quantize_b_kernel = std::make_unique<kernels::CpuDynamicQuantizeKernel>();
+    _quantize_b_kernel->configure(b, &_quantized_b, &_scales_b, true);
+
+    _asm_glue = std::make_unique<CpuGemmAssemblyDispatch>();
+    _asm_glue->configure(&_quantized_a, &_quantized_b, nullptr, d, init_assembly_metadata(b));
+    ARM_COMPUTE_EXIT_ON_MSG(!_asm_glue->is_configured(), "Error in CpuGemmAssemblyDispatch configuration");
+
+    _output_stage_kernel = std::make_unique<kernels::CpuDynamicDequantizeOutputStageKernel>();
+    _output_stage_kernel->configure(d, &_scales_a, &_scales_b, c, _run_activation ? ActivationLayerInfo() : act_info);
+
+    if (_run_activation)
+    {
+        _activation_func = std::make_unique<CpuActivation>();
+        _activation_func->configure(d, nullptr, act_info);
+    }
+
+    // Specify memory required by the assembly kernel
+    const auto asm_mem_req = _asm_glue->workspace();
+    for (unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = asm_mem_req[slot];
+    }
+
+    // Once pretransposed by the assembly kernel, the quantized b is not needed anymore
+    _is_b_pretransposed = _is_b_constant && _aux_mem[Pretranspose].size > 0;
+
+    _aux_mem[QuantizedA] = MemoryInfo(offset_int_vec(QuantizedA), MemoryLifetime::Temporary, _quantized_a.total_size());
+    _aux_mem[ScalesA]    = MemoryInfo(offset_int_vec(ScalesA), MemoryLifetime::Temporary, _scales_a.total_size());
+    _aux_mem[QuantizedB] = MemoryInfo(offset_int_vec(QuantizedB),
+                                      !_is_b_constant       ? MemoryLifetime::Temporary
+                                      : _is_b_pretransposed ? MemoryLifetime::Prepare
+                                                            : MemoryLifetime::Persistent,
+                                      _quantized_b.total_size());
+    _aux_mem[ScalesB]    = MemoryInfo(offset_int_vec(ScalesB),
+                                      _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary,
+                                      _scales_b.total_size());
+}
+
+void CpuDynamicQuantizedGemm::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "CpuDynamicQuantizedGemm::run");
+    prepare(tensors);
+
+    auto a = tensors.get_const_tensor(ACL_SRC_0);
+    auto b = tensors.get_const_tensor(ACL_SRC_1);
+    auto c = tensors.get_const_tensor(ACL_SRC_2);
+    auto d = tensors.get_tensor(ACL_DST);
+
+    CpuAuxTensorHandler quantized_a(offset_int_vec(QuantizedA), _quantized_a, tensors);
+    CpuAuxTensorHandler scales_a(offset_int_vec(ScalesA), _scales_a, tensors);
+    CpuAuxTensorHandler quantized_b(offset_int_vec(QuantizedB), _quantized_b, tensors, false /*pack_inject*/,
+                                    _is_b_pretransposed /*bypass_alloc*/, _is_b_pretransposed /*bypass_import*/);
+    CpuAuxTensorHandler scales_b(offset_int_vec(ScalesB), _scales_b, tensors);
+
+    // Quantize a, each row being reduced to its scale and quantized in the same pass
+    ITensorPack quantize_a_pack{{ACL_SRC, a}, {ACL_DST_0, quantized_a.get()}, {ACL_DST_1, scales_a.get()}};
+    NEScheduler::get().schedule_op(_quantize_a_kernel.get(), _quantize_a_kernel->split_dimension(),
+                                   _quantize_a_kernel->window(), quantize_a_pack);
+
+    if (!_is_b_constant)
+    {
+        ITensorPack quantize_b_pack{{ACL_SRC, b}, {ACL_DST_0, quantized_b.get()}, {ACL_DST_1, scales_b.get()}};
+        NEScheduler::get().schedule_op(_quantize_b_kernel.get(), _quantize_b_kernel->split_dimension(),
+                                       _quantize_b_kernel->window(), quantize_b_pack);
+    }
+
+    // The bias is added by the output stage, after the scales
+    ITensorPack asm_pack = tensors;
+    asm_pack.remove_tensor(ACL_SRC_2);
+    asm_pack.add_const_tensor(ACL_SRC_0, quantized_a.get());
+    if (!_is_b_pretransposed)
+    {
+        asm_pack.add_const_tensor(ACL_SRC_1, quantized_b.get());
+    }
+    _asm_glue->run(asm_pack);
+
+    ITensorPack output_stage_pack{
+        {ACL_SRC_0, scales_a.get()}, {ACL_SRC_1, scales_b.get()}, {ACL_SRC_2, c}, {ACL_DST, d}};
+    NEScheduler::get().schedule_op(_output_stage_kernel.get(), Window::DimY, _output_stage_kernel->window(),
+                                   output_stage_pack);
+
+    if (_run_activation)
+    {
+        ITensorPack act_pack{{ACL_SRC, d}, {ACL_DST, d}};
+        _activation_func->run(act_pack);
+    }
+}
+
+void CpuDynamicQuantizedGemm::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_is_b_constant)
+        {
+            auto b = tensors.get_const_tensor(ACL_SRC_1);
+
+            CpuAuxTensorHandler quantized_b(offset_int_vec(QuantizedB), _quantized_b, tensors);
+            CpuAuxTensorHandler scales_b(offset_int_vec(ScalesB), _scales_b, tensors);
+
+            // Quantize b once and let the assembly kernel pretranspose it
+            ITensorPack quantize_b_pack{{ACL_SRC, b}, {ACL_DST_0, quantized_b.get()}, {ACL_DST_1, scales_b.get()}};
+            NEScheduler::get().schedule_op(_quantize_b_kernel.get(), _quantize_b_kernel->split_dimension(),
+                                           _quantize_b_kernel->window(), quantize_b_pack);
+
+            ITensorPack asm_pack = tensors;
+            asm_pack.remove_tensor(ACL_SRC_2);
+            asm_pack.add_const_tensor(ACL_SRC_1, quantized_b.get());
+            _asm_glue->prepare(asm_pack);
+
+            b->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuDynamicQuantizedGemm::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
+#define ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuDynamicDequantizeOutputStageKernel.h"
+#include "src/cpu/kernels/CpuDynamicQuantizeKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to compute an F32 GEMM on int8 operands quantized at run time. This function calls the following
+ * kernels/operators:
+ *
+ *  -# @ref cpu::kernels::CpuDynamicQuantizeKernel (per row of a, and per column of b)
+ *  -# @ref cpu::CpuGemmAssemblyDispatch
+ *  -# @ref cpu::kernels::CpuDynamicDequantizeOutputStageKernel
+ *  -# @ref cpu::CpuActivation (if the activation cannot be fused in the output stage)
+ *
+ * Each row of a and each column of b are quantized symmetrically to QASYMM8_SIGNED with their own scale, so no
+ * quantization information is needed at configure time. The int8 products are accumulated and converted to F32 by
+ * the assembly kernels, and the output stage applies the row and column scales, the bias and the activation.
+ * When b is constant it is quantized only once, in prepare().
+ */
+class CpuDynamicQuantizedGemm : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuDynamicQuantizedGemm() = default;
+    /** Destructor */
+    ~CpuDynamicQuantizedGemm() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicQuantizedGemm);
+    /** Initialise the kernel's inputs and output
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  a        First input tensor info (Matrix A). Data type supported: F32.
+     * @param[in]  b        Second input tensor info (Matrix B) with the same number of rows as @p a has columns. It
+     *                      can have batches, in which case they must match the batches of @p a. Data type supported: same as @p a.
+     * @param[in]  c        (Optional) 1D bias tensor info with one value per column of @p b. Can be nullptr. Data type supported: same as @p a.
+     * @param[out] d        Output tensor info. Data type supported: same as @p a.
+     * @param[in]  act_info (Optional) Activation to apply after the matrix multiplication.
+     */
+    void configure(const ITensorInfo         *a,
+                   const ITensorInfo         *b,
+                   const ITensorInfo         *c,
+                   ITensorInfo               *d,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuDynamicQuantizedGemm
+     *
+     * Similar to @ref CpuDynamicQuantizedGemm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *a,
+                           const ITensorInfo         *b,
+                           const ITensorInfo         *c,
+                           const ITensorInfo         *d,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        AsmGemmWorkspace = 0,
+        PrePretransposedB,
+        Pretranspose,
+        // Slots above (0-2) reserved for CpuGemmAssemblyDispatch
+        QuantizedA,
+        ScalesA,
+        QuantizedB,
+        ScalesB,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuDynamicQuantizeKernel>              _quantize_a_kernel{nullptr};
+    std::unique_ptr<kernels::CpuDynamicQuantizeKernel>              _quantize_b_kernel{nullptr};
+    std::unique_ptr<CpuGemmAssemblyDispatch>                        _asm_glue{nullptr};
+    std::unique_ptr<kernels::CpuDynamicDequantizeOutputStageKernel> _output_stage_kernel{nullptr};
+    std::unique_ptr<CpuActivation>                                  _activation_func{nullptr};
+
+    TensorInfo _quantized_a{};
+    TensorInfo _scales_a{};
+    TensorInfo _quantized_b{};
+    TensorInfo _scales_b{};
+
+    bool                             _is_b_constant{false};
+    bool                             _is_b_pretransposed{false};
+    bool                             _run_activation{false};
+    bool                             _is_prepared{false};
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUDYNAMICQUANTIZEDGEMM_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@
 #include "src/core/utils/quantization/AsymmHelpers.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/CpuConvertFullyConnectedWeights.h"
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
 #include "src/cpu/operators/CpuFlatten.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
@@ -90,7 +91,8 @@ Status validate_mm(const ITensorInfo         *src,
                    const ITensorInfo         *dst,
                    const ActivationLayerInfo &act,
                    bool                       enable_fast_math,
-                   WeightFormat               weight_format)
+                   WeightFormat               weight_format,
+                   bool                       dynamic_quantization)
 {
     if (is_data_type_quantized_asymmetric(src->data_type()))
     {
@@ -116,12 +118,19 @@ Status validate_mm(const ITensorInfo         *src,
     }
     else
     {
-        GEMMInfo gemm_info;
-        gemm_info.set_weight_format(weight_format);
-        gemm_info.set_fixed_format(weight_format != WeightFormat::UNSPECIFIED);
-        gemm_info.set_fast_math(enable_fast_math);
-        gemm_info.set_activation_info(act);
-        ARM_COMPUTE_RETURN_ON_ERROR(CpuGemm::validate(src, weights, biases, dst, 1.f, 1.0f, gemm_info));
+        // Dynamic quantization is a hint: fall back to the F32 GEMM if the int8 kernels are not available
+        const bool use_dynamic_quantization =
+            dynamic_quantization && weight_format == WeightFormat::UNSPECIFIED &&
+            bool(CpuDynamicQuantizedGemm::validate(src, weights, biases, dst, act));
+        if (!use_dynamic_quantization)
+        {
+            GEMMInfo gemm_info;
+            gemm_info.set_weight_format(weight_format);
+            gemm_info.set_fixed_format(weight_format != WeightFormat::UNSPECIFIED);
+            gemm_info.set_fast_math(enable_fast_math);
+            gemm_info.set_activation_info(act);
+            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemm::validate(src, weights, biases, dst, 1.f, 1.0f, gemm_info));
+        }
     }
 
     return Status{};
@@ -134,6 +143,7 @@ CpuFullyConnected::CpuFullyConnected()
       _transpose_weights(nullptr),
       _mm_gemm(nullptr),
       _mm_gemmlowp(nullptr),
+      _mm_dynamic_quantized_gemm(nullptr),
       _flattened_src(),
       _converted_weights(),
       _reshaped_weights(),
@@ -148,7 +158,8 @@ CpuFullyConnected::CpuFullyConnected()
       _enable_fast_math(false),
       _fixed_format(false),
       _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
-      _dynamic_weights(false)
+      _dynamic_weights(false),
+      _dynamic_quantization(false)
 {
 }
 
@@ -160,6 +171,10 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
                                      ITensorInfo               *dst,
                                      const ActivationLayerInfo &act)
 {
+    // Fall back to the F32 GEMM if the int8 kernels are not available
+    _dynamic_quantization = _dynamic_quantization && !_is_quantized_asymmetric && !_fixed_format &&
+                            bool(CpuDynamicQuantizedGemm::validate(src, weights, biases, dst, act));
+
     if (_is_quantized_asymmetric)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
@@ -185,6 +200,11 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
         _mm_gemmlowp = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
         _mm_gemmlowp->configure(&src_info, &weights_info, biases, dst, gemm_info);
     }
+    else if (_dynamic_quantization)
+    {
+        _mm_dynamic_quantized_gemm = std::make_unique<CpuDynamicQuantizedGemm>();
+        _mm_dynamic_quantized_gemm->configure(src, weights, biases, dst, act);
+    }
     else
     {
         // Configure matrix multiply kernel
@@ -255,6 +275,7 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     _fixed_format             = weights_info.weight_format() != WeightFormat::UNSPECIFIED;
     _weight_format            = weights_info.weight_format();
     _dynamic_weights          = !weights->are_values_constant() && _needs_weights_reshape;
+    _dynamic_quantization     = fc_info.dynamic_quantization;
 
     // With the Fully Connected layer we can have 4 different cases:
     //  1) Convolution layer -> Fully Connected layer without batches
@@ -321,15 +342,18 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     }
 
     // Set auxiliary memory requirements
-    auto gemm_mem_req = (_is_quantized_asymmetric) ? _mm_gemmlowp->workspace() : _mm_gemm->workspace();
+    auto gemm_mem_req = (_is_quantized_asymmetric) ? _mm_gemmlowp->workspace()
+                        : (_dynamic_quantization)  ? _mm_dynamic_quantized_gemm->workspace()
+                                                   : _mm_gemm->workspace();
     for (unsigned int i = 0; i < gemm_mem_req.size(); ++i)
     {
         _aux_mem[i] = gemm_mem_req[i];
     }
 
-    if (_aux_mem[Pretranspose].size > 0)
+    if (_aux_mem[Pretranspose].size > 0 || _dynamic_quantization)
     {
-        // Release permuted weights at the end of prepare as they are further transposed by the assembly dispatch
+        // Release permuted weights at the end of prepare as they are further transposed by the assembly dispatch,
+        // or quantized by the dynamically quantized GEMM
         // Do not release them if biases are dynamic and data type is quantized, since the weights tensor will be used for biases offset calculation
         // Keep all the auxiliary tensors in case of dynamic weights as they are recalculated every time.
         _aux_mem[TransposedWeights] = MemoryInfo(
@@ -495,7 +519,8 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     }
     // Validate matrix multiply kernel
     ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(src_to_use, weights_to_use, biases, dst, fc_info.activation_info,
-                                            fc_info.enable_fast_math, weights_info.weight_format()));
+                                            fc_info.enable_fast_math, weights_info.weight_format(),
+                                            fc_info.dynamic_quantization));
 
     return Status{};
 }
@@ -534,6 +559,10 @@ void CpuFullyConnected::run(ITensorPack &tensors)
     {
         _mm_gemmlowp->run(gemm_pack);
     }
+    else if (_dynamic_quantization)
+    {
+        _mm_dynamic_quantized_gemm->run(gemm_pack);
+    }
     else
     {
         _mm_gemm->run(gemm_pack);
@@ -583,13 +612,17 @@ void CpuFullyConnected::prepare(ITensorPack &tensors)
         gemm_pack.add_const_tensor(ACL_SRC_1, cur_weights);
 
         // Prepare GEMM prepare and release unused weights
-        if (!_is_quantized_asymmetric)
+        if (_is_quantized_asymmetric)
         {
-            _mm_gemm->prepare(gemm_pack);
+            _mm_gemmlowp->prepare(gemm_pack);
+        }
+        else if (_dynamic_quantization)
+        {
+            _mm_dynamic_quantized_gemm->prepare(gemm_pack);
         }
         else
         {
-            _mm_gemmlowp->prepare(gemm_pack);
+            _mm_gemm->prepare(gemm_pack);
         }
 
         _is_prepared = true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@ namespace cpu
 {
 // Forward declarations
 class CpuConvertFullyConnectedWeights;
+class CpuDynamicQuantizedGemm;
 class CpuFlatten;
 class CpuGemm;
 class CpuGemmLowpMatrixMultiplyCore;
@@ -47,7 +48,8 @@ class CpuTransposeKernel;
 /** Basic function to compute a Fully Connected layer. This function calls the following kernels:
  *  -# @ref kernels::CpuIm2ColKernel (called when the input comes from a convolutional layer)
  *  -# @ref kernels::CpuTransposeKernel (if @p are_weights_reshaped is set to false and transpose_weights is set to true ) (called once)
- *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric)
+ *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric) or @ref CpuDynamicQuantizedGemm (if
+ *     FullyConnectedLayerInfo::dynamic_quantization is set and the int8 kernels are available)
  *  -# @ref kernels::CpuGemmMatrixAdditionKernel or @ref CpuGemmLowpOutputStage (if quantized asymmetric) (if @p biases is not equal to nullptr)
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
@@ -153,7 +155,7 @@ private:
         GemmTemp6,
         GemmTemp7,
         GemmTemp8,
-        // Slots above (0-9) reserved for either CpuGemm or CpuGemmLowpMatrixMultiplyCore
+        // Slots above (0-9) reserved for either CpuGemm, CpuGemmLowpMatrixMultiplyCore or CpuDynamicQuantizedGemm
         TransposedWeights,
         ConvertedWeights,
         FlattenedSrc,
@@ -165,6 +167,7 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel>     _transpose_weights;
     std::unique_ptr<CpuGemm>                         _mm_gemm;
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>   _mm_gemmlowp;
+    std::unique_ptr<CpuDynamicQuantizedGemm>         _mm_dynamic_quantized_gemm;
 
     TensorInfo   _flattened_src;
     TensorInfo   _converted_weights;
@@ -183,6 +186,7 @@ private:
     bool                      _fixed_format;
     arm_compute::WeightFormat _weight_format;
     bool                      _dynamic_weights;
+    bool                      _dynamic_quantization;
 
 #ifdef ARM_COMPUTE_ASSERTS_ENABLED
     int _asrt_run_count{};
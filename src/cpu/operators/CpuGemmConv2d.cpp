@@ -186,9 +186,10 @@ CpuGemmConv2d::SkipInfo CpuGemmConv2d::skip_im_col_info(const ITensorInfo
     std::tie(conv_w, conv_h) = scaled_dimensions(src->dimension(idx_width), src->dimension(idx_height), kernel_width,
                                                  kernel_height, conv_info, dilation);
 
+    // Skipping im2col reinterprets the input planes as a single matrix, which requires them to be contiguous
     const bool skip_im2col = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 &&
                               conv_info.stride().first == 1 && conv_info.stride().second == 1) &&
-                             !conv_info.has_padding();
+                             !conv_info.has_padding() && !has_holes(*src);
 
     if (skip_im2col)
     {
@@ -919,7 +920,9 @@ void CpuGemmConv2d::run(ITensorPack &tensors)
     CpuAuxTensorHandler im2col_output(offset_int_vec(Im2ColOutput), _im2col_output, tensors, false);
     CpuAuxTensorHandler gemm_output(offset_int_vec(GemmOutput), _gemm_output, tensors, false);
 
-    bool out_has_padding = _skip_col2im && (dst->info()->padding().bottom != 0 || dst->info()->padding().top != 0);
+    // GEMM3D writes the output planes as a single matrix, so holes in the output, e.g. a sub-tensor that splits the
+    // planes of its parent, require a dense intermediate output
+    bool out_has_padding = _skip_col2im && has_holes(*dst->info());
     if (!_skip_im2col)
     {
         // Run input reshaping
@@ -936,7 +939,7 @@ void CpuGemmConv2d::run(ITensorPack &tensors)
         gemm_input_to_use = im2col_output.get();
     }
 
-    // Handle the case where output has top/bottom padding
+    // Handle the case where the output has holes
     const ITensor *out_to_use = out_has_padding ? gemm_output.get() : dst;
     Tensor         gemm3d;
     TensorInfo     gemm3d_info(_gemm_output_3d);
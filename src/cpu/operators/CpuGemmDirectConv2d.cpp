@@ -94,6 +94,8 @@ cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect
     asm_info.fixed_format            = info.weights_info.weight_format() != WeightFormat::UNSPECIFIED;
     asm_info.weight_format           = info.weights_info.weight_format();
     asm_info.use_fp32_acc            = info.use_fp32_acc;
+    asm_info.num_groups              = info.num_groups;
+    asm_info.dilation                = info.dilation;
     return asm_info;
 }
 } // namespace
@@ -180,13 +182,19 @@ Status CpuGemmDirectConv2d::validate(const ITensorInfo *src,
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
     }
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_groups > 1, "Grouping (num_groups != 1) is not supported on Cpu");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Data layout supported is NHWC");
     const DataType    data_type = src->data_type();
     const TensorShape i_shape   = src->tensor_shape();
     const TensorShape w_shape   = weights->tensor_shape();
-    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[0] != i_shape[0]);
-    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation != Size2D(1U, 1U));
+    ARM_COMPUTE_RETURN_ERROR_ON(info.num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[0] * info.num_groups != i_shape[0]);
+    if (info.num_groups > 1)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(w_shape[3] % info.num_groups != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->data_type() == DataType::QSYMM8_PER_CHANNEL,
+                                        "Grouping is not supported with per channel quantized weights");
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation.width == 0 || info.dilation.height == 0);
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
     // Validate Permute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -87,6 +87,7 @@ CpuMatMul::CpuMatMul()
     : _transpose_kernel_lhs(),
       _transpose_kernel_rhs(),
       _asm_glue(),
+      _dynamic_quantized_gemm(),
       _lhs_transposed(),
       _rhs_transposed(),
       _original_lhs_shape(),
@@ -153,6 +154,13 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
                                         "Broadcasting in Batch dimension is unsupported by this operator.");
     }
 
+    // Dynamic quantization is a hint: fall back to the F32 assembly kernels if the int8 kernels are not available
+    if (settings.dynamic_quantization() && !settings.fixed_format() &&
+        bool(CpuDynamicQuantizedGemm::validate(lhs_to_use, rhs_to_use, nullptr, dst, act_info)))
+    {
+        return Status{};
+    }
+
     // Quantized-specific configuration
     if (is_data_type_quantized(lhs->data_type()))
     {
@@ -247,6 +255,24 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     lhs_to_use = (_adj_lhs) ? _lhs_transposed : lhs_to_use;
     rhs_to_use = (_adj_rhs) ? _rhs_transposed : rhs_to_use;
 
+    _dynamic_quantization = settings.dynamic_quantization() && !settings.fixed_format() &&
+                            bool(CpuDynamicQuantizedGemm::validate(&lhs_to_use, &rhs_to_use, nullptr, &dst_to_use,
+                                                                   act_info));
+    if (_dynamic_quantization)
+    {
+        // Quantize lhs per row and rhs per column at run time, and use the int8 assembly kernels
+        _dynamic_quantized_gemm = std::make_unique<cpu::CpuDynamicQuantizedGemm>();
+        _dynamic_quantized_gemm->configure(&lhs_to_use, &rhs_to_use, nullptr, &dst_to_use, act_info);
+
+        // Specify memory required by the dynamically quantized gemm
+        const auto gemm_mem_req = _dynamic_quantized_gemm->workspace();
+        for (unsigned int slot = 0; slot < gemm_mem_req.size(); ++slot)
+        {
+            _aux_mem[slot] = gemm_mem_req[slot];
+        }
+        return;
+    }
+
     // Quantized-specific configuration
     if (is_data_type_quantized(lhs->data_type()))
     {
@@ -327,7 +353,14 @@ void CpuMatMul::run(ITensorPack &tensors)
         asm_tensors.add_const_tensor(TensorType::ACL_SRC_1, rhs_transposed.get());
     }
     // Run asm kernel
-    _asm_glue->run(asm_tensors);
+    if (_dynamic_quantization)
+    {
+        _dynamic_quantized_gemm->run(asm_tensors);
+    }
+    else
+    {
+        _asm_glue->run(asm_tensors);
+    }
 
     // Undo reshape of tensors
     dst->info()->set_tensor_shape(_original_dst_shape);
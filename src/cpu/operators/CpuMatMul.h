@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
+#include "src/cpu/operators/CpuDynamicQuantizedGemm.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 namespace arm_compute
@@ -45,6 +46,7 @@ namespace cpu
  *  -# @ref cpu::kernels::CpuTransposeKernel
  * Then :
  *  -# @ref cpu::CpuGemmAssemblyDispatch
+ *     or @ref cpu::CpuDynamicQuantizedGemm (if dynamic quantization is enabled and the int8 kernels are available)
  */
 class CpuMatMul : public ICpuOperator
 {
@@ -93,8 +95,8 @@ public:
 private:
     enum InternalTensorIdx
     {
-        /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
-        TransposeLHS = 3,
+        /* Slots 0 - 6 reserved for CpuGemmAssemblyDispatch or CpuDynamicQuantizedGemm */
+        TransposeLHS = 7,
         TransposeRHS,
         Count
     };
@@ -103,6 +105,7 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_lhs{nullptr};
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_rhs{nullptr};
     std::unique_ptr<CpuGemmAssemblyDispatch>     _asm_glue{nullptr};
+    std::unique_ptr<CpuDynamicQuantizedGemm>     _dynamic_quantized_gemm{nullptr};
 
     // TensorInfo for tensors stored in auxillary memory
     TensorInfo _lhs_transposed{};
@@ -117,6 +120,7 @@ private:
     bool                             _adj_lhs{false};
     bool                             _adj_rhs{false};
     bool                             _fast_math{false};
+    bool                             _dynamic_quantization{false};
     AsmGemmInfo                      _gemm_info{};
     experimental::MemoryRequirements _aux_mem{Count};
 };
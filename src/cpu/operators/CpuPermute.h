@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,7 +36,7 @@ class CpuPermute : public ICpuOperator
 public:
     /** Configure operator for a given list of arguments
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
+     * @note Arbitrary permutation vectors are supported with rank not greater than 6
      *
      * @param[in]  src  Source tensor to permute. Data types supported: All
      * @param[out] dst  Destintation tensor. Data types supported: Same as @p src
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUQKVROPE_H
+#define ACL_SRC_CPU_OPERATORS_CPUQKVROPE_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuQKVRoPEKernel
+ *
+ * The tensors are passed to @ref run with the following ids:
+ * ACL_SRC_0 qkv, ACL_SRC_1 positions, ACL_DST_0 q, ACL_DST_1 k and ACL_DST_2 v.
+ */
+class CpuQKVRoPE : public ICpuOperator
+{
+public:
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * Similar to @ref kernels::CpuQKVRoPEKernel::configure()
+     */
+    void configure(const ITensorInfo *qkv,
+                   const ITensorInfo *positions,
+                   ITensorInfo       *q,
+                   ITensorInfo       *k,
+                   ITensorInfo       *v,
+                   const RoPEInfo    &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuQKVRoPE::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *qkv,
+                           const ITensorInfo *positions,
+                           const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const RoPEInfo    &info);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    size_t _split_dimension{Window::DimY};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUQKVROPE_H
@@ -131,6 +131,11 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     {
         p.indirect = true;
         p.sections = b->tensor_shape()[2] * b->tensor_shape()[3];
+
+        // The groups of a grouped convolution are the multis of a single GEMM
+        p.multis = info.num_groups;
+        p.N /= info.num_groups;
+        p.K /= info.num_groups;
     }
     else
     {
@@ -142,7 +147,7 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     if (info.depth_output_gemm3d != 0)
     {
         p.M       = d->tensor_shape().y() * d->tensor_shape().z();
-        p.batches = d->tensor_shape().total_size_upper(3) / p.multis;
+        p.batches = d->tensor_shape().total_size_upper(3) / (p.indirect ? 1 : p.multis);
     }
 
     return p;
@@ -261,6 +266,22 @@ private:
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
     /** Prepare the indirect buffer */
     void prepare_indirect_buffer(ITensorPack &tensors);
+    /** Element stride between the B matrices of two consecutive multis
+     *
+     * The groups of a grouped convolution share the weights tensor and read their own slice of the output channels
+     *
+     * @param[in] b Tensor info of the Matrix B.
+     *
+     * @return The stride in elements
+     */
+    int get_multi_stride_b(const ITensorInfo *b) const;
+    /** Element stride between the biases of two consecutive multis
+     *
+     * @param[in] b Tensor info of the Matrix B.
+     *
+     * @return The stride in elements, zero if the biases are shared by all the multis
+     */
+    size_t get_bias_multi_stride(const ITensorInfo *b) const;
 
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
@@ -348,8 +369,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_
                     {
                         for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
                         {
-                            int64_t input_x   = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
-                            int64_t input_y   = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
+                            int64_t input_x =
+                                (output_x * _cp.output_stride_w) + (kernel_x * _cp.dilation_w) - _cp.padding_left;
+                            int64_t input_y =
+                                (output_y * _cp.output_stride_h) + (kernel_y * _cp.dilation_h) - _cp.padding_top;
                             int64_t kernel_xy = (kernel_y * _cp.kernel_width) + kernel_x;
                             int64_t input_xy  = (input_y * _cp.input_width) + input_x;
 
@@ -371,6 +394,22 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+int Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::get_multi_stride_b(const ITensorInfo *b) const
+{
+    if (_gemm_info.num_groups > 1)
+    {
+        return b->dimension(0) / _gemm_info.num_groups;
+    }
+    return b->strides_in_bytes().z() / b->element_size();
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+size_t Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::get_bias_multi_stride(const ITensorInfo *b) const
+{
+    return (_gemm_info.num_groups > 1) ? b->dimension(0) / _gemm_info.num_groups : 0;
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirect(const ITensorInfo *a,
                                                                                   const ITensorInfo *b,
@@ -387,7 +426,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
 
     const auto input_width    = static_cast<int64_t>(a->tensor_shape()[1]);
     const auto input_height   = static_cast<int64_t>(a->tensor_shape()[2]);
-    const auto input_channels = static_cast<int64_t>(a->tensor_shape()[0]);
+    const auto input_channels = static_cast<int64_t>(a->tensor_shape()[0] / info.num_groups);
     const auto kernel_width   = static_cast<int64_t>(b->tensor_shape()[2]);
     const auto kernel_height  = static_cast<int64_t>(b->tensor_shape()[3]);
     const auto output_width   = static_cast<int64_t>(d->tensor_shape()[1]);
@@ -402,8 +441,8 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
            output_height,
            info.ps_info.stride().first,
            info.ps_info.stride().second,
-           1,
-           1,
+           static_cast<int64_t>(info.dilation.width),
+           static_cast<int64_t>(info.dilation.height),
            info.padding_top,
            info.padding_left,
            zeropad};
@@ -472,6 +511,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
     auto acl_gemm_wrapper = std::make_unique<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>>();
     ARM_COMPUTE_ERROR_ON(acl_gemm_wrapper == nullptr);
     acl_gemm_wrapper->configure(_gemm_kernel_asm.get(), gemm_cfg.filter);
+    acl_gemm_wrapper->set_flop_count(2ULL * args._Msize * args._Nsize * args._Ksize * args._Ksections * args._nbatches *
+                                     args._nmulti);
+    acl_gemm_wrapper->set_configured_tensors_size(a->total_size() + b->total_size() + (c ? c->total_size() : 0) +
+                                                  d->total_size());
     const size_t       workspace_size = _gemm_kernel_asm->get_working_size();
     const unsigned int alignment      = 4096;
     _workspace_info                   = TensorInfo(TensorShape(workspace_size), 1, DataType::U8);
@@ -571,7 +614,8 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
         if (c && c->info()->data_type() == DataType::S32)
         {
             _gemm_kernel_asm->set_quantized_bias(
-                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
+                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()),
+                get_bias_multi_stride(b->info()));
         }
         const ITensor *b_to_use = b;
 
@@ -600,7 +644,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
             const int  ldb     = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
             const auto in1_ptr = reinterpret_cast<const TypeWeight *>(
                 b_to_use->buffer() + b_to_use->info()->offset_first_element_in_bytes());
-            const int multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+            const int multi_stride_b = get_multi_stride_b(b_to_use->info());
 
             CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
 
@@ -667,9 +711,16 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     int       batch_stride_a = a->info()->strides_in_bytes()[a_batch_idx] / a->info()->element_size();
     const int batch_stride_d = d->info()->strides_in_bytes()[d_batch_idx] / d->info()->element_size();
 
-    int       multi_stride_a = a->info()->strides_in_bytes()[a_multi_idx] / a->info()->element_size();
-    int       multi_stride_b = 0;
-    const int multi_stride_d = d->info()->strides_in_bytes()[d_multi_idx] / d->info()->element_size();
+    int multi_stride_a = a->info()->strides_in_bytes()[a_multi_idx] / a->info()->element_size();
+    int multi_stride_b = 0;
+    int multi_stride_d = d->info()->strides_in_bytes()[d_multi_idx] / d->info()->element_size();
+
+    if (_gemm_info.num_groups > 1)
+    {
+        // Each group reads and writes its own slice of the channels, the pixel and batch strides are shared
+        multi_stride_a = a->info()->dimension(0) / _gemm_info.num_groups;
+        multi_stride_d = d->info()->dimension(0) / _gemm_info.num_groups;
+    }
 
     auto in0_ptr = reinterpret_cast<const TypeInput *>(a->buffer() + a->info()->offset_first_element_in_bytes());
     const TypeWeight *in1_ptr = nullptr;
@@ -694,7 +745,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     if (b_to_use && !_gemm_kernel_asm->B_is_pretransposed())
     {
         ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
-        multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+        multi_stride_b = get_multi_stride_b(b_to_use->info());
         in1_ptr        = reinterpret_cast<const TypeWeight *>(b_to_use->buffer() +
                                                        b_to_use->info()->offset_first_element_in_bytes());
     }
@@ -705,7 +756,8 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
         if (c && c->info()->data_type() == DataType::S32)
         {
             _gemm_kernel_asm->set_quantized_bias(
-                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
+                reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()),
+                (b != nullptr) ? get_bias_multi_stride(b->info()) : 0);
         }
 
         // Pretranspose B if required
@@ -717,7 +769,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
             const int  ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
             const auto b_ptr          = reinterpret_cast<const TypeWeight *>(b_to_use->buffer() +
                                                                     b_to_use->info()->offset_first_element_in_bytes());
-            const int  multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+            const int  multi_stride_b = get_multi_stride_b(b_to_use->info());
 
             CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, true);
             ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
@@ -791,8 +843,9 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     }
 
     // Set gemm parameters
+    const size_t bias_multi_stride = (b != nullptr) ? get_bias_multi_stride(b->info()) : 0;
     _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr,
-                                 ldd, batch_stride_d, multi_stride_d, bias, 0);
+                                 ldd, batch_stride_d, multi_stride_d, bias, bias_multi_stride);
 
     // Need to pack the input/output pointers separately to use the thread-safe,
     // stateless-execution interface for fixed-format kernels.
@@ -1090,6 +1143,18 @@ Status CpuGemmAssemblyDispatch::validate(
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.reshape_b_only_on_first_run),
                                     "Assembly kernel will not be executed when reshape_b_only_on_first_run is false");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.num_groups == 0);
+    if (info.num_groups > 1)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.method != AsmConvMethod::Conv,
+                                        "Grouping is only supported by the convolution method");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_per_channel(b->data_type()),
+                                        "Grouping is not supported with per channel quantized weights");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_fixed_format(info.weight_format),
+                                        "Grouping is not supported with fixed format weights");
+        ARM_COMPUTE_RETURN_ERROR_ON(a->dimension(0) % info.num_groups != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(d->dimension(0) % info.num_groups != 0);
+    }
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
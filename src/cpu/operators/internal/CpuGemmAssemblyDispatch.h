@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #ifndef ACL_SRC_CPU_OPERATORS_INTERNAL_CPUGEMMASSEMBLYDISPATCH_H
 #define ACL_SRC_CPU_OPERATORS_INTERNAL_CPUGEMMASSEMBLYDISPATCH_H
 
+#include "arm_compute/core/Size2D.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
 #include "src/core/common/Macros.h"
@@ -66,6 +67,13 @@ struct AsmGemmInfo
      *       fixed format kernels do not accept weights (B) with any prior transformations
      */
     bool transpose_b{false};
+    /** Number of groups of a grouped convolution, only supported by @ref AsmConvMethod::Conv
+     * @note Every group runs as a separate "multi" of the same assembly kernel, reading and writing its own slice of
+     *       the channels of the input, weights, bias and output tensors
+     */
+    unsigned int num_groups{1};
+    /** Dilation of the convolution, only supported by @ref AsmConvMethod::Conv and @ref AsmConvMethod::Indirect */
+    Size2D dilation{1U, 1U};
 };
 
 /** Assembly kernel glue */
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuMwsTable.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+struct MwsEntry
+{
+    CPUModel    model;
+    const char *kernel;
+    size_t      elements;
+};
+
+/* Built-in entries
+ *
+ * Only values measured on the respective cores are listed. Other cores fall back to the default minimum workload
+ * size and are expected to be covered by a calibrated table.
+ */
+#define MWS_FP32_BINARY_ENTRIES(MODEL, ADD, SUB, MUL, MIN_MAX, DIV)                  \
+    {CPUModel::MODEL, "CpuAddKernel/neon_fp32_add", ADD},                            \
+        {CPUModel::MODEL, "CpuSubKernel/neon_fp32_sub", SUB},                        \
+        {CPUModel::MODEL, "CpuMulKernel:f32_f32_f32", MUL},                          \
+        {CPUModel::MODEL, "CpuArithmeticKernel/neon_fp32_arithmetic:min", MIN_MAX}, \
+        {CPUModel::MODEL, "CpuArithmeticKernel/neon_fp32_arithmetic:max", MIN_MAX}, \
+        {CPUModel::MODEL, "CpuArithmeticKernel/neon_fp32_arithmetic:div", DIV}
+
+const MwsEntry builtin_entries[] = {
+    MWS_FP32_BINARY_ENTRIES(N1, 24536, 24385, 22447, 25308, 19043),
+    MWS_FP32_BINARY_ENTRIES(V1, 40510, 40520, 38982, 34772, 25511),
+};
+
+#undef MWS_FP32_BINARY_ENTRIES
+
+bool model_from_string(const std::string &name, CPUModel &model)
+{
+#define X(MODEL)                   \
+    if (name == #MODEL)            \
+    {                              \
+        model = CPUModel::MODEL;   \
+        return true;               \
+    }
+    ARM_COMPUTE_CPU_MODEL_LIST
+#undef X
+    return false;
+}
+
+std::string trim(const std::string &str)
+{
+    const auto first = str.find_first_not_of(" \t\r");
+    if (first == std::string::npos)
+    {
+        return std::string{};
+    }
+    const auto last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+}
+} // namespace
+
+const CpuMwsTable &CpuMwsTable::get()
+{
+    static const CpuMwsTable table = []()
+    {
+        const std::string path = utility::getenv("ARM_COMPUTE_CPU_MWS_TABLE");
+        if (path.empty())
+        {
+            return CpuMwsTable();
+        }
+        if (utility::tolower(path) == "none")
+        {
+            return CpuMwsTable(false);
+        }
+        if (utility::tolower(path) == "calibrate")
+        {
+            CpuMwsTable calibration(false);
+            calibration._calibrating = true;
+            return calibration;
+        }
+
+        CpuMwsTable   tuned;
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Cannot open the MWS table %s, using built-in values",
+                                                      path.c_str());
+            return tuned;
+        }
+        std::stringstream text;
+        text << file.rdbuf();
+        const Status status = tuned.parse(text.str());
+        if (!bool(status))
+        {
+            ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Ignoring the MWS table %s: %s", path.c_str(),
+                                                      status.error_description().c_str());
+            return CpuMwsTable();
+        }
+        return tuned;
+    }();
+    return table;
+}
+
+CpuMwsTable::CpuMwsTable(bool with_builtin_entries)
+{
+    if (with_builtin_entries)
+    {
+        for (const auto &entry : builtin_entries)
+        {
+            add(entry.model, entry.kernel, entry.elements);
+        }
+    }
+}
+
+void CpuMwsTable::add(CPUModel model, const std::string &kernel, size_t elements)
+{
+    _tables[static_cast<size_t>(model)][kernel] = elements;
+}
+
+bool CpuMwsTable::find(CPUModel model, const char *kernel, size_t &elements) const
+{
+    const auto idx = static_cast<size_t>(model);
+    if (idx >= _tables.size() || _tables[idx].empty())
+    {
+        return false;
+    }
+    const auto it = _tables[idx].find(kernel);
+    if (it == _tables[idx].end())
+    {
+        return false;
+    }
+    elements = it->second;
+    return true;
+}
+
+bool CpuMwsTable::calibrating() const
+{
+    return _calibrating;
+}
+
+Status CpuMwsTable::parse(const std::string &text)
+{
+    std::istringstream lines(text);
+    std::string        line;
+    size_t             line_number = 0;
+    while (std::getline(lines, line))
+    {
+        ++line_number;
+        line = trim(line);
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        const auto first  = line.find(',');
+        const auto second = line.rfind(',');
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR(first == std::string::npos || first == second,
+                                            "Line %zu: expected <cpu model>,<kernel>,<elements>", line_number);
+
+        CPUModel          model    = CPUModel::GENERIC;
+        const std::string kernel   = trim(line.substr(first + 1, second - first - 1));
+        const std::string elements = trim(line.substr(second + 1));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR(!model_from_string(trim(line.substr(0, first)), model),
+                                            "Line %zu: unknown CPU model", line_number);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR(kernel.empty(), "Line %zu: missing kernel name", line_number);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR(elements.empty() ||
+                                                elements.find_first_not_of("0123456789") != std::string::npos,
+                                            "Line %zu: invalid number of elements", line_number);
+
+        add(model, kernel, std::stoull(elements));
+    }
+    return Status{};
+}
+
+size_t mws_from_elements(size_t elements, const Window &window)
+{
+    // Tensor is 1D or was re-interpreted as 1D
+    if (window.shape().num_dimensions() == 1)
+    {
+        return std::max(static_cast<size_t>(1), elements);
+    }
+
+    const size_t rows   = std::max(static_cast<size_t>(1), window.num_iterations(Window::DimY));
+    const size_t others = std::max(static_cast<size_t>(1), window.num_iterations_total() / rows);
+    return std::max(static_cast<size_t>(1), elements / others);
+}
+
+CpuMwsEntry resolve_mws(const CPUInfo &platform, const char *kernel)
+{
+    const CpuMwsTable &table = CpuMwsTable::get();
+
+    CpuMwsEntry entry{};
+    entry.model = platform.get_cpu_model();
+    if (table.calibrating())
+    {
+        // Let the scheduler split the window as finely as it wants
+        entry.elements = 1;
+        entry.found    = true;
+        return entry;
+    }
+    entry.found = table.find(entry.model, kernel, entry.elements);
+    return entry;
+}
+
+bool lookup_mws(const CpuMwsEntry &entry, const CPUInfo &platform, const Window &window, size_t &mws)
+{
+    if (!entry.found || entry.model != platform.get_cpu_model())
+    {
+        return false;
+    }
+    mws = mws_from_elements(entry.elements, window);
+    return true;
+}
+} // namespace cpu
+} // namespace arm_compute
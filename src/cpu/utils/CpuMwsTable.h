@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUMWSTABLE_H
+#define ACL_SRC_CPU_UTILS_CPUMWSTABLE_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+
+#include <array>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Table of minimum workload sizes (MWS) keyed by CPU model and kernel
+ *
+ * Each entry holds the minimum number of elements a thread has to process for a split of the kernel's window
+ * to pay off on the given CPU model. Kernels are identified by the string returned by @ref ICPPKernel::name(),
+ * optionally followed by ":" and an operation tag when the same micro-kernel serves several operations.
+ *
+ * The built-in entries can be extended or overridden at runtime with a table generated by the
+ * neon_mws_calibration example and pointed to by the ARM_COMPUTE_CPU_MWS_TABLE environment variable.
+ * Each line of the file has the form "<cpu model>,<kernel>,<elements>", lines starting with '#' are ignored.
+ * Setting the variable to "none" disables all the table-driven values, built-in ones included. Setting it to
+ * "calibrate" makes every kernel split its window down to a single element per thread, ignoring the kernels' own
+ * defaults, so that the neon_mws_calibration example can measure the actual breakeven sizes.
+ */
+class CpuMwsTable
+{
+public:
+    /** Access the table of the current process
+     *
+     * The table is initialized on first access and immutable afterwards, so lookups can be issued concurrently.
+     *
+     * @return The minimum workload size table
+     */
+    static const CpuMwsTable &get();
+    /** Look up the minimum number of elements per thread of a kernel
+     *
+     * @param[in]  model    CPU model to look up.
+     * @param[in]  kernel   Kernel identifier.
+     * @param[out] elements Minimum number of elements per thread, untouched if the table has no entry.
+     *
+     * @return True if an entry was found
+     */
+    bool find(CPUModel model, const char *kernel, size_t &elements) const;
+    /** Whether the table is in calibration mode, in which every kernel gets the smallest minimum workload size
+     *
+     * @return True if ARM_COMPUTE_CPU_MWS_TABLE was set to "calibrate"
+     */
+    bool calibrating() const;
+    /** Parse a table in text form and merge its entries into this table
+     *
+     * @param[in] text Content of the table, in the format of the ARM_COMPUTE_CPU_MWS_TABLE file.
+     *
+     * @return Status with the first malformed line if any
+     */
+    Status parse(const std::string &text);
+    /** Constructor
+     *
+     * @param[in] with_builtin_entries (Optional) Initialize the table with the built-in entries. Defaults to true.
+     */
+    explicit CpuMwsTable(bool with_builtin_entries = true);
+
+private:
+    using KernelTable = std::map<std::string, size_t, std::less<>>;
+
+#define X(MODEL) +1
+    static constexpr size_t num_models = 0 ARM_COMPUTE_CPU_MODEL_LIST;
+#undef X
+
+    void add(CPUModel model, const std::string &kernel, size_t elements);
+
+    std::array<KernelTable, num_models> _tables{};
+    bool                                _calibrating{false};
+};
+
+/** Convert a minimum number of elements per thread into a minimum workload size for a kernel window
+ *
+ * The workloads of multi-dimensional windows are split along the Y dimension, so the number of elements is scaled
+ * down by the number of elements along all the other dimensions. This allows for parallelization when the Y
+ * dimension is small but the other ones are large.
+ *
+ * @param[in] elements Minimum number of elements per thread.
+ * @param[in] window   Execution window of the kernel.
+ *
+ * @return The minimum workload size, at least 1
+ */
+size_t mws_from_elements(size_t elements, const Window &window);
+
+/** Entry of a kernel in the minimum workload size table, resolved once when the kernel is configured */
+struct CpuMwsEntry
+{
+    CPUModel model{CPUModel::GENERIC}; /**< CPU model the entry was resolved for */
+    size_t   elements{0};              /**< Minimum number of elements per thread */
+    bool     found{false};             /**< Whether the table has an entry for the kernel */
+};
+
+/** Resolve the entry of a kernel in the table of the given platform
+ *
+ * In calibration mode, every kernel resolves to an entry of a single element per thread.
+ *
+ * @param[in] platform Platform the kernel runs on.
+ * @param[in] kernel   Kernel identifier.
+ *
+ * @return The entry of the kernel, not found if the table has none
+ */
+CpuMwsEntry resolve_mws(const CPUInfo &platform, const char *kernel);
+
+/** Compute the minimum workload size of a kernel from its resolved table entry
+ *
+ * @param[in]  entry    Entry of the kernel, as returned by @ref resolve_mws.
+ * @param[in]  platform Platform the kernel runs on. Entries resolved for another CPU model are ignored.
+ * @param[in]  window   Execution window of the kernel.
+ * @param[out] mws      Minimum workload size, untouched if the entry does not apply.
+ *
+ * @return True if the entry applies to the platform
+ */
+bool lookup_mws(const CpuMwsEntry &entry, const CPUInfo &platform, const Window &window, size_t &mws);
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUMWSTABLE_H
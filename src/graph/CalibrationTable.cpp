@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/CalibrationTable.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+constexpr size_t num_histogram_bins = 2048; /**< Bins of the histograms of the absolute values */
+constexpr size_t num_quantized_bins = 128;  /**< Levels an absolute value is quantized to */
+
+/** Calls a function on each row of an F32 tensor
+ *
+ * @param[in] tensor Tensor to iterate
+ * @param[in] func   Function called with a pointer to the row, its length and its coordinates
+ */
+template <typename F>
+void for_each_row(const ITensor &tensor, F &&func)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.info()->data_type() != DataType::F32);
+
+    const size_t num_elements_x = tensor.info()->dimension(0);
+
+    Window win;
+    win.use_tensor_dimensions(tensor.info()->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    execute_window_loop(win,
+                        [&](const Coordinates &id)
+                        { func(reinterpret_cast<const float *>(tensor.ptr_to_element(id)), num_elements_x, id); });
+}
+
+/** Computes the KL divergence between a distribution and its quantization to @ref num_quantized_bins levels
+ *
+ * @param[in] histogram  Histogram of the absolute values
+ * @param[in] num_bins   Number of bins kept, the values of the following bins are clipped into the last one
+ * @param[in] num_values Total number of values of the histogram
+ *
+ * @return The divergence of the quantized distribution from the clipped one
+ */
+double quantization_divergence(const std::vector<uint64_t> &histogram, size_t num_bins, uint64_t num_values)
+{
+    std::vector<double> p(histogram.begin(), histogram.begin() + num_bins);
+    std::vector<double> q(num_bins, 0.0);
+
+    // Values beyond the threshold saturate to the last level
+    const double kept = std::accumulate(p.begin(), p.end(), 0.0);
+    p[num_bins - 1] += static_cast<double>(num_values) - kept;
+
+    // Spread each quantized level evenly over the bins it merges, skipping the bins that were empty
+    const double bins_per_level = static_cast<double>(num_bins) / num_quantized_bins;
+    for (size_t level = 0; level < num_quantized_bins; ++level)
+    {
+        const auto start = static_cast<size_t>(level * bins_per_level);
+        const auto end =
+            level == num_quantized_bins - 1 ? num_bins : static_cast<size_t>((level + 1) * bins_per_level);
+
+        double sum      = 0.0;
+        size_t non_zero = 0;
+        for (size_t i = start; i < end; ++i)
+        {
+            sum += histogram[i];
+            non_zero += histogram[i] != 0 ? 1 : 0;
+        }
+        for (size_t i = start; i < end && non_zero != 0; ++i)
+        {
+            q[i] = histogram[i] != 0 ? sum / non_zero : 0.0;
+        }
+    }
+
+    const double p_sum = std::accumulate(p.begin(), p.end(), 0.0);
+    const double q_sum = std::accumulate(q.begin(), q.end(), 0.0);
+    if (p_sum == 0.0 || q_sum == 0.0)
+    {
+        return std::numeric_limits<double>::max();
+    }
+
+    double divergence = 0.0;
+    for (size_t i = 0; i < num_bins; ++i)
+    {
+        if (p[i] != 0.0)
+        {
+            const double p_i = p[i] / p_sum;
+            const double q_i = std::max(q[i] / q_sum, 1e-12);
+            divergence += p_i * std::log(p_i / q_i);
+        }
+    }
+    return divergence;
+}
+} // namespace
+
+CalibrationTable::CalibrationTable(CalibrationMethod method, float percentile)
+    : _method(method), _percentile(percentile), _stats()
+{
+    if (percentile <= 0.f || percentile > 100.f)
+    {
+        ARM_COMPUTE_ERROR_VAR("Calibration percentile %f is not in (0, 100]", percentile);
+    }
+}
+
+void CalibrationTable::observe(TensorID tid, const ITensor &tensor)
+{
+    float tensor_min = std::numeric_limits<float>::max();
+    float tensor_max = std::numeric_limits<float>::lowest();
+    for_each_row(tensor,
+                 [&](const float *row, size_t len, const Coordinates &)
+                 {
+                     for (size_t x = 0; x < len; ++x)
+                     {
+                         tensor_min = std::min(tensor_min, row[x]);
+                         tensor_max = std::max(tensor_max, row[x]);
+                     }
+                 });
+
+    const bool   first = _stats.find(tid) == _stats.end();
+    TensorStats &stats = _stats[tid];
+    stats.min          = first ? tensor_min : std::min(stats.min, tensor_min);
+    stats.max          = first ? tensor_max : std::max(stats.max, tensor_max);
+
+    if (_method == CalibrationMethod::MinMax)
+    {
+        return;
+    }
+
+    auto &histogram = stats.histogram;
+    if (histogram.empty())
+    {
+        histogram.resize(num_histogram_bins, 0);
+    }
+
+    // Widen the histogram by merging pairs of bins until it covers the new values
+    const float abs_max = std::max(std::abs(tensor_min), std::abs(tensor_max));
+    if (stats.hist_max == 0.f)
+    {
+        stats.hist_max = abs_max;
+    }
+    while (abs_max > stats.hist_max)
+    {
+        for (size_t i = 0; i < num_histogram_bins / 2; ++i)
+        {
+            histogram[i] = histogram[2 * i] + histogram[2 * i + 1];
+        }
+        std::fill(histogram.begin() + num_histogram_bins / 2, histogram.end(), 0);
+        stats.hist_max *= 2.f;
+    }
+
+    const float bin_scale = stats.hist_max > 0.f ? num_histogram_bins / stats.hist_max : 0.f;
+    for_each_row(tensor,
+                 [&](const float *row, size_t len, const Coordinates &)
+                 {
+                     for (size_t x = 0; x < len; ++x)
+                     {
+                         const auto bin = static_cast<size_t>(std::abs(row[x]) * bin_scale);
+                         ++histogram[std::min(bin, num_histogram_bins - 1)];
+                     }
+                 });
+}
+
+void CalibrationTable::observe_channels(TensorID tid, const ITensor &tensor, size_t channel_idx)
+{
+    ARM_COMPUTE_ERROR_ON(channel_idx >= tensor.info()->num_dimensions());
+
+    const bool   first  = _stats.find(tid) == _stats.end();
+    TensorStats &stats  = _stats[tid];
+    auto        &ranges = stats.channel_ranges;
+    ranges.resize(tensor.info()->dimension(channel_idx), 0.f);
+
+    float tensor_min = std::numeric_limits<float>::max();
+    float tensor_max = std::numeric_limits<float>::lowest();
+    for_each_row(tensor,
+                 [&](const float *row, size_t len, const Coordinates &id)
+                 {
+                     for (size_t x = 0; x < len; ++x)
+                     {
+                         const size_t channel = channel_idx == 0 ? x : id[channel_idx];
+                         ranges[channel]      = std::max(ranges[channel], std::abs(row[x]));
+                         tensor_min           = std::min(tensor_min, row[x]);
+                         tensor_max           = std::max(tensor_max, row[x]);
+                     }
+                 });
+
+    stats.min = first ? tensor_min : std::min(stats.min, tensor_min);
+    stats.max = first ? tensor_max : std::max(stats.max, tensor_max);
+}
+
+bool CalibrationTable::has_range(TensorID tid) const
+{
+    return _stats.find(tid) != _stats.end();
+}
+
+std::pair<float, float> CalibrationTable::range(TensorID tid) const
+{
+    const auto it = _stats.find(tid);
+    ARM_COMPUTE_ERROR_ON_MSG(it == _stats.end(), "Tensor has not been calibrated");
+
+    const float threshold = clipping_threshold(it->second);
+    return std::make_pair(std::max(it->second.min, -threshold), std::min(it->second.max, threshold));
+}
+
+std::vector<float> CalibrationTable::channel_ranges(TensorID tid) const
+{
+    const auto it = _stats.find(tid);
+    return it != _stats.end() ? it->second.channel_ranges : std::vector<float>();
+}
+
+float CalibrationTable::clipping_threshold(const TensorStats &stats) const
+{
+    const float abs_max = std::max(std::abs(stats.min), std::abs(stats.max));
+    if (_method == CalibrationMethod::MinMax || stats.histogram.empty() || stats.hist_max == 0.f)
+    {
+        return abs_max;
+    }
+
+    const auto    &histogram  = stats.histogram;
+    const uint64_t num_values = std::accumulate(histogram.begin(), histogram.end(), uint64_t(0));
+    const float    bin_width  = stats.hist_max / num_histogram_bins;
+
+    size_t num_bins = num_histogram_bins;
+    switch (_method)
+    {
+        case CalibrationMethod::Percentile:
+        {
+            const double target  = static_cast<double>(num_values) * _percentile / 100.0;
+            uint64_t     counted = 0;
+            for (num_bins = 0; num_bins < num_histogram_bins && counted < target; ++num_bins)
+            {
+                counted += histogram[num_bins];
+            }
+            break;
+        }
+        case CalibrationMethod::Entropy:
+        {
+            double min_divergence = std::numeric_limits<double>::max();
+            for (size_t i = num_quantized_bins; i <= num_histogram_bins; ++i)
+            {
+                const double divergence = quantization_divergence(histogram, i, num_values);
+                if (divergence < min_divergence)
+                {
+                    min_divergence = divergence;
+                    num_bins       = i;
+                }
+            }
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported calibration method");
+            break;
+    }
+    return std::min(abs_max, num_bins * bin_width);
+}
+
+void CalibrationTable::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+
+    // Each line holds: tensor id, minimum, maximum, number of channels and the range of each channel
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        std::istringstream ss(line);
+        TensorID           tid          = NullTensorID;
+        size_t             num_channels = 0;
+        TensorStats        stats;
+        ss >> tid >> stats.min >> stats.max >> num_channels;
+        if (ss.fail() || stats.min > stats.max)
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+
+        stats.channel_ranges.resize(num_channels);
+        for (auto &channel_range : stats.channel_ranges)
+        {
+            ss >> channel_range;
+        }
+        if (ss.fail())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        _stats[tid] = std::move(stats);
+    }
+    fs.close();
+}
+
+void CalibrationTable::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    fs.precision(std::numeric_limits<float>::max_digits10);
+    for (const auto &stats : _stats)
+    {
+        // The clipping is applied once, so loaded tables do not need the histograms
+        const auto clipped_range = range(stats.first);
+        fs << stats.first << " " << clipped_range.first << " " << clipped_range.second << " "
+           << stats.second.channel_ranges.size();
+        for (const auto &channel_range : stats.second.channel_ranges)
+        {
+            fs << " " << channel_range;
+        }
+        fs << std::endl;
+    }
+    fs.close();
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorHandle.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/PassManager.h"
 #include "arm_compute/graph/TypePrinter.h"
@@ -39,7 +41,53 @@ namespace arm_compute
 {
 namespace graph
 {
-GraphManager::GraphManager() : _workloads()
+namespace
+{
+/** Accumulates the values of an F32 tensor into its calibrated range */
+void observe_tensor(CalibrationTable &table, Tensor *tensor)
+{
+    if (tensor == nullptr || tensor->handle() == nullptr || tensor->desc().data_type != DataType::F32)
+    {
+        return;
+    }
+
+    ITensorHandle *handle = tensor->handle();
+    handle->map(true);
+    table.observe(tensor->id(), handle->tensor());
+    handle->unmap();
+}
+
+/** Records the per-channel ranges of the F32 weights of the convolution layers of a graph */
+void observe_weights(Graph &g, CalibrationTable &table)
+{
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr || (node->type() != NodeType::ConvolutionLayer &&
+                                node->type() != NodeType::DepthwiseConvolutionLayer))
+        {
+            continue;
+        }
+
+        Tensor *weights = node->input(1);
+        if (weights == nullptr || weights->handle() == nullptr || weights->desc().data_type != DataType::F32)
+        {
+            continue;
+        }
+
+        // Convolution weights are quantized per output feature map, depthwise ones per channel
+        const DataLayoutDimension channel_dim = node->type() == NodeType::ConvolutionLayer
+                                                    ? DataLayoutDimension::BATCHES
+                                                    : DataLayoutDimension::CHANNEL;
+
+        ITensorHandle *handle = weights->handle();
+        handle->map(true);
+        table.observe_channels(weights->id(), handle->tensor(), get_dimension_idx(weights->desc().layout, channel_dim));
+        handle->unmap();
+    }
+}
+} // namespace
+
+GraphManager::GraphManager() : _workloads(), _calibrations()
 {
 }
 
@@ -100,6 +148,14 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
 
+    // Weights are recorded before the preparation of the functions releases them
+    if (ctx.config().use_calibration)
+    {
+        CalibrationTable table(ctx.config().calibration_method);
+        observe_weights(graph, table);
+        _calibrations[graph.id()] = std::move(table);
+    }
+
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
@@ -129,6 +185,24 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Without accessors there is nothing to stop the loop, so run only once
+    const bool run_once = detail::all_io_tensors_imported(it->second);
+
+    // Calibrated graphs record the range of each output right after the task producing it
+    auto                         calibration = _calibrations.find(graph.id());
+    CalibrationTable            *table       = calibration != std::end(_calibrations) ? &calibration->second : nullptr;
+    std::function<void(INode &)> observer    = nullptr;
+    if (table != nullptr)
+    {
+        observer = [table](INode &node)
+        {
+            for (size_t i = 0; i < node.num_outputs(); ++i)
+            {
+                observe_tensor(*table, node.output(i));
+            }
+        };
+    }
+
     while (true)
     {
         // Call input accessors
@@ -137,23 +211,76 @@ void GraphManager::execute_graph(Graph &graph)
             return;
         }
 
+        if (table != nullptr)
+        {
+            for (auto &input : it->second.inputs)
+            {
+                observe_tensor(*table, input);
+            }
+        }
+
         // Run graph
-        detail::call_all_tasks(it->second);
+        detail::call_all_tasks(it->second, observer);
 
         // Call output accessors
-        if (!detail::call_all_output_node_accessors(it->second))
+        if (!detail::call_all_output_node_accessors(it->second) || run_once)
         {
             return;
         }
     }
 }
 
+Status GraphManager::import_memory(Graph &graph, NodeID nid, void *memory)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    INode *node = graph.node(nid);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node == nullptr, "Invalid node id");
+
+    Tensor *tensor = nullptr;
+    switch (node->type())
+    {
+        case NodeType::Input:
+            tensor = node->output(0);
+            break;
+        case NodeType::Output:
+            tensor = node->input(0);
+            break;
+        default:
+            ARM_COMPUTE_RETURN_ERROR_MSG("Memory can only be imported into input or output nodes");
+    }
+
+    return detail::import_tensor_memory(it->second, tensor, memory);
+}
+
+std::vector<RuntimeProfiler::Stats> GraphManager::profile_summary(const Graph                &graph,
+                                                                  RuntimeProfiler::EventType type) const
+{
+    return RuntimeProfiler::get().summary(type, static_cast<uint32_t>(graph.id()));
+}
+
+std::vector<RuntimeProfiler::RooflineStats>
+GraphManager::profile_roofline(const Graph &graph, const RuntimeProfiler::RooflineInfo &info, const char *layer) const
+{
+    return RuntimeProfiler::get().roofline(info, static_cast<uint32_t>(graph.id()), layer);
+}
+
+const CalibrationTable &GraphManager::calibration_table(const Graph &graph) const
+{
+    auto it = _calibrations.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_calibrations), "Graph has not been finalized for calibration!");
+
+    return it->second;
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
     _workloads.erase(it);
+    _calibrations.erase(graph.id());
 }
 } // namespace graph
 } // namespace arm_compute
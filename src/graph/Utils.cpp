@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,9 +24,12 @@
 #include "arm_compute/graph/Utils.h"
 
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/CalibrationTable.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/mutators/GraphMutators.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
@@ -73,7 +76,6 @@ void force_target_to_graph(Graph &g, Target target)
 
 PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
 {
-    ARM_COMPUTE_UNUSED(target);
     PassManager pm;
 
     // Passes that mutate graph IR
@@ -94,13 +96,26 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
             }
         }
     }
+    pm.append(std::make_unique<ConstantFoldingMutator>(cfg.use_dead_node_elimination));
     pm.append(std::make_unique<NodeFusionMutator>());
+    if (cfg.use_quantization)
+    {
+        CalibrationTable table;
+        table.load_from_file(cfg.calibration_file);
+        pm.append(std::make_unique<PostTrainingQuantizationMutator>(std::move(table)));
+    }
+    if (cfg.use_mixed_precision && target == Target::NEON)
+    {
+        pm.append(std::make_unique<MixedPrecisionMutator>());
+    }
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>());
 
     // Passes that mutate backend information
     pm.append(std::make_unique<DepthConcatSubTensorMutator>());
     pm.append(std::make_unique<SplitLayerSubTensorMutator>());
+    pm.append(std::make_unique<SliceLayerSubTensorMutator>());
+    pm.append(std::make_unique<StackLayerSubTensorMutator>());
     pm.append(std::make_unique<NodeExecutionMethodMutator>());
 
     return pm;
@@ -229,5 +244,74 @@ void configure_tensor(Tensor *tensor)
     }
 }
 
+bool is_written_in_place(const Graph &g, const Tensor &tensor)
+{
+    for (const auto &eid : tensor.bound_edges())
+    {
+        const Edge *e = g.edge(eid);
+        if (e != nullptr && e->consumer() != nullptr)
+        {
+            const std::vector<TensorID> &outputs = e->consumer()->outputs();
+            if (std::find(outputs.cbegin(), outputs.cend(), tensor.id()) != outputs.cend())
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool is_subtensor_parent(Graph &g, Tensor &tensor)
+{
+    ITensorHandle *handle = tensor.handle();
+    if (handle == nullptr)
+    {
+        return false;
+    }
+
+    for (auto &t : g.tensors())
+    {
+        if (t != nullptr && t->handle() != nullptr && t->handle()->is_subtensor() &&
+            t->handle()->parent_handle() == handle)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool keeps_parent_planes(const TensorShape &parent_shape, const TensorShape &shape)
+{
+    return shape[0] == parent_shape[0] && shape[1] == parent_shape[1];
+}
+
+bool supports_strided_access(const Graph &g, Tensor &tensor, const INode &ignored)
+{
+    // Accessors fill and read tensors as a whole
+    const Target target = tensor.desc().target;
+    if (tensor.accessor() != nullptr || !is_target_supported(target))
+    {
+        return false;
+    }
+
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(target);
+    for (const auto &eid : tensor.bound_edges())
+    {
+        const Edge *e = g.edge(eid);
+        if (e == nullptr)
+        {
+            continue;
+        }
+        for (const INode *node : {e->producer(), e->consumer()})
+        {
+            if (node != nullptr && node != &ignored && !backend.supports_strided_subtensors(*node))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 } // namespace graph
 } // namespace arm_compute
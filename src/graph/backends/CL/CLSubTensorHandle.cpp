@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,6 +74,12 @@ void CLSubTensorHandle::release_if_unused()
     // noop
 }
 
+Status CLSubTensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_UNUSED(memory);
+    return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Cannot import memory into a sub-tensor");
+}
+
 const arm_compute::ITensor &CLSubTensorHandle::tensor() const
 {
     return _sub_tensor;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,12 @@ void CLTensorHandle::release_if_unused()
     }
 }
 
+Status CLTensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_UNUSED(memory);
+    return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Memory import is not supported by the CL backend");
+}
+
 const arm_compute::ITensor &CLTensorHandle::tensor() const
 {
     return _tensor;
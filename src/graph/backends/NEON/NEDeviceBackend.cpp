@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,9 +33,11 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
@@ -43,6 +45,8 @@
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
+#include "support/Cast.h"
+
 namespace arm_compute
 {
 namespace graph
@@ -78,10 +82,13 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
     // Create function level memory manager
     if (ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
+        const MemoryManagerAffinity affinity =
+            ctx.config().use_interval_memory_planner ? MemoryManagerAffinity::Interval : MemoryManagerAffinity::Offset;
+
         MemoryManagerContext mm_ctx;
         mm_ctx.target      = Target::NEON;
-        mm_ctx.intra_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
-        mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
+        mm_ctx.intra_mm    = create_memory_manager(affinity);
+        mm_ctx.cross_mm    = create_memory_manager(affinity);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
         mm_ctx.allocator   = &_allocator;
 
@@ -133,6 +140,24 @@ NEDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coor
     return std::make_unique<NESubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+bool NEDeviceBackend::supports_strided_subtensors(const INode &node)
+{
+    // Functions checked to only collapse or squash their execution window over dimensions without holes
+    switch (node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::PadLayer:
+            return true;
+        case NodeType::ConvolutionLayer:
+            // Only the GEMM-based convolution has been checked, the method chosen by default is not known yet
+            return arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&node)
+                       ->convolution_method() == ConvolutionMethod::GEMM;
+        default:
+            return false;
+    }
+}
+
 std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CPU node with ID : " << node.id() << std::endl);
@@ -157,6 +182,10 @@ std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_mana
     {
         lifetime_mgr = std::make_shared<BlobLifetimeManager>();
     }
+    else if (affinity == MemoryManagerAffinity::Interval)
+    {
+        lifetime_mgr = std::make_shared<IntervalLifetimeManager>();
+    }
     else
     {
         lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
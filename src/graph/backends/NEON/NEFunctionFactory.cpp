@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -134,6 +134,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<NEBatchNormalizationLayer, NETargetInfo>(
                 *polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::create_cast_layer<NECast, NETargetInfo>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
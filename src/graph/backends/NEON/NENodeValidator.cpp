@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -70,6 +70,8 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::BoundingBoxTransformLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : BoundingBoxTransformLayer");
+        case NodeType::CastLayer:
+            return detail::validate_cast_layer<NECast>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::validate_channel_shuffle_layer<NEChannelShuffleLayer>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Arm Limited.
+ * Copyright (c) 2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,6 +71,12 @@ void NESubTensorHandle::release_if_unused()
     // noop
 }
 
+Status NESubTensorHandle::import_memory(void *memory)
+{
+    ARM_COMPUTE_UNUSED(memory);
+    return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Cannot import memory into a sub-tensor");
+}
+
 const arm_compute::ITensor &NESubTensorHandle::tensor() const
 {
     return _sub_tensor;
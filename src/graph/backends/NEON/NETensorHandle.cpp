@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,6 +74,11 @@ void NETensorHandle::release_if_unused()
     }
 }
 
+Status NETensorHandle::import_memory(void *memory)
+{
+    return _tensor.allocator()->import_memory(memory);
+}
+
 const arm_compute::ITensor &NETensorHandle::tensor() const
 {
     return _tensor;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,12 +23,16 @@
  */
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
+#include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/RuntimeProfiler.h"
+
+#include <algorithm>
 
 namespace arm_compute
 {
@@ -213,12 +217,47 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload)
     std::for_each(std::begin(workload.inputs), std::end(workload.inputs),
                   [&](Tensor *input_tensor)
                   {
+                      if (workload.imported_tensors.count(input_tensor) != 0)
+                      {
+                          return;
+                      }
                       bool valid_input = (input_tensor != nullptr) && input_tensor->call_accessor();
                       is_valid         = is_valid && valid_input;
                   });
     return is_valid;
 }
 
+Status import_tensor_memory(ExecutionWorkload &workload, Tensor *tensor, void *memory)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(tensor == nullptr || memory == nullptr);
+
+    const auto &inputs    = workload.inputs;
+    const auto &outputs   = workload.outputs;
+    const bool  is_input  = std::find(inputs.begin(), inputs.end(), tensor) != inputs.end();
+    const bool  is_output = std::find(outputs.begin(), outputs.end(), tensor) != outputs.end();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_input && !is_output, "Tensor is not an input or output of the workload");
+
+    ITensorHandle *handle = tensor->handle();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(handle == nullptr, "Tensor has no backend handle");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(handle->parent_handle() != handle, "Cannot import memory into a sub-tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(handle->tensor().info()->has_padding(),
+                                    "Imported memory must be dense but the tensor has padding");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!utility::check_aligned(memory, handle->tensor().info()->element_size()),
+                                    "Imported memory must be aligned to the size of the tensor elements");
+    ARM_COMPUTE_RETURN_ON_ERROR(handle->import_memory(memory));
+
+    workload.imported_tensors.insert(tensor);
+    return Status{};
+}
+
+bool all_io_tensors_imported(const ExecutionWorkload &workload)
+{
+    const auto is_imported = [&](Tensor *tensor) { return workload.imported_tensors.count(tensor) != 0; };
+    return !workload.imported_tensors.empty() &&
+           std::all_of(workload.inputs.begin(), workload.inputs.end(), is_imported) &&
+           std::all_of(workload.outputs.begin(), workload.outputs.end(), is_imported);
+}
+
 void prepare_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
@@ -229,7 +268,7 @@ void prepare_all_tasks(ExecutionWorkload &workload)
     }
 }
 
-void call_all_tasks(ExecutionWorkload &workload)
+void call_all_tasks(ExecutionWorkload &workload, const std::function<void(INode &)> &observer)
 {
     ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
 
@@ -243,9 +282,26 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
+    const bool profile = RuntimeProfiler::get().is_enabled();
     for (auto &task : workload.tasks)
     {
-        task();
+        if (profile && task.node != nullptr)
+        {
+            const std::string name = task.node->name().empty() ? "node_" + std::to_string(task.node->id())
+                                                               : task.node->name();
+            RuntimeProfiler::LayerScope layer(name.c_str(), static_cast<uint32_t>(workload.graph->id()));
+            task();
+        }
+        else
+        {
+            task();
+        }
+
+        // Outputs are only valid until the transition buffers are reused by the following tasks
+        if (observer && task.node != nullptr)
+        {
+            observer(*task.node);
+        }
     }
 
     // Release memory for the transition buffers
@@ -264,6 +320,10 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload)
     std::for_each(std::begin(workload.outputs), std::end(workload.outputs),
                   [&](Tensor *output_tensor)
                   {
+                      if (workload.imported_tensors.count(output_tensor) != 0)
+                      {
+                          return;
+                      }
                       bool valid_output = (output_tensor != nullptr) && output_tensor->call_accessor();
                       is_valid          = is_valid && valid_output;
                   });
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,25 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+void Stream::save_calibration() const
+{
+    _manager.calibration_table(_g).save_to_file(_ctx.config().calibration_file);
+}
+
+Status Stream::import_input_memory(size_t idx, void *memory)
+{
+    const std::vector<NodeID> &inputs = _g.nodes(NodeType::Input);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(idx >= inputs.size(), "Input index out of range");
+    return _manager.import_memory(_g, inputs[idx], memory);
+}
+
+Status Stream::import_output_memory(size_t idx, void *memory)
+{
+    const std::vector<NodeID> &outputs = _g.nodes(NodeType::Output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(idx >= outputs.size(), "Output index out of range");
+    return _manager.import_memory(_g, outputs[idx], memory);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Cast.h"
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+using DenseBuffer  = std::vector<uint8_t>;
+using FoldFunction = std::function<DenseBuffer(const std::vector<DenseBuffer> &)>;
+
+/** Constant input of a folded node */
+struct FoldedInput
+{
+    TensorInfo          info{};     /**< Metadata of the constant tensor */
+    ITensorAccessorUPtr accessor{}; /**< Accessor that used to populate the constant tensor */
+};
+
+TensorInfo tensor_info_from_descriptor(const TensorDescriptor &desc)
+{
+    TensorInfo info(desc.shape, 1, desc.data_type, desc.quant_info);
+    info.set_data_layout(desc.layout);
+    return info;
+}
+
+size_t tensor_size_in_bytes(const TensorDescriptor &desc)
+{
+    return desc.shape.total_size() * data_size_from_type(desc.data_type);
+}
+
+/** Copy the elements of a (possibly padded) tensor into a dense buffer, with dimension 0 running fastest */
+DenseBuffer read_dense(const ITensor &tensor)
+{
+    const ITensorInfo &info      = *tensor.info();
+    const size_t       row_bytes = info.dimension(0) * info.element_size();
+    DenseBuffer        dense(info.tensor_shape().total_size() * info.element_size());
+
+    Window win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    size_t offset = 0;
+    execute_window_loop(win,
+                        [&](const Coordinates &id)
+                        {
+                            std::memcpy(dense.data() + offset, tensor.ptr_to_element(id), row_bytes);
+                            offset += row_bytes;
+                        });
+    return dense;
+}
+
+/** Copy a dense buffer, with dimension 0 running fastest, into a (possibly padded) tensor */
+void write_dense(ITensor &tensor, const DenseBuffer &dense)
+{
+    const ITensorInfo &info      = *tensor.info();
+    const size_t       row_bytes = info.dimension(0) * info.element_size();
+    ARM_COMPUTE_ERROR_ON(dense.size() != info.tensor_shape().total_size() * info.element_size());
+
+    Window win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    size_t offset = 0;
+    execute_window_loop(win,
+                        [&](const Coordinates &id)
+                        {
+                            std::memcpy(tensor.ptr_to_element(id), dense.data() + offset, row_bytes);
+                            offset += row_bytes;
+                        });
+}
+
+/** Strides, in elements, of a dense tensor of the given shape */
+Strides dense_strides(const TensorShape &shape)
+{
+    Strides strides;
+    size_t  stride = 1;
+    for (size_t i = 0; i < Coordinates::num_max_dimensions; ++i)
+    {
+        strides.set(i, stride);
+        stride *= shape[i];
+    }
+    return strides;
+}
+
+/** Visit every coordinate of @p shape, with dimension 0 running fastest, along with its linear index */
+template <typename F>
+void for_each_coordinate(const TensorShape &shape, F &&func)
+{
+    Window win;
+    win.use_tensor_dimensions(shape);
+
+    size_t index = 0;
+    execute_window_loop(win, [&](const Coordinates &id) { func(id, index++); });
+}
+
+FoldFunction make_permute_fold(const TensorShape &src_shape, const TensorShape &dst_shape, PermutationVector perm,
+                               size_t element_size)
+{
+    return [=](const std::vector<DenseBuffer> &inputs)
+    {
+        const Strides src_strides = dense_strides(src_shape);
+        DenseBuffer   dst(dst_shape.total_size() * element_size);
+        for_each_coordinate(dst_shape,
+                            [&](const Coordinates &id, size_t index)
+                            {
+                                // Dimension i of the destination is dimension perm[i] of the source
+                                size_t src_index = 0;
+                                for (size_t i = 0; i < dst_shape.num_dimensions(); ++i)
+                                {
+                                    const size_t src_dim = i < perm.num_dimensions() ? perm[i] : i;
+                                    src_index += id[i] * src_strides[src_dim];
+                                }
+                                std::memcpy(dst.data() + index * element_size,
+                                            inputs[0].data() + src_index * element_size, element_size);
+                            });
+        return dst;
+    };
+}
+
+template <typename T>
+T eltwise_op(EltwiseOperation op, T a, T b)
+{
+    switch (op)
+    {
+        case EltwiseOperation::Add:
+            return a + b;
+        case EltwiseOperation::Sub:
+            return a - b;
+        case EltwiseOperation::Mul:
+            return a * b;
+        case EltwiseOperation::Div:
+            return a / b;
+        case EltwiseOperation::Max:
+            return std::max(a, b);
+        case EltwiseOperation::Min:
+            return std::min(a, b);
+        default:
+            ARM_COMPUTE_ERROR("Unsupported element-wise operation");
+    }
+}
+
+template <typename T>
+FoldFunction make_eltwise_fold(const TensorShape &src0_shape,
+                               const TensorShape &src1_shape,
+                               const TensorShape &dst_shape,
+                               EltwiseOperation   op)
+{
+    return [=](const std::vector<DenseBuffer> &inputs)
+    {
+        const Strides src0_strides = dense_strides(src0_shape);
+        const Strides src1_strides = dense_strides(src1_shape);
+        const T      *src0         = reinterpret_cast<const T *>(inputs[0].data());
+        const T      *src1         = reinterpret_cast<const T *>(inputs[1].data());
+        DenseBuffer   dst(dst_shape.total_size() * sizeof(T));
+        T            *dst_ptr = reinterpret_cast<T *>(dst.data());
+        for_each_coordinate(dst_shape,
+                            [&](const Coordinates &id, size_t index)
+                            {
+                                // Broadcast dimensions of size 1
+                                size_t src0_index = 0;
+                                size_t src1_index = 0;
+                                for (size_t i = 0; i < dst_shape.num_dimensions(); ++i)
+                                {
+                                    src0_index += (src0_shape[i] == 1 ? 0 : id[i]) * src0_strides[i];
+                                    src1_index += (src1_shape[i] == 1 ? 0 : id[i]) * src1_strides[i];
+                                }
+                                dst_ptr[index] = eltwise_op<T>(op, src0[src0_index], src1[src1_index]);
+                            });
+        return dst;
+    };
+}
+
+template <typename T>
+FoldFunction make_dequantization_fold(const UniformQuantizationInfo &qinfo,
+                                      float (*dequantize)(T, const UniformQuantizationInfo &))
+{
+    return [=](const std::vector<DenseBuffer> &inputs)
+    {
+        const size_t num_elements = inputs[0].size() / sizeof(T);
+        const T     *src          = reinterpret_cast<const T *>(inputs[0].data());
+        DenseBuffer  dst(num_elements * sizeof(float));
+        float       *dst_ptr = reinterpret_cast<float *>(dst.data());
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            dst_ptr[i] = dequantize(src[i], qinfo);
+        }
+        return dst;
+    };
+}
+
+float dequantize_u8(uint8_t value, const UniformQuantizationInfo &qinfo)
+{
+    return dequantize_qasymm8(value, qinfo);
+}
+
+float dequantize_s8(int8_t value, const UniformQuantizationInfo &qinfo)
+{
+    return dequantize_qasymm8_signed(value, qinfo);
+}
+
+float dequantize_s16(int16_t value, const UniformQuantizationInfo &qinfo)
+{
+    return dequantize_qsymm16(value, qinfo);
+}
+
+/** Check that the node only consumes constants that nothing else reads
+ *
+ * The constant inputs are removed together with the folded node, so they must not feed any other node.
+ */
+bool has_exclusive_constant_inputs(const INode &node)
+{
+    if (node.num_inputs() == 0)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if (edge == nullptr || edge->producer() == nullptr || edge->tensor() == nullptr)
+        {
+            return false;
+        }
+        const INode *producer = edge->producer();
+        if (producer->type() != NodeType::Const || producer->output_edges().size() != 1 ||
+            edge->tensor()->accessor() == nullptr)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Create the function evaluating a node on constant inputs
+ *
+ * @param[in] node Node to fold
+ *
+ * @return The fold function if the node can be folded, else an empty function
+ */
+FoldFunction get_fold_function(const INode &node)
+{
+    if (node.num_outputs() != 1 || node.output(0) == nullptr || node.output(0)->accessor() != nullptr ||
+        !has_exclusive_constant_inputs(node))
+    {
+        return nullptr;
+    }
+
+    const TensorDescriptor &src_desc = node.input(0)->desc();
+    const TensorDescriptor &dst_desc = node.output(0)->desc();
+
+    switch (node.type())
+    {
+        case NodeType::ReshapeLayer:
+        case NodeType::FlattenLayer:
+            // The dense layout of the elements is unaffected by a reshape
+            return [](const std::vector<DenseBuffer> &inputs) { return inputs[0]; };
+        case NodeType::PermuteLayer:
+        {
+            const auto *permute = utils::cast::polymorphic_downcast<const PermuteLayerNode *>(&node);
+            return make_permute_fold(src_desc.shape, dst_desc.shape, permute->permutation_vector(),
+                                     data_size_from_type(src_desc.data_type));
+        }
+        case NodeType::DequantizationLayer:
+        {
+            if (dst_desc.data_type != DataType::F32)
+            {
+                return nullptr;
+            }
+            const UniformQuantizationInfo qinfo = src_desc.quant_info.uniform();
+            switch (src_desc.data_type)
+            {
+                case DataType::QASYMM8:
+                    return make_dequantization_fold<uint8_t>(qinfo, &dequantize_u8);
+                case DataType::QASYMM8_SIGNED:
+                case DataType::QSYMM8:
+                    return make_dequantization_fold<int8_t>(qinfo, &dequantize_s8);
+                case DataType::QSYMM16:
+                    return make_dequantization_fold<int16_t>(qinfo, &dequantize_s16);
+                default:
+                    return nullptr;
+            }
+        }
+        case NodeType::EltwiseLayer:
+        {
+            const auto             *eltwise   = utils::cast::polymorphic_downcast<const EltwiseLayerNode *>(&node);
+            const TensorDescriptor &src1_desc = node.input(1)->desc();
+            if (eltwise->fused_activation().enabled() || src_desc.data_type != src1_desc.data_type ||
+                src_desc.data_type != dst_desc.data_type)
+            {
+                return nullptr;
+            }
+            for (size_t i = 0; i < dst_desc.shape.num_dimensions(); ++i)
+            {
+                const bool src0_broadcastable = src_desc.shape[i] == dst_desc.shape[i] || src_desc.shape[i] == 1;
+                const bool src1_broadcastable = src1_desc.shape[i] == dst_desc.shape[i] || src1_desc.shape[i] == 1;
+                if (!src0_broadcastable || !src1_broadcastable)
+                {
+                    return nullptr;
+                }
+            }
+            switch (dst_desc.data_type)
+            {
+                case DataType::F32:
+                    return make_eltwise_fold<float>(src_desc.shape, src1_desc.shape, dst_desc.shape,
+                                                    eltwise->eltwise_operation());
+                case DataType::F16:
+                    return make_eltwise_fold<half>(src_desc.shape, src1_desc.shape, dst_desc.shape,
+                                                   eltwise->eltwise_operation());
+                default:
+                    return nullptr;
+            }
+        }
+        default:
+            return nullptr;
+    }
+}
+
+/** Accessor evaluating a folded node from the accessors of its constant inputs */
+class ConstantFoldingAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] name   Name of the folded node
+     * @param[in] inputs Constant inputs of the folded node
+     * @param[in] fold   Function evaluating the folded node
+     */
+    ConstantFoldingAccessor(std::string name, std::vector<FoldedInput> inputs, FoldFunction fold)
+        : _name(std::move(name)), _inputs(std::move(inputs)), _fold(std::move(fold))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        std::vector<DenseBuffer> dense_inputs;
+        dense_inputs.reserve(_inputs.size());
+        for (auto &input : _inputs)
+        {
+            arm_compute::Tensor src;
+            src.allocator()->init(input.info);
+            src.allocator()->allocate();
+            if (!input.accessor->access_tensor(src))
+            {
+                return false;
+            }
+            dense_inputs.emplace_back(read_dense(src));
+        }
+
+        // Time the folded computation, which no longer runs at every inference
+        const auto        start  = std::chrono::steady_clock::now();
+        const DenseBuffer result = _fold(dense_inputs);
+        const auto        end    = std::chrono::steady_clock::now();
+        write_dense(tensor, result);
+
+        const auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        ARM_COMPUTE_LOG_GRAPH_INFO("Evaluated constant folded node " << _name << " once in " << elapsed_us
+                                                                     << " us instead of at every inference"
+                                                                     << std::endl);
+        ARM_COMPUTE_UNUSED(elapsed_us);
+        return true;
+    }
+
+private:
+    std::string              _name;
+    std::vector<FoldedInput> _inputs;
+    FoldFunction             _fold;
+};
+
+/** Replace a node and its constant inputs with a single constant node
+ *
+ * @return Size in bytes of the constant inputs that no longer need to be kept alive
+ */
+size_t fold_node(Graph &g, INode &node, FoldFunction fold)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding constant node with ID : " << node.id() << " and name : " << node.name()
+                                                                     << std::endl);
+
+    size_t                   freed_bytes = 0;
+    std::vector<FoldedInput> inputs;
+    std::vector<NodeID>      const_nids;
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        Tensor *input = node.input(i);
+        freed_bytes += tensor_size_in_bytes(input->desc());
+        inputs.push_back(FoldedInput{tensor_info_from_descriptor(input->desc()), input->extract_accessor()});
+        const_nids.push_back(node.input_edge(i)->producer_id());
+    }
+
+    const TensorDescriptor         desc          = node.output(0)->desc();
+    const NodeParams               params        = node.common_node_params();
+    const std::string              name          = params.name.empty() ? std::to_string(node.id()) : params.name;
+    const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(node);
+
+    // Remove the folded node and its constant inputs
+    g.remove_node(node.id());
+    for (const auto &nid : const_nids)
+    {
+        g.remove_node(nid);
+    }
+
+    // Drive the consumers from a constant node computing the folded result
+    const NodeID folded_nid = g.add_node<ConstNode>(desc);
+    INode       *folded     = g.node(folded_nid);
+    folded->set_common_node_parameters(params);
+    for (const auto &driving_node : driving_nodes)
+    {
+        g.add_connection(folded_nid, 0, driving_node.node_id, driving_node.index);
+    }
+    folded->output(0)->set_accessor(
+        std::make_unique<ConstantFoldingAccessor>(name, std::move(inputs), std::move(fold)));
+
+    return freed_bytes;
+}
+
+/** Check if a node computes outputs that nothing consumes nor accesses */
+bool is_dead_node(const INode &node)
+{
+    // Inputs, outputs and nodes with side effects are always kept
+    if (node.type() == NodeType::Input || node.type() == NodeType::Output || node.type() == NodeType::PrintLayer ||
+        node.num_outputs() == 0 || !node.output_edges().empty())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *output = node.output(i);
+        if (output != nullptr && output->accessor() != nullptr && node.type() != NodeType::Const)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Remove the nodes whose outputs are unused, until none is left
+ *
+ * @return Size in bytes of the output tensors of the removed nodes
+ */
+size_t remove_dead_nodes(Graph &g, size_t &num_removed)
+{
+    size_t freed_bytes = 0;
+    bool   removed     = true;
+    while (removed)
+    {
+        removed = false;
+        for (auto &node : g.nodes())
+        {
+            if (node != nullptr && is_dead_node(*node))
+            {
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removing unused node with ID : " << node->id()
+                                                                                << " and name : " << node->name()
+                                                                                << std::endl);
+                for (size_t i = 0; i < node->num_outputs(); ++i)
+                {
+                    if (node->output(i) != nullptr)
+                    {
+                        freed_bytes += tensor_size_in_bytes(node->output(i)->desc());
+                    }
+                }
+                g.remove_node(node->id());
+                ++num_removed;
+                removed = true;
+            }
+        }
+    }
+    return freed_bytes;
+}
+} // namespace
+
+ConstantFoldingMutator::ConstantFoldingMutator(bool remove_dead_nodes) : _remove_dead_nodes(remove_dead_nodes)
+{
+}
+
+const char *ConstantFoldingMutator::name()
+{
+    return "ConstantFoldingMutator";
+}
+
+IGraphMutator::MutationType ConstantFoldingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void ConstantFoldingMutator::mutate(Graph &g)
+{
+    size_t num_folded   = 0;
+    size_t folded_bytes = 0;
+
+    // Visit the nodes in topological order so that chains of operations on constants collapse into one node
+    for (const auto &nid : dfs(g))
+    {
+        INode *node = g.node(nid);
+        if (node == nullptr)
+        {
+            continue;
+        }
+        FoldFunction fold = get_fold_function(*node);
+        if (fold)
+        {
+            folded_bytes += fold_node(g, *node, std::move(fold));
+            ++num_folded;
+        }
+    }
+
+    size_t num_removed = 0;
+    size_t dead_bytes  = 0;
+    if (_remove_dead_nodes)
+    {
+        dead_bytes = remove_dead_nodes(g, num_removed);
+    }
+
+    if (num_folded != 0 || num_removed != 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Folded " << num_folded << " constant nodes, releasing " << folded_bytes
+                                             << " bytes of constant inputs, and removed " << num_removed
+                                             << " unused nodes holding " << dead_bytes << " bytes" << std::endl);
+    }
+    ARM_COMPUTE_UNUSED(folded_bytes, dead_bytes);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,13 +67,16 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
             // Get output tensor
             auto output_tensor = node->output(0);
 
-            // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2)
+            // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2, or along
+            // width and height when every producer and consumer of the inputs honours the strides of sub-tensors)
             auto *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
-            if (output_tensor == nullptr ||
-                get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis()) < 2)
+            if (output_tensor == nullptr || !is_target_supported(output_tensor->desc().target))
             {
                 continue;
             }
+            backends::IDeviceBackend &backend =
+                backends::BackendRegistry::get().get_backend(output_tensor->desc().target);
+            const size_t axis = get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis());
 
             // Check that all tensor have the same target, valid inputs and same quantization info
             bool is_valid =
@@ -82,28 +85,31 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
                             {
                                 return (g.edge(eid) != nullptr) && (g.edge(eid)->tensor() != nullptr) &&
                                        (g.edge(eid)->tensor()->desc().target == output_tensor->desc().target) &&
-                                       (g.edge(eid)->tensor()->desc().quant_info == output_tensor->desc().quant_info);
+                                       (g.edge(eid)->tensor()->desc().quant_info == output_tensor->desc().quant_info) &&
+                                       (axis >= 2 || supports_strided_access(g, *g.edge(eid)->tensor(), *node));
                             });
 
             // Create subtensors
-            if (is_valid && is_target_supported(output_tensor->desc().target))
+            if (is_valid)
             {
                 ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
                                               << node->id() << " and name : " << node->name() << std::endl);
+                const bool extend_parent = (axis < 2);
+
                 // Create sub-tensor handles
-                unsigned depth = 0;
+                int offset = 0;
                 for (unsigned int i = 0; i < node->input_edges().size(); ++i)
                 {
                     auto       input_tensor = node->input(i);
                     const auto input_shape  = input_tensor->desc().shape;
 
-                    backends::IDeviceBackend &backend =
-                        backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
+                    Coordinates coords;
+                    coords.set(axis, offset);
                     std::unique_ptr<ITensorHandle> handle =
-                        backend.create_subtensor(output_tensor->handle(), input_shape, Coordinates(0, 0, depth), false);
+                        backend.create_subtensor(output_tensor->handle(), input_shape, coords, extend_parent);
                     input_tensor->set_handle(std::move(handle));
 
-                    depth += input_shape.z();
+                    offset += static_cast<int>(input_shape[axis]);
                 }
 
                 auto *dc_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
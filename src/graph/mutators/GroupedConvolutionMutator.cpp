@@ -139,6 +139,27 @@ void GroupedConvolutionMutator::mutate(Graph &g)
             backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node->assigned_target());
             Status                    status  = backend.validate_node(*node);
 
+            // On the Neon backend, the requested method may not support grouping while the generic convolution can run
+            // all the groups natively, in which case the node is kept whole rather than split. Other backends keep
+            // the requested method and split the node
+            auto *grouped_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
+            if (!bool(status) && node->assigned_target() == Target::NEON &&
+                grouped_node->convolution_method() != ConvolutionMethod::Default)
+            {
+                const ConvolutionMethod requested_method = grouped_node->convolution_method();
+                grouped_node->set_convolution_method(ConvolutionMethod::Default);
+                status = backend.validate_node(*node);
+                if (bool(status))
+                {
+                    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Switched grouped ConvolutionLayer method of node with ID : "
+                                                  << node->id() << " and Name: " << node->name() << std::endl);
+                }
+                else
+                {
+                    grouped_node->set_convolution_method(requested_method);
+                }
+            }
+
             // If grouped convolution is not supported
             if (!bool(status))
             {
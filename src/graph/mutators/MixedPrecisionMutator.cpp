@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/MixedPrecisionMutator.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Bfloat16.h"
+#include "support/Cast.h"
+
+#include <map>
+#include <set>
+#include <utility>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Convert F32 values to BFLOAT16 */
+void convert_to_bfloat16(const ITensor &src, ITensor &dst)
+{
+    const size_t num_elements_x = src.info()->dimension(0);
+
+    Window win;
+    win.use_tensor_dimensions(src.info()->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    execute_window_loop(win,
+                        [&](const Coordinates &id)
+                        {
+                            const auto *src_ptr = reinterpret_cast<const float *>(src.ptr_to_element(id));
+                            auto       *dst_ptr = reinterpret_cast<bfloat16 *>(dst.ptr_to_element(id));
+                            for (size_t x = 0; x < num_elements_x; ++x)
+                            {
+                                dst_ptr[x] = bfloat16(src_ptr[x]);
+                            }
+                        });
+}
+
+/** Check if a node is a convolution that can run with BFLOAT16 storage */
+bool is_eligible(INode &node)
+{
+    if (node.type() != NodeType::ConvolutionLayer || node.assigned_target() != Target::NEON)
+    {
+        return false;
+    }
+
+    const auto   *conv    = utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(&node);
+    const Tensor *input   = node.input(0);
+    const Tensor *weights = node.input(1);
+    Tensor       *output  = node.output(0);
+    if (input == nullptr || weights == nullptr || output == nullptr || output->accessor() != nullptr)
+    {
+        return false;
+    }
+    if (input->desc().data_type != DataType::F32 || input->desc().layout != DataLayout::NHWC ||
+        conv->num_groups() != 1)
+    {
+        return false;
+    }
+
+    // Only the indirect GEMM method writes BFLOAT16 outputs
+    const ConvolutionMethod method = conv->convolution_method();
+    if (method != ConvolutionMethod::Default && method != ConvolutionMethod::GEMM)
+    {
+        return false;
+    }
+
+    // The activation has to be fused in the GEMM as the activation kernels do not support BFLOAT16
+    const ActivationLayerInfo act_info = conv->fused_activation();
+    if (act_info.enabled() &&
+        ((act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU &&
+          act_info.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU &&
+          act_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU) ||
+         act_info.b() != 0.f))
+    {
+        return false;
+    }
+
+    // Weights and biases are converted in place, so they must not be shared
+    if (!is_exclusive_constant(node.input_edge(1)) ||
+        (node.input_edge(2) != nullptr && !is_exclusive_constant(node.input_edge(2))))
+    {
+        return false;
+    }
+
+    // The non fixed-format BFLOAT16 GEMM kernels need a reduction longer than 4
+    const TensorShape &weights_shape = weights->desc().shape;
+    return weights_shape[0] * weights_shape[1] * weights_shape[2] > 4;
+}
+
+/** Check if a node of the chain exchanges its input or output with another node of the chain */
+bool has_chain_neighbour(const Graph &g, const INode &node, const std::set<NodeID> &chain)
+{
+    const Edge *input_edge = node.input_edge(0);
+    if (input_edge != nullptr && chain.count(input_edge->producer_id()) != 0)
+    {
+        return true;
+    }
+    for (const auto &eid : node.output_edges())
+    {
+        const Edge *e = g.edge(eid);
+        if (e != nullptr && e->consumer_idx() == 0 && chain.count(e->consumer_id()) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+const char *MixedPrecisionMutator::name()
+{
+    return "MixedPrecisionMutator";
+}
+
+IGraphMutator::MutationType MixedPrecisionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void MixedPrecisionMutator::mutate(Graph &g)
+{
+    if (!CPUInfo::get().has_bf16())
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Mixed precision is not applied as the CPU does not support BFLOAT16" << std::endl);
+        return;
+    }
+
+    std::set<NodeID> chain;
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && is_eligible(*node))
+        {
+            chain.insert(node->id());
+        }
+    }
+
+    // An isolated convolution would pay for two casts without saving any traffic, so it is kept in F32
+    bool pruned = true;
+    while (pruned)
+    {
+        pruned = false;
+        for (auto it = chain.begin(); it != chain.end();)
+        {
+            if (!has_chain_neighbour(g, *g.node(*it), chain))
+            {
+                it     = chain.erase(it);
+                pruned = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    if (chain.empty())
+    {
+        return;
+    }
+
+    // Group the chain inputs and outputs that need a cast, so consumers of the same tensor share a cast layer
+    std::map<std::pair<NodeID, size_t>, std::vector<NodeIdxPair>> inputs_to_cast;
+    std::map<NodeID, std::vector<NodeIdxPair>>                    outputs_to_cast;
+    for (const auto &nid : chain)
+    {
+        INode *node = g.node(nid);
+
+        const Edge *input_edge = node->input_edge(0);
+        if (chain.count(input_edge->producer_id()) == 0)
+        {
+            inputs_to_cast[std::make_pair(input_edge->producer_id(), input_edge->producer_idx())].push_back(
+                NodeIdxPair{nid, 0});
+        }
+        for (const auto &eid : node->output_edges())
+        {
+            const Edge *e = g.edge(eid);
+            if (e->consumer_idx() != 0 || chain.count(e->consumer_id()) == 0)
+            {
+                outputs_to_cast[nid].push_back(NodeIdxPair{e->consumer_id(), e->consumer_idx()});
+            }
+        }
+
+        // Weights and biases are converted once, when the constant accessors run
+        convert_constant(*node->input(1), DataType::BFLOAT16, QuantizationInfo(), convert_to_bfloat16);
+        if (node->input(2) != nullptr)
+        {
+            convert_constant(*node->input(2), DataType::BFLOAT16, QuantizationInfo(), convert_to_bfloat16);
+        }
+        utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node)->set_convolution_method(
+            ConvolutionMethod::Default);
+    }
+
+    for (const auto &input : inputs_to_cast)
+    {
+        const INode *producer = g.node(input.first.first);
+        insert_conversion_layer<CastLayerNode>(g, input.first.first, input.first.second, input.second,
+                                               NodeParams{producer->name() + "_to_bf16", producer->assigned_target()},
+                                               DataType::BFLOAT16);
+    }
+    for (const auto &output : outputs_to_cast)
+    {
+        const INode *producer = g.node(output.first);
+        insert_conversion_layer<CastLayerNode>(g, output.first, 0, output.second,
+                                               NodeParams{producer->name() + "_to_f32", producer->assigned_target()},
+                                               DataType::F32);
+    }
+    for (const auto &nid : chain)
+    {
+        convert_tensor(*g.node(nid)->output(0), DataType::BFLOAT16);
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Converted " << chain.size() << " convolution layers to BFLOAT16 storage with "
+                                            << inputs_to_cast.size() + outputs_to_cast.size() << " cast layers"
+                                            << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,10 @@
  */
 #include "src/graph/mutators/MutatorUtils.h"
 
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstring>
+
 namespace arm_compute
 {
 namespace graph
@@ -48,5 +52,59 @@ bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &
 
     return false;
 }
+
+ConversionAccessor::ConversionAccessor(TensorInfo info, ITensorAccessorUPtr accessor, ConversionFunction func)
+    : _info(std::move(info)), _accessor(std::move(accessor)), _func(std::move(func))
+{
+}
+
+bool ConversionAccessor::access_tensor(ITensor &tensor)
+{
+    arm_compute::Tensor src;
+    src.allocator()->init(_info);
+    src.allocator()->allocate();
+    if (_accessor == nullptr)
+    {
+        std::memset(src.buffer(), 0, src.info()->total_size());
+    }
+    else if (!_accessor->access_tensor(src))
+    {
+        return false;
+    }
+
+    _func(src, tensor);
+    return true;
+}
+
+bool is_exclusive_constant(const Edge *edge)
+{
+    if (edge == nullptr || edge->producer() == nullptr || edge->tensor() == nullptr)
+    {
+        return false;
+    }
+    const INode *producer = edge->producer();
+    return producer->type() == NodeType::Const && producer->output_edges().size() == 1 &&
+           edge->tensor()->accessor() != nullptr && edge->tensor()->desc().data_type == DataType::F32;
+}
+
+void convert_tensor(Tensor &tensor, DataType data_type, const QuantizationInfo &qinfo)
+{
+    tensor.desc().data_type  = data_type;
+    tensor.desc().quant_info = qinfo;
+    tensor.set_handle(nullptr);
+    configure_tensor(&tensor);
+}
+
+void convert_constant(Tensor                                &tensor,
+                      DataType                               data_type,
+                      const QuantizationInfo                &qinfo,
+                      ConversionAccessor::ConversionFunction func)
+{
+    TensorInfo info(tensor.desc().shape, 1, DataType::F32);
+    info.set_data_layout(tensor.desc().layout);
+    tensor.set_accessor(
+        std::make_unique<ConversionAccessor>(std::move(info), tensor.extract_accessor(), std::move(func)));
+    convert_tensor(tensor, data_type, qinfo);
+}
 } // namespace graph
 } // namespace arm_compute
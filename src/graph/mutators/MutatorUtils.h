@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,15 @@
 #ifndef ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 #define ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <functional>
+#include <utility>
+#include <vector>
+
 namespace arm_compute
 {
 namespace graph
@@ -36,6 +43,99 @@ namespace graph
  * @param[in] padding_list List of padding pairs
  */
 bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &padding_list);
+
+/** Accessor converting the F32 values populated by another accessor into the data type of its tensor */
+class ConversionAccessor final : public ITensorAccessor
+{
+public:
+    /** Function converting the F32 source tensor into the destination tensor */
+    using ConversionFunction = std::function<void(const ITensor &src, ITensor &dst)>;
+
+    /** Constructor
+     *
+     * @param[in] info     Metadata of the F32 tensor populated by @p accessor
+     * @param[in] accessor Accessor populating the F32 values. If nullptr, the values are zeros
+     * @param[in] func     Function converting the F32 values
+     */
+    ConversionAccessor(TensorInfo info, ITensorAccessorUPtr accessor, ConversionFunction func);
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    TensorInfo          _info;
+    ITensorAccessorUPtr _accessor;
+    ConversionFunction  _func;
+};
+
+/** Check if an edge carries an F32 constant with an accessor that only feeds its consumer
+ *
+ * Such constants can be converted in place to the data type of their consumer.
+ *
+ * @param[in] edge Edge to check
+ *
+ * @return True if the constant can be converted in place
+ */
+bool is_exclusive_constant(const Edge *edge);
+
+/** Switch a tensor to a new data type and recreate its backend handle
+ *
+ * @param[in, out] tensor    Tensor to convert
+ * @param[in]      data_type New data type
+ * @param[in]      qinfo     (Optional) New quantization information
+ */
+void convert_tensor(Tensor &tensor, DataType data_type, const QuantizationInfo &qinfo = QuantizationInfo());
+
+/** Make the accessor of an F32 constant convert its values once they are populated, and switch the constant to a
+ *  new data type
+ *
+ * @param[in, out] tensor    Constant tensor to convert
+ * @param[in]      data_type New data type
+ * @param[in]      qinfo     New quantization information
+ * @param[in]      func      Function converting the F32 values
+ */
+void convert_constant(Tensor                                &tensor,
+                      DataType                               data_type,
+                      const QuantizationInfo                &qinfo,
+                      ConversionAccessor::ConversionFunction func);
+
+/** Insert a conversion layer between an output of a node and some of its consumers
+ *
+ * @param[in, out] g            Graph to mutate
+ * @param[in]      producer_id  Node producing the converted tensor
+ * @param[in]      producer_idx Output index of the converted tensor
+ * @param[in]      consumers    Inputs that read the converted tensor instead
+ * @param[in]      params       Common parameters of the conversion layer, with the target to assign to it
+ * @param[in]      args         Arguments of the constructor of the conversion layer
+ *
+ * @return ID of the inserted layer
+ */
+template <typename NT, typename... Args>
+NodeID insert_conversion_layer(Graph                          &g,
+                               NodeID                          producer_id,
+                               size_t                          producer_idx,
+                               const std::vector<NodeIdxPair> &consumers,
+                               const NodeParams               &params,
+                               Args &&...args)
+{
+    const NodeID conversion_nid = g.add_node<NT>(std::forward<Args>(args)...);
+    INode       *conversion     = g.node(conversion_nid);
+    conversion->set_common_node_parameters(params);
+    conversion->set_assigned_target(params.target);
+
+    for (const auto &consumer : consumers)
+    {
+        g.remove_connection(g.node(consumer.node_id)->input_edge_id(consumer.index));
+    }
+    g.add_connection(producer_id, producer_idx, conversion_nid, 0);
+    for (const auto &consumer : consumers)
+    {
+        g.add_connection(conversion_nid, 0, consumer.node_id, consumer.index);
+    }
+    configure_tensor(conversion->output(0));
+
+    return conversion_nid;
+}
 } // namespace graph
 } // namespace arm_compute
 
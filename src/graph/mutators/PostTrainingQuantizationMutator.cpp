@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/PostTrainingQuantizationMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Cast.h"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <utility>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Function quantizing F32 values per channel, to QSYMM8_PER_CHANNEL or to S32 biases
+ *
+ * @param[in] scales      Quantization scale of each channel
+ * @param[in] channel_idx Dimension of the tensor indexing its channels
+ */
+ConversionAccessor::ConversionFunction quantize_per_channel(std::vector<float> scales, size_t channel_idx)
+{
+    return [scales, channel_idx](const ITensor &src, ITensor &dst)
+    {
+        const bool is_bias = dst.info()->data_type() == DataType::S32;
+
+        Window win;
+        win.use_tensor_dimensions(src.info()->tensor_shape());
+        execute_window_loop(win,
+                            [&](const Coordinates &id)
+                            {
+                                const float scale = scales[id[channel_idx]];
+                                const float value = *reinterpret_cast<const float *>(src.ptr_to_element(id)) / scale;
+                                if (is_bias)
+                                {
+                                    *reinterpret_cast<int32_t *>(dst.ptr_to_element(id)) =
+                                        static_cast<int32_t>(utility::clamp<double, int32_t>(std::round(value)));
+                                }
+                                else
+                                {
+                                    *reinterpret_cast<int8_t *>(dst.ptr_to_element(id)) =
+                                        static_cast<int8_t>(utility::clamp<float>(std::round(value), -127.f, 127.f));
+                                }
+                            });
+    };
+}
+
+/** Quantization parameters of a convolution */
+struct ConvolutionQuantization
+{
+    QuantizationInfo   input{};         /**< Quantization of the input */
+    QuantizationInfo   output{};        /**< Quantization of the output, after the fused activation */
+    std::vector<float> weight_scales{}; /**< Scale of each output channel of the weights */
+};
+
+/** Computes the QASYMM8_SIGNED quantization covering a range, which is widened to include zero */
+QuantizationInfo asymmetric_quantization(const std::pair<float, float> &range)
+{
+    const float min    = std::min(range.first, 0.f);
+    const float max    = std::max(range.second, 0.f);
+    const float scale  = max > min ? (max - min) / 255.f : 1.f;
+    const int   offset = static_cast<int>(std::round(-128.f - min / scale));
+    return QuantizationInfo(scale, utility::clamp<int>(offset, -128, 127));
+}
+
+/** Dimension of the weights of a convolution node that is quantized per channel */
+DataLayoutDimension weights_channel_dimension(const INode &node)
+{
+    return node.type() == NodeType::ConvolutionLayer ? DataLayoutDimension::BATCHES : DataLayoutDimension::CHANNEL;
+}
+
+/** Check if a node is a convolution that can be quantized with the calibrated ranges */
+bool is_eligible(INode &node, const CalibrationTable &table)
+{
+    ActivationLayerInfo act_info;
+    if (node.type() == NodeType::ConvolutionLayer)
+    {
+        const auto *conv = utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(&node);
+        if (conv->num_groups() != 1)
+        {
+            return false;
+        }
+        act_info = conv->fused_activation();
+    }
+    else if (node.type() == NodeType::DepthwiseConvolutionLayer)
+    {
+        act_info = utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(&node)->fused_activation();
+    }
+    else
+    {
+        return false;
+    }
+
+    const Tensor *input   = node.input(0);
+    const Tensor *weights = node.input(1);
+    Tensor       *output  = node.output(0);
+    if (input == nullptr || weights == nullptr || output == nullptr || output->accessor() != nullptr ||
+        input->desc().data_type != DataType::F32)
+    {
+        return false;
+    }
+
+    // Only the clamping activations are fused in the requantization of the output stage
+    if (act_info.enabled() && act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU &&
+        act_info.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU &&
+        act_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU)
+    {
+        return false;
+    }
+
+    // A shared constant would also be quantized for its other consumers
+    if (!is_exclusive_constant(node.input_edge(1)) ||
+        (node.input_edge(2) != nullptr && !is_exclusive_constant(node.input_edge(2))))
+    {
+        return false;
+    }
+
+    const size_t num_channels =
+        weights->desc().shape[get_dimension_idx(weights->desc().layout, weights_channel_dimension(node))];
+    return table.has_range(input->id()) && table.has_range(output->id()) &&
+           table.channel_ranges(weights->id()).size() == num_channels;
+}
+
+/** Quantize the weights and biases of a convolution once their accessors run */
+void quantize_constants(Graph &g, INode &node, const ConvolutionQuantization &quantization)
+{
+    Tensor &weights = *node.input(1);
+
+    const size_t channel_idx = get_dimension_idx(weights.desc().layout, weights_channel_dimension(node));
+    convert_constant(weights, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(quantization.weight_scales),
+                     quantize_per_channel(quantization.weight_scales, channel_idx));
+
+    // The bias of each channel is accumulated at the scale of the products of the input and the weights
+    std::vector<float> bias_scales(quantization.weight_scales);
+    for (auto &scale : bias_scales)
+    {
+        scale *= quantization.input.uniform().scale;
+    }
+
+    // The int8 paths need a bias, so a zero one is added to the convolutions without
+    if (node.input(2) == nullptr)
+    {
+        TensorDescriptor b_desc = weights.desc();
+        b_desc.shape            = TensorShape(bias_scales.size());
+        b_desc.data_type        = DataType::F32;
+        b_desc.quant_info       = QuantizationInfo();
+
+        NodeParams params  = node.common_node_params();
+        params.name        = params.name.empty() ? "" : params.name + "Bias";
+        params.target      = node.assigned_target();
+        const NodeID b_nid = GraphBuilder::add_const_node(g, params, b_desc);
+        g.node(b_nid)->set_assigned_target(params.target);
+        g.add_connection(b_nid, 0, node.id(), 2);
+    }
+
+    convert_constant(*node.input(2), DataType::S32, QuantizationInfo(),
+                     quantize_per_channel(std::move(bias_scales), 0));
+}
+} // namespace
+
+PostTrainingQuantizationMutator::PostTrainingQuantizationMutator(CalibrationTable table) : _table(std::move(table))
+{
+}
+
+const char *PostTrainingQuantizationMutator::name()
+{
+    return "PostTrainingQuantizationMutator";
+}
+
+IGraphMutator::MutationType PostTrainingQuantizationMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void PostTrainingQuantizationMutator::mutate(Graph &g)
+{
+    // The ranges are looked up before any connection changes, as inserted layers replace the calibrated tensors
+    std::map<NodeID, ConvolutionQuantization> chain;
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr || !is_eligible(*node, _table))
+        {
+            continue;
+        }
+
+        ConvolutionQuantization quantization;
+        quantization.input  = asymmetric_quantization(_table.range(node->input(0)->id()));
+        quantization.output = asymmetric_quantization(_table.range(node->output(0)->id()));
+
+        quantization.weight_scales = _table.channel_ranges(node->input(1)->id());
+        for (auto &scale : quantization.weight_scales)
+        {
+            scale = scale > 0.f ? scale / 127.f : 1.f;
+        }
+        chain.emplace(node->id(), std::move(quantization));
+    }
+
+    if (chain.empty())
+    {
+        return;
+    }
+
+    // One quantization layer per producer output serves every quantized consumer of that tensor
+    std::map<std::pair<NodeID, size_t>, std::vector<NodeIdxPair>> inputs_to_quantize;
+    std::map<std::pair<NodeID, size_t>, QuantizationInfo>         input_quantizations;
+    std::map<NodeID, std::vector<NodeIdxPair>>                    outputs_to_dequantize;
+    for (const auto &member : chain)
+    {
+        INode *node = g.node(member.first);
+
+        const Edge *input_edge = node->input_edge(0);
+        if (chain.count(input_edge->producer_id()) == 0)
+        {
+            const auto producer = std::make_pair(input_edge->producer_id(), input_edge->producer_idx());
+            inputs_to_quantize[producer].push_back(NodeIdxPair{member.first, 0});
+            input_quantizations[producer] = member.second.input;
+        }
+        for (const auto &eid : node->output_edges())
+        {
+            const Edge *e = g.edge(eid);
+            if (e->consumer_idx() != 0 || chain.count(e->consumer_id()) == 0)
+            {
+                outputs_to_dequantize[member.first].push_back(NodeIdxPair{e->consumer_id(), e->consumer_idx()});
+            }
+        }
+
+        quantize_constants(g, *node, member.second);
+        if (node->type() == NodeType::ConvolutionLayer)
+        {
+            utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node)->set_convolution_method(
+                ConvolutionMethod::Default);
+        }
+    }
+
+    for (const auto &input : inputs_to_quantize)
+    {
+        const INode *producer = g.node(input.first.first);
+        insert_conversion_layer<QuantizationLayerNode>(
+            g, input.first.first, input.first.second, input.second,
+            NodeParams{producer->name() + "_quantized", producer->assigned_target()},
+            input_quantizations[input.first], DataType::QASYMM8_SIGNED);
+    }
+    for (const auto &output : outputs_to_dequantize)
+    {
+        const INode *producer = g.node(output.first);
+        insert_conversion_layer<DequantizationLayerNode>(
+            g, output.first, 0, output.second,
+            NodeParams{producer->name() + "_dequantized", producer->assigned_target()});
+    }
+    for (const auto &member : chain)
+    {
+        convert_tensor(*g.node(member.first)->output(0), DataType::QASYMM8_SIGNED, member.second.output);
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Quantized " << chain.size() << " convolution layers with "
+                                            << inputs_to_quantize.size() << " quantization and "
+                                            << outputs_to_dequantize.size() << " dequantization layers"
+                                            << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/SliceLayerSubTensorMutator.h"
+
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/SliceLayerNode.h"
+#include "arm_compute/graph/nodes/StridedSliceLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+#include "support/Iterable.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Computes the start coordinates of a slice node in its input
+ *
+ * @param[in]  node   Slice or strided slice node
+ * @param[in]  shape  Shape of the input tensor
+ * @param[out] starts Absolute start coordinates of the slice
+ *
+ * @return True if the slice has unit strides and can be expressed as a sub-tensor else false
+ */
+bool compute_subtensor_coords(INode &node, const TensorShape &shape, Coordinates &starts)
+{
+    using namespace arm_compute::helpers::tensor_transform;
+
+    Coordinates ends;
+    Coordinates strides;
+    if (node.type() == NodeType::SliceLayer)
+    {
+        auto *slice_node = arm_compute::utils::cast::polymorphic_downcast<SliceLayerNode *>(&node);
+        std::tie(starts, ends, strides) =
+            calculate_strided_slice_coords(shape, slice_node->starts(), slice_node->ends(), BiStrides(), 0,
+                                           construct_slice_end_mask(slice_node->ends()));
+    }
+    else
+    {
+        auto *slice_node = arm_compute::utils::cast::polymorphic_downcast<StridedSliceLayerNode *>(&node);
+
+        const StridedSliceLayerInfo info = slice_node->strided_slice_info();
+        if (info.shrink_axis_mask() != 0)
+        {
+            return false;
+        }
+        std::tie(starts, ends, strides) =
+            calculate_strided_slice_coords(shape, slice_node->starts(), slice_node->ends(), slice_node->strides(),
+                                           info.begin_mask(), info.end_mask(), info.shrink_axis_mask());
+    }
+
+    for (unsigned int i = 0; i < starts.num_dimensions(); ++i)
+    {
+        if (strides[i] != 1 || starts[i] < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Disables the backend function of a slice node */
+void disable_slice_node(INode &node)
+{
+    if (node.type() == NodeType::SliceLayer)
+    {
+        arm_compute::utils::cast::polymorphic_downcast<SliceLayerNode *>(&node)->set_enabled(false);
+    }
+    else
+    {
+        arm_compute::utils::cast::polymorphic_downcast<StridedSliceLayerNode *>(&node)->set_enabled(false);
+    }
+}
+} // namespace
+
+const char *SliceLayerSubTensorMutator::name()
+{
+    return "SliceLayerSubTensorMutator";
+}
+
+IGraphMutator::MutationType SliceLayerSubTensorMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void SliceLayerSubTensorMutator::mutate(Graph &g)
+{
+    // Early exit if no Slice layers exist in graph
+    if (g.nodes(NodeType::SliceLayer).empty() && g.nodes(NodeType::StridedSliceLayer).empty())
+    {
+        return;
+    }
+
+    // Perform topological sort
+    std::vector<NodeID> topological_sorted_node_ids = dfs(g);
+
+    // Should be in reverse order of execution
+    for (auto &node_id : arm_compute::utils::iterable::reverse_iterate(topological_sorted_node_ids))
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr ||
+            (node->type() != NodeType::SliceLayer && node->type() != NodeType::StridedSliceLayer) ||
+            node->input(0) == nullptr || node->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        Tensor *input_tensor  = node->input(0);
+        Tensor *output_tensor = node->output(0);
+
+        // Check that both tensors have the same target
+        const Target target = input_tensor->desc().target;
+        if (output_tensor->desc().target != target || !is_target_supported(target))
+        {
+            continue;
+        }
+        backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(target);
+
+        // A view that splits the rows or planes of the input is only read by consumers that honour its strides
+        if (!keeps_parent_planes(input_tensor->desc().shape, output_tensor->desc().shape) &&
+            !supports_strided_access(g, *output_tensor, *node))
+        {
+            continue;
+        }
+
+        // The view aliases the input so neither side can be overwritten by an in-place operation,
+        // nested sub-tensors are not created and the output handle must not be referenced by other sub-tensors
+        const bool is_valid = (output_tensor->accessor() == nullptr) && (output_tensor->handle() != nullptr) &&
+                              (input_tensor->handle() != nullptr) && !output_tensor->handle()->is_subtensor() &&
+                              !input_tensor->handle()->is_subtensor() &&
+                              (output_tensor->desc().quant_info == input_tensor->desc().quant_info) &&
+                              !is_subtensor_parent(g, *output_tensor) && !is_written_in_place(g, *input_tensor) &&
+                              !is_written_in_place(g, *output_tensor);
+
+        Coordinates coords;
+        if (is_valid && compute_subtensor_coords(*node, input_tensor->desc().shape, coords))
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
+                                          << node->id() << " and name : " << node->name() << std::endl);
+
+            std::unique_ptr<ITensorHandle> handle =
+                backend.create_subtensor(input_tensor->handle(), output_tensor->desc().shape, coords, false);
+            output_tensor->set_handle(std::move(handle));
+
+            disable_slice_node(*node);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
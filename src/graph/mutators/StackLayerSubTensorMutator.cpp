@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/StackLayerSubTensorMutator.h"
+
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/StackLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+#include "support/Iterable.h"
+
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+const char *StackLayerSubTensorMutator::name()
+{
+    return "StackLayerSubTensorMutator";
+}
+
+IGraphMutator::MutationType StackLayerSubTensorMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void StackLayerSubTensorMutator::mutate(Graph &g)
+{
+    // Early exit if no Stack layers exist in graph
+    if (g.nodes(NodeType::StackLayer).empty())
+    {
+        return;
+    }
+
+    // Perform topological sort
+    std::vector<NodeID> topological_sorted_node_ids = dfs(g);
+
+    // Should be in reverse order of execution
+    for (auto &node_id : arm_compute::utils::iterable::reverse_iterate(topological_sorted_node_ids))
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr || node->type() != NodeType::StackLayer || node->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        // Get output tensor
+        Tensor *output_tensor = node->output(0);
+
+        const Target target = output_tensor->desc().target;
+        if (!is_target_supported(target) || output_tensor->handle() == nullptr ||
+            output_tensor->handle()->is_subtensor())
+        {
+            continue;
+        }
+        backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(target);
+
+        // Only stacking along a new outermost dimension keeps the inputs' layout intact inside the output
+        auto     *stack_node = arm_compute::utils::cast::polymorphic_downcast<StackLayerNode *>(node);
+        const int axis       = stack_node->axis();
+
+        // Check that all inputs are distinct intermediate tensors with the same target and quantization info,
+        // whose handles are not referenced by other sub-tensors and that are not written by in-place operations.
+        // Inputs with fewer than two dimensions split the rows or planes of the output, so their producers and
+        // consumers must also honour the strides of the sub-tensor
+        std::set<TensorID> input_ids;
+        bool               is_valid = true;
+        for (unsigned int i = 0; i < node->num_inputs() && is_valid; ++i)
+        {
+            const Edge *e            = node->input_edge(i);
+            Tensor     *input_tensor = node->input(i);
+            is_valid = (e != nullptr) && (e->producer() != nullptr) && (input_tensor != nullptr) &&
+                       (e->producer()->type() != NodeType::Const) && (e->producer()->type() != NodeType::Input) &&
+                       (input_tensor->accessor() == nullptr) && (input_tensor->handle() != nullptr) &&
+                       !input_tensor->handle()->is_subtensor() && (input_tensor->desc().target == target) &&
+                       (input_tensor->desc().quant_info == output_tensor->desc().quant_info) &&
+                       (axis == static_cast<int>(input_tensor->desc().shape.num_dimensions())) &&
+                       input_ids.insert(input_tensor->id()).second && !is_subtensor_parent(g, *input_tensor) &&
+                       !is_written_in_place(g, *input_tensor) &&
+                       (keeps_parent_planes(output_tensor->desc().shape, input_tensor->desc().shape) ||
+                        supports_strided_access(g, *input_tensor, *node));
+        }
+
+        // Create subtensors
+        if (is_valid && !is_written_in_place(g, *output_tensor))
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
+                                          << node->id() << " and name : " << node->name() << std::endl);
+            const bool extend_parent = (axis < 2);
+
+            // Create sub-tensor handles
+            for (unsigned int i = 0; i < node->num_inputs(); ++i)
+            {
+                Tensor           *input_tensor = node->input(i);
+                const TensorShape input_shape  = input_tensor->desc().shape;
+
+                Coordinates coords;
+                coords.set(axis, static_cast<int>(i));
+                std::unique_ptr<ITensorHandle> handle =
+                    backend.create_subtensor(output_tensor->handle(), input_shape, coords, extend_parent);
+                input_tensor->set_handle(std::move(handle));
+            }
+
+            stack_node->set_enabled(false);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
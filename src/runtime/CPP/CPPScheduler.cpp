@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,6 +74,55 @@ private:
     const unsigned int _end;
 };
 
+/** Non-owning view over an array of either type-erased or kernel workloads */
+class WorkloadList
+{
+public:
+    /** Constructor
+     *
+     * @param[in] workloads Type-erased workloads to run
+     */
+    explicit WorkloadList(std::vector<IScheduler::Workload> &workloads)
+        : _workloads(&workloads), _kernel_workloads(nullptr), _size(workloads.size())
+    {
+    }
+    /** Constructor
+     *
+     * @param[in] workloads Kernel workloads to run
+     */
+    explicit WorkloadList(std::vector<IScheduler::KernelWorkload> &workloads)
+        : _workloads(nullptr), _kernel_workloads(&workloads), _size(workloads.size())
+    {
+    }
+    /** Number of workloads in the list */
+    size_t size() const
+    {
+        return _size;
+    }
+    /** Run a workload of the list
+     *
+     * @param[in] idx  Index of the workload to run
+     * @param[in] info Threading and CPU info.
+     */
+    void run(unsigned int idx, const ThreadInfo &info) const
+    {
+        ARM_COMPUTE_ERROR_ON(idx >= _size);
+        if (_kernel_workloads != nullptr)
+        {
+            (*_kernel_workloads)[idx](info);
+        }
+        else
+        {
+            (*_workloads)[idx](info);
+        }
+    }
+
+private:
+    std::vector<IScheduler::Workload>       *_workloads;
+    std::vector<IScheduler::KernelWorkload> *_kernel_workloads;
+    size_t                                   _size;
+};
+
 /** Execute workloads[info.thread_id] first, then call the feeder to get the index of the next workload to run.
  *
  * Will run workloads until the feeder reaches the end of its range.
@@ -82,13 +131,12 @@ private:
  * @param[in,out] feeder    The feeder indicating which workload to execute next.
  * @param[in]     info      Threading and CPU info.
  */
-void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeeder &feeder, const ThreadInfo &info)
+void process_workloads(const WorkloadList &workloads, ThreadFeeder &feeder, const ThreadInfo &info)
 {
     unsigned int workload_index = info.thread_id;
     do
     {
-        ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
-        workloads[workload_index](info);
+        workloads.run(workload_index, info);
     } while (feeder.get_next(workload_index));
 }
 
@@ -158,7 +206,7 @@ public:
     ~Thread();
 
     /** Set workloads */
-    void set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info);
+    void set_workload(const WorkloadList *workloads, ThreadFeeder &feeder, const ThreadInfo &info);
 
     /** Request the worker thread to start executing workloads.
      *
@@ -193,19 +241,19 @@ public:
     }
 
 private:
-    std::thread                        _thread{};
-    ThreadInfo                         _info{};
-    std::vector<IScheduler::Workload> *_workloads{nullptr};
-    ThreadFeeder                      *_feeder{nullptr};
-    std::mutex                         _m{};
-    std::condition_variable            _cv{};
-    bool                               _wait_for_work{false};
-    bool                               _job_complete{true};
-    std::exception_ptr                 _current_exception{nullptr};
-    int                                _core_pin{-1};
-    std::list<Thread>                 *_thread_pool{nullptr};
-    unsigned int                       _wake_beg{0};
-    unsigned int                       _wake_end{0};
+    std::thread             _thread{};
+    ThreadInfo              _info{};
+    const WorkloadList     *_workloads{nullptr};
+    ThreadFeeder           *_feeder{nullptr};
+    std::mutex              _m{};
+    std::condition_variable _cv{};
+    bool                    _wait_for_work{false};
+    bool                    _job_complete{true};
+    std::exception_ptr      _current_exception{nullptr};
+    int                     _core_pin{-1};
+    std::list<Thread>      *_thread_pool{nullptr};
+    unsigned int            _wake_beg{0};
+    unsigned int            _wake_end{0};
 };
 
 Thread::Thread(int core_pin) : _core_pin(core_pin)
@@ -225,7 +273,7 @@ Thread::~Thread()
     }
 }
 
-void Thread::set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info)
+void Thread::set_workload(const WorkloadList *workloads, ThreadFeeder &feeder, const ThreadInfo &info)
 {
     _workloads = workloads;
     _feeder    = &feeder;
@@ -413,7 +461,7 @@ struct CPPScheduler::Impl final
         return _mode;
     }
 
-    void run_workloads(std::vector<IScheduler::Workload> &workloads);
+    void run_workloads(const WorkloadList &workloads, CPUInfo &cpu_info);
 
     unsigned int       _num_threads;
     std::list<Thread>  _threads;
@@ -459,28 +507,38 @@ unsigned int CPPScheduler::num_threads() const
 
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    _impl->run_workloads(WorkloadList(workloads), cpu_info());
+}
+
+void CPPScheduler::run_kernel_workloads(std::vector<IScheduler::KernelWorkload> &workloads)
+{
+    _impl->run_workloads(WorkloadList(workloads), cpu_info());
+}
+
+void CPPScheduler::Impl::run_workloads(const WorkloadList &workloads, CPUInfo &cpu_info)
 {
     // Mutex to ensure other threads won't interfere with the setup of the current thread's workloads
     // Other thread's workloads will be scheduled after the current thread's workloads have finished
     // This is not great because different threads workloads won't run in parallel but at least they
     // won't interfere each other and deadlock.
-    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
-    const unsigned int num_threads_to_use = std::min(_impl->num_threads(), static_cast<unsigned int>(workloads.size()));
+    arm_compute::lock_guard<std::mutex> lock(_run_workloads_mutex);
+    const unsigned int num_threads_to_use = std::min(num_threads(), static_cast<unsigned int>(workloads.size()));
     if (num_threads_to_use < 1)
     {
         return;
     }
     // Re-adjust the mode if the actual number of threads to use is different from the number of threads created
-    _impl->auto_switch_mode(num_threads_to_use);
+    auto_switch_mode(num_threads_to_use);
     int num_threads_to_start = 0;
-    switch (_impl->mode())
+    switch (mode())
     {
-        case CPPScheduler::Impl::Mode::Fanout:
+        case Mode::Fanout:
         {
-            num_threads_to_start = static_cast<int>(_impl->wake_fanout()) - 1;
+            num_threads_to_start = static_cast<int>(wake_fanout()) - 1;
             break;
         }
-        case CPPScheduler::Impl::Mode::Linear:
+        case Mode::Linear:
         default:
         {
             num_threads_to_start = static_cast<int>(num_threads_to_use) - 1;
@@ -489,17 +547,17 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     }
     ThreadFeeder feeder(num_threads_to_use, workloads.size());
     ThreadInfo   info;
-    info.cpu_info          = &cpu_info();
+    info.cpu_info          = &cpu_info;
     info.num_threads       = num_threads_to_use;
     unsigned int t         = 0;
-    auto         thread_it = _impl->_threads.begin();
+    auto         thread_it = _threads.begin();
     // Set num_threads_to_use - 1 workloads to the threads as the remaining 1 is left to the main thread
     for (; t < num_threads_to_use - 1; ++t, ++thread_it)
     {
         info.thread_id = t;
         thread_it->set_workload(&workloads, feeder, info);
     }
-    thread_it = _impl->_threads.begin();
+    thread_it = _threads.begin();
     for (int i = 0; i < num_threads_to_start; ++i, ++thread_it)
     {
         thread_it->start();
@@ -521,7 +579,7 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     try
     {
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        thread_it = _impl->_threads.begin();
+        thread_it = _threads.begin();
         for (unsigned int i = 0; i < num_threads_to_use - 1; ++i, ++thread_it)
         {
             std::exception_ptr current_exception = thread_it->wait();
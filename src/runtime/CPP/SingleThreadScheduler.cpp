@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/RuntimeProfiler.h"
 
 namespace arm_compute
 {
@@ -48,6 +49,10 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
         }
     }
 
+    const ITensorPack              tensors;
+    RuntimeProfiler::KernelScope   profiler_scope(kernel, tensors);
+    RuntimeProfiler::WorkloadScope workload_scope(kernel);
+
     ThreadInfo info;
     info.cpu_info = &cpu_info();
     kernel->run(kernel->window(), info);
@@ -59,6 +64,9 @@ void SingleThreadScheduler::schedule_op(ICPPKernel   *kernel,
                                         ITensorPack  &tensors)
 {
     ARM_COMPUTE_UNUSED(hints);
+    RuntimeProfiler::KernelScope   profiler_scope(kernel, tensors);
+    RuntimeProfiler::WorkloadScope workload_scope(kernel);
+
     ThreadInfo info;
     info.cpu_info = &cpu_info();
     kernel->run_op(tensors, window, info);
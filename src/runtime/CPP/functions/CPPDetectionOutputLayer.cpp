@@ -27,12 +27,14 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/NMSHelpers.h"
 
-#include <list>
+#include <algorithm>
 
 namespace arm_compute
 {
@@ -125,23 +127,18 @@ void retrieve_all_loc_predictions(const ITensor          *input_loc,
             }
         }
     }
+    const auto *loc_ptr = reinterpret_cast<const float *>(input_loc->ptr_to_element(Coordinates(0)));
     for (int i = 0; i < num; ++i)
     {
-        for (int p = 0; p < num_priors; ++p)
+        for (int c = 0; c < num_loc_classes; ++c)
         {
-            for (int c = 0; c < num_loc_classes; ++c)
+            const int          label  = share_location ? -1 : c;
+            std::vector<BBox> &bboxes = all_location_predictions[i][label];
+            for (int p = 0; p < num_priors; ++p)
             {
-                const int label    = share_location ? -1 : c;
-                const int base_ptr = i * num_priors * num_loc_classes * 4 + p * num_loc_classes * 4 + c * 4;
                 //xmin, ymin, xmax, ymax
-                all_location_predictions[i][label][p][0] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr)));
-                all_location_predictions[i][label][p][1] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr + 1)));
-                all_location_predictions[i][label][p][2] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr + 2)));
-                all_location_predictions[i][label][p][3] =
-                    *reinterpret_cast<float *>(input_loc->ptr_to_element(Coordinates(base_ptr + 3)));
+                const float *loc = loc_ptr + i * num_priors * num_loc_classes * 4 + p * num_loc_classes * 4 + c * 4;
+                bboxes[p]        = {{loc[0], loc[1], loc[2], loc[3]}};
             }
         }
     }
@@ -163,28 +160,21 @@ void retrieve_all_conf_scores(const ITensor                                  *in
                               const int                                       num_classes,
                               std::vector<std::map<int, std::vector<float>>> &all_confidence_scores)
 {
-    std::vector<float> tmp_buffer;
-    tmp_buffer.resize(num * num_priors * num_classes);
+    const auto *conf_ptr = reinterpret_cast<const float *>(input_conf->ptr_to_element(Coordinates(0)));
     for (int i = 0; i < num; ++i)
     {
         for (int c = 0; c < num_classes; ++c)
         {
+            // Transpose the scores of the image so that every class is contiguous
+            std::vector<float> &scores    = all_confidence_scores[i][c];
+            const float        *image_ptr = conf_ptr + i * num_classes * num_priors + c;
+            scores.resize(num_priors);
             for (int p = 0; p < num_priors; ++p)
             {
-                tmp_buffer[i * num_classes * num_priors + c * num_priors + p] = *reinterpret_cast<float *>(
-                    input_conf->ptr_to_element(Coordinates(i * num_classes * num_priors + p * num_classes + c)));
+                scores[p] = image_ptr[p * num_classes];
             }
         }
     }
-    for (int i = 0; i < num; ++i)
-    {
-        for (int c = 0; c < num_classes; ++c)
-        {
-            all_confidence_scores[i][c].resize(num_priors);
-            all_confidence_scores[i][c].assign(&tmp_buffer[i * num_classes * num_priors + c * num_priors],
-                                               &tmp_buffer[i * num_classes * num_priors + c * num_priors + num_priors]);
-        }
-    }
 }
 
 /** Get prior boxes from input_priorbox.
@@ -221,84 +211,95 @@ void retrieve_all_priorbox(const ITensor                     *input_priorbox,
     }
 }
 
-/** Decode a bbox according to a prior bbox.
+/** Decode the bboxes of a label according to the prior bboxes.
  *
- * @param[in]  prior_bbox                 The input prior bounding boxes.
- * @param[in]  prior_variance             The corresponding input variance.
+ * @param[in]  prior_bboxes               The input prior bounding boxes.
+ * @param[in]  prior_variances            The corresponding input variances.
  * @param[in]  code_type                  The detection output code type used to decode the results.
  * @param[in]  variance_encoded_in_target If true, the variance is encoded in target.
  * @param[in]  clip_bbox                  If true, the results should be between 0.f and 1.f.
- * @param[in]  bbox                       The input bbox to decode
- * @param[out] decode_bbox                The decoded bboxes.
+ * @param[in]  bboxes                     The input bboxes to decode, one per prior.
+ * @param[out] decode_bboxes              The decoded bboxes.
  *
  */
-void DecodeBBox(const BBox                        &prior_bbox,
-                const std::array<float, 4>        &prior_variance,
-                const DetectionOutputLayerCodeType code_type,
-                const bool                         variance_encoded_in_target,
-                const bool                         clip_bbox,
-                const BBox                        &bbox,
-                BBox                              &decode_bbox)
+void DecodeBBoxes(const std::vector<BBox>                 &prior_bboxes,
+                  const std::vector<std::array<float, 4>> &prior_variances,
+                  const DetectionOutputLayerCodeType       code_type,
+                  const bool                               variance_encoded_in_target,
+                  const bool                               clip_bbox,
+                  const std::vector<BBox>                 &bboxes,
+                  std::vector<BBox>                       &decode_bboxes)
 {
+    const size_t num_bboxes = prior_bboxes.size();
+
     // if the variance is encoded in target, we simply need to add the offset predictions
     // otherwise we need to scale the offset accordingly.
+    // The code type and the variance selection are resolved once per label so that the loops below are branch-free.
+    const std::array<float, 4> unit_variance{{1.f, 1.f, 1.f, 1.f}};
+
     switch (code_type)
     {
         case DetectionOutputLayerCodeType::CORNER:
         {
-            decode_bbox[0] = prior_bbox[0] + (variance_encoded_in_target ? bbox[0] : prior_variance[0] * bbox[0]);
-            decode_bbox[1] = prior_bbox[1] + (variance_encoded_in_target ? bbox[1] : prior_variance[1] * bbox[1]);
-            decode_bbox[2] = prior_bbox[2] + (variance_encoded_in_target ? bbox[2] : prior_variance[2] * bbox[2]);
-            decode_bbox[3] = prior_bbox[3] + (variance_encoded_in_target ? bbox[3] : prior_variance[3] * bbox[3]);
-
+            for (size_t j = 0; j < num_bboxes; ++j)
+            {
+                const BBox                 &prior    = prior_bboxes[j];
+                const std::array<float, 4> &variance = variance_encoded_in_target ? unit_variance : prior_variances[j];
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    decode_bboxes[j][k] = prior[k] + variance[k] * bboxes[j][k];
+                }
+            }
             break;
         }
         case DetectionOutputLayerCodeType::CENTER_SIZE:
         {
-            const float prior_width  = prior_bbox[2] - prior_bbox[0];
-            const float prior_height = prior_bbox[3] - prior_bbox[1];
-
-            // Check if the prior width and height are right
-            ARM_COMPUTE_ERROR_ON(prior_width <= 0.f);
-            ARM_COMPUTE_ERROR_ON(prior_height <= 0.f);
-
-            const float prior_center_x = (prior_bbox[0] + prior_bbox[2]) / 2.;
-            const float prior_center_y = (prior_bbox[1] + prior_bbox[3]) / 2.;
-
-            const float decode_bbox_center_x =
-                (variance_encoded_in_target ? bbox[0] : prior_variance[0] * bbox[0]) * prior_width + prior_center_x;
-            const float decode_bbox_center_y =
-                (variance_encoded_in_target ? bbox[1] : prior_variance[1] * bbox[1]) * prior_height + prior_center_y;
-            const float decode_bbox_width =
-                (variance_encoded_in_target ? std::exp(bbox[2]) : std::exp(prior_variance[2] * bbox[2])) * prior_width;
-            const float decode_bbox_height =
-                (variance_encoded_in_target ? std::exp(bbox[3]) : std::exp(prior_variance[3] * bbox[3])) * prior_height;
-
-            decode_bbox[0] = (decode_bbox_center_x - decode_bbox_width / 2.f);
-            decode_bbox[1] = (decode_bbox_center_y - decode_bbox_height / 2.f);
-            decode_bbox[2] = (decode_bbox_center_x + decode_bbox_width / 2.f);
-            decode_bbox[3] = (decode_bbox_center_y + decode_bbox_height / 2.f);
-
+            for (size_t j = 0; j < num_bboxes; ++j)
+            {
+                const BBox                 &prior = prior_bboxes[j];
+                const std::array<float, 4> &variance =
+                    variance_encoded_in_target ? unit_variance : prior_variances[j];
+                const float prior_width  = prior[2] - prior[0];
+                const float prior_height = prior[3] - prior[1];
+
+                // Check if the prior width and height are right
+                ARM_COMPUTE_ERROR_ON(prior_width <= 0.f);
+                ARM_COMPUTE_ERROR_ON(prior_height <= 0.f);
+
+                const float prior_center_x = (prior[0] + prior[2]) / 2.;
+                const float prior_center_y = (prior[1] + prior[3]) / 2.;
+
+                const float decode_bbox_center_x = variance[0] * bboxes[j][0] * prior_width + prior_center_x;
+                const float decode_bbox_center_y = variance[1] * bboxes[j][1] * prior_height + prior_center_y;
+                const float decode_bbox_width    = std::exp(variance[2] * bboxes[j][2]) * prior_width;
+                const float decode_bbox_height   = std::exp(variance[3] * bboxes[j][3]) * prior_height;
+
+                decode_bboxes[j][0] = (decode_bbox_center_x - decode_bbox_width / 2.f);
+                decode_bboxes[j][1] = (decode_bbox_center_y - decode_bbox_height / 2.f);
+                decode_bboxes[j][2] = (decode_bbox_center_x + decode_bbox_width / 2.f);
+                decode_bboxes[j][3] = (decode_bbox_center_y + decode_bbox_height / 2.f);
+            }
             break;
         }
         case DetectionOutputLayerCodeType::CORNER_SIZE:
         {
-            const float prior_width  = prior_bbox[2] - prior_bbox[0];
-            const float prior_height = prior_bbox[3] - prior_bbox[1];
-
-            // Check if the prior width and height are greater than 0
-            ARM_COMPUTE_ERROR_ON(prior_width <= 0.f);
-            ARM_COMPUTE_ERROR_ON(prior_height <= 0.f);
-
-            decode_bbox[0] =
-                prior_bbox[0] + (variance_encoded_in_target ? bbox[0] : prior_variance[0] * bbox[0]) * prior_width;
-            decode_bbox[1] =
-                prior_bbox[1] + (variance_encoded_in_target ? bbox[1] : prior_variance[1] * bbox[1]) * prior_height;
-            decode_bbox[2] =
-                prior_bbox[2] + (variance_encoded_in_target ? bbox[2] : prior_variance[2] * bbox[2]) * prior_width;
-            decode_bbox[3] =
-                prior_bbox[3] + (variance_encoded_in_target ? bbox[3] : prior_variance[3] * bbox[3]) * prior_height;
-
+            for (size_t j = 0; j < num_bboxes; ++j)
+            {
+                const BBox                 &prior = prior_bboxes[j];
+                const std::array<float, 4> &variance =
+                    variance_encoded_in_target ? unit_variance : prior_variances[j];
+                const float prior_width  = prior[2] - prior[0];
+                const float prior_height = prior[3] - prior[1];
+
+                // Check if the prior width and height are greater than 0
+                ARM_COMPUTE_ERROR_ON(prior_width <= 0.f);
+                ARM_COMPUTE_ERROR_ON(prior_height <= 0.f);
+
+                decode_bboxes[j][0] = prior[0] + variance[0] * bboxes[j][0] * prior_width;
+                decode_bboxes[j][1] = prior[1] + variance[1] * bboxes[j][1] * prior_height;
+                decode_bboxes[j][2] = prior[2] + variance[2] * bboxes[j][2] * prior_width;
+                decode_bboxes[j][3] = prior[3] + variance[3] * bboxes[j][3] * prior_height;
+            }
             break;
         }
         default:
@@ -307,9 +308,12 @@ void DecodeBBox(const BBox                        &prior_bbox,
 
     if (clip_bbox)
     {
-        for (auto &d_bbox : decode_bbox)
+        for (auto &decode_bbox : decode_bboxes)
         {
-            d_bbox = utility::clamp(d_bbox, 0.f, 1.f);
+            for (auto &d_bbox : decode_bbox)
+            {
+                d_bbox = utility::clamp(d_bbox, 0.f, 1.f);
+            }
         }
     }
 }
@@ -322,106 +326,57 @@ void DecodeBBox(const BBox                        &prior_bbox,
  * @param[in]  nms_threshold   The threshold used in non maximum suppression.
  * @param[in]  eta             Adaptation rate for nms threshold.
  * @param[in]  top_k           If not -1, keep at most top_k picked indices.
+ * @param[in]  candidates      Scratch buffer for the candidates above the score threshold.
+ * @param[in]  kept_bboxes     Scratch buffer for the kept bounding boxes.
  * @param[out] indices         The kept indices of bboxes after nms.
  *
  */
-void ApplyNMSFast(const std::vector<BBox>  &bboxes,
-                  const std::vector<float> &scores,
-                  const float               score_threshold,
-                  const float               nms_threshold,
-                  const float               eta,
-                  const int                 top_k,
-                  std::vector<int>         &indices)
+void ApplyNMSFast(const std::vector<BBox>               &bboxes,
+                  const std::vector<float>              &scores,
+                  const float                            score_threshold,
+                  const float                            nms_threshold,
+                  const float                            eta,
+                  const int                              top_k,
+                  std::vector<nms_helpers::ScoredIndex> &candidates,
+                  nms_helpers::BoxArrays                &kept_bboxes,
+                  std::vector<int>                      &indices)
 {
     ARM_COMPUTE_ERROR_ON_MSG(bboxes.size() != scores.size(), "bboxes and scores have different size.");
 
-    // Get top_k scores (with corresponding indices).
-    std::list<std::pair<float, int>> score_index_vec;
-
     // Generate index score pairs.
+    candidates.clear();
     for (size_t i = 0; i < scores.size(); ++i)
     {
         if (scores[i] > score_threshold)
         {
-            score_index_vec.emplace_back(std::make_pair(scores[i], i));
+            candidates.push_back({scores[i], static_cast<int>(i)});
         }
     }
 
-    // Sort the score pair according to the scores in descending order
-    score_index_vec.sort(SortScorePairDescend<int>);
-
     // Keep top_k scores if needed.
-    const int score_index_vec_size = score_index_vec.size();
-    if (top_k > -1 && top_k < score_index_vec_size)
-    {
-        score_index_vec.resize(top_k);
-    }
+    nms_helpers::keep_top_k(candidates, top_k);
 
     // Do nms.
-    float adaptive_threshold = nms_threshold;
-    indices.clear();
-
-    while (!score_index_vec.empty())
-    {
-        const int idx  = score_index_vec.front().second;
-        bool      keep = true;
-        for (int kept_idx : indices)
-        {
-            if (keep)
-            {
-                // Compute the jaccard (intersection over union IoU) overlap between two bboxes.
-                BBox intersect_bbox = std::array<float, 4>({0, 0, 0, 0});
-                if (bboxes[kept_idx][0] > bboxes[idx][2] || bboxes[kept_idx][2] < bboxes[idx][0] ||
-                    bboxes[kept_idx][1] > bboxes[idx][3] || bboxes[kept_idx][3] < bboxes[idx][1])
-                {
-                    intersect_bbox = std::array<float, 4>({{0, 0, 0, 0}});
-                }
-                else
-                {
-                    intersect_bbox = std::array<float, 4>(
-                        {{std::max(bboxes[idx][0], bboxes[kept_idx][0]), std::max(bboxes[idx][1], bboxes[kept_idx][1]),
-                          std::min(bboxes[idx][2], bboxes[kept_idx][2]),
-                          std::min(bboxes[idx][3], bboxes[kept_idx][3])}});
-                }
-
-                float intersect_width  = intersect_bbox[2] - intersect_bbox[0];
-                float intersect_height = intersect_bbox[3] - intersect_bbox[1];
-
-                float overlap = 0.f;
-                if (intersect_width > 0 && intersect_height > 0)
-                {
-                    float intersect_size = intersect_width * intersect_height;
-                    float bbox1_size     = (bboxes[idx][2] < bboxes[idx][0] || bboxes[idx][3] < bboxes[idx][1])
-                                               ? 0.f
-                                               : (bboxes[idx][2] - bboxes[idx][0]) *
-                                                 (bboxes[idx][3] - bboxes[idx][1]); //BBoxSize(bboxes[idx]);
-                    float bbox2_size =
-                        (bboxes[kept_idx][2] < bboxes[kept_idx][0] || bboxes[kept_idx][3] < bboxes[kept_idx][1])
-                            ? 0.f
-                            : (bboxes[kept_idx][2] - bboxes[kept_idx][0]) *
-                                  (bboxes[kept_idx][3] - bboxes[kept_idx][1]); // BBoxSize(bboxes[kept_idx]);
-                    overlap = intersect_size / (bbox1_size + bbox2_size - intersect_size);
-                }
-                keep = (overlap <= adaptive_threshold);
-            }
-            else
-            {
-                break;
-            }
-        }
-        if (keep)
-        {
-            indices.push_back(idx);
-        }
-        score_index_vec.erase(score_index_vec.begin());
-        if (keep && eta < 1.f && adaptive_threshold > 0.5f)
-        {
-            adaptive_threshold *= eta;
-        }
-    }
+    nms_helpers::greedy_nms(candidates, bboxes.data()->data(), 4, nms_threshold, eta, candidates.size(), kept_bboxes,
+                            indices);
 }
 } // namespace
 
+/** Buffers and workloads reused across runs to apply the non maximum suppression of every class in parallel */
+struct CPPDetectionOutputLayer::NMSWorkspace
+{
+    /** Scratch buffers of a single workload */
+    struct Scratch
+    {
+        std::vector<nms_helpers::ScoredIndex> candidates{};
+        nms_helpers::BoxArrays                kept_bboxes{};
+    };
+    std::vector<Scratch>                                scratches{};
+    std::vector<std::vector<int>>                       class_indices{};
+    std::vector<std::pair<float, std::pair<int, int>>> score_index_pairs{};
+    std::vector<IScheduler::Workload>                   workloads{};
+};
+
 CPPDetectionOutputLayer::CPPDetectionOutputLayer()
     : _input_loc(nullptr),
       _input_conf(nullptr),
@@ -435,10 +390,13 @@ CPPDetectionOutputLayer::CPPDetectionOutputLayer()
       _all_prior_bboxes(),
       _all_prior_variances(),
       _all_decode_bboxes(),
-      _all_indices()
+      _all_indices(),
+      _nms_workspace(std::make_unique<NMSWorkspace>())
 {
 }
 
+CPPDetectionOutputLayer::~CPPDetectionOutputLayer() = default;
+
 void CPPDetectionOutputLayer::configure(const ITensor           *input_loc,
                                         const ITensor           *input_conf,
                                         const ITensor           *input_priorbox,
@@ -489,6 +447,63 @@ void CPPDetectionOutputLayer::configure(const ITensor           *input_loc,
     }
     _all_indices.resize(_num);
 
+    // Every (image, class) pair is an independent non maximum suppression, their indices are kept in a flat array
+    const int num_classes = _info.num_classes();
+    const int num_jobs    = _num * num_classes;
+    const int max_kept    = (_info.top_k() > -1) ? std::min(_info.top_k(), _num_priors) : _num_priors;
+    _nms_workspace->class_indices.resize(num_jobs);
+    for (auto &indices : _nms_workspace->class_indices)
+    {
+        indices.reserve(max_kept);
+    }
+    for (int i = 0; i < _num; ++i)
+    {
+        for (int c = 0; c < num_classes; ++c)
+        {
+            if (c != _info.background_label_id())
+            {
+                _all_indices[i][c].reserve(max_kept);
+            }
+        }
+    }
+    _nms_workspace->score_index_pairs.reserve(num_classes * max_kept);
+
+    const int num_workloads = std::max(1, std::min<int>(Scheduler::get().num_threads(), num_jobs));
+    _nms_workspace->scratches.resize(num_workloads);
+    _nms_workspace->workloads.clear();
+    for (int w = 0; w < num_workloads; ++w)
+    {
+        _nms_workspace->scratches[w].candidates.reserve(_num_priors);
+        _nms_workspace->scratches[w].kept_bboxes.reserve(max_kept);
+        _nms_workspace->workloads.emplace_back(
+            [this, w, num_workloads, num_jobs, num_classes](const ThreadInfo &)
+            {
+                NMSWorkspace::Scratch &scratch = _nms_workspace->scratches[w];
+                for (int job = w; job < num_jobs; job += num_workloads)
+                {
+                    const int i = job / num_classes;
+                    const int c = job % num_classes;
+                    if (c == _info.background_label_id())
+                    {
+                        // Ignore background class
+                        continue;
+                    }
+                    const int label = _info.share_location() ? -1 : c;
+                    if (_all_confidence_scores[i].find(c) == _all_confidence_scores[i].end() ||
+                        _all_decode_bboxes[i].find(label) == _all_decode_bboxes[i].end())
+                    {
+                        ARM_COMPUTE_ERROR_VAR("Could not find predictions for label %d.", label);
+                    }
+                    const std::vector<float> &scores = _all_confidence_scores[i].find(c)->second;
+                    const std::vector<BBox>  &bboxes = _all_decode_bboxes[i].find(label)->second;
+
+                    ApplyNMSFast(bboxes, scores, _info.confidence_threshold(), _info.nms_threshold(), _info.eta(),
+                                 _info.top_k(), scratch.candidates, scratch.kept_bboxes,
+                                 _nms_workspace->class_indices[job]);
+                }
+            });
+    }
+
     Coordinates coord;
     coord.set_num_dimensions(output->info()->num_dimensions());
     output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
@@ -533,64 +548,52 @@ void CPPDetectionOutputLayer::run()
 
             const std::vector<BBox> &label_loc_preds = _all_location_predictions[i].find(label)->second;
 
-            const int num_bboxes = _all_prior_bboxes.size();
             ARM_COMPUTE_ERROR_ON(_all_prior_variances[i].size() != 4);
 
-            for (int j = 0; j < num_bboxes; ++j)
-            {
-                DecodeBBox(_all_prior_bboxes[j], _all_prior_variances[j], _info.code_type(),
-                           _info.variance_encoded_in_target(), clip_bbox, label_loc_preds[j],
-                           _all_decode_bboxes[i][label][j]);
-            }
+            DecodeBBoxes(_all_prior_bboxes, _all_prior_variances, _info.code_type(),
+                         _info.variance_encoded_in_target(), clip_bbox, label_loc_preds, _all_decode_bboxes[i][label]);
         }
     }
 
+    // Apply the non maximum suppression of every class of every image in parallel
+    Scheduler::get().run_tagged_workloads(_nms_workspace->workloads, "CPPDetectionOutputLayer");
+
     int num_kept = 0;
 
+    const int num_classes = _info.num_classes();
     for (int i = 0; i < _num; ++i)
     {
-        const LabelBBox                         &decode_bboxes = _all_decode_bboxes[i];
         const std::map<int, std::vector<float>> &conf_scores   = _all_confidence_scores[i];
+        std::map<int, std::vector<int>>         &image_indices = _all_indices[i];
+        const std::vector<int>                  *indices       = _nms_workspace->class_indices.data() + i * num_classes;
 
-        std::map<int, std::vector<int>> indices;
-        int                             num_det = 0;
-        for (int c = 0; c < _info.num_classes(); ++c)
+        int num_det = 0;
+        for (int c = 0; c < num_classes; ++c)
         {
-            if (c == _info.background_label_id())
-            {
-                // Ignore background class
-                continue;
-            }
-            const int label = _info.share_location() ? -1 : c;
-            if (conf_scores.find(c) == conf_scores.end() || decode_bboxes.find(label) == decode_bboxes.end())
+            if (c != _info.background_label_id())
             {
-                ARM_COMPUTE_ERROR_VAR("Could not find predictions for label %d.", label);
+                num_det += indices[c].size();
             }
-            const std::vector<float> &scores = conf_scores.find(c)->second;
-            const std::vector<BBox>  &bboxes = decode_bboxes.find(label)->second;
-
-            ApplyNMSFast(bboxes, scores, _info.confidence_threshold(), _info.nms_threshold(), _info.eta(),
-                         _info.top_k(), indices[c]);
-
-            num_det += indices[c].size();
         }
 
         int num_to_add = 0;
         if (_info.keep_top_k() > -1 && num_det > _info.keep_top_k())
         {
-            std::vector<std::pair<float, std::pair<int, int>>> score_index_pairs;
-            for (auto const &it : indices)
+            auto &score_index_pairs = _nms_workspace->score_index_pairs;
+            score_index_pairs.clear();
+            for (int label = 0; label < num_classes; ++label)
             {
-                const int               label         = it.first;
-                const std::vector<int> &label_indices = it.second;
-
+                if (label == _info.background_label_id())
+                {
+                    continue;
+                }
                 if (conf_scores.find(label) == conf_scores.end())
                 {
                     ARM_COMPUTE_ERROR_VAR("Could not find predictions for label %d.", label);
                 }
 
                 const std::vector<float> &scores = conf_scores.find(label)->second;
-                for (auto idx : label_indices)
+                for (auto idx : indices[label])
                 {
                     ARM_COMPUTE_ERROR_ON(idx > static_cast<int>(scores.size()));
                     score_index_pairs.emplace_back(std::make_pair(scores[idx], std::make_pair(label, idx)));
@@ -598,25 +601,33 @@ void CPPDetectionOutputLayer::run()
             }
 
             // Keep top k results per image.
-            std::sort(score_index_pairs.begin(), score_index_pairs.end(), SortScorePairDescend<std::pair<int, int>>);
+            std::partial_sort(score_index_pairs.begin(), score_index_pairs.begin() + _info.keep_top_k(),
+                              score_index_pairs.end(), SortScorePairDescend<std::pair<int, int>>);
             score_index_pairs.resize(_info.keep_top_k());
 
             // Store the new indices.
-
-            std::map<int, std::vector<int>> new_indices;
+            for (auto &it : image_indices)
+            {
+                it.second.clear();
+            }
             for (auto score_index_pair : score_index_pairs)
             {
                 int label = score_index_pair.second.first;
                 int idx   = score_index_pair.second.second;
-                new_indices[label].push_back(idx);
+                image_indices[label].push_back(idx);
             }
-            _all_indices[i] = new_indices;
-            num_to_add      = _info.keep_top_k();
+            num_to_add = _info.keep_top_k();
         }
         else
         {
-            _all_indices[i] = indices;
-            num_to_add      = num_det;
+            for (int c = 0; c < num_classes; ++c)
+            {
+                if (c != _info.background_label_id())
+                {
+                    image_indices[c].assign(indices[c].begin(), indices[c].end());
+                }
+            }
+            num_to_add = num_det;
         }
         num_kept += num_to_add;
     }
@@ -31,9 +31,11 @@
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <ios>
 #include <list>
+#include <numeric>
 
 namespace arm_compute
 {
@@ -459,19 +461,26 @@ void CPPDetectionPostProcessLayer::run()
     // Regular NMS
     if (_info.use_regular_nms())
     {
+        // Every class keeps at most detection_per_class boxes, reserve the results once for all the classes
+        const unsigned int        max_selected = num_classes * _info.detection_per_class();
         std::vector<int>          result_idx_boxes_after_nms;
         std::vector<int>          result_classes_after_nms;
         std::vector<float>        result_scores_after_nms;
         std::vector<unsigned int> sorted_indices;
+        result_idx_boxes_after_nms.reserve(max_selected);
+        result_classes_after_nms.reserve(max_selected);
+        result_scores_after_nms.reserve(max_selected);
 
+        const size_t score_stride = _input_scores_to_use->info()->strides_in_bytes()[1] / sizeof(float);
+        auto        *class_scores = reinterpret_cast<float *>(_class_scores.buffer());
         for (unsigned int c = 0; c < num_classes; ++c)
         {
             // For each boxes get scores of the boxes for the class c
+            const auto *scores =
+                reinterpret_cast<const float *>(_input_scores_to_use->ptr_to_element(Coordinates(c + 1, 0)));
             for (unsigned int i = 0; i < _num_boxes; ++i)
             {
-                *(reinterpret_cast<float *>(_class_scores.ptr_to_element(Coordinates(i)))) =
-                    *(reinterpret_cast<float *>(_input_scores_to_use->ptr_to_element(
-                        Coordinates(c + 1, i)))); // i * _num_classes_with_background + c + 1
+                class_scores[i] = scores[i * score_stride]; // i * _num_classes_with_background + c + 1
             }
 
             // Run Non-maxima Suppression
@@ -517,18 +526,20 @@ void CPPDetectionPostProcessLayer::run()
         std::vector<float> max_scores;
         std::vector<int>   box_indices;
         std::vector<int>   max_score_classes;
+        max_scores.reserve(_num_boxes * num_classes_per_box);
+        box_indices.reserve(_num_boxes * num_classes_per_box);
+        max_score_classes.reserve(_num_boxes * num_classes_per_box);
+
+        // Scratch buffers shared by all the boxes
+        std::vector<float>        box_scores(num_classes);
+        std::vector<unsigned int> max_score_indices(num_classes);
 
         for (unsigned int b = 0; b < _num_boxes; ++b)
         {
-            std::vector<float> box_scores;
-            for (unsigned int c = 0; c < num_classes; ++c)
-            {
-                box_scores.emplace_back(
-                    *(reinterpret_cast<float *>(_input_scores_to_use->ptr_to_element(Coordinates(c + 1, b)))));
-            }
+            const auto *scores =
+                reinterpret_cast<const float *>(_input_scores_to_use->ptr_to_element(Coordinates(1, b)));
+            std::copy(scores, scores + num_classes, box_scores.begin());
 
-            std::vector<unsigned int> max_score_indices;
-            max_score_indices.resize(_info.num_classes());
             std::iota(max_score_indices.data(), max_score_indices.data() + _info.num_classes(), 0);
             std::partial_sort(max_score_indices.data(), max_score_indices.data() + num_classes_per_box,
                               max_score_indices.data() + num_classes,
@@ -549,6 +560,7 @@ void CPPDetectionPostProcessLayer::run()
         // Run Non-maxima Suppression
         _nms.run();
         std::vector<unsigned int> selected_indices;
+        selected_indices.reserve(max_detections);
         for (unsigned int i = 0; i < max_detections; ++i)
         {
             // NMS returns M valid indices, the not valid tail is filled with -1
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Log.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/RuntimeProfiler.h"
 
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/runtime/SchedulerUtils.h"
@@ -59,6 +60,8 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 #ifndef BARE_METAL
+    RuntimeProfiler::KernelScope profiler_scope(kernel, tensors);
+
     const Window &max_window = window;
     if (hints.split_dimension() == IScheduler::split_dimensions_all)
     {
@@ -84,38 +87,32 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             n_threads = std::min<unsigned int>(n, n_threads);
         }
 
-        std::vector<IScheduler::Workload> workloads;
+        profiler_scope.set_num_threads(m_threads * n_threads);
+
+        const RuntimeProfiler::Attribution attribution = RuntimeProfiler::current_attribution();
+        std::vector<KernelWorkload>       &workloads   = thread_kernel_workloads(m_threads * n_threads);
         for (unsigned int ni = 0; ni != n_threads; ++ni)
         {
             for (unsigned int mi = 0; mi != m_threads; ++mi)
             {
-                workloads.push_back(
-                    [ni, mi, m_threads, n_threads, &max_window, &kernel, &tensors](const ThreadInfo &info)
-                    {
-                        //narrow the window to our mi-ni workload
-                        Window win = max_window.split_window(Window::DimX, mi, m_threads)
-                                         .split_window(Window::DimY, ni, n_threads);
-
-                        win.validate();
-
-                        Window thread_locator;
-                        thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
-                        thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
-
-                        thread_locator.validate();
-
-                        if (tensors.empty())
-                        {
-                            kernel->run_nd(win, info, thread_locator);
-                        }
-                        else
-                        {
-                            kernel->run_op(tensors, win, info);
-                        }
-                    });
+                KernelWorkload &workload = workloads[ni * m_threads + mi];
+                workload.kernel          = kernel;
+                workload.tensors         = &tensors;
+                workload.is_2d_split     = true;
+                workload.attribution     = attribution;
+
+                //narrow the window to our mi-ni workload
+                workload.window = max_window.split_window(Window::DimX, mi, m_threads)
+                                      .split_window(Window::DimY, ni, n_threads);
+                workload.window.validate();
+
+                workload.thread_locator = Window();
+                workload.thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
+                workload.thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
+                workload.thread_locator.validate();
             }
         }
-        run_workloads(workloads);
+        run_kernel_workloads(workloads);
     }
     else
     {
@@ -129,6 +126,8 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 
         if (!kernel->is_parallelisable() || num_threads == 1)
         {
+            RuntimeProfiler::WorkloadScope workload_scope(kernel);
+
             ThreadInfo info;
             info.cpu_info = &cpu_info();
             if (tensors.empty())
@@ -161,27 +160,21 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             }
             // Make sure the smallest window is larger than minimum workload size
             num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
+            profiler_scope.set_num_threads(std::min(num_windows, num_threads));
 
-            std::vector<IScheduler::Workload> workloads(num_windows);
+            const RuntimeProfiler::Attribution attribution = RuntimeProfiler::current_attribution();
+            std::vector<KernelWorkload>       &workloads   = thread_kernel_workloads(num_windows);
             for (unsigned int t = 0; t < num_windows; ++t)
             {
-                //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
-                {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
-                    win.validate();
-
-                    if (tensors.empty())
-                    {
-                        kernel->run(win, info);
-                    }
-                    else
-                    {
-                        kernel->run_op(tensors, win, info);
-                    }
-                };
+                KernelWorkload &workload = workloads[t];
+                workload.kernel          = kernel;
+                workload.tensors         = &tensors;
+                workload.is_2d_split     = false;
+                workload.attribution     = attribution;
+                workload.window          = max_window.split_window(hints.split_dimension(), t, num_windows);
+                workload.window.validate();
             }
-            run_workloads(workloads);
+            run_kernel_workloads(workloads);
         }
     }
 #else  /* !BARE_METAL */
@@ -189,6 +182,42 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 #endif /* !BARE_METAL */
 }
 
+void IScheduler::KernelWorkload::operator()(const ThreadInfo &info) const
+{
+    ARM_COMPUTE_ERROR_ON(kernel == nullptr || tensors == nullptr);
+    RuntimeProfiler::WorkloadScope profiler_scope(kernel, attribution);
+    if (!tensors->empty())
+    {
+        kernel->run_op(*tensors, window, info);
+    }
+    else if (is_2d_split)
+    {
+        kernel->run_nd(window, info, thread_locator);
+    }
+    else
+    {
+        kernel->run(window, info);
+    }
+}
+
+void IScheduler::run_kernel_workloads(std::vector<KernelWorkload> &workloads)
+{
+    std::vector<Workload> type_erased_workloads;
+    type_erased_workloads.reserve(workloads.size());
+    for (const KernelWorkload &workload : workloads)
+    {
+        type_erased_workloads.emplace_back([&workload](const ThreadInfo &info) { workload(info); });
+    }
+    run_workloads(type_erased_workloads);
+}
+
+std::vector<IScheduler::KernelWorkload> &IScheduler::thread_kernel_workloads(size_t num_workloads)
+{
+    thread_local std::vector<KernelWorkload> workloads;
+    workloads.resize(num_workloads);
+    return workloads;
+}
+
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
     ARM_COMPUTE_UNUSED(tag);
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/OffsetMemoryPool.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+size_t align_offset(size_t offset, size_t alignment)
+{
+    const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
+    return (remainder != 0U) ? offset + (alignment - remainder) : offset;
+}
+} // namespace
+IntervalLifetimeManager::IntervalLifetimeManager() : _blob(0), _stats(), _intervals(), _time(0)
+{
+}
+
+const IntervalLifetimeManager::info_type &IntervalLifetimeManager::info() const
+{
+    return _blob;
+}
+
+const IntervalLifetimeManager::PlanningStats &IntervalLifetimeManager::stats() const
+{
+    return _stats;
+}
+
+void IntervalLifetimeManager::start_lifetime(void *obj)
+{
+    ISimpleLifetimeManager::start_lifetime(obj);
+    _intervals[obj] = Interval{_time++, 0};
+}
+
+void IntervalLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
+{
+    // The interval has to be closed before the group gets finalized by the base class
+    auto interval_it = _intervals.find(obj);
+    ARM_COMPUTE_ERROR_ON(interval_it == std::end(_intervals));
+    interval_it->second.end = _time++;
+
+    ISimpleLifetimeManager::end_lifetime(obj, obj_memory, size, alignment);
+}
+
+std::unique_ptr<IMemoryPool> IntervalLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+    return std::make_unique<OffsetMemoryPool>(allocator, _blob);
+}
+
+MappingType IntervalLifetimeManager::mapping_type() const
+{
+    return MappingType::OFFSETS;
+}
+
+void IntervalLifetimeManager::update_blobs_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+    ARM_COMPUTE_ERROR_ON(_intervals.size() != _active_elements.size());
+
+    // Place the largest elements first, ties are broken by the earliest start
+    std::vector<void *> order;
+    order.reserve(_active_elements.size());
+    for (const auto &active_element : _active_elements)
+    {
+        order.push_back(active_element.first);
+    }
+    std::sort(std::begin(order), std::end(order),
+              [&](void *lhs, void *rhs)
+              {
+                  const size_t lhs_size = _active_elements.at(lhs).size;
+                  const size_t rhs_size = _active_elements.at(rhs).size;
+                  return (lhs_size != rhs_size) ? lhs_size > rhs_size
+                                                : _intervals.at(lhs).start < _intervals.at(rhs).start;
+              });
+
+    struct Placement
+    {
+        size_t   offset;
+        size_t   size;
+        Interval interval;
+    };
+    std::vector<Placement>         placements;
+    std::vector<const Placement *> conflicts;
+    placements.reserve(order.size());
+
+    auto  &group_mappings = _active_group->mappings();
+    size_t planned_size   = 0;
+    for (void *id : order)
+    {
+        const Element  &element  = _active_elements.at(id);
+        const Interval &interval = _intervals.at(id);
+
+        // Collect the placed elements that are alive at the same time
+        conflicts.clear();
+        for (const Placement &p : placements)
+        {
+            if (p.interval.start <= interval.end && interval.start <= p.interval.end)
+            {
+                conflicts.push_back(&p);
+            }
+        }
+        std::sort(std::begin(conflicts), std::end(conflicts),
+                  [](const Placement *lhs, const Placement *rhs) { return lhs->offset < rhs->offset; });
+
+        // Best fit: pick the smallest gap between the conflicting elements that can hold the element,
+        // otherwise place it past all of them
+        size_t best_offset = std::numeric_limits<size_t>::max();
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t gap_start   = 0;
+        for (const Placement *c : conflicts)
+        {
+            const size_t offset = align_offset(gap_start, element.alignment);
+            if (c->offset >= offset + element.size && (c->offset - gap_start) < best_gap)
+            {
+                best_gap    = c->offset - gap_start;
+                best_offset = offset;
+            }
+            gap_start = std::max(gap_start, c->offset + c->size);
+        }
+        if (best_offset == std::numeric_limits<size_t>::max())
+        {
+            best_offset = align_offset(gap_start, element.alignment);
+        }
+
+        placements.push_back(Placement{best_offset, element.size, interval});
+        group_mappings[element.handle] = best_offset;
+        planned_size                   = std::max(planned_size, best_offset + element.size);
+        _blob.alignment                = std::max(_blob.alignment, element.alignment);
+    }
+
+    // The peak of the aggregated size of the live elements is a lower bound for any offset assignment
+    std::vector<std::pair<size_t, const Placement *>> events;
+    events.reserve(2 * placements.size());
+    for (const Placement &p : placements)
+    {
+        events.emplace_back(p.interval.start, &p);
+        events.emplace_back(p.interval.end, &p);
+    }
+    std::sort(std::begin(events), std::end(events),
+              [](const std::pair<size_t, const Placement *> &lhs, const std::pair<size_t, const Placement *> &rhs)
+              { return lhs.first < rhs.first; });
+    size_t live_size   = 0;
+    size_t lower_bound = 0;
+    for (const auto &event : events)
+    {
+        if (event.first == event.second->interval.start)
+        {
+            live_size += event.second->size;
+            lower_bound = std::max(lower_bound, live_size);
+        }
+        else
+        {
+            live_size -= event.second->size;
+        }
+    }
+
+    _blob.size          = std::max(_blob.size, planned_size);
+    _stats.planned_size = std::max(_stats.planned_size, planned_size);
+    _stats.lower_bound  = std::max(_stats.lower_bound, lower_bound);
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Interval memory planner: planned %zu bytes, lower bound %zu bytes",
+                                              planned_size, lower_bound);
+
+    // Reset the logical time for the next group
+    _intervals.clear();
+    _time = 0;
+}
+} // namespace arm_compute
@@ -76,16 +76,19 @@ void NEConvolutionLayer::configure(ITensor                   *input,
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEConvolutionLayer::configure");
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(
         input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info,
         weights_info, dilation, act_info, enable_fast_math, num_groups));
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
                            enable_fast_math, num_groups);
 
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (cpu::CpuConv2d::get_convolution_method(input->info(), weights->info(), output->info(), conv_info,
-                                                   weights_info, dilation, act_info, enable_fast_math))
+    // Grouped convolutions are only supported natively by the assembly convolution of cpu::CpuConv2d
+    const ConvolutionMethod method =
+        (num_groups > 1) ? ConvolutionMethod::GEMM_CONV2D
+                         : cpu::CpuConv2d::get_convolution_method(input->info(), weights->info(), output->info(),
+                                                                  conv_info, weights_info, dilation, act_info,
+                                                                  enable_fast_math);
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         case ConvolutionMethod::GEMM:
@@ -146,8 +149,11 @@ Status NEConvolutionLayer::validate(const ITensorInfo         *input,
                                         "Dynamic Biases are not supported with quantized input data.");
     }
 
-    switch (cpu::CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                                   enable_fast_math))
+    const ConvolutionMethod method =
+        (num_groups > 1) ? ConvolutionMethod::GEMM_CONV2D
+                         : cpu::CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info,
+                                                                  dilation, act_info, enable_fast_math);
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         case ConvolutionMethod::GEMM:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,9 @@
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/NEON/kernels/NEDeconvolutionInterleaveKernel.h"
+
+#include <cstring>
 
 using namespace arm_compute::misc::shape_calculator;
 
@@ -74,24 +77,193 @@ compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_pad_x, uint32_t
                                         deconv_pad_bottom, DimensionRoundingType::FLOOR),
                           negative_padding);
 }
+
+/** Geometry of a stride phase of the deconvolution along one spatial dimension */
+struct PhaseGeometry
+{
+    int taps{0};          /**< Number of kernel taps contributing to the phase */
+    int output_offset{0}; /**< First element of the deconvolution output that belongs to the phase */
+    int input_offset{0};  /**< First element of the sub-convolution output that belongs to the phase */
+    int pad_before{0};    /**< Padding of the sub-convolution before the input */
+    int pad_after{0};     /**< Padding of the sub-convolution after the input */
+    int conv_size{0};     /**< Number of elements computed by the sub-convolution */
+};
+
+/** Compute the geometry of the phase gathering the kernel taps equal to @p phase modulo @p stride
+ *
+ * @return false if the phase cannot be computed as a unit-stride convolution of the original input
+ */
+bool compute_phase_geometry(
+    int input_size, int kernel_size, int stride, int upsample_pad, int output_size, int phase, PhaseGeometry &geometry)
+{
+    // The output element o receives the input element i through the (non-flipped) tap k when o + crop == i * stride + k
+    // A phase without any tap, when the kernel is smaller than the stride, only receives the bias: it is computed
+    // with a single zero tap at position phase
+    const int crop        = kernel_size - 1 - upsample_pad;
+    const int taps        = phase < kernel_size ? (kernel_size - 1 - phase) / stride + 1 : 1;
+    const int first_out   = ((phase - crop) % stride + stride) % stride;
+    const int num_outputs = first_out < output_size ? (output_size - 1 - first_out) / stride + 1 : 0;
+    const int first_in    = (first_out + crop - phase) / stride;
+    const int pad_before  = taps - 1 - first_in;
+    const int pad_after   = num_outputs + taps - 1 - input_size - pad_before;
+
+    // Negative paddings are turned into extra elements computed by the sub-convolution and skipped by the interleave
+    geometry.taps          = taps;
+    geometry.output_offset = first_out;
+    geometry.input_offset  = std::max(-pad_before, 0);
+    geometry.pad_before    = std::max(pad_before, 0);
+    geometry.pad_after     = std::max(pad_after, 0);
+    geometry.conv_size     = input_size + geometry.pad_before + geometry.pad_after - taps + 1;
+
+    return num_outputs > 0 && geometry.conv_size >= geometry.input_offset + num_outputs;
+}
+
+bool compute_phases(const ITensorInfo         &input,
+                    const ITensorInfo         &weights,
+                    const ITensorInfo         &output,
+                    const PadStrideInfo       &info,
+                    const PadStrideInfo       &upsample_info,
+                    std::vector<PhaseGeometry> &phases_x,
+                    std::vector<PhaseGeometry> &phases_y)
+{
+    const DataLayout   data_layout = input.data_layout();
+    const unsigned int idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+
+    phases_x.resize(info.stride().first);
+    phases_y.resize(info.stride().second);
+
+    bool valid = true;
+    for (size_t r = 0; r < phases_x.size(); ++r)
+    {
+        valid = valid && compute_phase_geometry(input.dimension(idx_w), weights.dimension(idx_w), phases_x.size(),
+                                                upsample_info.pad_left(), output.dimension(idx_w), r, phases_x[r]);
+    }
+    for (size_t r = 0; r < phases_y.size(); ++r)
+    {
+        valid = valid && compute_phase_geometry(input.dimension(idx_h), weights.dimension(idx_h), phases_y.size(),
+                                                upsample_info.pad_top(), output.dimension(idx_h), r, phases_y[r]);
+    }
+    return valid;
+}
+
+TensorInfo phase_weights_info(const ITensorInfo &weights, const PhaseGeometry &gx, const PhaseGeometry &gy)
+{
+    const unsigned int idx_w = get_data_layout_dimension_index(weights.data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int idx_h = get_data_layout_dimension_index(weights.data_layout(), DataLayoutDimension::HEIGHT);
+
+    TensorShape shape = weights.tensor_shape();
+    shape.set(idx_w, gx.taps);
+    shape.set(idx_h, gy.taps);
+    return TensorInfo(weights.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape));
+}
+
+TensorInfo phase_output_info(const ITensorInfo &output, const PhaseGeometry &gx, const PhaseGeometry &gy)
+{
+    const unsigned int idx_w = get_data_layout_dimension_index(output.data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int idx_h = get_data_layout_dimension_index(output.data_layout(), DataLayoutDimension::HEIGHT);
+
+    TensorShape shape = output.tensor_shape();
+    shape.set(idx_w, gx.conv_size);
+    shape.set(idx_h, gy.conv_size);
+    return TensorInfo(output.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape));
+}
+
+PadStrideInfo phase_conv_info(const PhaseGeometry &gx, const PhaseGeometry &gy)
+{
+    return PadStrideInfo(1, 1, gx.pad_before, gx.pad_after, gy.pad_before, gy.pad_after, DimensionRoundingType::FLOOR);
+}
+
+Status validate_phases(const ITensorInfo                *input,
+                       const ITensorInfo                *weights,
+                       const ITensorInfo                *bias,
+                       const ITensorInfo                *output,
+                       const std::vector<PhaseGeometry> &phases_x,
+                       const std::vector<PhaseGeometry> &phases_y,
+                       bool                              enable_fast_math)
+{
+    const Size2D stride(phases_x.size(), phases_y.size());
+    for (const auto &gy : phases_y)
+    {
+        for (const auto &gx : phases_x)
+        {
+            const TensorInfo phase_weights = phase_weights_info(*weights, gx, gy);
+            const TensorInfo phase_output  = phase_output_info(*output, gx, gy);
+            ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(input, &phase_weights, bias, &phase_output,
+                                                                     phase_conv_info(gx, gy), WeightsInfo(),
+                                                                     Size2D(1U, 1U), ActivationLayerInfo(),
+                                                                     enable_fast_math));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEDeconvolutionInterleaveKernel::validate(
+                &phase_output, output, stride, Size2D(gx.output_offset, gy.output_offset),
+                Size2D(gx.input_offset, gy.input_offset)));
+        }
+    }
+    return Status{};
+}
+
+/** Gather the taps of the phase (phase_x, phase_y) from the original weights, flipped to be used by a convolution
+ *
+ * The sub-kernel of a phase without any tap is filled with zeros.
+ */
+void extract_phase_weights(const ITensor *weights, ITensor *phase_weights, const Size2D &stride, const Size2D &phase)
+{
+    const ITensorInfo *info         = phase_weights->info();
+    const unsigned int idx_w        = get_data_layout_dimension_index(info->data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int idx_h        = get_data_layout_dimension_index(info->data_layout(), DataLayoutDimension::HEIGHT);
+    const int          taps_x       = info->dimension(idx_w);
+    const int          taps_y       = info->dimension(idx_h);
+    const size_t       element_size = info->element_size();
+    const bool         no_taps      = phase.x() >= weights->info()->dimension(idx_w) ||
+                                      phase.y() >= weights->info()->dimension(idx_h);
+    const uint8_t      zero         = is_data_type_quantized_asymmetric(info->data_type())
+                                          ? static_cast<uint8_t>(info->quantization_info().uniform().offset)
+                                          : 0;
+
+    Window win;
+    win.use_tensor_dimensions(info->tensor_shape());
+    Iterator out(phase_weights, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            if (no_taps)
+            {
+                std::memset(out.ptr(), zero, element_size);
+                return;
+            }
+            Coordinates src_id = id;
+            src_id.set(idx_w, phase.x() + (taps_x - 1 - id[idx_w]) * stride.x());
+            src_id.set(idx_h, phase.y() + (taps_y - 1 - id[idx_h]) * stride.y());
+            std::memcpy(out.ptr(), weights->ptr_to_element(src_id), element_size);
+        },
+        out);
+}
 } // namespace
 
 NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
-    : _memory_group(memory_manager),
+    : _memory_manager(memory_manager),
+      _memory_group(memory_manager),
       _conv_f(memory_manager),
       _upsample_f(),
       _flip_weights(),
       _scaled_output(),
       _weights_flipped(),
       _flip_axis(),
+      _phase_conv_f(),
+      _phase_interleave_kernels(),
+      _phase_weights(),
+      _phase_outputs(),
       _original_weights(nullptr),
       _input(nullptr),
       _info(),
       _is_prepared(false),
-      _do_upsampling(true)
+      _do_upsampling(true),
+      _use_phases(false)
 {
 }
 
+NEDeconvolutionLayer::~NEDeconvolutionLayer() = default;
+
 Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
                                       const ITensorInfo   *weights,
                                       const ITensorInfo   *bias,
@@ -191,6 +363,21 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
 
     if (do_upsampling)
     {
+        // Prefer the phase decomposition, which never materializes the zeros of the upsampled input
+        const TensorInfo output_info =
+            output->total_size() != 0
+                ? TensorInfo(*output)
+                : TensorInfo(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+                      compute_deconvolution_output_shape(out_dims, *input, *weights)));
+        std::vector<PhaseGeometry> phases_x;
+        std::vector<PhaseGeometry> phases_y;
+        if (weights_info.weight_format() == WeightFormat::UNSPECIFIED && !weights_info.are_reshaped() &&
+            compute_phases(*input, *weights, output_info, info, upsample_info, phases_x, phases_y) &&
+            bool(validate_phases(input, weights, bias, &output_info, phases_x, phases_y, enable_fast_math)))
+        {
+            return Status{};
+        }
+
         const PadStrideInfo conv_info(1, 1, 0, 0, 0, 0, DimensionRoundingType::CEIL);
         ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(&scale_out_info, weights, bias, output, conv_info,
                                                                  weights_info, Size2D(1U, 1U), ActivationLayerInfo(),
@@ -245,11 +432,6 @@ void NEDeconvolutionLayer::configure(ITensor             *input,
     auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(),
                        input->info()->quantization_info());
 
-    _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
-
-    _weights_flipped.allocator()->init(weights->info()->clone()->set_data_layout(data_layout));
-    _flip_weights.configure(weights, &_weights_flipped, &_flip_axis);
-
     // setup the function to convolve the upscaled output
     uint32_t          deconv_pad_x    = 0;
     uint32_t          deconv_pad_y    = 0;
@@ -264,6 +446,52 @@ void NEDeconvolutionLayer::configure(ITensor             *input,
     // Do not perform upsampling when the operation uses unit stride in all dimensions
     _do_upsampling = stride_x != 1 || stride_y != 1;
 
+    // Compute each stride phase as a convolution of the original input whenever possible
+    std::vector<PhaseGeometry> phases_x;
+    std::vector<PhaseGeometry> phases_y;
+    _use_phases = _do_upsampling && weights_info.weight_format() == WeightFormat::UNSPECIFIED &&
+                  !weights_info.are_reshaped() &&
+                  compute_phases(*input->info(), *weights->info(), *output->info(), info, upsample_info, phases_x,
+                                 phases_y) &&
+                  bool(validate_phases(input->info(), weights->info(), (bias == nullptr) ? nullptr : bias->info(),
+                                       output->info(), phases_x, phases_y, enable_fast_math));
+    if (_use_phases)
+    {
+        const size_t num_phases = phases_x.size() * phases_y.size();
+        _phase_weights.resize(num_phases);
+        _phase_outputs.resize(num_phases);
+        _phase_conv_f.clear();
+        _phase_interleave_kernels.clear();
+
+        for (size_t i = 0; i < num_phases; ++i)
+        {
+            const PhaseGeometry &gx = phases_x[i % phases_x.size()];
+            const PhaseGeometry &gy = phases_y[i / phases_x.size()];
+
+            _phase_weights[i].allocator()->init(phase_weights_info(*weights->info(), gx, gy));
+            _phase_outputs[i].allocator()->init(phase_output_info(*output->info(), gx, gy));
+            _memory_group.manage(&_phase_outputs[i]);
+
+            _phase_conv_f.emplace_back(std::make_unique<NEConvolutionLayer>(_memory_manager));
+            _phase_conv_f.back()->configure(input, &_phase_weights[i], bias, &_phase_outputs[i],
+                                            phase_conv_info(gx, gy), WeightsInfo(), Size2D(1U, 1U),
+                                            ActivationLayerInfo(), enable_fast_math);
+
+            _phase_interleave_kernels.emplace_back(std::make_unique<NEDeconvolutionInterleaveKernel>());
+            _phase_interleave_kernels.back()->configure(&_phase_outputs[i], output, Size2D(stride_x, stride_y),
+                                                        Size2D(gx.output_offset, gy.output_offset),
+                                                        Size2D(gx.input_offset, gy.input_offset));
+
+            _phase_outputs[i].allocator()->allocate();
+        }
+        return;
+    }
+
+    _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
+
+    _weights_flipped.allocator()->init(weights->info()->clone()->set_data_layout(data_layout));
+    _flip_weights.configure(weights, &_weights_flipped, &_flip_axis);
+
     // Setup flip axis data
     _flip_axis.allocator()->allocate();
     auto axis_data = reinterpret_cast<uint32_t *>(_flip_axis.buffer());
@@ -305,6 +533,16 @@ void NEDeconvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_use_phases)
+    {
+        for (size_t i = 0; i < _phase_conv_f.size(); ++i)
+        {
+            _phase_conv_f[i]->run();
+            NEScheduler::get().schedule(_phase_interleave_kernels[i].get(), Window::DimY);
+        }
+        return;
+    }
+
     if (_do_upsampling)
     {
         _upsample_f.run();
@@ -318,6 +556,32 @@ void NEDeconvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
+        if (_use_phases)
+        {
+            // Gather the sub-kernels of each phase and mark original weights tensor as unused
+            const Size2D stride(_info.stride().first, _info.stride().second);
+            for (size_t i = 0; i < _phase_weights.size(); ++i)
+            {
+                _phase_weights[i].allocator()->allocate();
+                extract_phase_weights(_original_weights, &_phase_weights[i], stride,
+                                      Size2D(i % stride.x(), i / stride.x()));
+            }
+            _original_weights->mark_as_unused();
+
+            // Prepare the convolutions and release the sub-kernels they no longer need
+            for (size_t i = 0; i < _phase_conv_f.size(); ++i)
+            {
+                _phase_conv_f[i]->prepare();
+                if (!_phase_weights[i].is_used())
+                {
+                    _phase_weights[i].allocator()->free();
+                }
+            }
+
+            _is_prepared = true;
+            return;
+        }
+
         // Run weights flipping and mark original weights tensor as unused
         _weights_flipped.allocator()->allocate();
         _flip_weights.run();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,11 +31,31 @@
 #include "src/common/utils/profile/acl_profile.h"
 #include "src/core/NEON/kernels/NEFFTDigitReverseKernel.h"
 #include "src/core/NEON/kernels/NEFFTRadixStageKernel.h"
+#include "src/core/NEON/kernels/NEFFTRealPackKernel.h"
+#include "src/core/NEON/kernels/NEFFTRealUnpackKernel.h"
 #include "src/core/NEON/kernels/NEFFTScaleKernel.h"
 #include "src/core/utils/helpers/fft.h"
 
 namespace arm_compute
 {
+namespace
+{
+/** Check whether a real transform only produces (or consumes) the N / 2 + 1 non-redundant bins of its spectrum */
+bool is_half_spectrum(const ITensorInfo *input, const ITensorInfo *output, const FFT1DInfo &config)
+{
+    if ((config.axis != 0) || (output == nullptr) || (output->total_size() == 0))
+    {
+        return false;
+    }
+
+    const bool         is_inverse = config.direction == FFTDirection::Inverse;
+    const ITensorInfo *real       = is_inverse ? output : input;
+    const ITensorInfo *spectrum   = is_inverse ? input : output;
+    return (real->num_channels() == 1) && (spectrum->num_channels() == 2) && (real->dimension(0) % 2 == 0) &&
+           (spectrum->dimension(0) == real->dimension(0) / 2 + 1);
+}
+} // namespace
+
 NEFFT1D::~NEFFT1D() = default;
 
 NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
@@ -43,11 +63,14 @@ NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
       _digit_reverse_kernel(),
       _fft_kernels(),
       _scale_kernel(),
+      _real_pack_kernel(),
+      _real_unpack_kernel(),
       _digit_reversed_input(),
       _digit_reverse_indices(),
       _num_ffts(0),
       _axis(0),
-      _run_scale(false)
+      _run_scale(false),
+      _is_half_spectrum(false)
 {
 }
 
@@ -58,36 +81,51 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT1D::validate(input->info(), output->info(), config));
     ARM_COMPUTE_LOG_PARAMS(input, output, config);
 
-    // Decompose size to radix factors
-    const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->info()->tensor_shape()[config.axis];
-    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
-    ARM_COMPUTE_ERROR_ON(decomposed_vector.empty());
-
     // Flags
-    _run_scale = config.direction == FFTDirection::Inverse;
+    _run_scale        = config.direction == FFTDirection::Inverse;
+    _is_half_spectrum = is_half_spectrum(input->info(), output->info(), config);
 
     const bool is_c2r = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
 
+    // A real transform of even length is computed as a complex transform of half length
+    const unsigned int N = _is_half_spectrum ? (_run_scale ? output : input)->info()->dimension(0) / 2
+                                             : input->info()->tensor_shape()[config.axis];
+
+    // Get the cached radix decomposition and digit reverse indices for this size
+    const auto plan = arm_compute::helpers::fft::get_plan(N, NEFFTRadixStageKernel::supported_radix());
+    ARM_COMPUTE_ERROR_ON(plan->stages.empty());
+
     // Configure digit reverse
-    FFTDigitReverseKernelInfo digit_reverse_config;
-    digit_reverse_config.axis      = config.axis;
-    digit_reverse_config.conjugate = config.direction == FFTDirection::Inverse;
-    TensorInfo digit_reverse_indices_info(TensorShape(input->info()->tensor_shape()[config.axis]), 1, DataType::U32);
+    TensorInfo digit_reverse_indices_info(TensorShape(N), 1, DataType::U32);
     _digit_reverse_indices.allocator()->init(digit_reverse_indices_info);
     _memory_group.manage(&_digit_reversed_input);
-    _digit_reverse_kernel = std::make_unique<NEFFTDigitReverseKernel>();
-    _digit_reverse_kernel->configure(input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    FFTRealKernelInfo real_config;
+    real_config.inverse = _run_scale;
+    if (_is_half_spectrum)
+    {
+        // The packing kernel stores its output in digit reverse order
+        _real_pack_kernel = std::make_unique<NEFFTRealPackKernel>();
+        _real_pack_kernel->configure(input, &_digit_reversed_input, &_digit_reverse_indices, real_config);
+    }
+    else
+    {
+        FFTDigitReverseKernelInfo digit_reverse_config;
+        digit_reverse_config.axis      = config.axis;
+        digit_reverse_config.conjugate = config.direction == FFTDirection::Inverse;
+        _digit_reverse_kernel          = std::make_unique<NEFFTDigitReverseKernel>();
+        _digit_reverse_kernel->configure(input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    }
 
     // Create and configure FFT kernels
     unsigned int Nx = 1;
-    _num_ffts       = decomposed_vector.size();
+    _num_ffts       = plan->stages.size();
     _fft_kernels.resize(_num_ffts);
     _axis = config.axis;
 
     for (unsigned int i = 0; i < _num_ffts; ++i)
     {
-        const unsigned int radix_for_stage = decomposed_vector.at(i);
+        const unsigned int radix_for_stage = plan->stages.at(i);
+        const bool         is_last_stage   = i == (_num_ffts - 1);
 
         FFTRadixStageKernelInfo fft_kernel_info;
         fft_kernel_info.axis           = config.axis;
@@ -95,21 +133,28 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
         fft_kernel_info.Nx             = Nx;
         fft_kernel_info.is_first_stage = (i == 0);
         _fft_kernels[i]                = std::make_unique<NEFFTRadixStageKernel>();
-        _fft_kernels[i]->configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r) ? output : nullptr,
+        _fft_kernels[i]->configure(&_digit_reversed_input,
+                                   (is_last_stage && !is_c2r && !_is_half_spectrum) ? output : nullptr,
                                    fft_kernel_info);
 
         Nx *= radix_for_stage;
     }
 
-    // Configure scale kernel
-    if (_run_scale)
+    if (_is_half_spectrum)
+    {
+        // Configure unpacking kernel, which also takes care of the scaling of the inverse transform
+        _real_unpack_kernel = std::make_unique<NEFFTRealUnpackKernel>();
+        _real_unpack_kernel->configure(&_digit_reversed_input, output, real_config);
+    }
+    else if (_run_scale)
     {
+        // Configure scale kernel
         FFTScaleKernelInfo scale_config;
         scale_config.scale     = static_cast<float>(N);
         scale_config.conjugate = config.direction == FFTDirection::Inverse;
         _scale_kernel          = std::make_unique<NEFFTScaleKernel>();
         is_c2r ? _scale_kernel->configure(&_digit_reversed_input, output, scale_config)
-                        : _scale_kernel->configure(output, nullptr, scale_config);
+               : _scale_kernel->configure(output, nullptr, scale_config);
     }
 
     // Allocate tensors
@@ -117,8 +162,8 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     _digit_reverse_indices.allocator()->allocate();
 
     // Init digit reverse indices
-    const auto digit_reverse_cpu = arm_compute::helpers::fft::digit_reverse_indices(N, decomposed_vector);
-    std::copy_n(digit_reverse_cpu.data(), N, reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer()));
+    std::copy_n(plan->digit_reverse_indices.data(), N,
+                reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer()));
 }
 
 Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, const FFT1DInfo &config)
@@ -130,15 +175,30 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({0, 1}).count(config.axis) == 0);
 
+    const bool         is_half = is_half_spectrum(input, output, config);
+    const ITensorInfo *real    = (config.direction == FFTDirection::Inverse) ? output : input;
+
     // Check if FFT is decomposable
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->tensor_shape()[config.axis];
+    const unsigned int N                 = is_half ? real->dimension(0) / 2 : input->tensor_shape()[config.axis];
     const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
     ARM_COMPUTE_RETURN_ERROR_ON(decomposed_vector.empty());
 
-    // Checks performed when output is configured
-    if ((output != nullptr) && (output->total_size() != 0))
+    if (is_half)
+    {
+        FFTRealKernelInfo real_config;
+        real_config.inverse = config.direction == FFTDirection::Inverse;
+
+        TensorShape packed_shape = output->tensor_shape();
+        packed_shape.set(0, N);
+        const TensorInfo packed_info(packed_shape, 2, DataType::F32);
+        const TensorInfo idx_info(TensorShape(N), 1, DataType::U32);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFTRealPackKernel::validate(input, &packed_info, &idx_info, real_config));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFFTRealUnpackKernel::validate(&packed_info, output, real_config));
+    }
+    else if ((output != nullptr) && (output->total_size() != 0))
     {
+        // Checks performed when output is configured
         // All combinations are supported except real input with real output (i.e., both input channels set to 1)
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() == 1 && input->num_channels() == 1);
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() > 2);
@@ -154,15 +214,26 @@ void NEFFT1D::run()
     ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NEFFT1D::run");
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    NEScheduler::get().schedule(_digit_reverse_kernel.get(), (_axis == 0 ? Window::DimY : Window::DimZ));
+    if (_is_half_spectrum)
+    {
+        NEScheduler::get().schedule(_real_pack_kernel.get(), Window::DimY);
+    }
+    else
+    {
+        NEScheduler::get().schedule(_digit_reverse_kernel.get(), (_axis == 0 ? Window::DimY : Window::DimZ));
+    }
 
     for (unsigned int i = 0; i < _num_ffts; ++i)
     {
         NEScheduler::get().schedule(_fft_kernels[i].get(), (_axis == 0 ? Window::DimY : Window::DimX));
     }
 
-    // Run output scaling
-    if (_run_scale)
+    // Recover the half spectrum, or run output scaling
+    if (_is_half_spectrum)
+    {
+        NEScheduler::get().schedule(_real_unpack_kernel.get(), Window::DimY);
+    }
+    else if (_run_scale)
     {
         NEScheduler::get().schedule(_scale_kernel.get(), Window::DimY);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,8 +30,56 @@
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
 
+#include <utility>
+
 namespace arm_compute
 {
+namespace
+{
+/** Check whether a real transform only produces (or consumes) the N / 2 + 1 non-redundant bins along X */
+bool is_half_spectrum(const ITensorInfo *input, const ITensorInfo *output, const FFT2DInfo &config)
+{
+    if ((config.axis0 != 0) || (output == nullptr) || (output->total_size() == 0))
+    {
+        return false;
+    }
+
+    const bool         is_inverse = config.direction == FFTDirection::Inverse;
+    const ITensorInfo *real       = is_inverse ? output : input;
+    const ITensorInfo *spectrum   = is_inverse ? input : output;
+    return (real->num_channels() == 1) && (spectrum->num_channels() == 2) && (real->dimension(0) % 2 == 0) &&
+           (spectrum->dimension(0) == real->dimension(0) / 2 + 1);
+}
+
+/** Compute the configuration of the two passes
+ *
+ * The inverse of a half spectrum transform must run the complex-to-real pass along X last.
+ */
+std::pair<FFT1DInfo, FFT1DInfo> configure_passes(const FFT2DInfo &config, bool is_half)
+{
+    const bool swap_axes = is_half && (config.direction == FFTDirection::Inverse);
+
+    FFT1DInfo first_pass_config;
+    first_pass_config.axis      = swap_axes ? config.axis1 : config.axis0;
+    first_pass_config.direction = config.direction;
+
+    FFT1DInfo second_pass_config;
+    second_pass_config.axis      = swap_axes ? config.axis0 : config.axis1;
+    second_pass_config.direction = config.direction;
+
+    return std::make_pair(first_pass_config, second_pass_config);
+}
+
+TensorInfo first_pass_tensor_info(const ITensorInfo *input, const ITensorInfo *output, const FFT2DInfo &config)
+{
+    // The forward half spectrum transform is already reduced along X after the first pass
+    const bool is_forward_half = is_half_spectrum(input, output, config) && (config.direction == FFTDirection::Forward);
+
+    const ITensorInfo *src = is_forward_half ? output : input;
+    return TensorInfo(src->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
+}
+} // namespace
+
 NEFFT2D::~NEFFT2D() = default;
 
 NEFFT2D::NEFFT2D(std::shared_ptr<IMemoryManager> memory_manager)
@@ -49,18 +97,19 @@ void NEFFT2D::configure(const ITensor *input, ITensor *output, const FFT2DInfo &
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT2D::validate(input->info(), output->info(), config));
     ARM_COMPUTE_LOG_PARAMS(input, output, config);
 
+    const bool is_half = is_half_spectrum(input->info(), output->info(), config);
+    const auto passes  = configure_passes(config, is_half);
+
     // Setup first pass
-    FFT1DInfo first_pass_config;
-    first_pass_config.axis      = config.axis0;
-    first_pass_config.direction = config.direction;
+    if (is_half)
+    {
+        _first_pass_tensor.allocator()->init(first_pass_tensor_info(input->info(), output->info(), config));
+    }
     _memory_group.manage(&_first_pass_tensor);
-    _first_pass_func.configure(input, &_first_pass_tensor, first_pass_config);
+    _first_pass_func.configure(input, &_first_pass_tensor, passes.first);
 
     // Setup second pass
-    FFT1DInfo second_pass_config;
-    second_pass_config.axis      = config.axis1;
-    second_pass_config.direction = config.direction;
-    _second_pass_func.configure(&_first_pass_tensor, output, second_pass_config);
+    _second_pass_func.configure(&_first_pass_tensor, output, passes.second);
     _first_pass_tensor.allocator()->allocate();
 }
 
@@ -70,23 +119,20 @@ Status NEFFT2D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
 
+    const bool is_half = is_half_spectrum(input, output, config);
+    const auto passes  = configure_passes(config, is_half);
+
     // Create intermediate tensor info
-    TensorInfo first_pass_tensor(input->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
+    const TensorInfo first_pass_tensor = first_pass_tensor_info(input, output, config);
 
     // Validate first pass
-    FFT1DInfo first_pass_config;
-    first_pass_config.axis      = config.axis0;
-    first_pass_config.direction = config.direction;
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(input, &first_pass_tensor, first_pass_config));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(input, &first_pass_tensor, passes.first));
 
     // Validate second pass
-    FFT1DInfo second_pass_config;
-    second_pass_config.axis      = config.axis1;
-    second_pass_config.direction = config.direction;
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&first_pass_tensor, output, second_pass_config));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&first_pass_tensor, output, passes.second));
 
     // Checks performed when output is configured
-    if ((output != nullptr) && (output->total_size() != 0))
+    if (!is_half && (output != nullptr) && (output->total_size() != 0))
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,6 +59,27 @@ int pad_decomposable(int N)
     }
     return pad;
 }
+
+/** Padding needed to compute the real transforms along X as complex transforms of half length */
+int pad_half_decomposable(int N)
+{
+    const auto supported_radix = NEFFTRadixStageKernel::supported_radix();
+
+    int pad = 0;
+    while (((N + pad) % 2 != 0) || arm_compute::helpers::fft::decompose_stages((N + pad) / 2, supported_radix).empty())
+    {
+        ++pad;
+    }
+    return pad;
+}
+
+/** Info of the non-redundant half of the Hermitian spectrum of a real tensor */
+TensorInfo half_spectrum_info(const ITensorInfo &info)
+{
+    TensorShape shape = info.tensor_shape();
+    shape.set(0, shape.x() / 2 + 1);
+    return TensorInfo(info.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape).set_num_channels(2));
+}
 } // namespace
 
 NEFFTConvolutionLayer::NEFFTConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -132,7 +153,8 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
         Size2D(input->info()->tensor_shape()[idx_width], input->info()->tensor_shape()[idx_height]);
     const Size2D kernel_size =
         Size2D(weights->info()->tensor_shape()[idx_width], weights->info()->tensor_shape()[idx_height]);
-    const Size2D pad_valid = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1),
+    // The width is padded to an even size so that only half of the Hermitian spectra are computed
+    const Size2D pad_valid = Size2D(pad_half_decomposable(input_dims.x() + kernel_size.x() - 1),
                                     pad_decomposable(input_dims.y() + kernel_size.y() - 1));
     // Tensors to use
     ITensor       *input_to_use   = input;
@@ -173,6 +195,7 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
     _pad_weights_func.configure(&_flipped_weights, &_padded_weights, padding_w);
 
     // Transform weights
+    _transformed_weights.allocator()->init(half_spectrum_info(*_padded_weights.info()));
     _transform_weights_func = std::make_unique<NEFFT2D>();
     _transform_weights_func->configure(&_padded_weights, &_transformed_weights, FFT2DInfo());
 
@@ -186,6 +209,7 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
     }
 
     // Transform input
+    _transformed_input.allocator()->init(half_spectrum_info(*_padded_input.info()));
     _memory_group.manage(&_transformed_input);
     _transform_input_func.configure(&_padded_input, &_transformed_input, FFT2DInfo());
     _padded_input.allocator()->allocate();
@@ -204,8 +228,14 @@ void NEFFTConvolutionLayer::configure(ITensor                   *input,
     _memory_group.manage(&_itransformed_output);
     FFT2DInfo itranform_info;
     itranform_info.direction = FFTDirection::Inverse;
-    _itransformed_output.allocator()->init(
-        _output_reduced.info()->clone()->set_is_resizable(true).set_num_channels(1).reset_padding());
+    TensorShape itransformed_shape = _output_reduced.info()->tensor_shape();
+    itransformed_shape.set(0, _padded_input.info()->dimension(0));
+    _itransformed_output.allocator()->init(_output_reduced.info()
+                                               ->clone()
+                                               ->set_is_resizable(true)
+                                               .set_num_channels(1)
+                                               .reset_padding()
+                                               .set_tensor_shape(itransformed_shape));
     _itransform_output_func.configure(&_output_reduced, &_itransformed_output, itranform_info);
     _output_reduced.allocator()->allocate();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,14 +30,51 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
 
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
 #include "src/common/utils/Log.h"
 #include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/CpuLSTMCellKernel.h"
+
+#include <cstring>
 
 namespace arm_compute
 {
 using namespace arm_compute::misc::shape_calculator;
 using namespace arm_compute::utils::info_helpers;
 
+namespace
+{
+/** Check whether the gates can be computed by a single GEMM followed by @ref cpu::kernels::CpuLSTMCellKernel */
+Status validate_fused_cell(const ITensorInfo        *input,
+                           const ITensorInfo        *output_state_in,
+                           const ITensorInfo        *cell_state_in,
+                           const ITensorInfo        *scratch_buffer,
+                           bool                      has_projection,
+                           const LSTMCellKernelInfo &cell_info)
+{
+    const DataType     data_type   = input->data_type();
+    const unsigned int num_gates   = cell_info.has_cifg_opt ? 3 : 4;
+    const unsigned int num_units   = cell_state_in->dimension(0);
+    const unsigned int num_batches = input->dimension(1);
+
+    const TensorInfo concat_input(TensorShape(input->dimension(0) + output_state_in->dimension(0), num_batches), 1,
+                                  data_type);
+    const TensorInfo gate_weights(TensorShape(concat_input.dimension(0), num_units * num_gates), 1, data_type);
+    const TensorInfo gates(TensorShape(num_units * num_gates, num_batches), 1, data_type);
+    const TensorInfo coefficients(TensorShape(num_units, static_cast<unsigned int>(LSTMCellCoefficient::Count)), 1,
+                                  data_type);
+    const TensorInfo state(cell_state_in->tensor_shape(), 1, data_type);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&concat_input, &gate_weights, nullptr, &gates));
+    // Without projection the output state is written straight into the output state tensor, which then has the
+    // same shape as the cell state
+    ARM_COMPUTE_RETURN_ERROR_ON(!has_projection && output_state_in->tensor_shape() != cell_state_in->tensor_shape());
+    return cpu::kernels::CpuLSTMCellKernel::validate(&gates, cell_state_in, &coefficients, &state, &state,
+                                                     scratch_buffer, cell_info);
+}
+} // namespace
+
 NELSTMLayer::~NELSTMLayer() = default;
 
 NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -87,6 +124,9 @@ NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
       _mean_std_norm_output_gate(),
       _pixelwise_mul_output_gate_coeff(),
       _accum_output_gate_bias(),
+      _concat_weights_cell(),
+      _concat_weights_gates(),
+      _fully_connected_gates(),
       _input_gate_out1(),
       _input_gate_out2(),
       _input_gate_out3(),
@@ -116,13 +156,21 @@ NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
       _cell_layer_norm_out2(),
       _output_layer_norm_out1(),
       _output_layer_norm_out2(),
+      _cell_weights(),
+      _gate_weights(),
+      _gates(),
+      _coefficients(),
       _run_peephole_opt(false),
       _run_cifg_opt(false),
       _perform_cell_clipping(false),
       _has_projection_weights(false),
       _perform_projection_clipping(false),
       _is_prepared(false),
-      _is_layer_norm_lstm(false)
+      _is_layer_norm_lstm(false),
+      _use_fused_cell(false),
+      _lstm_cell_kernel(),
+      _lstm_cell_pack(),
+      _coefficient_sources()
 {
 }
 
@@ -172,6 +220,25 @@ void NELSTMLayer::configure(const ITensor             *input,
         cell_state_in->info(), scratch_buffer->info(), output_state_out->info(), cell_state_out->info(), output->info(),
         lstm_params_info, activation_info, cell_threshold, projection_threshold));
 
+    LSTMCellKernelInfo cell_info{};
+    cell_info.act_info       = activation_info;
+    cell_info.cell_threshold = cell_threshold;
+    cell_info.has_cifg_opt   = lstm_params.has_cifg_opt();
+    cell_info.has_peephole   = lstm_params.has_peephole_opt();
+    cell_info.use_layer_norm = _is_layer_norm_lstm;
+
+    _use_fused_cell = bool(validate_fused_cell(input->info(), output_state_in->info(), cell_state_in->info(),
+                                               scratch_buffer->info(), lstm_params.has_projection(), cell_info));
+    if (_use_fused_cell)
+    {
+        configure_fused_cell(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                             recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                             forget_gate_bias, cell_bias, output_gate_bias, output_state_in, cell_state_in,
+                             scratch_buffer, output_state_out, cell_state_out, output, lstm_params, cell_info,
+                             projection_threshold);
+        return;
+    }
+
     const TensorShape cell_state_shape = cell_state_in->info()->tensor_shape();
 
     // Configure block that calculates the forget gate
@@ -483,6 +550,151 @@ void NELSTMLayer::configure(const ITensor             *input,
     output_gate_out->allocator()->allocate();
 }
 
+void NELSTMLayer::configure_fused_cell(const ITensor             *input,
+                                       const ITensor             *input_to_forget_weights,
+                                       const ITensor             *input_to_cell_weights,
+                                       const ITensor             *input_to_output_weights,
+                                       const ITensor             *recurrent_to_forget_weights,
+                                       const ITensor             *recurrent_to_cell_weights,
+                                       const ITensor             *recurrent_to_output_weights,
+                                       const ITensor             *forget_gate_bias,
+                                       const ITensor             *cell_bias,
+                                       const ITensor             *output_gate_bias,
+                                       const ITensor             *output_state_in,
+                                       const ITensor             *cell_state_in,
+                                       ITensor                   *scratch_buffer,
+                                       ITensor                   *output_state_out,
+                                       ITensor                   *cell_state_out,
+                                       ITensor                   *output,
+                                       const LSTMParams<ITensor> &lstm_params,
+                                       const LSTMCellKernelInfo  &cell_info,
+                                       float                      projection_threshold)
+{
+    const DataType     data_type        = input->info()->data_type();
+    const TensorShape  cell_state_shape = cell_state_in->info()->tensor_shape();
+    const unsigned int num_units        = cell_state_shape[0];
+
+    _run_peephole_opt = cell_info.has_peephole;
+    _run_cifg_opt     = cell_info.has_cifg_opt;
+
+    // gates = (input,output_state_in) * (weights of all the gates)
+    // where the weights of every gate are the concatenation of its input and recurrent weights, and the gates are
+    // stacked in [input, forget, cell, output] order (the input gate is skipped with CIFG).
+    std::vector<const ITensor *> inputs_vector;
+    inputs_vector.emplace_back(input);
+    inputs_vector.emplace_back(output_state_in);
+
+    _memory_group.manage(&_forget_gate_out1);
+    _concat_inputs_forget_gate.configure(inputs_vector, &_forget_gate_out1, Window::DimX);
+
+    std::vector<const ITensor *> gate_weights;
+    if (!_run_cifg_opt)
+    {
+        std::vector<const ITensor *> lstm_weights;
+        lstm_weights.emplace_back(lstm_params.input_to_input_weights());
+        lstm_weights.emplace_back(lstm_params.recurrent_to_input_weights());
+        _concat_weights_input_gate.configure(lstm_weights, &_input_gate_out2, Window::DimX);
+        gate_weights.emplace_back(&_input_gate_out2);
+    }
+
+    std::vector<const ITensor *> forget_weights;
+    forget_weights.emplace_back(input_to_forget_weights);
+    forget_weights.emplace_back(recurrent_to_forget_weights);
+    _concat_weights_forget_gate.configure(forget_weights, &_forget_gate_out5, Window::DimX);
+    gate_weights.emplace_back(&_forget_gate_out5);
+
+    std::vector<const ITensor *> cell_weights;
+    cell_weights.emplace_back(input_to_cell_weights);
+    cell_weights.emplace_back(recurrent_to_cell_weights);
+    _concat_weights_cell.configure(cell_weights, &_cell_weights, Window::DimX);
+    gate_weights.emplace_back(&_cell_weights);
+
+    std::vector<const ITensor *> in_out_weights;
+    in_out_weights.emplace_back(input_to_output_weights);
+    in_out_weights.emplace_back(recurrent_to_output_weights);
+    _concat_weights_output.configure(in_out_weights, &_output2, Window::DimX);
+    gate_weights.emplace_back(&_output2);
+
+    _concat_weights_gates.configure(gate_weights, &_gate_weights, Window::DimY);
+    if (!_run_cifg_opt)
+    {
+        _input_gate_out2.allocator()->allocate();
+    }
+    _forget_gate_out5.allocator()->allocate();
+    _cell_weights.allocator()->allocate();
+    _output2.allocator()->allocate();
+
+    _memory_group.manage(&_gates);
+    _fully_connected_gates.configure(&_forget_gate_out1, &_gate_weights, nullptr, &_gates);
+    _gate_weights.allocator()->allocate();
+    _forget_gate_out1.allocator()->allocate();
+
+    // Per-unit biases, peephole and layer normalization weights are packed at every run into a single tensor, so
+    // that updates to any of them are picked up like in the per-gate path
+    const auto set_coefficient = [&](LSTMCellCoefficient coefficient, const ITensor *source)
+    { _coefficient_sources[static_cast<size_t>(coefficient)] = source; };
+    _coefficient_sources.fill(nullptr);
+    set_coefficient(LSTMCellCoefficient::InputGateBias, _run_cifg_opt ? nullptr : lstm_params.input_gate_bias());
+    set_coefficient(LSTMCellCoefficient::ForgetGateBias, forget_gate_bias);
+    set_coefficient(LSTMCellCoefficient::CellBias, cell_bias);
+    set_coefficient(LSTMCellCoefficient::OutputGateBias, output_gate_bias);
+    if (_run_peephole_opt)
+    {
+        set_coefficient(LSTMCellCoefficient::CellToInput,
+                        _run_cifg_opt ? nullptr : lstm_params.cell_to_input_weights());
+        set_coefficient(LSTMCellCoefficient::CellToForget, lstm_params.cell_to_forget_weights());
+        set_coefficient(LSTMCellCoefficient::CellToOutput, lstm_params.cell_to_output_weights());
+    }
+    if (_is_layer_norm_lstm)
+    {
+        set_coefficient(LSTMCellCoefficient::InputLayerNorm,
+                        _run_cifg_opt ? nullptr : lstm_params.input_layer_norm_weights());
+        set_coefficient(LSTMCellCoefficient::ForgetLayerNorm, lstm_params.forget_layer_norm_weights());
+        set_coefficient(LSTMCellCoefficient::CellLayerNorm, lstm_params.cell_layer_norm_weights());
+        set_coefficient(LSTMCellCoefficient::OutputLayerNorm, lstm_params.output_layer_norm_weights());
+    }
+    _coefficients.allocator()->init(TensorInfo(
+        TensorShape(num_units, static_cast<unsigned int>(LSTMCellCoefficient::Count)), 1, data_type));
+    _coefficients.allocator()->allocate();
+
+    // Apply biases, peephole connections, layer normalization and activations, and update the states in one pass
+    ITensor *output_state_out_tmp = lstm_params.has_projection() ? &_output_state1 : output_state_out;
+    if (lstm_params.has_projection())
+    {
+        _output_state1.allocator()->init(TensorInfo(cell_state_shape, 1, data_type));
+        _memory_group.manage(&_output_state1);
+    }
+
+    _lstm_cell_kernel = std::make_unique<cpu::kernels::CpuLSTMCellKernel>();
+    _lstm_cell_kernel->configure(_gates.info(), cell_state_in->info(), _coefficients.info(), cell_state_out->info(),
+                                 output_state_out_tmp->info(), scratch_buffer->info(), cell_info);
+    _lstm_cell_pack.add_const_tensor(TensorType::ACL_SRC_0, &_gates);
+    _lstm_cell_pack.add_const_tensor(TensorType::ACL_SRC_1, cell_state_in);
+    _lstm_cell_pack.add_const_tensor(TensorType::ACL_SRC_2, &_coefficients);
+    _lstm_cell_pack.add_tensor(TensorType::ACL_DST_0, cell_state_out);
+    _lstm_cell_pack.add_tensor(TensorType::ACL_DST_1, output_state_out_tmp);
+    _lstm_cell_pack.add_tensor(TensorType::ACL_DST_2, scratch_buffer);
+    _gates.allocator()->allocate();
+
+    if (lstm_params.has_projection())
+    {
+        _has_projection_weights = true;
+        _fully_connected_output_state.configure(output_state_out_tmp, lstm_params.projection_weights(),
+                                                lstm_params.projection_bias(), output_state_out);
+        _output_state1.allocator()->allocate();
+        // Perform clipping
+        if (projection_threshold != 0.f)
+        {
+            _perform_projection_clipping = true;
+            _projection_clip.configure(output_state_out, nullptr,
+                                       ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
+                                                           -projection_threshold, projection_threshold));
+        }
+    }
+
+    _copy_output.configure(output_state_out, output);
+}
+
 Status NELSTMLayer::validate(const ITensorInfo             *input,
                              const ITensorInfo             *input_to_forget_weights,
                              const ITensorInfo             *input_to_cell_weights,
@@ -779,6 +991,24 @@ void NELSTMLayer::run()
     MemoryGroupResourceScope scope_mg(_memory_group);
 
     _concat_inputs_forget_gate.run();
+    if (_use_fused_cell)
+    {
+        pack_cell_coefficients();
+        _fully_connected_gates.run();
+        NEScheduler::get().schedule_op(_lstm_cell_kernel.get(), Window::DimY, _lstm_cell_kernel->window(),
+                                       _lstm_cell_pack);
+        if (_has_projection_weights)
+        {
+            _fully_connected_output_state.run();
+            if (_perform_projection_clipping)
+            {
+                _projection_clip.run();
+            }
+        }
+        _copy_output.run();
+        return;
+    }
+
     _fully_connected_forget_gate.run();
 
     if (_run_peephole_opt)
@@ -890,7 +1120,40 @@ void NELSTMLayer::prepare()
             _concat_weights_input_gate.run();
         }
         _concat_weights_output.run();
+
+        if (_use_fused_cell)
+        {
+            _concat_weights_cell.run();
+            _concat_weights_gates.run();
+
+            // The per-gate weights are only needed to build the concatenated weights
+            if (!_run_cifg_opt)
+            {
+                _input_gate_out2.allocator()->free();
+            }
+            _forget_gate_out5.allocator()->free();
+            _cell_weights.allocator()->free();
+            _output2.allocator()->free();
+        }
         _is_prepared = true;
     }
 }
+
+void NELSTMLayer::pack_cell_coefficients()
+{
+    // Copy the per-unit coefficients, leaving the unused rows to zero
+    const size_t row_size = _coefficients.info()->dimension(0) * _coefficients.info()->element_size();
+    for (size_t i = 0; i < _coefficient_sources.size(); ++i)
+    {
+        uint8_t *dst = _coefficients.ptr_to_element(Coordinates(0, static_cast<int>(i)));
+        if (_coefficient_sources[i] != nullptr)
+        {
+            std::memcpy(dst, _coefficient_sources[i]->ptr_to_element(Coordinates(0)), row_size);
+        }
+        else
+        {
+            std::memset(dst, 0, row_size);
+        }
+    }
+}
 } // namespace arm_compute
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELSTMSequenceLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/InfoHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/CpuRecurrentStepKernel.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+using namespace arm_compute::utils::info_helpers;
+
+namespace
+{
+template <typename T>
+RecurrentStepKernelInfo make_step_info(const LSTMParams<T>       &lstm_params,
+                                       const ActivationLayerInfo &activation_info,
+                                       float                      cell_threshold)
+{
+    RecurrentStepKernelInfo step_info{};
+    step_info.is_lstm                  = true;
+    step_info.cell_info.act_info       = activation_info;
+    step_info.cell_info.cell_threshold = cell_threshold;
+    step_info.cell_info.has_cifg_opt   = lstm_params.has_cifg_opt();
+    step_info.cell_info.has_peephole   = lstm_params.has_peephole_opt();
+    return step_info;
+}
+} // namespace
+
+NELSTMSequenceLayer::~NELSTMSequenceLayer() = default;
+
+NELSTMSequenceLayer::NELSTMSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)),
+      _concat_input_weights(),
+      _concat_recurrent_weights(),
+      _concat_biases(),
+      _reshape_input(),
+      _fully_connected(memory_manager),
+      _copy_cell_state(),
+      _copy_output_state(),
+      _step_kernel(),
+      _input_weights(),
+      _recurrent_weights(),
+      _biases(),
+      _coefficients(),
+      _input_2d(),
+      _pre_gates(),
+      _pre_gates_steps(),
+      _output_steps(),
+      _step_packs(),
+      _coefficient_sources(),
+      _has_peephole(false),
+      _is_prepared(false)
+{
+}
+
+Status NELSTMSequenceLayer::validate(const ITensorInfo             *input,
+                                     const ITensorInfo             *input_to_forget_weights,
+                                     const ITensorInfo             *input_to_cell_weights,
+                                     const ITensorInfo             *input_to_output_weights,
+                                     const ITensorInfo             *recurrent_to_forget_weights,
+                                     const ITensorInfo             *recurrent_to_cell_weights,
+                                     const ITensorInfo             *recurrent_to_output_weights,
+                                     const ITensorInfo             *forget_gate_bias,
+                                     const ITensorInfo             *cell_bias,
+                                     const ITensorInfo             *output_gate_bias,
+                                     const ITensorInfo             *output_state_in,
+                                     const ITensorInfo             *cell_state_in,
+                                     const ITensorInfo             *output,
+                                     const ITensorInfo             *output_state_out,
+                                     const ITensorInfo             *cell_state_out,
+                                     const LSTMParams<ITensorInfo> &lstm_params,
+                                     const ActivationLayerInfo     &activation_info,
+                                     float                          cell_threshold)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NELSTMSequenceLayer::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                        recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                        recurrent_to_output_weights, forget_gate_bias, cell_bias, output_gate_bias,
+                                        output_state_in, cell_state_in, output, output_state_out, cell_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, input_to_forget_weights, input_to_cell_weights,
+                                                       input_to_output_weights, recurrent_to_forget_weights,
+                                                       recurrent_to_cell_weights, recurrent_to_output_weights,
+                                                       forget_gate_bias, cell_bias, output_gate_bias, output_state_in,
+                                                       cell_state_in, output, output_state_out, cell_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output_state_in, cell_state_in, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lstm_params.has_projection(), "Projection is not supported, use NELSTMLayer");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lstm_params.use_layer_norm(),
+                                    "Layer normalization is not supported, use NELSTMLayer");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_threshold < 0.f);
+
+    const DataType     data_type   = input->data_type();
+    const unsigned int input_size  = input->dimension(0);
+    const unsigned int num_batches = input->dimension(1);
+    const unsigned int num_steps   = input->dimension(2);
+    const unsigned int num_units   = cell_state_in->dimension(0);
+    const unsigned int num_gates   = lstm_params.has_cifg_opt() ? 3 : 4;
+
+    const TensorShape state_shape(num_units, num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(cell_state_in->tensor_shape(), state_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_state_in->tensor_shape(), state_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                       TensorShape(num_units, num_batches, num_steps));
+    if (output_state_out->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_state_out->tensor_shape(), state_shape);
+    }
+    if (cell_state_out->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(cell_state_out->tensor_shape(), state_shape);
+    }
+
+    std::vector<const ITensorInfo *> input_weights;
+    std::vector<const ITensorInfo *> recurrent_weights;
+    std::vector<const ITensorInfo *> biases;
+    if (!lstm_params.has_cifg_opt())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.input_to_input_weights(),
+                                            lstm_params.recurrent_to_input_weights(), lstm_params.input_gate_bias());
+        input_weights.emplace_back(lstm_params.input_to_input_weights());
+        recurrent_weights.emplace_back(lstm_params.recurrent_to_input_weights());
+        biases.emplace_back(lstm_params.input_gate_bias());
+    }
+    input_weights.insert(input_weights.end(),
+                         {input_to_forget_weights, input_to_cell_weights, input_to_output_weights});
+    recurrent_weights.insert(recurrent_weights.end(),
+                             {recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights});
+    biases.insert(biases.end(), {forget_gate_bias, cell_bias, output_gate_bias});
+    for (unsigned int g = 0; g < num_gates; ++g)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input_weights[g]->tensor_shape(),
+                                                           TensorShape(input_size, num_units));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_weights[g]->tensor_shape(),
+                                                           TensorShape(num_units, num_units));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(biases[g]->tensor_shape(), TensorShape(num_units));
+    }
+    if (lstm_params.has_peephole_opt())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.cell_to_forget_weights(), lstm_params.cell_to_output_weights());
+        ARM_COMPUTE_RETURN_ERROR_ON(!lstm_params.has_cifg_opt() && lstm_params.cell_to_input_weights() == nullptr);
+    }
+
+    const TensorInfo input_weights_info(TensorShape(input_size, num_units * num_gates), 1, data_type);
+    const TensorInfo recurrent_weights_info(TensorShape(num_units, num_units * num_gates), 1, data_type);
+    const TensorInfo biases_info(TensorShape(num_units * num_gates), 1, data_type);
+    const TensorInfo input_2d(TensorShape(input_size, num_batches * num_steps), 1, data_type);
+    const TensorInfo pre_gates(TensorShape(num_units * num_gates, num_batches * num_steps), 1, data_type);
+    const TensorInfo pre_gates_step(TensorShape(num_units * num_gates, num_batches), 1, data_type);
+    const TensorInfo coefficients(TensorShape(num_units, static_cast<unsigned int>(LSTMCellCoefficient::Count)), 1,
+                                  data_type);
+    const TensorInfo state(state_shape, 1, data_type);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(input_weights, &input_weights_info, Window::DimY));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(recurrent_weights, &recurrent_weights_info, Window::DimY));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(biases, &biases_info, Window::DimX));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEReshapeLayer::validate(input, &input_2d));
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        NEFullyConnectedLayer::validate(&input_2d, &input_weights_info, &biases_info, &pre_gates));
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuRecurrentStepKernel::validate(
+        &pre_gates_step, &recurrent_weights_info, &state, &coefficients, &state, &state,
+        make_step_info(lstm_params, activation_info, cell_threshold)));
+
+    return Status{};
+}
+
+void NELSTMSequenceLayer::configure(const ITensor             *input,
+                                    const ITensor             *input_to_forget_weights,
+                                    const ITensor             *input_to_cell_weights,
+                                    const ITensor             *input_to_output_weights,
+                                    const ITensor             *recurrent_to_forget_weights,
+                                    const ITensor             *recurrent_to_cell_weights,
+                                    const ITensor             *recurrent_to_output_weights,
+                                    const ITensor             *forget_gate_bias,
+                                    const ITensor             *cell_bias,
+                                    const ITensor             *output_gate_bias,
+                                    const ITensor             *output_state_in,
+                                    const ITensor             *cell_state_in,
+                                    ITensor                   *output,
+                                    ITensor                   *output_state_out,
+                                    ITensor                   *cell_state_out,
+                                    const LSTMParams<ITensor> &lstm_params,
+                                    const ActivationLayerInfo &activation_info,
+                                    float                      cell_threshold)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NELSTMSequenceLayer::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                 recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                 forget_gate_bias, cell_bias, output_gate_bias, output_state_in, cell_state_in, output,
+                                 output_state_out, cell_state_out);
+    ARM_COMPUTE_LOG_PARAMS(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                           recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                           forget_gate_bias, cell_bias, output_gate_bias, output_state_in, cell_state_in, output,
+                           output_state_out, cell_state_out, lstm_params, activation_info, cell_threshold);
+
+    LSTMParams<ITensorInfo> lstm_params_info{};
+    build_lstm_params_tensor_info(lstm_params, &lstm_params_info);
+    ARM_COMPUTE_ERROR_THROW_ON(NELSTMSequenceLayer::validate(
+        input->info(), input_to_forget_weights->info(), input_to_cell_weights->info(), input_to_output_weights->info(),
+        recurrent_to_forget_weights->info(), recurrent_to_cell_weights->info(), recurrent_to_output_weights->info(),
+        forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(), output_state_in->info(),
+        cell_state_in->info(), output->info(), output_state_out->info(), cell_state_out->info(), lstm_params_info,
+        activation_info, cell_threshold));
+
+    const DataType     data_type   = input->info()->data_type();
+    const unsigned int input_size  = input->info()->dimension(0);
+    const unsigned int num_batches = input->info()->dimension(1);
+    const unsigned int num_steps   = input->info()->dimension(2);
+    const unsigned int num_units   = cell_state_in->info()->dimension(0);
+    const unsigned int num_gates   = lstm_params.has_cifg_opt() ? 3 : 4;
+
+    _is_prepared  = false;
+    _has_peephole = lstm_params.has_peephole_opt();
+
+    // Stack the weights and biases of every gate in [input, forget, cell, output] order (the input gate is skipped
+    // with CIFG), so that the input projection of all the gates is a single GEMM
+    std::vector<const ITensor *> input_weights;
+    std::vector<const ITensor *> recurrent_weights;
+    std::vector<const ITensor *> biases;
+    if (!lstm_params.has_cifg_opt())
+    {
+        input_weights.emplace_back(lstm_params.input_to_input_weights());
+        recurrent_weights.emplace_back(lstm_params.recurrent_to_input_weights());
+        biases.emplace_back(lstm_params.input_gate_bias());
+    }
+    input_weights.insert(input_weights.end(),
+                         {input_to_forget_weights, input_to_cell_weights, input_to_output_weights});
+    recurrent_weights.insert(recurrent_weights.end(),
+                             {recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights});
+    biases.insert(biases.end(), {forget_gate_bias, cell_bias, output_gate_bias});
+
+    _concat_input_weights.configure(input_weights, &_input_weights, Window::DimY);
+    _concat_recurrent_weights.configure(recurrent_weights, &_recurrent_weights, Window::DimY);
+    _concat_biases.configure(biases, &_biases, Window::DimX);
+
+    // Compute the input projection of all the gates and all the steps
+    _input_2d.allocator()->init(TensorInfo(TensorShape(input_size, num_batches * num_steps), 1, data_type));
+    _memory_group.manage(&_input_2d);
+    _reshape_input.configure(input, &_input_2d);
+
+    _pre_gates.allocator()->init(
+        TensorInfo(TensorShape(num_units * num_gates, num_batches * num_steps), 1, data_type));
+    _memory_group.manage(&_pre_gates);
+    _fully_connected.configure(&_input_2d, &_input_weights, &_biases, &_pre_gates);
+    _input_2d.allocator()->allocate();
+    _input_weights.allocator()->allocate();
+    _biases.allocator()->allocate();
+    _recurrent_weights.allocator()->allocate();
+
+    // Peephole weights are packed at prepare time into the layout expected by the step kernel
+    _coefficient_sources.fill(nullptr);
+    if (_has_peephole)
+    {
+        _coefficient_sources[static_cast<size_t>(LSTMCellCoefficient::CellToInput)] =
+            lstm_params.has_cifg_opt() ? nullptr : lstm_params.cell_to_input_weights();
+        _coefficient_sources[static_cast<size_t>(LSTMCellCoefficient::CellToForget)] =
+            lstm_params.cell_to_forget_weights();
+        _coefficient_sources[static_cast<size_t>(LSTMCellCoefficient::CellToOutput)] =
+            lstm_params.cell_to_output_weights();
+        _coefficients.allocator()->init(TensorInfo(
+            TensorShape(num_units, static_cast<unsigned int>(LSTMCellCoefficient::Count)), 1, data_type));
+        _coefficients.allocator()->allocate();
+    }
+
+    // The cell state is carried in cell_state_out and updated in place by every step
+    _copy_cell_state.configure(const_cast<ITensor *>(cell_state_in), cell_state_out);
+
+    _step_kernel = std::make_unique<cpu::kernels::CpuRecurrentStepKernel>();
+    _pre_gates_steps.reserve(num_steps);
+    _output_steps.reserve(num_steps);
+    _step_packs.reserve(num_steps);
+    for (unsigned int t = 0; t < num_steps; ++t)
+    {
+        _pre_gates_steps.emplace_back(&_pre_gates, TensorShape(num_units * num_gates, num_batches),
+                                      Coordinates(0, t * num_batches));
+        _output_steps.emplace_back(output, TensorShape(num_units, num_batches), Coordinates(0, 0, t));
+    }
+    _step_kernel->configure(_pre_gates_steps[0].info(), _recurrent_weights.info(), output_state_in->info(),
+                            _has_peephole ? _coefficients.info() : nullptr, cell_state_out->info(),
+                            _output_steps[0].info(), make_step_info(lstm_params, activation_info, cell_threshold));
+
+    for (unsigned int t = 0; t < num_steps; ++t)
+    {
+        ITensorPack pack;
+        pack.add_const_tensor(TensorType::ACL_SRC_0, &_pre_gates_steps[t]);
+        pack.add_const_tensor(TensorType::ACL_SRC_1, &_recurrent_weights);
+        pack.add_const_tensor(TensorType::ACL_SRC_2, t == 0 ? output_state_in : &_output_steps[t - 1]);
+        pack.add_const_tensor(TensorType::ACL_SRC_3, &_coefficients);
+        pack.add_tensor(TensorType::ACL_DST_0, cell_state_out);
+        pack.add_tensor(TensorType::ACL_DST_1, &_output_steps[t]);
+        _step_packs.emplace_back(std::move(pack));
+    }
+    _pre_gates.allocator()->allocate();
+
+    _copy_output_state.configure(&_output_steps.back(), output_state_out);
+}
+
+void NELSTMSequenceLayer::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NELSTMSequenceLayer::run");
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    _reshape_input.run();
+    _fully_connected.run();
+    _copy_cell_state.run();
+
+    // One dispatch per step: the units are split along X, so every thread always processes the same units
+    for (auto &pack : _step_packs)
+    {
+        NEScheduler::get().schedule_op(_step_kernel.get(), Window::DimX, _step_kernel->window(), pack);
+    }
+
+    _copy_output_state.run();
+}
+
+void NELSTMSequenceLayer::prepare()
+{
+    if (!_is_prepared)
+    {
+        _concat_input_weights.run();
+        _concat_recurrent_weights.run();
+        _concat_biases.run();
+
+        _fully_connected.prepare();
+        if (!_input_weights.is_used())
+        {
+            _input_weights.allocator()->free();
+        }
+
+        if (_has_peephole)
+        {
+            // Pack the peephole weights, leaving the unused rows to zero
+            const size_t row_size = _coefficients.info()->dimension(0) * _coefficients.info()->element_size();
+            for (size_t i = 0; i < _coefficient_sources.size(); ++i)
+            {
+                uint8_t *dst = _coefficients.ptr_to_element(Coordinates(0, static_cast<int>(i)));
+                if (_coefficient_sources[i] != nullptr)
+                {
+                    std::memcpy(dst, _coefficient_sources[i]->ptr_to_element(Coordinates(0)), row_size);
+                }
+                else
+                {
+                    std::memset(dst, 0, row_size);
+                }
+            }
+        }
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NERNNSequenceLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/common/utils/profile/acl_profile.h"
+#include "src/cpu/kernels/CpuRecurrentStepKernel.h"
+
+namespace arm_compute
+{
+namespace
+{
+RecurrentStepKernelInfo make_step_info(const ActivationLayerInfo &info)
+{
+    RecurrentStepKernelInfo step_info{};
+    step_info.is_lstm            = false;
+    step_info.cell_info.act_info = info;
+    return step_info;
+}
+} // namespace
+
+NERNNSequenceLayer::~NERNNSequenceLayer() = default;
+
+NERNNSequenceLayer::NERNNSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)),
+      _reshape_input(),
+      _fully_connected(memory_manager),
+      _transpose_recurrent_weights(),
+      _copy_hidden_state(),
+      _step_kernel(),
+      _input_2d(),
+      _pre_gates(),
+      _recurrent_weights_transposed(),
+      _pre_gates_steps(),
+      _output_steps(),
+      _step_packs(),
+      _recurrent_weights(nullptr),
+      _is_prepared(false)
+{
+}
+
+Status NERNNSequenceLayer::validate(const ITensorInfo         *input,
+                                    const ITensorInfo         *weights,
+                                    const ITensorInfo         *recurrent_weights,
+                                    const ITensorInfo         *bias,
+                                    const ITensorInfo         *hidden_state,
+                                    const ITensorInfo         *output,
+                                    const ActivationLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NERNNSequenceLayer::validate");
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, recurrent_weights, bias, hidden_state);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, recurrent_weights, bias, hidden_state, output);
+
+    const size_t input_size  = input->dimension(0);
+    const size_t num_batches = input->dimension(1);
+    const size_t num_steps   = input->dimension(2);
+    const size_t num_units   = weights->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() != 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input_size);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->dimension(1) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->dimension(1) != num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                       TensorShape(num_units, num_batches, num_steps));
+
+    const DataType   data_type = input->data_type();
+    const TensorInfo input_2d(TensorShape(input_size, num_batches * num_steps), 1, data_type);
+    const TensorInfo pre_gates(TensorShape(num_units, num_batches * num_steps), 1, data_type);
+    const TensorInfo pre_gates_step(TensorShape(num_units, num_batches), 1, data_type);
+    const TensorInfo recurrent_weights_transposed(recurrent_weights->clone()->set_is_resizable(true).reset_padding());
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEReshapeLayer::validate(input, &input_2d));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&input_2d, weights, bias, &pre_gates));
+    ARM_COMPUTE_RETURN_ON_ERROR(NETranspose::validate(recurrent_weights, &recurrent_weights_transposed));
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuRecurrentStepKernel::validate(
+        &pre_gates_step, &recurrent_weights_transposed, hidden_state, nullptr, nullptr, hidden_state,
+        make_step_info(info)));
+
+    return Status{};
+}
+
+void NERNNSequenceLayer::configure(const ITensor             *input,
+                                   const ITensor             *weights,
+                                   const ITensor             *recurrent_weights,
+                                   const ITensor             *bias,
+                                   ITensor                   *hidden_state,
+                                   ITensor                   *output,
+                                   const ActivationLayerInfo &info)
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NERNNSequenceLayer::configure");
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NERNNSequenceLayer::validate(input->info(), weights->info(), recurrent_weights->info(),
+                                                            bias->info(), hidden_state->info(), output->info(), info));
+    ARM_COMPUTE_LOG_PARAMS(input, weights, recurrent_weights, bias, hidden_state, output, info);
+
+    const DataType     data_type   = input->info()->data_type();
+    const unsigned int input_size  = input->info()->dimension(0);
+    const unsigned int num_batches = input->info()->dimension(1);
+    const unsigned int num_steps   = input->info()->dimension(2);
+    const unsigned int num_units   = weights->info()->dimension(1);
+
+    _is_prepared       = false;
+    _recurrent_weights = recurrent_weights;
+
+    // Compute the input projection of all the steps with a single GEMM
+    _input_2d.allocator()->init(TensorInfo(TensorShape(input_size, num_batches * num_steps), 1, data_type));
+    _memory_group.manage(&_input_2d);
+    _reshape_input.configure(input, &_input_2d);
+
+    _pre_gates.allocator()->init(TensorInfo(TensorShape(num_units, num_batches * num_steps), 1, data_type));
+    _memory_group.manage(&_pre_gates);
+    _fully_connected.configure(&_input_2d, weights, bias, &_pre_gates);
+    _input_2d.allocator()->allocate();
+
+    // The step kernel reads the recurrent weights one unit per row
+    _transpose_recurrent_weights.configure(recurrent_weights, &_recurrent_weights_transposed);
+
+    _step_kernel = std::make_unique<cpu::kernels::CpuRecurrentStepKernel>();
+    _pre_gates_steps.reserve(num_steps);
+    _output_steps.reserve(num_steps);
+    _step_packs.reserve(num_steps);
+    for (unsigned int t = 0; t < num_steps; ++t)
+    {
+        _pre_gates_steps.emplace_back(&_pre_gates, TensorShape(num_units, num_batches),
+                                      Coordinates(0, t * num_batches));
+        _output_steps.emplace_back(output, TensorShape(num_units, num_batches), Coordinates(0, 0, t));
+    }
+    _step_kernel->configure(_pre_gates_steps[0].info(), _recurrent_weights_transposed.info(), hidden_state->info(),
+                            nullptr, nullptr, _output_steps[0].info(), make_step_info(info));
+
+    for (unsigned int t = 0; t < num_steps; ++t)
+    {
+        ITensorPack pack;
+        pack.add_const_tensor(TensorType::ACL_SRC_0, &_pre_gates_steps[t]);
+        pack.add_const_tensor(TensorType::ACL_SRC_1, &_recurrent_weights_transposed);
+        pack.add_const_tensor(TensorType::ACL_SRC_2, t == 0 ? hidden_state : &_output_steps[t - 1]);
+        pack.add_tensor(TensorType::ACL_DST_1, &_output_steps[t]);
+        _step_packs.emplace_back(std::move(pack));
+    }
+    _pre_gates.allocator()->allocate();
+    _recurrent_weights_transposed.allocator()->allocate();
+
+    // The hidden state is only overwritten once the whole sequence has been processed
+    _copy_hidden_state.configure(&_output_steps.back(), hidden_state);
+}
+
+void NERNNSequenceLayer::run()
+{
+    ARM_COMPUTE_TRACE_EVENT(ARM_COMPUTE_PROF_CAT_CPU, ARM_COMPUTE_PROF_LVL_CPU, "NERNNSequenceLayer::run");
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    _reshape_input.run();
+    _fully_connected.run();
+
+    // One dispatch per step: the units are split along X, so every thread always processes the same units
+    for (auto &pack : _step_packs)
+    {
+        NEScheduler::get().schedule_op(_step_kernel.get(), Window::DimX, _step_kernel->window(), pack);
+    }
+
+    _copy_hidden_state.run();
+}
+
+void NERNNSequenceLayer::prepare()
+{
+    if (!_is_prepared)
+    {
+        _fully_connected.prepare();
+        _transpose_recurrent_weights.run();
+        _recurrent_weights->mark_as_unused();
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,11 +28,58 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/RuntimeProfiler.h"
 
 #include <omp.h>
 
 namespace arm_compute
 {
+namespace
+{
+/** Run the workloads with an OpenMP parallel loop, one workload per thread
+ *
+ * @param[in] workloads   Workloads to run
+ * @param[in] num_threads Number of threads of the OpenMP thread pool
+ * @param[in] cpu_info    CPU info to pass to the workloads
+ */
+template <typename WorkloadType>
+void run_omp_workloads(std::vector<WorkloadType> &workloads, unsigned int num_threads, CPUInfo &cpu_info)
+{
+    const unsigned int amount_of_work     = static_cast<unsigned int>(workloads.size());
+    const unsigned int num_threads_to_use = std::min(num_threads, amount_of_work);
+
+    if (num_threads_to_use < 1)
+    {
+        return;
+    }
+
+    ThreadInfo info;
+    info.cpu_info    = &cpu_info;
+    info.num_threads = num_threads_to_use;
+
+    ARM_COMPUTE_ERROR_ON(amount_of_work > num_threads);
+
+#if !defined(__ANDROID__)
+    // Use fixed number of omp threads in the thread pool because changing this
+    // in-between kernel execution negatively affects the scheduler performance,
+    // possibly switching between X and Y number of threads, causing reconfiguration
+    // of the synchronization mechanism. This has been only tested in a subset of
+    // operating systems, thus we limit the change using guards.
+    const unsigned int omp_num_threads = num_threads;
+#else  /* !__ANDROID__ */
+    const unsigned int omp_num_threads = num_threads_to_use;
+#endif /* __ANDROID__ */
+
+#pragma omp parallel for firstprivate(info) num_threads(omp_num_threads) default(shared) proc_bind(close) \
+    schedule(static, 1)
+    for (unsigned int wid = 0; wid < amount_of_work; ++wid)
+    {
+        info.thread_id = wid;
+        workloads[wid](info);
+    }
+}
+} // namespace
+
 #if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)
 OMPScheduler::OMPScheduler() // NOLINT
@@ -87,6 +134,8 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
     ARM_COMPUTE_ERROR_ON_MSG(hints.strategy() == StrategyHint::DYNAMIC,
                              "Dynamic scheduling is not supported in OMPScheduler");
 
+    RuntimeProfiler::KernelScope profiler_scope(kernel, tensors);
+
     const Window      &max_window     = window;
     const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
     const unsigned int mws            = kernel->get_mws(CPUInfo::get(), _num_threads);
@@ -99,62 +148,41 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
 
     if (!kernel->is_parallelisable() || num_threads == 1)
     {
+        RuntimeProfiler::WorkloadScope workload_scope(kernel);
+
         ThreadInfo info;
         info.cpu_info = &cpu_info();
         kernel->run_op(tensors, max_window, info);
     }
     else
     {
-        const unsigned int                num_windows = num_threads;
-        std::vector<IScheduler::Workload> workloads(num_windows);
+        profiler_scope.set_num_threads(num_threads);
+
+        const unsigned int                 num_windows = num_threads;
+        const RuntimeProfiler::Attribution attribution = RuntimeProfiler::current_attribution();
+        std::vector<KernelWorkload>       &workloads   = thread_kernel_workloads(num_windows);
         for (unsigned int t = 0; t < num_windows; t++)
         {
-            //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
-            {
-                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
-                win.validate();
-                kernel->run_op(tensors, win, info);
-            };
+            KernelWorkload &workload = workloads[t];
+            workload.kernel          = kernel;
+            workload.tensors         = &tensors;
+            workload.is_2d_split     = false;
+            workload.attribution     = attribution;
+            workload.window          = max_window.split_window(hints.split_dimension(), t, num_windows);
+            workload.window.validate();
         }
-        run_workloads(workloads);
+        run_kernel_workloads(workloads);
     }
 }
 #ifndef DOXYGEN_SKIP_THIS
 void OMPScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload> &workloads)
 {
-    const unsigned int amount_of_work     = static_cast<unsigned int>(workloads.size());
-    const unsigned int num_threads_to_use = std::min(_num_threads, amount_of_work);
-
-    if (num_threads_to_use < 1)
-    {
-        return;
-    }
-
-    ThreadInfo info;
-    info.cpu_info    = &cpu_info();
-    info.num_threads = num_threads_to_use;
-
-    ARM_COMPUTE_ERROR_ON(amount_of_work > _num_threads);
-
-#if !defined(__ANDROID__)
-    // Use fixed number of omp threads in the thread pool because changing this
-    // in-between kernel execution negatively affects the scheduler performance,
-    // possibly switching between X and Y number of threads, causing reconfiguration
-    // of the synchronization mechanism. This has been only tested in a subset of
-    // operating systems, thus we limit the change using guards.
-    const unsigned int omp_num_threads = _num_threads;
-#else  /* !__ANDROID__ */
-    const unsigned int omp_num_threads = num_threads_to_use;
-#endif /* __ANDROID__ */
+    run_omp_workloads(workloads, _num_threads, cpu_info());
+}
 
-#pragma omp parallel for firstprivate(info) num_threads(omp_num_threads) default(shared) proc_bind(close) \
-    schedule(static, 1)
-    for (unsigned int wid = 0; wid < amount_of_work; ++wid)
-    {
-        info.thread_id = wid;
-        workloads[wid](info);
-    }
+void OMPScheduler::run_kernel_workloads(std::vector<arm_compute::IScheduler::KernelWorkload> &workloads)
+{
+    run_omp_workloads(workloads, _num_threads, cpu_info());
 }
 #endif /* DOXYGEN_SKIP_THIS */
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,63 +26,136 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IMemoryPool.h"
 
-#include <algorithm>
-#include <list>
-
 using namespace arm_compute;
 
-PoolManager::PoolManager() : _free_pools(), _occupied_pools(), _sem(), _mtx()
+PoolManager::PoolManager()
+    : _pools(),
+      _pool_index(),
+      _occupied(),
+      _available(0),
+      _last_freed(0),
+      _waiters(0),
+      _num_locks(0),
+      _num_contended_locks(0),
+      _num_claim_retries(0),
+      _mtx(),
+      _wait_mtx()
+{
+}
+
+PoolManager::Stats PoolManager::stats() const
+{
+    Stats stats;
+    stats.num_locks           = _num_locks.load(std::memory_order_relaxed);
+    stats.num_contended_locks = _num_contended_locks.load(std::memory_order_relaxed);
+    stats.num_claim_retries   = _num_claim_retries.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void PoolManager::reset_stats()
 {
+    _num_locks.store(0, std::memory_order_relaxed);
+    _num_contended_locks.store(0, std::memory_order_relaxed);
+    _num_claim_retries.store(0, std::memory_order_relaxed);
 }
 
 IMemoryPool *PoolManager::lock_pool()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pools.empty(), "Haven't setup any pools!");
 
-    _sem->wait();
-    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
-    _occupied_pools.splice(std::begin(_occupied_pools), _free_pools, std::begin(_free_pools));
-    return _occupied_pools.front().get();
+    // Reserve one of the free pools, only waiting if all of them are occupied
+    bool contended = false;
+    int  available = _available.load();
+    while (true)
+    {
+        if (available > 0)
+        {
+            if (_available.compare_exchange_weak(available, available - 1))
+            {
+                break;
+            }
+        }
+        else
+        {
+            contended = true;
+            wait_for_pool();
+            available = _available.load();
+        }
+    }
+
+    _num_locks.fetch_add(1, std::memory_order_relaxed);
+    if (contended)
+    {
+        _num_contended_locks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // The reservation guarantees that a pool is free: claim it, starting from the most recently unlocked pool
+    const size_t num_pools = _pools.size();
+    const size_t first     = _last_freed.load(std::memory_order_relaxed);
+    for (size_t i = 0;; ++i)
+    {
+        const size_t idx      = (first + i) % num_pools;
+        bool         occupied = false;
+        if (!_occupied[idx].load(std::memory_order_relaxed) &&
+            _occupied[idx].compare_exchange_strong(occupied, true, std::memory_order_acquire))
+        {
+            return _pools[idx].get();
+        }
+        _num_claim_retries.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 void PoolManager::unlock_pool(IMemoryPool *pool)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pools.empty(), "Haven't setup any pools!");
 
-    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    auto it = std::find_if(std::begin(_occupied_pools), std::end(_occupied_pools),
-                           [pool](const std::unique_ptr<IMemoryPool> &pool_it) { return pool_it.get() == pool; });
-    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
-    _free_pools.splice(std::begin(_free_pools), _occupied_pools, it);
-    _sem->signal();
+    const auto it = _pool_index.find(pool);
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_pool_index), "Pool to be unlocked couldn't be found!");
+    ARM_COMPUTE_ERROR_ON_MSG(!_occupied[it->second].load(), "Pool to be unlocked isn't locked!");
+
+    _occupied[it->second].store(false, std::memory_order_release);
+    _last_freed.store(it->second, std::memory_order_relaxed);
+    _available.fetch_add(1);
+
+    // Wake up a waiter, if any. The mutex is taken so that the notification can't be missed by a waiter
+    // that has checked the number of free pools but hasn't started waiting yet
+    if (_waiters.load() > 0)
+    {
+#ifndef NO_MULTI_THREADING
+        {
+            std::lock_guard<std::mutex> lock(_wait_mtx);
+        }
+        _cv.notify_one();
+#endif /* NO_MULTI_THREADING */
+    }
 }
 
 void PoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to register a new one!");
+    ARM_COMPUTE_ERROR_ON_MSG(_available.load() != static_cast<int>(_pools.size()),
+                             "All pools should be free in order to register a new one!");
 
     // Set pool
-    _free_pools.push_front(std::move(pool));
+    _pool_index[pool.get()] = _pools.size();
+    _pools.push_back(std::move(pool));
 
-    // Update semaphore
-    _sem = std::make_unique<arm_compute::Semaphore>(_free_pools.size());
+    reset_occupancy();
 }
 
 std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to release one!");
+    ARM_COMPUTE_ERROR_ON_MSG(_available.load() != static_cast<int>(_pools.size()),
+                             "All pools should be free in order to release one!");
 
-    if (!_free_pools.empty())
+    if (!_pools.empty())
     {
-        std::unique_ptr<IMemoryPool> pool = std::move(_free_pools.front());
-        ARM_COMPUTE_ERROR_ON(_free_pools.front() != nullptr);
-        _free_pools.pop_front();
+        std::unique_ptr<IMemoryPool> pool = std::move(_pools.back());
+        _pools.pop_back();
+        _pool_index.erase(pool.get());
 
-        // Update semaphore
-        _sem = std::make_unique<arm_compute::Semaphore>(_free_pools.size());
+        reset_occupancy();
 
         return pool;
     }
@@ -93,16 +166,37 @@ std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 void PoolManager::clear_pools()
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to clear the PoolManager!");
-    _free_pools.clear();
+    ARM_COMPUTE_ERROR_ON_MSG(_available.load() != static_cast<int>(_pools.size()),
+                             "All pools should be free in order to clear the PoolManager!");
+    _pools.clear();
+    _pool_index.clear();
 
-    // Update semaphore
-    _sem = nullptr;
+    reset_occupancy();
 }
 
 size_t PoolManager::num_pools() const
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
 
-    return _free_pools.size() + _occupied_pools.size();
+    return _pools.size();
+}
+
+void PoolManager::wait_for_pool()
+{
+#ifndef NO_MULTI_THREADING
+    std::unique_lock<std::mutex> lock(_wait_mtx);
+    ++_waiters;
+    _cv.wait(lock, [this]() { return _available.load() > 0; });
+    --_waiters;
+#else  /* NO_MULTI_THREADING */
+    ARM_COMPUTE_ERROR("All pools are occupied!");
+#endif /* NO_MULTI_THREADING */
+}
+
+void PoolManager::reset_occupancy()
+{
+    // Value-initialized flags mark all the pools as free
+    _occupied = _pools.empty() ? nullptr : std::make_unique<std::atomic<bool>[]>(_pools.size());
+    _available.store(static_cast<int>(_pools.size()));
+    _last_freed.store(_pools.empty() ? 0 : _pools.size() - 1, std::memory_order_relaxed);
 }
@@ -0,0 +1,787 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/RuntimeProfiler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <utility>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace
+{
+constexpr size_t default_buffer_size = 8192;
+/** Bytes transferred by a refill of the last level cache */
+constexpr uint64_t cache_line_size = 64;
+
+/** Layer and group the events of the current thread are attributed to */
+thread_local const char *current_layer = nullptr;
+thread_local uint32_t    current_group = RuntimeProfiler::no_group;
+
+void copy_name(char *dst, const char *src)
+{
+    if (src == nullptr)
+    {
+        dst[0] = '\0';
+        return;
+    }
+    std::strncpy(dst, src, RuntimeProfiler::max_name_length);
+    dst[RuntimeProfiler::max_name_length] = '\0';
+}
+
+const char *event_type_name(RuntimeProfiler::EventType type)
+{
+    switch (type)
+    {
+        case RuntimeProfiler::EventType::Layer:
+            return "layer";
+        case RuntimeProfiler::EventType::Kernel:
+            return "kernel";
+        case RuntimeProfiler::EventType::Workload:
+            return "workload";
+        default:
+            ARM_COMPUTE_ERROR("Unknown event type");
+    }
+}
+
+const char *bound_name(RuntimeProfiler::Bound bound)
+{
+    switch (bound)
+    {
+        case RuntimeProfiler::Bound::Memory:
+            return "memory";
+        case RuntimeProfiler::Bound::Compute:
+            return "compute";
+        case RuntimeProfiler::Bound::Unknown:
+            return "unknown";
+        default:
+            ARM_COMPUTE_ERROR("Unknown bound");
+    }
+}
+
+void write_json_string(std::ostream &os, const char *str)
+{
+    os << '"';
+    for (const char *c = str; *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    os << ' ';
+                }
+                else
+                {
+                    os << *c;
+                }
+        }
+    }
+    os << '"';
+}
+
+void write_csv_field(std::ostream &os, const char *str)
+{
+    if (std::strpbrk(str, ",\"\n") == nullptr)
+    {
+        os << str;
+        return;
+    }
+    os << '"';
+    for (const char *c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"')
+        {
+            os << '"';
+        }
+        os << *c;
+    }
+    os << '"';
+}
+
+/** Write a duration in nanoseconds as microseconds, the unit of the Chrome trace event format */
+void write_us(std::ostream &os, uint64_t ns)
+{
+    const uint64_t frac = ns % 1000;
+    os << ns / 1000 << '.' << (frac < 100 ? "0" : "") << (frac < 10 ? "0" : "") << frac;
+}
+
+RuntimeProfiler::PmuCounts operator-(const RuntimeProfiler::PmuCounts &a, const RuntimeProfiler::PmuCounts &b)
+{
+    RuntimeProfiler::PmuCounts counts{};
+    counts.cycles                = a.cycles - b.cycles;
+    counts.instructions          = a.instructions - b.instructions;
+    counts.l1d_misses            = a.l1d_misses - b.l1d_misses;
+    counts.l2d_misses            = a.l2d_misses - b.l2d_misses;
+    counts.llc_misses            = a.llc_misses - b.llc_misses;
+    counts.stall_frontend_cycles = a.stall_frontend_cycles - b.stall_frontend_cycles;
+    counts.stall_backend_cycles  = a.stall_backend_cycles - b.stall_backend_cycles;
+    return counts;
+}
+
+RuntimeProfiler::PmuCounts &operator+=(RuntimeProfiler::PmuCounts &a, const RuntimeProfiler::PmuCounts &b)
+{
+    a.cycles += b.cycles;
+    a.instructions += b.instructions;
+    a.l1d_misses += b.l1d_misses;
+    a.l2d_misses += b.l2d_misses;
+    a.llc_misses += b.llc_misses;
+    a.stall_frontend_cycles += b.stall_frontend_cycles;
+    a.stall_backend_cycles += b.stall_backend_cycles;
+    return a;
+}
+
+#if defined(__linux__) && !defined(BARE_METAL)
+/** Group of PMU counters measuring the calling thread
+ *
+ * The counters are opened as a single perf event group, led by the cycle counter, so they are scheduled together
+ * and read with a single system call. Counters the CPU does not support, or that do not fit in the group, are skipped.
+ */
+class PmuCounters
+{
+public:
+    PmuCounters()
+    {
+        _fds.fill(-1);
+        _slots.fill(-1);
+
+        constexpr uint64_t cache_read_miss =
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const std::array<std::pair<uint32_t, uint64_t>, num_counters> configs = {{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | cache_read_miss},
+#if defined(__aarch64__) || defined(__arm__)
+            // There is no generic L2 event, use the L2D_CACHE_REFILL event of the Arm architecture
+            {PERF_TYPE_RAW, 0x17},
+#else  /* defined(__aarch64__) || defined(__arm__) */
+            {PERF_TYPE_MAX, 0},
+#endif /* defined(__aarch64__) || defined(__arm__) */
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | cache_read_miss},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND},
+        }};
+
+        int num_open = 0;
+        for (size_t i = 0; i < num_counters; ++i)
+        {
+            if (configs[i].first == PERF_TYPE_MAX)
+            {
+                continue;
+            }
+
+            perf_event_attr attr{};
+            attr.type           = configs[i].first;
+            attr.size           = sizeof(perf_event_attr);
+            attr.config         = configs[i].second;
+            attr.read_format    = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+
+            // Measure the calling thread on any CPU
+            const int leader = _fds[0];
+            const int fd     = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+            if (fd < 0)
+            {
+                if (i == 0)
+                {
+                    // Without the cycle counter leading the group no counter is available
+                    return;
+                }
+                continue;
+            }
+            _fds[i]   = fd;
+            _slots[i] = num_open++;
+        }
+        ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    PmuCounters(const PmuCounters &)            = delete;
+    PmuCounters &operator=(const PmuCounters &) = delete;
+
+    ~PmuCounters()
+    {
+        // Close the members before the leader of the group
+        for (size_t i = num_counters; i > 0; --i)
+        {
+            if (_fds[i - 1] >= 0)
+            {
+                close(_fds[i - 1]);
+            }
+        }
+    }
+
+    bool read_counts(RuntimeProfiler::PmuCounts &counts) const
+    {
+        if (_fds[0] < 0)
+        {
+            return false;
+        }
+
+        // Layout of a group read: number of counters followed by their values, in the order they were opened
+        std::array<uint64_t, num_counters + 1> values{};
+        if (::read(_fds[0], values.data(), sizeof(values)) <= 0)
+        {
+            return false;
+        }
+
+        const auto value = [&](size_t counter) -> uint64_t
+        { return _slots[counter] >= 0 ? values[1 + _slots[counter]] : 0; };
+        counts.cycles                = value(0);
+        counts.instructions          = value(1);
+        counts.l1d_misses            = value(2);
+        counts.l2d_misses            = value(3);
+        counts.llc_misses            = value(4);
+        counts.stall_frontend_cycles = value(5);
+        counts.stall_backend_cycles  = value(6);
+        return true;
+    }
+
+private:
+    static constexpr size_t num_counters = 7;
+
+    std::array<int, num_counters> _fds{};
+    std::array<int, num_counters> _slots{};
+};
+
+bool read_pmu_counts(RuntimeProfiler::PmuCounts &counts)
+{
+    static thread_local PmuCounters counters;
+    return counters.read_counts(counts);
+}
+#else  /* defined(__linux__) && !defined(BARE_METAL) */
+bool read_pmu_counts(RuntimeProfiler::PmuCounts &counts)
+{
+    ARM_COMPUTE_UNUSED(counts);
+    return false;
+}
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+} // namespace
+
+struct RuntimeProfiler::ThreadBuffer
+{
+    ThreadBuffer(uint32_t index, size_t size) : index(index), events(size)
+    {
+    }
+
+    uint32_t              index;
+    std::vector<Event>    events;
+    std::atomic<uint64_t> count{0};
+    std::atomic<bool>     in_use{true};
+};
+
+struct RuntimeProfiler::ThreadBufferHandle
+{
+    ~ThreadBufferHandle()
+    {
+        // The buffer is kept, along with its events, and handed over to the next thread that records events
+        if (buffer != nullptr)
+        {
+            buffer->in_use.store(false, std::memory_order_release);
+        }
+    }
+
+    ThreadBuffer *buffer{nullptr};
+};
+
+RuntimeProfiler::LayerScope::LayerScope(const char *name, uint32_t group)
+    : _enabled(RuntimeProfiler::get().is_enabled()), _group(group)
+{
+    if (_enabled)
+    {
+        copy_name(_name, name);
+        _prev_layer   = current_layer;
+        _prev_group   = current_group;
+        current_layer = _name;
+        current_group = group;
+        _start        = RuntimeProfiler::get().now();
+    }
+}
+
+RuntimeProfiler::LayerScope::~LayerScope()
+{
+    if (_enabled)
+    {
+        RuntimeProfiler &profiler = RuntimeProfiler::get();
+
+        Event event{};
+        event.type        = EventType::Layer;
+        event.group       = _group;
+        event.start_ns    = _start;
+        event.duration_ns = profiler.now() - _start;
+        copy_name(event.name, _name);
+        copy_name(event.layer, _prev_layer);
+        profiler.record(event);
+
+        current_layer = _prev_layer;
+        current_group = _prev_group;
+    }
+}
+
+RuntimeProfiler::KernelScope::KernelScope(const ICPPKernel *kernel, const ITensorPack &tensors)
+    : _kernel(kernel), _tensors(&tensors), _enabled(RuntimeProfiler::get().is_enabled())
+{
+    if (_enabled)
+    {
+        _start = RuntimeProfiler::get().now();
+    }
+}
+
+RuntimeProfiler::KernelScope::~KernelScope()
+{
+    if (_enabled)
+    {
+        RuntimeProfiler &profiler = RuntimeProfiler::get();
+
+        Event event{};
+        event.type        = EventType::Kernel;
+        event.group       = current_group;
+        event.num_threads = _num_threads;
+        event.start_ns    = _start;
+        event.duration_ns = profiler.now() - _start;
+        event.bytes       = _tensors->empty() ? _kernel->get_configured_tensors_size() : _tensors->total_size();
+        event.flops       = _kernel->get_flop_count(*_tensors);
+        copy_name(event.name, _kernel->name());
+        copy_name(event.layer, current_layer);
+        profiler.record(event);
+    }
+}
+
+RuntimeProfiler::WorkloadScope::WorkloadScope(const ICPPKernel *kernel, const Attribution &attribution)
+    : _kernel(kernel), _attribution(attribution), _enabled(RuntimeProfiler::get().is_enabled())
+{
+    if (_enabled)
+    {
+        RuntimeProfiler &profiler = RuntimeProfiler::get();
+
+        _pmu   = profiler.is_pmu_enabled() && read_pmu_counts(_counts);
+        _start = profiler.now();
+    }
+}
+
+RuntimeProfiler::WorkloadScope::~WorkloadScope()
+{
+    if (_enabled)
+    {
+        RuntimeProfiler &profiler = RuntimeProfiler::get();
+
+        Event event{};
+        event.type        = EventType::Workload;
+        event.group       = _attribution.group;
+        event.start_ns    = _start;
+        event.duration_ns = profiler.now() - _start;
+
+        PmuCounts counts{};
+        if (_pmu && read_pmu_counts(counts))
+        {
+            event.pmu = counts - _counts;
+        }
+        copy_name(event.name, _kernel->name());
+        copy_name(event.layer, _attribution.layer);
+        profiler.record(event);
+    }
+}
+
+RuntimeProfiler::Attribution RuntimeProfiler::current_attribution()
+{
+    Attribution attribution{};
+    attribution.layer = current_layer;
+    attribution.group = current_group;
+    return attribution;
+}
+
+RuntimeProfiler &RuntimeProfiler::get()
+{
+    // Never destroyed, as worker threads can outlive static objects and hand their buffers back at exit
+    static RuntimeProfiler *profiler = new RuntimeProfiler();
+    return *profiler;
+}
+
+RuntimeProfiler::RuntimeProfiler() : _buffer_size(default_buffer_size), _epoch(0)
+{
+    _epoch = now();
+    const std::string mode = utility::getenv("ARM_COMPUTE_RUNTIME_PROFILER");
+    _enabled.store(mode == "1" || mode == "pmu", std::memory_order_relaxed);
+    _pmu_enabled.store(mode == "pmu", std::memory_order_relaxed);
+}
+
+RuntimeProfiler::~RuntimeProfiler() = default;
+
+uint64_t RuntimeProfiler::now() const
+{
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+    return static_cast<uint64_t>(ns.count()) - _epoch;
+}
+
+void RuntimeProfiler::set_enabled(bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void RuntimeProfiler::set_pmu_enabled(bool enabled)
+{
+    _pmu_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void RuntimeProfiler::set_buffer_size(size_t num_events)
+{
+    ARM_COMPUTE_ERROR_ON(num_events == 0);
+    std::lock_guard<std::mutex> lock(_mtx);
+    _buffer_size = num_events;
+}
+
+void RuntimeProfiler::clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    for (auto &buffer : _buffers)
+    {
+        buffer->events.assign(_buffer_size, Event{});
+        buffer->count.store(0, std::memory_order_release);
+    }
+}
+
+RuntimeProfiler::ThreadBuffer &RuntimeProfiler::thread_buffer()
+{
+    static thread_local ThreadBufferHandle handle;
+    if (handle.buffer == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        for (auto &buffer : _buffers)
+        {
+            bool in_use = false;
+            if (buffer->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+            {
+                handle.buffer = buffer.get();
+                break;
+            }
+        }
+        if (handle.buffer == nullptr)
+        {
+            _buffers.emplace_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(_buffers.size()), _buffer_size));
+            handle.buffer = _buffers.back().get();
+        }
+    }
+    return *handle.buffer;
+}
+
+void RuntimeProfiler::record(const Event &event)
+{
+    ThreadBuffer  &buffer = thread_buffer();
+    const uint64_t count  = buffer.count.load(std::memory_order_relaxed);
+    Event         &slot   = buffer.events[count % buffer.events.size()];
+    slot                  = event;
+    slot.thread           = buffer.index;
+    buffer.count.store(count + 1, std::memory_order_release);
+}
+
+std::vector<RuntimeProfiler::Event> RuntimeProfiler::events() const
+{
+    std::vector<Event> events;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        for (const auto &buffer : _buffers)
+        {
+            const uint64_t count = buffer->count.load(std::memory_order_acquire);
+            const uint64_t size  = buffer->events.size();
+            for (uint64_t i = count > size ? count - size : 0; i < count; ++i)
+            {
+                events.push_back(buffer->events[i % size]);
+            }
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const Event &a, const Event &b) { return a.start_ns < b.start_ns; });
+    return events;
+}
+
+std::vector<RuntimeProfiler::Stats> RuntimeProfiler::summary(EventType type, uint32_t group, const char *layer) const
+{
+    const std::vector<Event> all_events = events();
+
+    const auto is_filtered_out = [&](const Event &event)
+    {
+        return (group != no_group && event.group != group) ||
+               (layer != nullptr && std::strncmp(event.layer, layer, max_name_length) != 0);
+    };
+
+    // Time spent by the threads running the workloads of each kernel, and time they were allotted
+    std::map<std::string, std::pair<uint64_t, uint64_t>> kernel_busy_allotted;
+    if (type == EventType::Kernel)
+    {
+        for (const auto &event : all_events)
+        {
+            if (is_filtered_out(event))
+            {
+                continue;
+            }
+            if (event.type == EventType::Workload)
+            {
+                kernel_busy_allotted[event.name].first += event.duration_ns;
+            }
+            else if (event.type == EventType::Kernel)
+            {
+                kernel_busy_allotted[event.name].second += event.duration_ns * event.num_threads;
+            }
+        }
+    }
+
+    std::map<std::string, Stats> stats;
+    for (const auto &event : all_events)
+    {
+        if (event.type != type || is_filtered_out(event))
+        {
+            continue;
+        }
+
+        Stats &entry = stats[event.name];
+        if (entry.count == 0)
+        {
+            entry.type   = type;
+            entry.name   = event.name;
+            entry.min_ns = event.duration_ns;
+        }
+        entry.count += 1;
+        entry.total_ns += event.duration_ns;
+        entry.min_ns = std::min(entry.min_ns, event.duration_ns);
+        entry.max_ns = std::max(entry.max_ns, event.duration_ns);
+        entry.bytes += event.bytes;
+    }
+
+    std::vector<Stats> result;
+    result.reserve(stats.size());
+    for (auto &entry : stats)
+    {
+        const auto it = kernel_busy_allotted.find(entry.first);
+        if (it != kernel_busy_allotted.end() && it->second.second != 0)
+        {
+            entry.second.utilization =
+                std::min(1.0, static_cast<double>(it->second.first) / static_cast<double>(it->second.second));
+        }
+        result.push_back(std::move(entry.second));
+    }
+    std::sort(result.begin(), result.end(), [](const Stats &a, const Stats &b) { return a.total_ns > b.total_ns; });
+    return result;
+}
+
+std::vector<RuntimeProfiler::RooflineStats>
+RuntimeProfiler::roofline(const RooflineInfo &info, uint32_t group, const char *layer) const
+{
+    ARM_COMPUTE_ERROR_ON(info.peak_gflops <= 0.0 || info.peak_bandwidth_gbps <= 0.0);
+
+    const double ridge_point = info.peak_gflops / info.peak_bandwidth_gbps;
+
+    std::map<std::string, RooflineStats> stats;
+    for (const auto &event : events())
+    {
+        if ((event.type != EventType::Kernel && event.type != EventType::Workload) ||
+            (group != no_group && event.group != group) ||
+            (layer != nullptr && std::strncmp(event.layer, layer, max_name_length) != 0))
+        {
+            continue;
+        }
+
+        RooflineStats &entry = stats[event.name];
+        entry.name           = event.name;
+        if (event.type == EventType::Kernel)
+        {
+            entry.count += 1;
+            entry.total_ns += event.duration_ns;
+            entry.flops += event.flops;
+            entry.bytes += event.bytes;
+        }
+        else
+        {
+            entry.pmu += event.pmu;
+        }
+    }
+
+    std::vector<RooflineStats> result;
+    result.reserve(stats.size());
+    for (auto &it : stats)
+    {
+        RooflineStats &entry = it.second;
+        if (entry.count == 0)
+        {
+            // Workloads whose kernel event has been overwritten
+            continue;
+        }
+        if (entry.flops == 0 || entry.bytes == 0)
+        {
+            // The kernel does not report its number of operations, or the bytes of its tensors are unknown, e.g. it
+            // was scheduled without a tensor pack. An intensity of 0 would wrongly classify it as memory-bound.
+            entry.bound = Bound::Unknown;
+            result.push_back(std::move(entry));
+            continue;
+        }
+
+        // Operations per nanosecond are GFLOP/s
+        entry.gflops    = entry.total_ns != 0 ? static_cast<double>(entry.flops) / entry.total_ns : 0.0;
+        entry.intensity = static_cast<double>(entry.flops) / entry.bytes;
+        entry.dram_intensity =
+            entry.pmu.llc_misses != 0 ? static_cast<double>(entry.flops) / (entry.pmu.llc_misses * cache_line_size)
+                                      : 0.0;
+        entry.attainable_gflops = std::min(info.peak_gflops, entry.intensity * info.peak_bandwidth_gbps);
+        entry.efficiency        = entry.attainable_gflops > 0.0 ? entry.gflops / entry.attainable_gflops : 0.0;
+        entry.bound             = entry.intensity < ridge_point ? Bound::Memory : Bound::Compute;
+        result.push_back(std::move(entry));
+    }
+    std::sort(result.begin(), result.end(),
+              [](const RooflineStats &a, const RooflineStats &b) { return a.total_ns > b.total_ns; });
+    return result;
+}
+
+std::vector<RuntimeProfiler::Stats>
+RuntimeProfiler::profile(IFunction &function, const char *name, unsigned int iterations)
+{
+    const bool was_enabled = _enabled.exchange(true);
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        LayerScope scope(name);
+        function.run();
+    }
+    _enabled.store(was_enabled);
+    return summary(EventType::Kernel, no_group, name);
+}
+
+void RuntimeProfiler::write_chrome_trace(std::ostream &os) const
+{
+    const std::vector<Event> all_events = events();
+
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto &event : all_events)
+    {
+        os << (first ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(os, event.name);
+        os << ",\"cat\":\"" << event_type_name(event.type) << "\",\"ph\":\"X\",\"ts\":";
+        write_us(os, event.start_ns);
+        os << ",\"dur\":";
+        write_us(os, event.duration_ns);
+        os << ",\"pid\":0,\"tid\":" << event.thread << ",\"args\":{\"layer\":";
+        write_json_string(os, event.layer);
+        if (event.group != no_group)
+        {
+            os << ",\"group\":" << event.group;
+        }
+        if (event.type == EventType::Kernel)
+        {
+            os << ",\"bytes\":" << event.bytes << ",\"threads\":" << event.num_threads;
+            if (event.flops != 0)
+            {
+                os << ",\"flops\":" << event.flops;
+            }
+        }
+        else if (event.type == EventType::Workload && event.pmu.cycles != 0)
+        {
+            os << ",\"cycles\":" << event.pmu.cycles << ",\"instructions\":" << event.pmu.instructions
+               << ",\"l1d_misses\":" << event.pmu.l1d_misses << ",\"l2d_misses\":" << event.pmu.l2d_misses
+               << ",\"llc_misses\":" << event.pmu.llc_misses
+               << ",\"stall_frontend_cycles\":" << event.pmu.stall_frontend_cycles
+               << ",\"stall_backend_cycles\":" << event.pmu.stall_backend_cycles;
+        }
+        os << "}}";
+        first = false;
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void RuntimeProfiler::write_csv(std::ostream &os) const
+{
+    os << "type,name,layer,group,thread,start_ns,duration_ns,bytes,threads,flops,cycles,instructions,l1d_misses,"
+          "l2d_misses,llc_misses,stall_frontend_cycles,stall_backend_cycles\n";
+    for (const auto &event : events())
+    {
+        os << event_type_name(event.type) << ',';
+        write_csv_field(os, event.name);
+        os << ',';
+        write_csv_field(os, event.layer);
+        os << ',';
+        if (event.group != no_group)
+        {
+            os << event.group;
+        }
+        os << ',' << event.thread << ',' << event.start_ns << ',' << event.duration_ns << ',' << event.bytes << ','
+           << event.num_threads << ',' << event.flops << ',' << event.pmu.cycles << ',' << event.pmu.instructions << ','
+           << event.pmu.l1d_misses << ',' << event.pmu.l2d_misses << ',' << event.pmu.llc_misses << ','
+           << event.pmu.stall_frontend_cycles << ',' << event.pmu.stall_backend_cycles << '\n';
+    }
+}
+
+void RuntimeProfiler::write_csv(std::ostream &os, const std::vector<Stats> &stats)
+{
+    os << "type,name,count,total_ns,min_ns,max_ns,avg_ns,bytes,utilization\n";
+    for (const auto &entry : stats)
+    {
+        os << event_type_name(entry.type) << ',';
+        write_csv_field(os, entry.name.c_str());
+        os << ',' << entry.count << ',' << entry.total_ns << ',' << entry.min_ns << ',' << entry.max_ns << ','
+           << (entry.count != 0 ? entry.total_ns / entry.count : 0) << ',' << entry.bytes << ',' << entry.utilization
+           << '\n';
+    }
+}
+
+void RuntimeProfiler::write_csv(std::ostream &os, const std::vector<RooflineStats> &stats)
+{
+    os << "name,count,total_ns,flops,bytes,gflops,intensity,dram_intensity,attainable_gflops,efficiency,bound,cycles,"
+          "instructions,ipc,l1d_misses,l2d_misses,llc_misses,stall_frontend_cycles,stall_backend_cycles\n";
+    for (const auto &entry : stats)
+    {
+        const double ipc =
+            entry.pmu.cycles != 0 ? static_cast<double>(entry.pmu.instructions) / entry.pmu.cycles : 0.0;
+
+        write_csv_field(os, entry.name.c_str());
+        os << ',' << entry.count << ',' << entry.total_ns << ',' << entry.flops << ',' << entry.bytes << ','
+           << entry.gflops << ',' << entry.intensity << ',' << entry.dram_intensity << ',' << entry.attainable_gflops
+           << ',' << entry.efficiency << ',' << bound_name(entry.bound) << ','
+           << entry.pmu.cycles << ',' << entry.pmu.instructions << ',' << ipc << ',' << entry.pmu.l1d_misses << ','
+           << entry.pmu.l2d_misses << ',' << entry.pmu.llc_misses << ',' << entry.pmu.stall_frontend_cycles << ','
+           << entry.pmu.stall_backend_cycles << '\n';
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "src/cpu/operators/CpuQKVRoPE.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/experimental/operators/CpuQKVRoPE.h"
+
+namespace arm_compute
+{
+namespace experimental
+{
+namespace op
+{
+struct CpuQKVRoPE::Impl
+{
+    std::unique_ptr<cpu::CpuQKVRoPE> op{nullptr};
+};
+
+CpuQKVRoPE::CpuQKVRoPE() : impl_(std::make_unique<Impl>())
+{
+}
+CpuQKVRoPE::~CpuQKVRoPE() = default;
+
+void CpuQKVRoPE::configure(const ITensorInfo *qkv,
+                           const ITensorInfo *positions,
+                           ITensorInfo       *q,
+                           ITensorInfo       *k,
+                           ITensorInfo       *v,
+                           const RoPEInfo    &info)
+{
+    impl_->op = std::make_unique<cpu::CpuQKVRoPE>();
+    impl_->op->configure(qkv, positions, q, k, v, info);
+}
+
+Status CpuQKVRoPE::validate(const ITensorInfo *qkv,
+                            const ITensorInfo *positions,
+                            const ITensorInfo *q,
+                            const ITensorInfo *k,
+                            const ITensorInfo *v,
+                            const RoPEInfo    &info)
+{
+    return cpu::CpuQKVRoPE::validate(qkv, positions, q, k, v, info);
+}
+
+void CpuQKVRoPE::run(ITensorPack &tensors)
+{
+    impl_->op->run(tensors);
+}
+
+} // namespace op
+} // namespace experimental
+} // namespace arm_compute
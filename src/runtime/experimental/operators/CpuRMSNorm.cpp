@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "src/cpu/operators/CpuRMSNorm.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/experimental/operators/CpuRMSNorm.h"
+
+namespace arm_compute
+{
+namespace experimental
+{
+namespace op
+{
+struct CpuRMSNorm::Impl
+{
+    std::unique_ptr<cpu::CpuRMSNorm> op{nullptr};
+};
+
+CpuRMSNorm::CpuRMSNorm() : impl_(std::make_unique<Impl>())
+{
+}
+CpuRMSNorm::~CpuRMSNorm() = default;
+
+void CpuRMSNorm::configure(const ITensorInfo *src,
+                           const ITensorInfo *residual,
+                           const ITensorInfo *gamma,
+                           ITensorInfo       *dst,
+                           ITensorInfo       *residual_out,
+                           float              epsilon)
+{
+    impl_->op = std::make_unique<cpu::CpuRMSNorm>();
+    impl_->op->configure(src, residual, gamma, dst, residual_out, epsilon);
+}
+
+Status CpuRMSNorm::validate(const ITensorInfo *src,
+                            const ITensorInfo *residual,
+                            const ITensorInfo *gamma,
+                            const ITensorInfo *dst,
+                            const ITensorInfo *residual_out,
+                            float              epsilon)
+{
+    return cpu::CpuRMSNorm::validate(src, residual, gamma, dst, residual_out, epsilon);
+}
+
+void CpuRMSNorm::run(ITensorPack &tensors)
+{
+    impl_->op->run(tensors);
+}
+
+} // namespace op
+} // namespace experimental
+} // namespace arm_compute
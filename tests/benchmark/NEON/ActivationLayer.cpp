@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/ActivationLayerFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+/** 1D shapes with a fixed element count, so the reported time divided by the count gives the cost per element */
+const auto element_counts =
+    framework::dataset::make("Shape", {TensorShape(4096U), TensorShape(262144U), TensorShape(4194304U)});
+
+/** Activations built on the transcendental routines of the SIMD math library */
+const auto transcendental_functions =
+    framework::dataset::make("ActivationInfo",
+                             {ActivationLayerInfo(ActivationFunction::LOGISTIC),
+                              ActivationLayerInfo(ActivationFunction::TANH, 1.f, 1.f),
+                              ActivationLayerInfo(ActivationFunction::SWISH, 1.f),
+                              ActivationLayerInfo(ActivationFunction::GELU),
+                              ActivationLayerInfo(ActivationFunction::ELU, 1.f),
+                              ActivationLayerInfo(ActivationFunction::SOFT_RELU)});
+
+/** Activations with a fast accuracy tier */
+const auto fast_math_functions = framework::dataset::make("ActivationInfo",
+                                                          {ActivationLayerInfo(ActivationFunction::LOGISTIC),
+                                                           ActivationLayerInfo(ActivationFunction::TANH, 1.f, 1.f),
+                                                           ActivationLayerInfo(ActivationFunction::SWISH, 1.f),
+                                                           ActivationLayerInfo(ActivationFunction::ELU, 1.f),
+                                                           ActivationLayerInfo(ActivationFunction::SOFT_RELU)});
+} // namespace
+
+using NEActivationLayerFixture = ActivationLayerFixture<Tensor, NEActivationLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(ActivationLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunFloat,
+                                NEActivationLayerFixture,
+                                framework::DatasetMode::PRECOMMIT,
+                                combine(combine(combine(element_counts, transcendental_functions),
+                                                framework::dataset::make("FastMath", {false})),
+                                        framework::dataset::make("DataType", {DataType::F32})));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunFloatFastMath,
+                                NEActivationLayerFixture,
+                                framework::DatasetMode::PRECOMMIT,
+                                combine(combine(combine(element_counts, fast_math_functions),
+                                                framework::dataset::make("FastMath", {true})),
+                                        framework::dataset::make("DataType", {DataType::F32})));
+#ifdef ARM_COMPUTE_ENABLE_FP16
+REGISTER_FIXTURE_DATA_TEST_CASE(RunHalf,
+                                NEActivationLayerFixture,
+                                framework::DatasetMode::PRECOMMIT,
+                                combine(combine(combine(element_counts, transcendental_functions),
+                                                framework::dataset::make("FastMath", {false})),
+                                        framework::dataset::make("DataType", {DataType::F16})));
+#endif // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // ActivationLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
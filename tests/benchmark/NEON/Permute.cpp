@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEPermute.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/PermuteFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+using framework::dataset::make;
+
+// Layout changes found at model boundaries: NCHW <-> NHWC and the 2D transpose handled by the transpose kernel
+const auto LayoutPermutes = zip(make("Shape",
+                                     {
+                                         TensorShape(56U, 56U, 64U, 4U),
+                                         TensorShape(64U, 56U, 56U, 4U),
+                                         TensorShape(1024U, 1024U),
+                                     }),
+                                make("PermutationVector",
+                                     {
+                                         PermutationVector(2U, 0U, 1U),
+                                         PermutationVector(1U, 2U, 0U),
+                                         PermutationVector(1U, 0U),
+                                     }));
+
+// Attention head split/merge: [head_dim, heads, seq, batch] <-> [head_dim, seq, heads, batch] and the 5D/6D variants
+// used when the QKV projections or the spatial windows are kept in their own dimensions
+const auto AttentionPermutes = zip(make("Shape",
+                                        {
+                                            TensorShape(64U, 12U, 384U, 2U),
+                                            TensorShape(64U, 384U, 12U, 2U),
+                                            TensorShape(64U, 3U, 12U, 384U, 2U),
+                                            TensorShape(16U, 16U, 8U, 8U, 12U, 2U),
+                                        }),
+                                   make("PermutationVector",
+                                        {
+                                            PermutationVector(0U, 2U, 1U, 3U),
+                                            PermutationVector(1U, 0U, 2U, 3U),
+                                            PermutationVector(0U, 3U, 2U, 1U, 4U),
+                                            PermutationVector(2U, 0U, 3U, 1U, 4U, 5U),
+                                        }));
+} // namespace
+
+using NEPermuteFixture = PermuteFixture<Tensor, NEPermute, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(Permute)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLayout,
+                                NEPermuteFixture,
+                                framework::DatasetMode::ALL,
+                                combine(LayoutPermutes, make("DataType", {DataType::U8, DataType::F16, DataType::F32})));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunAttention,
+                                NEPermuteFixture,
+                                framework::DatasetMode::ALL,
+                                combine(AttentionPermutes, make("DataType", {DataType::F16, DataType::F32})));
+TEST_SUITE_END() // Permute
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/benchmark/fixtures/PoolManagerFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+#if !defined(NO_MULTI_THREADING) && !defined(BARE_METAL)
+namespace
+{
+using framework::dataset::make;
+
+// One request thread per function instance, sharing from a single pool up to one pool per thread
+const auto ConcurrentAcquirers = combine(make("Threads", {2U, 8U, 32U}), make("Pools", {1U, 4U, 32U}));
+} // namespace
+
+using NEPoolManagerFixture = PoolManagerFixture<Tensor, Allocator>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(PoolManager)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunConcurrentAcquire,
+                                NEPoolManagerFixture,
+                                framework::DatasetMode::ALL,
+                                ConcurrentAcquirers);
+TEST_SUITE_END() // PoolManager
+TEST_SUITE_END() // Neon
+#endif           // !defined(NO_MULTI_THREADING) && !defined(BARE_METAL)
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_POOLMANAGERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_POOLMANAGERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/PoolManager.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture timing concurrent memory group acquires and releases over a shared set of pools
+ *
+ * Each thread owns a memory group managing one tensor, as a function instance run by its own request thread would,
+ * and repeatedly acquires and releases it. With fewer pools than threads, acquirers contend for the free pools.
+ */
+template <typename TensorType, typename Allocator>
+class PoolManagerFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int num_threads, unsigned int num_pools)
+    {
+        lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+        pool_mgr     = std::make_shared<PoolManager>();
+        memory_mgr   = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+        tensors.resize(num_threads);
+        for (unsigned int t = 0; t < num_threads; ++t)
+        {
+            groups.emplace_back(std::make_unique<MemoryGroup>(memory_mgr));
+            tensors[t] = create_tensor<TensorType>(TensorShape(64U, 64U), DataType::F32);
+            groups[t]->manage(&tensors[t]);
+            tensors[t].allocator()->allocate();
+        }
+
+        memory_mgr->populate(allocator, num_pools);
+    }
+
+    void run()
+    {
+        std::vector<std::thread> threads;
+        for (auto &group : groups)
+        {
+            MemoryGroup *memory_group = group.get();
+            threads.emplace_back(
+                [memory_group]()
+                {
+                    for (unsigned int i = 0; i < num_iterations; ++i)
+                    {
+                        memory_group->acquire();
+                        memory_group->release();
+                    }
+                });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        memory_mgr->clear();
+        groups.clear();
+        tensors.clear();
+    }
+
+private:
+    static constexpr unsigned int num_iterations = 1000;
+
+    Allocator                                 allocator{};
+    std::shared_ptr<BlobLifetimeManager>      lifetime_mgr{nullptr};
+    std::shared_ptr<PoolManager>              pool_mgr{nullptr};
+    std::shared_ptr<MemoryManagerOnDemand>    memory_mgr{nullptr};
+    std::vector<std::unique_ptr<MemoryGroup>> groups{};
+    std::vector<TensorType>                   tensors{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_POOLMANAGERFIXTURE_H
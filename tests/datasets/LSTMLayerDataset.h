@@ -202,6 +202,24 @@ public:
     }
 };
 
+/** Configurations supported by the fused cell path of @ref NELSTMLayer, with and without CIFG */
+class FusedCellLSTMLayerDataset final : public LSTMLayerDataset
+{
+public:
+    FusedCellLSTMLayerDataset()
+    {
+        add_config(TensorShape(8U, 3U), TensorShape(8U, 16U), TensorShape(16U, 16U), TensorShape(16U),
+                   TensorShape(16U, 3U), TensorShape(16U, 3U), TensorShape(64U, 3U),
+                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f), 0.f, 0.f);
+        add_config(TensorShape(8U, 3U), TensorShape(8U, 16U), TensorShape(16U, 16U), TensorShape(16U),
+                   TensorShape(16U, 3U), TensorShape(16U, 3U), TensorShape(64U, 3U),
+                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC), 0.5f, 0.93f);
+        add_config(TensorShape(8U, 3U), TensorShape(8U, 16U), TensorShape(16U, 16U), TensorShape(16U),
+                   TensorShape(16U, 3U), TensorShape(16U, 3U), TensorShape(48U, 3U),
+                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f), 0.05f, 0.f);
+    }
+};
+
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
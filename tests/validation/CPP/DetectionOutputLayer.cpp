@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CPP/functions/CPPDetectionOutputLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+template <typename U, typename T>
+inline void fill_tensor(U &&tensor, const std::vector<T> &v)
+{
+    std::memcpy(tensor.data(), v.data(), sizeof(T) * v.size());
+}
+
+/** Information of a single image detection with two classes, the first one being the background
+ *
+ * The boxes are given in corner form with the variance encoded in the target.
+ */
+DetectionOutputLayerInfo make_info(int keep_top_k, int top_k, float confidence_threshold)
+{
+    return DetectionOutputLayerInfo(2, true, DetectionOutputLayerCodeType::CORNER, keep_top_k, 0.5f, top_k, 0,
+                                    confidence_threshold, true);
+}
+
+/** Run the detection output on a single image and check the detections
+ *
+ * The location predictions are zero, so the decoded boxes are the priors themselves.
+ *
+ * @param[in] info     Detection output information
+ * @param[in] priors   Prior boxes, four coordinates per box
+ * @param[in] scores   Score of the non-background class for each prior
+ * @param[in] expected Expected detections, seven values per row
+ */
+void run_detection_output(const DetectionOutputLayerInfo &info,
+                          const std::vector<float>       &priors,
+                          const std::vector<float>       &scores,
+                          const std::vector<float>       &expected)
+{
+    const unsigned int num_priors     = static_cast<unsigned int>(scores.size());
+    const unsigned int num_detections = static_cast<unsigned int>(expected.size() / 7);
+
+    Tensor input_loc      = create_tensor<Tensor>(TensorShape(num_priors * 4), DataType::F32);
+    Tensor input_conf     = create_tensor<Tensor>(TensorShape(num_priors * 2), DataType::F32);
+    Tensor input_priorbox = create_tensor<Tensor>(TensorShape(num_priors * 4, 2U), DataType::F32);
+    Tensor output;
+
+    CPPDetectionOutputLayer detection;
+    detection.configure(&input_loc, &input_conf, &input_priorbox, &output, info);
+
+    input_loc.allocator()->allocate();
+    input_conf.allocator()->allocate();
+    input_priorbox.allocator()->allocate();
+    output.allocator()->allocate();
+
+    // The confidences are interleaved per prior as [background, class 1]
+    std::vector<float> conf;
+    for (float score : scores)
+    {
+        conf.push_back(1.f - score);
+        conf.push_back(score);
+    }
+
+    // The second row of the priorbox input holds the variances
+    std::vector<float> priorbox(priors);
+    priorbox.resize(priors.size() * 2, 1.f);
+
+    fill_tensor(Accessor(input_loc), std::vector<float>(num_priors * 4, 0.f));
+    fill_tensor(Accessor(input_conf), conf);
+    fill_tensor(Accessor(input_priorbox), priorbox);
+
+    detection.run();
+
+    ARM_COMPUTE_EXPECT_EQUAL(output.info()->valid_region().shape[1], num_detections, framework::LogLevel::ERRORS);
+
+    SimpleTensor<float> reference(output.info()->tensor_shape(), DataType::F32);
+    std::fill_n(reference.data(), reference.num_elements(), 0.f);
+    std::copy(expected.begin(), expected.end(), reference.data());
+
+    validate(Accessor(output), reference, shape_to_valid_region(TensorShape(7U, num_detections)),
+             AbsoluteTolerance<float>(1e-6f));
+}
+
+// Four disjoint priors
+const std::vector<float> disjoint_priors{0.f, 0.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f,
+                                         4.f, 4.f, 5.f, 5.f, 6.f, 6.f, 7.f, 7.f};
+} // namespace
+
+TEST_SUITE(CPP)
+TEST_SUITE(DetectionOutputLayer)
+
+TEST_CASE(TiesKeepLowestIndexFirst, framework::DatasetMode::ALL)
+{
+    // Priors 0 and 1 are identical and prior 2 is disjoint: among the equal scores, prior 0 is visited first and
+    // suppresses prior 1
+    const std::vector<float> priors{0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f};
+    const std::vector<float> expected{0.f, 1.f, 0.8f, 0.f, 0.f, 1.f, 1.f, //
+                                      0.f, 1.f, 0.8f, 2.f, 2.f, 3.f, 3.f};
+    run_detection_output(make_info(10, -1, 0.f), priors, {0.8f, 0.8f, 0.8f}, expected);
+}
+
+TEST_CASE(KeepTopKSmallerThanDetections, framework::DatasetMode::ALL)
+{
+    const std::vector<float> expected{0.f, 1.f, 0.9f, 2.f, 2.f, 3.f, 3.f, //
+                                      0.f, 1.f, 0.7f, 6.f, 6.f, 7.f, 7.f};
+    run_detection_output(make_info(2, -1, 0.f), disjoint_priors, {0.3f, 0.9f, 0.5f, 0.7f}, expected);
+}
+
+TEST_CASE(TopKSmallerThanCandidates, framework::DatasetMode::ALL)
+{
+    const std::vector<float> expected{0.f, 1.f, 0.9f, 2.f, 2.f, 3.f, 3.f, //
+                                      0.f, 1.f, 0.7f, 6.f, 6.f, 7.f, 7.f, //
+                                      0.f, 1.f, 0.5f, 4.f, 4.f, 5.f, 5.f};
+    run_detection_output(make_info(10, 3, 0.f), disjoint_priors, {0.3f, 0.9f, 0.5f, 0.7f}, expected);
+}
+
+TEST_CASE(ConfidenceThresholdIsExclusive, framework::DatasetMode::ALL)
+{
+    // Scores equal to the confidence threshold are discarded
+    const std::vector<float> expected{0.f, 1.f, 0.75f, 6.f, 6.f, 7.f, 7.f, //
+                                      0.f, 1.f, 0.6f, 2.f, 2.f, 3.f, 3.f};
+    run_detection_output(make_info(10, -1, 0.5f), disjoint_priors, {0.5f, 0.6f, 0.4f, 0.75f}, expected);
+}
+
+TEST_SUITE_END() // DetectionOutputLayer
+TEST_SUITE_END() // CPP
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -24,6 +24,7 @@
 #include "src/core/helpers/LUTManager.h"
 #include "support/Half.h"
 #include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
 #include "tests/framework/Macros.h"
 #include "tests/validation/Helpers.h"
 #include "tests/validation/Validation.h"
@@ -46,6 +47,16 @@ inline uint16_t read_as_bf16(const float16_t tmp)
 }
 #endif // ARM_COMPUTE_ENABLE_FP16
 
+#ifdef __aarch64__
+// Take fp16 value and output as int16_t without changing bits.
+inline int16_t read_as_qsymm16(const float16_t tmp)
+{
+    int16_t out = 0;
+    memcpy(&out, &tmp, sizeof(tmp));
+    return out;
+}
+#endif // __aarch64__
+
 // Check if difference in values is within tolerance range
 template <typename U>
 bool equal_values_relative(const U target, const U reference, const float tolerance)
@@ -159,6 +170,66 @@ TEST_CASE(CheckLutReuse, framework::DatasetMode::ALL)
 TEST_SUITE_END() // BF16
 #endif           // ARM_COMPUTE_ENABLE_FP16
 
+#ifdef __aarch64__
+TEST_SUITE(QSYMM16)
+DATA_TEST_CASE(LUTValueTest,
+               framework::DatasetMode::ALL,
+               framework::dataset::make("ActivationFunction",
+                                        {ActivationLayerInfo::ActivationFunction::LOGISTIC,
+                                         ActivationLayerInfo::ActivationFunction::TANH}),
+               act)
+{
+    constexpr int                 num_elements = 65536;
+    const UniformQuantizationInfo qinfo_in(1.f / 4096.f, 0);
+    const UniformQuantizationInfo qinfo_out(1.f / 32768.f, 0);
+    unsigned int                  num_mismatches = 0;
+
+    LUTInfo    info = {act, 1.0f, 1.0f, DataType::QSYMM16, qinfo_in};
+    LUTManager lman = LUTManager::get_instance();
+
+    std::shared_ptr<LookupTable65536> lut = lman.get_lut_table<LookupTable65536>(info);
+    ARM_COMPUTE_EXPECT(lut != nullptr, framework::LogLevel::ALL);
+
+    // The table is indexed with the raw bit pattern of the quantized input
+    for (int i = 0; i < num_elements; i++)
+    {
+        const float x = dequantize_qsymm16(static_cast<int16_t>(static_cast<uint16_t>(i)), qinfo_in);
+        const float fref =
+            (act == ActivationLayerInfo::ActivationFunction::LOGISTIC) ? 1.f / (1.f + std::exp(-x)) : std::tanh(x);
+        const int16_t reference = quantize_qsymm16(fref, qinfo_out);
+        const int16_t target    = read_as_qsymm16((*lut)[i]);
+
+        if (std::abs(static_cast<int32_t>(target) - static_cast<int32_t>(reference)) > 1)
+        {
+            ARM_COMPUTE_TEST_INFO("id = " << i);
+            ARM_COMPUTE_TEST_INFO("target = " << target);
+            ARM_COMPUTE_TEST_INFO("reference = " << reference);
+            framework::ARM_COMPUTE_PRINT_INFO();
+            ++num_mismatches;
+        }
+    }
+
+    ARM_COMPUTE_EXPECT(num_mismatches == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CheckLutReuse, framework::DatasetMode::ALL)
+{
+    const UniformQuantizationInfo qinfo(1.f / 4096.f, 0);
+
+    LUTInfo    tanh_info     = {ActivationLayerInfo::ActivationFunction::TANH, 1.0f, 1.0f, DataType::QSYMM16, qinfo};
+    LUTInfo    logistic_info = {ActivationLayerInfo::ActivationFunction::LOGISTIC, 1.0f, 1.0f, DataType::QSYMM16,
+                                qinfo};
+    LUTManager lman          = LUTManager::get_instance();
+
+    auto first  = lman.get_lut_table<LookupTable65536>(tanh_info);
+    auto second = lman.get_lut_table<LookupTable65536>(tanh_info);
+    auto other  = lman.get_lut_table<LookupTable65536>(logistic_info);
+    ARM_COMPUTE_EXPECT(first == second, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(first != other, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // QSYMM16
+#endif           // __aarch64__
+
 TEST_SUITE_END() // LUTManager
 TEST_SUITE_END() // CPP
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025 Arm Limited.
+ * Copyright (c) 2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,9 @@
 #include "tests/validation/fixtures/NonMaxSuppressionFixture.h"
 #include "tests/validation/Validation.h"
 
+#include <cstring>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -54,6 +57,46 @@ const auto NMSParametersSmall        = datasets::Small2DNonMaxSuppressionShapes(
 const auto NMSParametersBig = datasets::Large2DNonMaxSuppressionShapes() * max_output_boxes_dataset *
                               score_threshold_dataset * iou_nms_threshold_dataset;
 
+/** Run the suppression on explicit boxes and scores and check the selected indices
+ *
+ * @param[in] boxes           Boxes, four coordinates per box
+ * @param[in] scores          Score of each box
+ * @param[in] max_output      Maximum number of boxes to select
+ * @param[in] score_threshold Score below which the boxes are discarded
+ * @param[in] nms_threshold   IoU above which a box is suppressed
+ * @param[in] expected        Expected indices, -1 for the unused outputs
+ */
+void run_nms(const std::vector<float> &boxes,
+             const std::vector<float> &scores,
+             unsigned int              max_output,
+             float                     score_threshold,
+             float                     nms_threshold,
+             const std::vector<int>   &expected)
+{
+    Tensor bboxes  = create_tensor<Tensor>(TensorShape(4U, static_cast<unsigned int>(scores.size())), DataType::F32);
+    Tensor bscores = create_tensor<Tensor>(TensorShape(static_cast<unsigned int>(scores.size())), DataType::F32);
+    Tensor indices = create_tensor<Tensor>(TensorShape(max_output), DataType::S32);
+
+    CPPNonMaximumSuppression nms;
+    nms.configure(&bboxes, &bscores, &indices, max_output, score_threshold, nms_threshold);
+
+    bboxes.allocator()->allocate();
+    bscores.allocator()->allocate();
+    indices.allocator()->allocate();
+
+    std::memcpy(bboxes.buffer(), boxes.data(), boxes.size() * sizeof(float));
+    std::memcpy(bscores.buffer(), scores.data(), scores.size() * sizeof(float));
+
+    nms.run();
+
+    SimpleTensor<int> reference(TensorShape(max_output), DataType::S32);
+    std::memcpy(reference.data(), expected.data(), expected.size() * sizeof(int));
+
+    validate(Accessor(indices), reference);
+}
+
+// Four disjoint boxes
+const std::vector<float> disjoint_boxes{0.f, 0.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f, 4.f, 4.f, 5.f, 5.f, 6.f, 6.f, 7.f, 7.f};
 } // namespace
 
 TEST_SUITE(CPP)
@@ -143,6 +186,31 @@ FIXTURE_DATA_TEST_CASE(RunLarge, CPPNonMaxSuppressionFixture, framework::Dataset
     validate(Accessor(_target), _reference);
 }
 
+TEST_CASE(TiesKeepLowestIndexFirst, framework::DatasetMode::ALL)
+{
+    // Boxes 0, 1 and 3 are identical and box 2 is disjoint: among the equal scores, box 1 is visited first and
+    // suppresses box 3, then box 2 is kept
+    const std::vector<float> boxes{0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f, 0.f, 0.f, 1.f, 1.f};
+    run_nms(boxes, {0.5f, 0.8f, 0.8f, 0.8f}, 4U, 0.f, 0.5f, {1, 2, -1, -1});
+}
+
+TEST_CASE(MaxOutputSmallerThanCandidates, framework::DatasetMode::ALL)
+{
+    std::vector<float> boxes(disjoint_boxes);
+    boxes.insert(boxes.end(), {8.f, 8.f, 9.f, 9.f});
+    run_nms(boxes, {0.3f, 0.9f, 0.5f, 0.7f, 0.6f}, 2U, 0.f, 0.5f, {1, 3});
+}
+
+TEST_CASE(ScoreThresholdEdges, framework::DatasetMode::ALL)
+{
+    const std::vector<float> scores{0.5f, 0.4999f, 1.f, 0.f};
+
+    // Scores equal to the threshold are kept
+    run_nms(disjoint_boxes, scores, 4U, 0.5f, 0.5f, {2, 0, -1, -1});
+    run_nms(disjoint_boxes, scores, 4U, 1.f, 0.5f, {2, -1, -1, -1});
+    run_nms(disjoint_boxes, scores, 4U, 0.f, 0.5f, {2, 0, 1, 3});
+}
+
 TEST_SUITE_END() // NMS
 TEST_SUITE_END() // CPP
 } // namespace validation
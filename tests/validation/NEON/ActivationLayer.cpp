@@ -70,6 +70,20 @@ const auto ActivationDataset =
 const auto ActivationDatasetForPaddingAfterConfigure =
     combine(make("InPlace", {false, true}), NeonActivationFunctionsDataset, make("AlphaBeta", {0.5f}));
 
+/** Activations with a fast accuracy tier */
+const auto FastMathActivationDataset = combine(make("InPlace", {false}),
+                                               make("ActivationFunction",
+                                                    {ActivationLayerInfo::ActivationFunction::LOGISTIC,
+                                                     ActivationLayerInfo::ActivationFunction::TANH,
+                                                     ActivationLayerInfo::ActivationFunction::SWISH,
+                                                     ActivationLayerInfo::ActivationFunction::ELU,
+                                                     ActivationLayerInfo::ActivationFunction::SOFT_RELU}),
+                                               make("AlphaBeta", {0.5f, 1.f}));
+
+/** The fast tier has a relative error of about 1e-4, and tanh an absolute one of the same order around 0 */
+RelativeTolerance<float> tolerance_fast_math_f32(0.001f);
+AbsoluteTolerance<float> abs_tolerance_fast_math_f32(0.001f);
+
 template <typename T, ARM_COMPUTE_REQUIRES_TA(arm_compute::utils::traits::is_floating_point<T>::value)>
 void test_float_sqrt_boundary_value()
 {
@@ -191,6 +205,8 @@ using NEActivationLayerFixture = ActivationValidationFixture<Tensor, Accessor, N
 template <typename T>
 using NEActivationLayerWithPaddingFixture =
     ActivationWithPaddingValidationFixture<Tensor, Accessor, NEActivationLayer, T>;
+template <typename T>
+using NEActivationLayerFastMathFixture = ActivationFastMathValidationFixture<Tensor, Accessor, NEActivationLayer, T>;
 
 TEST_SUITE(Float)
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -265,6 +281,15 @@ FIXTURE_DATA_TEST_CASE(PaddingAfterConfigure,
     validate(Accessor(_target), _reference, helper::relative_tolerance(_data_type, _function), 0.f,
              helper::absolute_tolerance(_data_type, _function));
 }
+
+FIXTURE_DATA_TEST_CASE(RunFastMath,
+                       NEActivationLayerFastMathFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallShapes(), FastMathActivationDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fast_math_f32, 0.f, abs_tolerance_fast_math_f32);
+}
 // Run only on SME Devices to stress Logistic SME kernel
 #ifdef ARM_COMPUTE_ENABLE_SME2
 TEST_SUITE(SME)
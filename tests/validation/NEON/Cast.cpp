@@ -117,6 +117,10 @@ const auto CastF32toS32Dataset     = combine(make("DataType", DataType::F32), ma
 const auto CastF32toQASYMM8Dataset = combine(make("DataType", DataType::F32), make("DataType", DataType::QASYMM8));
 const auto CastF32toQASYMM8_SIGNEDDataset =
     combine(make("DataType", DataType::F32), make("DataType", DataType::QASYMM8_SIGNED));
+const auto CastF32toBFLOAT16Dataset = combine(make("DataType", DataType::F32), make("DataType", DataType::BFLOAT16));
+
+// BFLOAT16
+const auto CastBFLOAT16toF32Dataset = combine(make("DataType", DataType::BFLOAT16), make("DataType", DataType::F32));
 
 // U64
 const auto CastU64toF32Dataset = combine(make("DataType", DataType::U64), make("DataType", DataType::F32));
@@ -194,6 +198,8 @@ using NECastToS64Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, in
 template <typename T>
 using NECastToF16Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, half>;
 template <typename T>
+using NECastToBF16Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, bfloat16>;
+template <typename T>
 using NECastToF32Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, float>;
 template <typename T>
 using NECastToQASYMM8Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, uint8_t>;
@@ -343,6 +349,30 @@ CAST_SUITE(F32_to_F16, DataType::F32, DataType::F16, NECastToF16Fixture<float>,
 CAST_SUITE(F32_to_S32, DataType::F32, DataType::S32, NECastToS32Fixture<float>, CastF32toS32Dataset, one_tolerance)
 CAST_SUITE(F32_to_U8, DataType::F32, DataType::U8, NECastToU8Fixture<float>, CastF32toU8Dataset, one_tolerance)
 
+#ifdef ARM_COMPUTE_ENABLE_BF16
+#define CAST_BF16_SUITE(NAME, type, dataset)                                                           \
+    TEST_SUITE(NAME)                                                                                   \
+    FIXTURE_DATA_TEST_CASE(RunSmall, type, framework::DatasetMode::PRECOMMIT,                          \
+                           combine(datasets::SmallShapes(), dataset, datasets::ConvertPolicies()))     \
+    {                                                                                                  \
+        if (CPUInfo::get().has_bf16())                                                                 \
+        {                                                                                              \
+            validate(Accessor(_target), _reference, zero_tolerance);                                   \
+        }                                                                                              \
+        else                                                                                           \
+        {                                                                                              \
+            ARM_COMPUTE_TEST_WARNING("Device does not support bf16 vector operations. Test SKIPPED."); \
+            framework::ARM_COMPUTE_PRINT_WARNING();                                                    \
+        }                                                                                              \
+    }                                                                                                  \
+    TEST_SUITE_END()
+
+CAST_BF16_SUITE(F32_to_BFLOAT16, NECastToBF16Fixture<float>, CastF32toBFLOAT16Dataset)
+
+// BFLOAT16
+CAST_BF16_SUITE(BFLOAT16_to_F32, NECastToF32Fixture<bfloat16>, CastBFLOAT16toF32Dataset)
+#endif // ARM_COMPUTE_ENABLE_BF16
+
 #ifdef __aarch64__
 // S64
 CAST_SUITE(S64_to_F32, DataType::S64, DataType::F32, NECastToF32Fixture<int64_t>, CastS64toF32Dataset, zero_tolerance)
@@ -34,6 +34,7 @@
 #include "src/cpu/operators/CpuGemmConv2d.h"
 #include "src/cpu/operators/CpuGemmDirectConv2d.h"
 #include "src/cpu/operators/CpuWinogradConv2d.h"
+#include "tests/datasets/DilatedConvolutionLayerDataset.h"
 #include "tests/datasets/LargeConvolutionLayerDataset.h"
 #include "tests/datasets/SmallConvolutionLayerDataset.h"
 #include "tests/framework/Asserts.h"
@@ -931,6 +932,167 @@ FIXTURE_DATA_TEST_CASE(RunLarge,
     }
 }
 TEST_SUITE_END() // Conv3x3
+
+TEST_SUITE(Conv5x5)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEWinogradConvolutionLayerFastMathFixture16,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer5x5Dataset(),
+                               make("DataType", {DataType::F16}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_convolution_layer_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // Conv5x5
+
+TEST_SUITE(Conv1x3)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEWinogradConvolutionLayerFastMathFixture16,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer1x3Dataset(),
+                               make("DataType", {DataType::F16}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_convolution_layer_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // Conv1x3
+
+TEST_SUITE(Conv3x1)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEWinogradConvolutionLayerFastMathFixture16,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x1Dataset(),
+                               make("DataType", {DataType::F16}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_convolution_layer_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // Conv3x1
+
+TEST_SUITE(Conv1x5)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEWinogradConvolutionLayerFastMathFixture16,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer1x5Dataset(),
+                               make("DataType", {DataType::F16}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_convolution_layer_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // Conv1x5
+
+TEST_SUITE(Conv5x1)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEWinogradConvolutionLayerFastMathFixture16,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer5x1Dataset(),
+                               make("DataType", {DataType::F16}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_convolution_layer_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // Conv5x1
+
+TEST_SUITE(Conv1x7)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEWinogradConvolutionLayerFastMathFixture16,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer1x7Dataset(),
+                               make("DataType", {DataType::F16}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_convolution_layer_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // Conv1x7
+
+TEST_SUITE(Conv7x1)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEWinogradConvolutionLayerFastMathFixture16,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer7x1Dataset(),
+                               make("DataType", {DataType::F16}),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC})))
+
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_convolution_layer_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // Conv7x1
 TEST_SUITE_END() // FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
 TEST_SUITE_END() // WinogradLayer
@@ -1382,6 +1544,9 @@ using NEGEMMConvolutionLayerPaddedWeightsFixture =
 template <typename T>
 using NEGEMMConvolutionLayerMixedDataLayoutFixture =
     ConvolutionValidationFixture<Tensor, Accessor, NEConvolutionLayer, T, true>;
+template <typename T>
+using NEGEMMConvolutionLayerBFloat16OutputFixture =
+    ConvolutionValidationBFloat16OutputFixture<Tensor, Accessor, NEConvolutionLayer, T>;
 
 /** Test case for memory injection in @ref cpu::CpuGemmConv2d.
  *
@@ -1499,6 +1664,35 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+// BFLOAT16 sources and destinations select the indirect GEMM method in CpuConv2d, as the mixed precision graph mode
+// relies on. The reductions are longer than 4 as the non fixed-format BFLOAT16 GEMM kernels require.
+FIXTURE_DATA_TEST_CASE(RunSmallBFloat16Output,
+                       NEGEMMConvolutionLayerBFloat16OutputFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(zip(make("Input",
+                                        {TensorShape(23U, 27U, 5U), TensorShape(17U, 31U, 2U, 4U),
+                                         TensorShape(33U, 27U, 3U), TensorShape(13U, 11U, 8U)}),
+                                   make("Weights",
+                                        {TensorShape(3U, 3U, 5U, 2U), TensorShape(5U, 5U, 2U, 19U),
+                                         TensorShape(5U, 7U, 3U, 4U), TensorShape(1U, 1U, 8U, 16U)}),
+                                   make("Bias", {TensorShape(2U), TensorShape(19U), TensorShape(4U), TensorShape(16U)}),
+                                   make("Output",
+                                        {TensorShape(11U, 25U, 2U), TensorShape(15U, 15U, 19U, 4U),
+                                         TensorShape(11U, 12U, 4U), TensorShape(13U, 11U, 16U)}),
+                                   make("PadStrideInfo",
+                                        {PadStrideInfo(2, 1, 0, 0), PadStrideInfo(1, 2, 1, 1),
+                                         PadStrideInfo(3, 2, 1, 1, 2, 0, DimensionRoundingType::FLOOR),
+                                         PadStrideInfo(1, 1, 0, 0)}),
+                                   make("Dilation", Size2D(1U, 1U))),
+                               make("ReshapeWeights", {true}),
+                               make("DataType",
+                                    Scheduler::get().cpu_info().has_bf16() ? DataType::BFLOAT16 : DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
 TEST_SUITE_END() // BFLOAT16
 #endif           /* defined(ARM_COMPUTE_ENABLE_BF16) */
 
@@ -1540,6 +1734,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+FIXTURE_DATA_TEST_CASE(RunSmallGrouped,
+                       NEGEMMConvolutionLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
 FIXTURE_DATA_TEST_CASE(RunMixedDataLayout,
                        NEGEMMConvolutionLayerMixedDataLayoutFixture<float>,
                        framework::DatasetMode::ALL,
@@ -1973,6 +2179,30 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+FIXTURE_DATA_TEST_CASE(RunSmallDilated,
+                       NEDirectGEMMConv2dLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallDilatedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+FIXTURE_DATA_TEST_CASE(RunSmallGrouped,
+                       NEDirectGEMMConv2dLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::F32),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -2053,6 +2283,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallDilated,
+                       NEDirectGEMMConv2dLayerQuantizedFixture<int8_t>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::SmallDilatedConvolutionLayerDataset(),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("DataLayout", {DataLayout::NHWC}),
+                               make("QuantizationInfo", {QuantizationInfo(0.01f, -10)}),
+                               QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 TEST_SUITE_END() // QASYMM8_SIGNED
 
 TEST_SUITE(QSYMM8_PER_CHANNEL)
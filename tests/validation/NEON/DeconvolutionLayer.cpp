@@ -84,6 +84,19 @@ const auto data1x1 = datasets::SmallDeconvolutionShapes() * make("StrideX", 1, 4
 const auto data5x1 = datasets::SmallDeconvolutionShapes() * make("StrideX", 1, 4) * make("StrideY", 1, 4) *
                      make("PadX", 0, 1) * make("PadY", 0, 1) * make("NumKernels", {3});
 
+/** Kernels smaller than the stride, where some of the stride phases are not reached by any kernel tap */
+const auto data1x1_phases = datasets::SmallDeconvolutionShapes() * make("StrideX", {2, 3}) * make("StrideY", {3}) *
+                            make("PadX", 0) * make("PadY", 0) * make("NumKernels", {3});
+
+const auto data2x2_asymm_phases = datasets::SmallDeconvolutionShapes() * make("StrideX", 3) * make("StrideY", 3) *
+                                  make("PadLeft", {0, 1}) * make("PadRight", 1) * make("PadTop", 1) *
+                                  make("PadBottom", {0, 1}) * make("NumKernels", {3});
+
+/** Uneven borders, where the phases start at different offsets and need different paddings */
+const auto data3x3_asymm_phases = datasets::SmallDeconvolutionShapes() * make("StrideX", 2) * make("StrideY", {2, 3}) *
+                                  make("PadLeft", 0) * make("PadRight", 2) * make("PadTop", 1) *
+                                  make("PadBottom", {0, 2}) * make("NumKernels", {3});
+
 const auto data_layouts_dataset = make("DataLayout", {DataLayout::NCHW, DataLayout::NHWC});
 
 const auto add_bias_dataset = make("AddBias", {true, false});
@@ -177,6 +190,10 @@ template <typename T>
 using NEDeconvolutionLayerAsymmFixture3x3 =
     DeconvolutionValidationAsymmFixture<Tensor, Accessor, NEDeconvolutionLayer, T, 3, 3>;
 
+template <typename T>
+using NEDeconvolutionLayerAsymmFixture2x2 =
+    DeconvolutionValidationAsymmFixture<Tensor, Accessor, NEDeconvolutionLayer, T, 2, 2>;
+
 template <typename T>
 using NEDeconvolutionLayerAsymmFixture9x9 =
     DeconvolutionValidationAsymmFixture<Tensor, Accessor, NEDeconvolutionLayer, T, 9, 9>;
@@ -217,6 +234,17 @@ FIXTURE_DATA_TEST_CASE(RunAsymm,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunAsymmSmall,
+                       NEDeconvolutionLayerAsymmFixture3x3<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data3x3_asymm_phases,
+                               make("DataType", DataType::F32),
+                               data_layouts_dataset,
+                               add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NEDeconvolutionLayerFixture3x3<float>,
                        framework::DatasetMode::NIGHTLY,
@@ -235,7 +263,28 @@ FIXTURE_DATA_TEST_CASE(Run,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDeconvolutionLayerFixture1x1<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data1x1_phases, make("DataType", DataType::F32), data_layouts_dataset, add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 TEST_SUITE_END() // W1x1
+TEST_SUITE(W2x2)
+FIXTURE_DATA_TEST_CASE(RunAsymmSmall,
+                       NEDeconvolutionLayerAsymmFixture2x2<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data2x2_asymm_phases,
+                               make("DataType", DataType::F32),
+                               data_layouts_dataset,
+                               add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // W2x2
 TEST_SUITE(W9x9)
 FIXTURE_DATA_TEST_CASE(RunSmall,
                        NEDeconvolutionLayerAsymmFixture9x9<float>,
@@ -462,6 +511,19 @@ FIXTURE_DATA_TEST_CASE(Run,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_quantized, tolerance_num_quant);
 }
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEDeconvolutionLayerQuantizedFixture1x1<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(data1x1_phases,
+                               make("DataType", DataType::QASYMM8),
+                               data_layouts_dataset,
+                               input_qinfo_dataset,
+                               output_qinfo_dataset,
+                               add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quantized, tolerance_num_quant);
+}
 TEST_SUITE_END() // W1x1
 
 TEST_SUITE(W5x1)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,11 +53,20 @@ const auto shapes_1d =
           TensorShape(49U, 2U, 3U), TensorShape(64U, 2U, 3U), TensorShape(16U, 2U, 3U), TensorShape(32U, 2U, 3U),
           TensorShape(96U, 2U, 2U)});
 
+const auto shapes_real_1d =
+    make("TensorShape",
+         {TensorShape(4U, 2U, 3U), TensorShape(8U, 2U, 3U), TensorShape(10U, 2U, 3U), TensorShape(18U, 2U, 3U),
+          TensorShape(50U, 2U, 3U), TensorShape(64U, 2U, 3U), TensorShape(96U, 2U, 2U)});
+
 const auto shapes_2d = make("TensorShape",
                             {TensorShape(2U, 2U, 3U), TensorShape(3U, 6U, 3U), TensorShape(4U, 5U, 3U),
                              TensorShape(5U, 7U, 3U), TensorShape(7U, 25U, 3U), TensorShape(8U, 2U, 3U),
                              TensorShape(9U, 16U, 3U), TensorShape(25U, 32U, 3U), TensorShape(192U, 128U, 2U)});
 
+const auto shapes_real_2d = make("TensorShape",
+                                 {TensorShape(4U, 5U, 3U), TensorShape(8U, 2U, 3U), TensorShape(18U, 16U, 3U),
+                                  TensorShape(50U, 32U, 3U), TensorShape(192U, 128U, 2U)});
+
 const auto ActivationFunctionsSmallDataset =
     make("ActivationInfo",
          {ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.5f)});
@@ -78,6 +87,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Unsupported axis
                                                 TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(25U, 13U, 2U), 1, DataType::F32), // Half spectrum of odd length
+                                                TensorInfo(TensorShape(32U, 16U, 2U), 1, DataType::F32), // Half spectrum along Y
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
         }),
         make("OutputInfo",{ TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F16),
                                                 TensorInfo(TensorShape(16U, 13U, 2U), 2, DataType::F32),
@@ -85,9 +97,12 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(13U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 9U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32),
         }),
-        make("Axis", { 0, 0, 0, 2, 0, 0 }),
-        make("Expected", { false, false, false, false, false, true })
+        make("Axis", { 0, 0, 0, 2, 0, 0, 0, 1, 0 }),
+        make("Expected", { false, false, false, false, false, true, false, false, true })
         ),
         input_info, output_info, axis, expected)
 {
@@ -101,6 +116,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
 
 template <typename T>
 using NEFFT1DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+template <typename T>
+using NEFFT1DRealFixture = FFTRealValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -112,6 +129,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallReal,
+                       NEFFT1DRealFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_real_1d, make("DataType", DataType::F32)))
+{
+    // Validate half spectrum and round trip
+    validate(Accessor(_target_spectrum), _reference_spectrum, tolerance_f32, tolerance_num);
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT1D
@@ -125,14 +151,16 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 3, DataType::F32), // Invalid channels
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32),
         }),
         make("OutputInfo",{ TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F16),
                                                 TensorInfo(TensorShape(16U, 25U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 25U, 2U), 2, DataType::F32),
         }),
-        make("Expected", { false, false, false, false, true })
+        make("Expected", { false, false, false, false, true, true })
         ),
                input_info, output_info, expected)
 {
@@ -144,6 +172,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
 
 template <typename T>
 using NEFFT2DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
+template <typename T>
+using NEFFT2DRealFixture = FFTRealValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -155,6 +185,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallReal,
+                       NEFFT2DRealFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(shapes_real_2d, make("DataType", DataType::F32)))
+{
+    // Validate half spectrum and round trip
+    validate(Accessor(_target_spectrum), _reference_spectrum, tolerance_f32, tolerance_num);
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT2D
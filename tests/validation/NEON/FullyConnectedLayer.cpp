@@ -51,6 +51,10 @@ constexpr RelativeTolerance<float> rel_tolerance_f32(
     0.01f); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
 constexpr AbsoluteTolerance<float> abs_tolerance_f32(
     0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr RelativeTolerance<float> rel_tolerance_dynamic_quantization(
+    0.001f); /**< Relative tolerance value for DataType::F32 against a reference on the same int8 operands, tight enough to detect the F32 fallback */
+constexpr AbsoluteTolerance<float> abs_tolerance_dynamic_quantization(
+    0.001f); /**< Absolute tolerance value for DataType::F32 against a reference on the same int8 operands */
 #ifdef ARM_COMPUTE_ENABLE_FP16
 const AbsoluteTolerance<float> abs_tolerance_f16(
     0.3f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F16 */
@@ -320,6 +324,9 @@ using NEFullyConnectedLayerDynamicWeightsFixture =
 template <typename T>
 using NEFullyConnectedLayerDynamicBiasFixture =
     FullyConnectedWithDynamicBiasFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+template <typename T>
+using NEFullyConnectedLayerDynamicQuantizationFixture =
+    FullyConnectedLayerDynamicQuantizationFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
 
 TEST_SUITE(Float)
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -453,6 +460,32 @@ FIXTURE_DATA_TEST_CASE(RunDynamicWeights,
                                make("WeightsReshaped", {false, true})))
 {
 }
+#ifdef __aarch64__
+FIXTURE_DATA_TEST_CASE(RunDynamicQuantization,
+                       NEFullyConnectedLayerDynamicQuantizationFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::FullyConnectedLayerWithActivationDataset(),
+                               FullyConnectedParameters,
+                               make("DataType", DataType::F32),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_quantization, 0,
+             abs_tolerance_dynamic_quantization);
+}
+FIXTURE_DATA_TEST_CASE(RunDynamicQuantizationSmall,
+                       NEFullyConnectedLayerDynamicQuantizationFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallFullyConnectedLayerDataset(),
+                               FullyConnectedParameters,
+                               make("DataType", DataType::F32),
+                               NoActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_quantization, 0,
+             abs_tolerance_dynamic_quantization);
+}
+#endif // __aarch64__
 TEST_SUITE_END()
 TEST_SUITE_END()
 
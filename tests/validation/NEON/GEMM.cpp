@@ -66,6 +66,11 @@ const AbsoluteTolerance<float>      abs_tolerance_f16(
          0.2f); /**< Absolute tolerance value for comparing reference's output against implementation's output for FP16 data types */
 constexpr float tolerance_num = 0.07f; /**< Tolerance number for FP16 data types */
 #endif                                 /* ARM_COMPUTE_ENABLE_FP16 */
+#ifdef ARM_COMPUTE_ENABLE_BF16
+constexpr RelativeTolerance<float> rel_tolerance_bf16(
+    0.01f); /**< Relative tolerance value for BFLOAT16 outputs, which are rounded once from F32 accumulators */
+constexpr float abs_tolerance_bf16 = 0.01f; /**< Absolute tolerance value for BFLOAT16 outputs close to zero */
+#endif                                      /* ARM_COMPUTE_ENABLE_BF16 */
 /** CNN data types */
 const auto CNNDataTypes = make("DataType",
                                {
@@ -392,6 +397,9 @@ using NEBatchedMatMulFixture =
 template <typename T>
 using NEGEMMAccumulateFixture = GEMMAccumulateValidationFixture<Tensor, Accessor, NEGEMM, T>;
 
+template <typename T>
+using NEGEMMBiasActivationFixture = GEMMBiasActivationValidationFixture<Tensor, Accessor, NEGEMM, T>;
+
 TEST_SUITE(Float)
 DATA_TEST_CASE(ValidateZeroPadding,
                framework::DatasetMode::ALL,
@@ -441,6 +449,40 @@ DATA_TEST_CASE(ValidateAccumulate,
     ARM_COMPUTE_EXPECT((expected == bool(status)), framework::LogLevel::ERRORS);
 }
 
+#ifdef ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE(BFLOAT16)
+// BFLOAT16 destinations run the non fixed-format interleaved BFLOAT16 kernels, which need a reduction longer than 4
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEGEMMBiasActivationFixture<bfloat16>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(zip(make("A", {TensorShape(21U, 13U), TensorShape(23U, 31U), TensorShape(32U, 1U)}),
+                                   make("B", {TensorShape(33U, 21U), TensorShape(17U, 23U), TensorShape(24U, 32U)}),
+                                   make("C", {TensorShape(33U), TensorShape(17U), TensorShape(24U)}),
+                                   make("Output", {TensorShape(33U, 13U), TensorShape(17U, 31U), TensorShape(24U, 1U)}),
+                                   make("Alpha", 1.0f),
+                                   make("Beta", 1.0f)),
+                               make("ReshapeWeights", {true}),
+                               make("DataType", DataType::BFLOAT16),
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+                                                         0.5f)})))
+{
+    if (CPUInfo::get().has_bf16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_bf16, 0.f, abs_tolerance_bf16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support bf16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // BFLOAT16
+#endif           /* ARM_COMPUTE_ENABLE_BF16 */
+
 #ifdef ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE(FP16)
 FIXTURE_DATA_TEST_CASE(RunSmall,
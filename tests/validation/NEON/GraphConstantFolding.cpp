@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+#include "arm_compute/graph/PassManager.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphAccessors.h"
+#include "tests/validation/Validation.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::VectorAccessor;
+
+namespace
+{
+std::vector<float> make_values(size_t num_elements, float start, float step)
+{
+    std::vector<float> values(num_elements);
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        values[i] = start + i * step;
+    }
+    return values;
+}
+
+/** Run input * (permute(a) + b), where a and b are constants, and return the output
+ *
+ * @param[in]  fold         Fold the constant sub-graph
+ * @param[out] num_eltwises Number of element-wise nodes left in the graph
+ */
+std::vector<float> run_graph(bool fold, size_t &num_eltwises)
+{
+    std::vector<float> a     = make_values(12, -3.f, 0.5f);
+    std::vector<float> b     = make_values(12, 0.25f, 0.75f);
+    std::vector<float> input = make_values(12, 1.f, -0.125f);
+    std::vector<float> output(12);
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "ConstantFolding");
+
+    const NodeParams       params{"", Target::NEON};
+    const TensorDescriptor a_desc(TensorShape(4U, 3U), DataType::F32);
+    const TensorDescriptor desc(TensorShape(3U, 4U), DataType::F32);
+
+    const NodeID a_nid = GraphBuilder::add_const_node(g, params, a_desc, std::make_unique<VectorAccessor>(a, false));
+    const NodeID b_nid = GraphBuilder::add_const_node(g, params, desc, std::make_unique<VectorAccessor>(b, false));
+    const NodeID permute_nid = GraphBuilder::add_permute_node(g, params, {a_nid, 0}, PermutationVector(1U, 0U));
+    const NodeID add_nid =
+        GraphBuilder::add_elementwise_node(g, params, {permute_nid, 0}, {b_nid, 0}, EltwiseOperation::Add);
+    const NodeID input_nid =
+        GraphBuilder::add_input_node(g, params, desc, std::make_unique<VectorAccessor>(input, false));
+    const NodeID mul_nid =
+        GraphBuilder::add_elementwise_node(g, params, {input_nid, 0}, {add_nid, 0}, EltwiseOperation::Mul);
+    GraphBuilder::add_output_node(g, params, {mul_nid, 0}, std::make_unique<VectorAccessor>(output, true));
+
+    PassManager pm;
+    pm.append(std::make_unique<ConstantFoldingMutator>(), fold);
+
+    ctx.set_config(GraphConfig());
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+    manager.execute_graph(g);
+
+    num_eltwises = g.nodes(NodeType::EltwiseLayer).size();
+    return output;
+}
+
+/** Build a graph with a constant reshape that nothing consumes, fold it and return the number of constants left */
+size_t count_constants_after_folding(bool remove_dead_nodes)
+{
+    std::vector<float> values = make_values(12, 0.f, 1.f);
+
+    Graph g(0, "DeadNodes");
+
+    const NodeParams       params{"", Target::NEON};
+    const TensorDescriptor desc(TensorShape(3U, 4U), DataType::F32);
+
+    const NodeID const_nid =
+        GraphBuilder::add_const_node(g, params, desc, std::make_unique<VectorAccessor>(values, false));
+    GraphBuilder::add_reshape_node(g, params, {const_nid, 0}, TensorShape(12U));
+
+    ConstantFoldingMutator mutator(remove_dead_nodes);
+    mutator.mutate(g);
+
+    return g.nodes(NodeType::Const).size();
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ConstantFoldingMutator)
+
+TEST_CASE(FoldedGraphMatchesUnfoldedGraph, framework::DatasetMode::ALL)
+{
+    size_t                   unfolded_eltwises = 0;
+    size_t                   folded_eltwises   = 0;
+    const std::vector<float> unfolded          = run_graph(false, unfolded_eltwises);
+    const std::vector<float> folded            = run_graph(true, folded_eltwises);
+
+    // Only the multiplication by the input is left once the constant sub-graph is folded
+    ARM_COMPUTE_EXPECT_EQUAL(unfolded_eltwises, 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(folded_eltwises, 1U, framework::LogLevel::ERRORS);
+
+    for (size_t i = 0; i < unfolded.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT_EQUAL(folded[i], unfolded[i], framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(DeadNodesOnlyRemovedWhenEnabled, framework::DatasetMode::ALL)
+{
+    // The unused reshape is folded into a constant, which is only removed with the dead node elimination
+    ARM_COMPUTE_EXPECT_EQUAL(count_constants_after_folding(false), 1U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(count_constants_after_folding(true), 0U, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ConstantFoldingMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
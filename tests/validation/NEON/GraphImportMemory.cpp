@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/backends/NEON/NESubTensorHandle.h"
+#include "arm_compute/graph/backends/NEON/NETensorHandle.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/frontend/Stream.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Workload.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphAccessors.h"
+#include "tests/validation/Validation.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::VectorAccessor;
+
+namespace
+{
+const TensorShape         shape(8U, 4U, 2U);
+const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f);
+
+std::vector<float> make_values(float offset)
+{
+    std::vector<float> values(shape.total_size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 0.5f * i + offset;
+    }
+    return values;
+}
+
+void validate_activation(const std::vector<float> &input, const std::vector<float> &output)
+{
+    ARM_COMPUTE_ASSERT(input.size() == output.size());
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT_EQUAL(output[i], 2.f * input[i] + 1.f, framework::LogLevel::ERRORS);
+    }
+}
+
+/** Accessor counting its calls, which asks for more data until it has been called a given number of times */
+class CountingAccessor final : public graph::ITensorAccessor
+{
+public:
+    CountingAccessor(unsigned int &count, unsigned int num_runs) : _count(count), _num_runs(num_runs)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        ARM_COMPUTE_UNUSED(tensor);
+        return ++_count < _num_runs;
+    }
+
+private:
+    unsigned int &_count;
+    unsigned int  _num_runs;
+};
+
+/** Graph with a single activation between an input and an output node */
+struct ActivationGraph
+{
+    ActivationGraph(ITensorAccessorUPtr input_accessor, ITensorAccessorUPtr output_accessor) : g(0, "ImportMemory")
+    {
+        const NodeParams params{"", Target::NEON};
+
+        input_nid  = GraphBuilder::add_input_node(g, params, TensorDescriptor(shape, DataType::F32),
+                                                  std::move(input_accessor));
+        act_nid    = GraphBuilder::add_activation_node(g, params, {input_nid, 0}, act_info);
+        output_nid = GraphBuilder::add_output_node(g, params, {act_nid, 0}, std::move(output_accessor));
+
+        // No pass, so that the activation is not run in-place on the input
+        PassManager pm;
+        ctx.set_config(GraphConfig());
+        manager.finalize_graph(g, ctx, pm, Target::NEON);
+    }
+
+    GraphContext ctx{};
+    GraphManager manager{};
+    Graph        g;
+    NodeID       input_nid{EmptyNodeID};
+    NodeID       act_nid{EmptyNodeID};
+    NodeID       output_nid{EmptyNodeID};
+};
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ImportMemory)
+
+TEST_CASE(ImportInputAndOutput, framework::DatasetMode::ALL)
+{
+    std::vector<float> input  = make_values(-3.f);
+    std::vector<float> output(shape.total_size());
+
+    // The accessors of imported tensors are not called, so the values they would fill are never read
+    std::vector<float> accessor_values(shape.total_size());
+    ActivationGraph    graph(std::make_unique<VectorAccessor>(accessor_values, false),
+                             std::make_unique<VectorAccessor>(accessor_values, true));
+
+    ARM_COMPUTE_EXPECT(bool(graph.manager.import_memory(graph.g, graph.input_nid, input.data())),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(graph.manager.import_memory(graph.g, graph.output_nid, output.data())),
+                       framework::LogLevel::ERRORS);
+
+    // Every input and output is imported, so the graph runs once
+    graph.manager.execute_graph(graph.g);
+
+    validate_activation(input, output);
+}
+
+TEST_CASE(RebindBetweenRuns, framework::DatasetMode::ALL)
+{
+    std::vector<float> input0 = make_values(-3.f);
+    std::vector<float> input1 = make_values(5.f);
+    std::vector<float> output0(shape.total_size());
+    std::vector<float> output1(shape.total_size());
+
+    // The input accessor keeps the activation out of place, it is skipped once the input is imported
+    std::vector<float> accessor_values(shape.total_size());
+    frontend::Stream   stream(0, "ImportMemory");
+    stream << frontend::InputLayer(TensorDescriptor(shape, DataType::F32),
+                                   std::make_unique<VectorAccessor>(accessor_values, false))
+           << frontend::ActivationLayer(act_info) << frontend::OutputLayer(nullptr);
+    stream.finalize(Target::NEON, GraphConfig());
+
+    ARM_COMPUTE_EXPECT(bool(stream.import_input_memory(0, input0.data())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(stream.import_output_memory(0, output0.data())), framework::LogLevel::ERRORS);
+    stream.run();
+
+    // Bind other buffers without reconfiguring the graph
+    ARM_COMPUTE_EXPECT(bool(stream.import_input_memory(0, input1.data())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(stream.import_output_memory(0, output1.data())), framework::LogLevel::ERRORS);
+    stream.run();
+
+    validate_activation(input0, output0);
+    validate_activation(input1, output1);
+
+    // Out of range indices are rejected
+    ARM_COMPUTE_EXPECT(!bool(stream.import_input_memory(1, input0.data())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(stream.import_output_memory(1, output0.data())), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RunUntilOutputAccessorStops, framework::DatasetMode::ALL)
+{
+    std::vector<float> input = make_values(-3.f);
+    unsigned int       count = 0;
+    ActivationGraph    graph(nullptr, std::make_unique<CountingAccessor>(count, 3));
+
+    // The output is not imported, so its accessor decides when to stop
+    ARM_COMPUTE_EXPECT(bool(graph.manager.import_memory(graph.g, graph.input_nid, input.data())),
+                       framework::LogLevel::ERRORS);
+    graph.manager.execute_graph(graph.g);
+    ARM_COMPUTE_EXPECT_EQUAL(count, 3U, framework::LogLevel::ERRORS);
+
+    // Once every input and output is imported, the graph runs once without calling the accessor
+    std::vector<float> output(shape.total_size());
+    ARM_COMPUTE_EXPECT(bool(graph.manager.import_memory(graph.g, graph.output_nid, output.data())),
+                       framework::LogLevel::ERRORS);
+    graph.manager.execute_graph(graph.g);
+    ARM_COMPUTE_EXPECT_EQUAL(count, 3U, framework::LogLevel::ERRORS);
+    validate_activation(input, output);
+}
+
+TEST_CASE(RejectNonIONode, framework::DatasetMode::ALL)
+{
+    std::vector<float> memory(shape.total_size());
+    ActivationGraph    graph(nullptr, nullptr);
+
+    ARM_COMPUTE_EXPECT(!bool(graph.manager.import_memory(graph.g, graph.act_nid, memory.data())),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(graph.manager.import_memory(graph.g, graph.input_nid, nullptr)),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectSubTensorPaddingAndMisalignment, framework::DatasetMode::ALL)
+{
+    TensorInfo padded_info(shape, 1, DataType::F32);
+    padded_info.extend_padding(PaddingSize(1));
+
+    graph::Tensor parent(0, TensorDescriptor(shape, DataType::F32));
+    graph::Tensor sub_tensor(1, TensorDescriptor(TensorShape(8U, 4U), DataType::F32));
+    graph::Tensor padded(2, TensorDescriptor(shape, DataType::F32));
+    graph::Tensor not_io(3, TensorDescriptor(shape, DataType::F32));
+    parent.set_handle(std::make_unique<backends::NETensorHandle>(TensorInfo(shape, 1, DataType::F32)));
+    sub_tensor.set_handle(std::make_unique<backends::NESubTensorHandle>(parent.handle(), TensorShape(8U, 4U),
+                                                                        Coordinates(0, 0, 1)));
+    padded.set_handle(std::make_unique<backends::NETensorHandle>(padded_info));
+    not_io.set_handle(std::make_unique<backends::NETensorHandle>(TensorInfo(shape, 1, DataType::F32)));
+
+    ExecutionWorkload workload;
+    workload.inputs  = {&parent, &sub_tensor};
+    workload.outputs = {&padded};
+
+    std::vector<float> memory(padded_info.total_size() / sizeof(float));
+    auto              *misaligned = reinterpret_cast<uint8_t *>(memory.data()) + 1;
+
+    ARM_COMPUTE_EXPECT(!bool(graph::detail::import_tensor_memory(workload, &not_io, memory.data())),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(graph::detail::import_tensor_memory(workload, &sub_tensor, memory.data())),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(graph::detail::import_tensor_memory(workload, &padded, memory.data())),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(graph::detail::import_tensor_memory(workload, &parent, misaligned)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(workload.imported_tensors.empty(), framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(bool(graph::detail::import_tensor_memory(workload, &parent, memory.data())),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(workload.imported_tensors.count(&parent) == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ImportMemory
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/mutators/MixedPrecisionMutator.h"
+#include "arm_compute/graph/PassManager.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphAccessors.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::VectorAccessor;
+
+namespace
+{
+std::vector<float> make_values(size_t num_elements, float scale)
+{
+    std::vector<float> values(num_elements);
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        values[i] = scale * static_cast<float>(static_cast<int>((i * 7) % 13) - 6);
+    }
+    return values;
+}
+
+/** State of the graph after it ran */
+struct GraphRun
+{
+    std::vector<float> output{};                          /**< Values of the output */
+    DataType           conv0_type{DataType::UNKNOWN};     /**< Data type of the output of the first convolution */
+    DataType           conv1_type{DataType::UNKNOWN};     /**< Data type of the output of the second convolution */
+    DataType           weights_type{DataType::UNKNOWN};   /**< Data type of the weights of the first convolution */
+    DataType           softmax_type{DataType::UNKNOWN};   /**< Data type of the input of the softmax */
+    NodeType           conv0_producer{NodeType::Dummy};   /**< Type of the node feeding the first convolution */
+    NodeType           softmax_producer{NodeType::Dummy}; /**< Type of the node feeding the softmax */
+    size_t             num_casts{0};                      /**< Number of cast layers in the graph */
+};
+
+/** Run a 1x1 convolution, a 3x3 convolution and a softmax on a NHWC input
+ *
+ * @param[in] mixed_precision Run the mixed precision pass
+ */
+GraphRun run_graph(bool mixed_precision)
+{
+    const TensorShape  input_shape(8U, 5U, 4U);
+    std::vector<float> input    = make_values(input_shape.total_size(), 0.125f);
+    std::vector<float> weights0 = make_values(8U * 8U, 0.05f);
+    std::vector<float> biases0  = make_values(8U, 0.1f);
+    std::vector<float> weights1 = make_values(8U * 3U * 3U * 8U, 0.02f);
+    std::vector<float> biases1  = make_values(8U, -0.1f);
+
+    GraphRun run;
+    run.output.resize(input_shape.total_size());
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "MixedPrecision");
+
+    const NodeParams params{"", Target::NEON};
+
+    const NodeID input_nid = GraphBuilder::add_input_node(
+        g, params, TensorDescriptor(input_shape, DataType::F32, QuantizationInfo(), DataLayout::NHWC),
+        std::make_unique<VectorAccessor>(input, false));
+    const NodeID conv0_nid = GraphBuilder::add_convolution_node(
+        g, params, {input_nid, 0}, Size2D(1U, 1U), 8U, PadStrideInfo(1, 1, 0, 0), 1U, graph::ConvolutionMethod::Default,
+        graph::FastMathHint::Disabled, std::make_unique<VectorAccessor>(weights0, false),
+        std::make_unique<VectorAccessor>(biases0, false));
+    const NodeID conv1_nid = GraphBuilder::add_convolution_node(
+        g, params, {conv0_nid, 0}, Size2D(3U, 3U), 8U, PadStrideInfo(1, 1, 1, 1), 1U, graph::ConvolutionMethod::Default,
+        graph::FastMathHint::Disabled, std::make_unique<VectorAccessor>(weights1, false),
+        std::make_unique<VectorAccessor>(biases1, false));
+    const NodeID softmax_nid = GraphBuilder::add_softmax_node(g, params, {conv1_nid, 0});
+    GraphBuilder::add_output_node(g, params, {softmax_nid, 0}, std::make_unique<VectorAccessor>(run.output, true));
+
+    PassManager pm;
+    pm.append(std::make_unique<MixedPrecisionMutator>(), mixed_precision);
+
+    ctx.set_config(GraphConfig());
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+    manager.execute_graph(g);
+
+    const INode *conv0   = g.node(conv0_nid);
+    const INode *softmax = g.node(softmax_nid);
+
+    run.conv0_type       = conv0->output(0)->desc().data_type;
+    run.conv1_type       = g.node(conv1_nid)->output(0)->desc().data_type;
+    run.weights_type     = conv0->input(1)->desc().data_type;
+    run.softmax_type     = softmax->input(0)->desc().data_type;
+    run.conv0_producer   = conv0->input_edge(0)->producer()->type();
+    run.softmax_producer = softmax->input_edge(0)->producer()->type();
+    run.num_casts        = g.nodes(NodeType::CastLayer).size();
+    return run;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(MixedPrecision)
+
+TEST_CASE(ConvolutionChainRunsInBFloat16, framework::DatasetMode::ALL)
+{
+    const GraphRun reference = run_graph(false);
+    const GraphRun run       = run_graph(true);
+
+    if (!CPUInfo::get().has_bf16())
+    {
+        // The pass leaves the graph untouched
+        ARM_COMPUTE_EXPECT_EQUAL(run.conv0_type, DataType::F32, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(run.num_casts, 0U, framework::LogLevel::ERRORS);
+        return;
+    }
+
+    // Both convolutions store BFLOAT16, with a single cast at each end of the chain
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv0_type, DataType::BFLOAT16, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv1_type, DataType::BFLOAT16, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.weights_type, DataType::BFLOAT16, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.num_casts, 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run.conv0_producer == NodeType::CastLayer, framework::LogLevel::ERRORS);
+
+    // The softmax keeps running in F32
+    ARM_COMPUTE_EXPECT_EQUAL(run.softmax_type, DataType::F32, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run.softmax_producer == NodeType::CastLayer, framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT_EQUAL(run.output.size(), reference.output.size(), framework::LogLevel::ERRORS);
+    for (size_t i = 0; i < std::min(run.output.size(), reference.output.size()); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(run.output[i] - reference.output[i]) <= 0.01f, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(IsolatedConvolutionStaysF32, framework::DatasetMode::ALL)
+{
+    const TensorShape  input_shape(8U, 5U, 4U);
+    std::vector<float> input   = make_values(input_shape.total_size(), 0.125f);
+    std::vector<float> weights = make_values(8U * 8U, 0.05f);
+    std::vector<float> output(input_shape.total_size());
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "MixedPrecisionIsolated");
+
+    const NodeParams params{"", Target::NEON};
+
+    const NodeID input_nid = GraphBuilder::add_input_node(
+        g, params, TensorDescriptor(input_shape, DataType::F32, QuantizationInfo(), DataLayout::NHWC),
+        std::make_unique<VectorAccessor>(input, false));
+    const NodeID conv_nid = GraphBuilder::add_convolution_node(
+        g, params, {input_nid, 0}, Size2D(1U, 1U), 8U, PadStrideInfo(1, 1, 0, 0), 1U, graph::ConvolutionMethod::Default,
+        graph::FastMathHint::Disabled, std::make_unique<VectorAccessor>(weights, false));
+    const NodeID softmax_nid = GraphBuilder::add_softmax_node(g, params, {conv_nid, 0});
+    GraphBuilder::add_output_node(g, params, {softmax_nid, 0}, std::make_unique<VectorAccessor>(output, true));
+
+    PassManager pm;
+    pm.append(std::make_unique<MixedPrecisionMutator>());
+
+    ctx.set_config(GraphConfig());
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+    manager.execute_graph(g);
+
+    // Two casts would cost more than the BFLOAT16 storage of a single convolution saves
+    ARM_COMPUTE_EXPECT_EQUAL(g.node(conv_nid)->output(0)->desc().data_type, DataType::F32,
+                             framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(g.nodes(NodeType::CastLayer).size(), 0U, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // MixedPrecision
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
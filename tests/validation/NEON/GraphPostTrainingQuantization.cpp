@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/CalibrationTable.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/mutators/PostTrainingQuantizationMutator.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphAccessors.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::VectorAccessor;
+
+namespace
+{
+/** Record the range of some values in a calibration table
+ *
+ * @param[in, out] table       Calibration table to update
+ * @param[in]      tid         Tensor the values belong to
+ * @param[in]      shape       Shape of the values
+ * @param[in]      values      Values, with dimension 0 running fastest
+ * @param[in]      per_channel Also record the range of each channel along dimension 3
+ */
+void observe_values(CalibrationTable  &table,
+                    TensorID           tid,
+                    const TensorShape &shape,
+                    std::vector<float> values,
+                    bool               per_channel = false)
+{
+    arm_compute::Tensor tensor;
+    tensor.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+    tensor.allocator()->allocate();
+    VectorAccessor(values, false).access_tensor(tensor);
+
+    if (per_channel)
+    {
+        table.observe_channels(tid, tensor, 3);
+    }
+    else
+    {
+        table.observe(tid, tensor);
+    }
+}
+
+/** Ranges recorded for the quantization of the graph */
+enum class Calibration
+{
+    None,          /**< No ranges */
+    MissingOutput, /**< Every range but the output of the second convolution */
+    All            /**< Every range */
+};
+
+/** State of the graph after it ran */
+struct GraphRun
+{
+    std::vector<float> output{};                      /**< Values of the output */
+    DataType           conv0_type{DataType::UNKNOWN}; /**< Data type of the output of the first convolution */
+    DataType           conv1_type{DataType::UNKNOWN}; /**< Data type of the output of the second convolution */
+    size_t             num_quantizations{0};          /**< Number of quantization layers in the graph */
+    size_t             num_dequantizations{0};        /**< Number of dequantization layers in the graph */
+};
+
+/** Run two 1x1 convolutions followed by an identity activation
+ *
+ * @param[in] quantize    Run the post-training quantization
+ * @param[in] calibration Ranges given to the quantization
+ */
+GraphRun run_graph(bool quantize, Calibration calibration)
+{
+    const TensorShape  input_shape(4U, 4U, 2U);
+    const TensorShape  weights_shape(1U, 1U, 2U, 2U);
+    std::vector<float> input(input_shape.total_size());
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = -2.f + i * 0.125f;
+    }
+    std::vector<float> weights0{0.5f, -0.25f, 0.75f, 1.f};
+    std::vector<float> biases0{0.1f, -0.2f};
+    std::vector<float> weights1{1.f, -0.5f, 0.25f, 0.5f};
+    std::vector<float> biases1{0.f, 0.3f};
+
+    GraphRun run;
+    run.output.resize(input_shape.total_size());
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "PostTrainingQuantization");
+
+    const NodeParams params{"", Target::NEON};
+
+    const NodeID input_nid = GraphBuilder::add_input_node(g, params, TensorDescriptor(input_shape, DataType::F32),
+                                                          std::make_unique<VectorAccessor>(input, false));
+    const NodeID conv0_nid = GraphBuilder::add_convolution_node(
+        g, params, {input_nid, 0}, Size2D(1U, 1U), 2U, PadStrideInfo(1, 1, 0, 0), 1U, graph::ConvolutionMethod::Default,
+        graph::FastMathHint::Disabled, std::make_unique<VectorAccessor>(weights0, false),
+        std::make_unique<VectorAccessor>(biases0, false));
+    const NodeID conv1_nid = GraphBuilder::add_convolution_node(
+        g, params, {conv0_nid, 0}, Size2D(1U, 1U), 2U, PadStrideInfo(1, 1, 0, 0), 1U, graph::ConvolutionMethod::Default,
+        graph::FastMathHint::Disabled, std::make_unique<VectorAccessor>(weights1, false),
+        std::make_unique<VectorAccessor>(biases1, false));
+    // The output accessor would prevent the quantization of the output of the second convolution
+    const NodeID act_nid = GraphBuilder::add_activation_node(
+        g, params, {conv1_nid, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 1.f, 0.f));
+    GraphBuilder::add_output_node(g, params, {act_nid, 0}, std::make_unique<VectorAccessor>(run.output, true));
+
+    INode *conv0 = g.node(conv0_nid);
+    INode *conv1 = g.node(conv1_nid);
+
+    CalibrationTable table;
+    if (calibration != Calibration::None)
+    {
+        observe_values(table, conv0->input(0)->id(), TensorShape(2U), {-2.f, 2.f});
+        observe_values(table, conv0->output(0)->id(), TensorShape(2U), {-4.f, 4.f});
+        observe_values(table, conv0->input(1)->id(), weights_shape, weights0, true);
+        observe_values(table, conv1->input(1)->id(), weights_shape, weights1, true);
+        if (calibration == Calibration::All)
+        {
+            observe_values(table, conv1->output(0)->id(), TensorShape(2U), {-4.f, 4.f});
+        }
+    }
+
+    PassManager pm;
+    pm.append(std::make_unique<PostTrainingQuantizationMutator>(std::move(table)), quantize);
+
+    ctx.set_config(GraphConfig());
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+    manager.execute_graph(g);
+
+    run.conv0_type          = conv0->output(0)->desc().data_type;
+    run.conv1_type          = conv1->output(0)->desc().data_type;
+    run.num_quantizations   = g.nodes(NodeType::QuantizationLayer).size();
+    run.num_dequantizations = g.nodes(NodeType::DequantizationLayer).size();
+    return run;
+}
+
+/** Check that the outputs of two runs are within an absolute tolerance */
+void validate_outputs(const std::vector<float> &output, const std::vector<float> &reference, float tolerance)
+{
+    ARM_COMPUTE_EXPECT_EQUAL(output.size(), reference.size(), framework::LogLevel::ERRORS);
+    for (size_t i = 0; i < std::min(output.size(), reference.size()); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(output[i] - reference[i]) <= tolerance, framework::LogLevel::ERRORS);
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(PostTrainingQuantization)
+
+TEST_CASE(EmptyTableLeavesGraphUnchanged, framework::DatasetMode::ALL)
+{
+    const GraphRun reference = run_graph(false, Calibration::None);
+    const GraphRun run       = run_graph(true, Calibration::None);
+
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv0_type, DataType::F32, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv1_type, DataType::F32, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.num_quantizations, 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.num_dequantizations, 0U, framework::LogLevel::ERRORS);
+    validate_outputs(run.output, reference.output, 0.f);
+}
+
+TEST_CASE(MissingOutputRangeKeepsConvolutionF32, framework::DatasetMode::ALL)
+{
+    const GraphRun reference = run_graph(false, Calibration::None);
+    const GraphRun run       = run_graph(true, Calibration::MissingOutput);
+
+    // Only the first convolution is quantized, and its output is dequantized for the second one
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv0_type, DataType::QASYMM8_SIGNED, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv1_type, DataType::F32, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.num_quantizations, 1U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.num_dequantizations, 1U, framework::LogLevel::ERRORS);
+    validate_outputs(run.output, reference.output, 0.1f);
+}
+
+TEST_CASE(FullTableQuantizesChain, framework::DatasetMode::ALL)
+{
+    const GraphRun reference = run_graph(false, Calibration::None);
+    const GraphRun run       = run_graph(true, Calibration::All);
+
+    // Both convolutions run in 8-bit, with a single conversion at each end of the chain
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv0_type, DataType::QASYMM8_SIGNED, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.conv1_type, DataType::QASYMM8_SIGNED, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.num_quantizations, 1U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(run.num_dequantizations, 1U, framework::LogLevel::ERRORS);
+    validate_outputs(run.output, reference.output, 0.1f);
+}
+
+TEST_SUITE_END() // PostTrainingQuantization
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
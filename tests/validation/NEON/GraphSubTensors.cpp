@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
+#include "arm_compute/graph/mutators/SliceLayerSubTensorMutator.h"
+#include "arm_compute/graph/mutators/StackLayerSubTensorMutator.h"
+#include "arm_compute/graph/nodes/ConcatenateLayerNode.h"
+#include "arm_compute/graph/nodes/SliceLayerNode.h"
+#include "arm_compute/graph/nodes/StackLayerNode.h"
+#include "arm_compute/graph/PassManager.h"
+
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/helpers/GraphAccessors.h"
+#include "tests/validation/Validation.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::VectorAccessor;
+
+namespace
+{
+std::vector<float> make_values(const TensorShape &shape)
+{
+    std::vector<float> values(shape.total_size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 0.5f * i - 7.f;
+    }
+    return values;
+}
+
+/** Activation, whose Neon function only collapses its window when its tensors have no holes */
+const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f);
+
+float activation(float x)
+{
+    return 2.f * x + 1.f;
+}
+
+/** Finalize a graph with the sub-tensor mutators only, so that no other pass changes the consumers, and run it */
+void run_graph(Graph &g, GraphContext &ctx, GraphManager &manager)
+{
+    PassManager pm;
+    pm.append(std::make_unique<DepthConcatSubTensorMutator>());
+    pm.append(std::make_unique<SliceLayerSubTensorMutator>());
+    pm.append(std::make_unique<StackLayerSubTensorMutator>());
+
+    ctx.set_config(GraphConfig());
+    manager.finalize_graph(g, ctx, pm, Target::NEON);
+    manager.execute_graph(g);
+}
+
+/** Slice [0, 5) x [start_y, end_y) x [start_z, end_z) of a 5x6x3 input, activate or flatten it and check the output
+ *
+ * @return True if the slice was turned into a view of its input else false
+ */
+bool run_slice(int start_y, int end_y, int start_z, int end_z, bool activate = true)
+{
+    const TensorShape  input_shape(5U, 6U, 3U);
+    const TensorShape  output_shape(5U, end_y - start_y, end_z - start_z);
+    std::vector<float> input = make_values(input_shape);
+    std::vector<float> output(output_shape.total_size());
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "Slice");
+
+    const NodeParams params{"", Target::NEON};
+    Coordinates      starts(0, start_y, start_z);
+    Coordinates      ends(5, end_y, end_z);
+
+    const NodeID input_nid = GraphBuilder::add_input_node(g, params, TensorDescriptor(input_shape, DataType::F32),
+                                                          std::make_unique<VectorAccessor>(input, false));
+    const NodeID slice_nid = GraphBuilder::add_slice_node(g, params, {input_nid, 0}, starts, ends);
+    const NodeID out_nid   = activate
+                                 ? GraphBuilder::add_activation_node(g, params, {slice_nid, 0}, act_info)
+                                 : GraphBuilder::add_reshape_node(g, params, {slice_nid, 0},
+                                                                  TensorShape(output_shape.total_size()));
+    GraphBuilder::add_output_node(g, params, {out_nid, 0}, std::make_unique<VectorAccessor>(output, true));
+
+    run_graph(g, ctx, manager);
+
+    size_t index = 0;
+    for (int z = start_z; z < end_z; ++z)
+    {
+        for (int y = start_y; y < end_y; ++y)
+        {
+            for (int x = 0; x < 5; ++x)
+            {
+                const float src      = input[x + 5 * (y + 6 * z)];
+                const float expected = activate ? activation(src) : src;
+                ARM_COMPUTE_EXPECT_EQUAL(output[index++], expected, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+
+    return !utils::cast::polymorphic_downcast<SliceLayerNode *>(g.node(slice_nid))->is_enabled();
+}
+
+/** Activate two inputs of the given shape, stack them along a new outermost dimension and check the output
+ *
+ * @return True if the activations write into views of the stack output else false
+ */
+bool run_stack(const TensorShape &input_shape)
+{
+    const int          axis = static_cast<int>(input_shape.num_dimensions());
+    TensorShape        output_shape(input_shape);
+    std::vector<float> input0 = make_values(input_shape);
+    std::vector<float> input1(input_shape.total_size());
+    for (size_t i = 0; i < input1.size(); ++i)
+    {
+        input1[i] = 3.f - 0.25f * i;
+    }
+    output_shape.set(axis, 2);
+    std::vector<float> output(output_shape.total_size());
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "Stack");
+
+    const NodeParams params{"", Target::NEON};
+
+    const NodeID input0_nid = GraphBuilder::add_input_node(g, params, TensorDescriptor(input_shape, DataType::F32),
+                                                           std::make_unique<VectorAccessor>(input0, false));
+    const NodeID input1_nid = GraphBuilder::add_input_node(g, params, TensorDescriptor(input_shape, DataType::F32),
+                                                           std::make_unique<VectorAccessor>(input1, false));
+    const NodeID act0_nid   = GraphBuilder::add_activation_node(g, params, {input0_nid, 0}, act_info);
+    const NodeID act1_nid   = GraphBuilder::add_activation_node(g, params, {input1_nid, 0}, act_info);
+    const NodeID stack_nid  = GraphBuilder::add_stack_node(g, params, {{act0_nid, 0}, {act1_nid, 0}}, axis);
+    GraphBuilder::add_output_node(g, params, {stack_nid, 0}, std::make_unique<VectorAccessor>(output, true));
+
+    run_graph(g, ctx, manager);
+
+    // Stacking along a new outermost dimension lays the inputs out one after the other
+    for (size_t i = 0; i < input0.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT_EQUAL(output[i], activation(input0[i]), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(output[input0.size() + i], activation(input1[i]), framework::LogLevel::ERRORS);
+    }
+
+    return !utils::cast::polymorphic_downcast<StackLayerNode *>(g.node(stack_nid))->is_enabled();
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(SubTensors)
+
+TEST_CASE(SliceAlongHeightIntoActivation, framework::DatasetMode::ALL)
+{
+    // The view splits the planes of the input, which the activation supports
+    ARM_COMPUTE_EXPECT(run_slice(1, 4, 0, 3), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(SliceAlongHeightIntoUncheckedConsumer, framework::DatasetMode::ALL)
+{
+    // The view would split the planes of the input, and the reshape has not been checked to support it
+    ARM_COMPUTE_EXPECT(!run_slice(1, 4, 0, 3, false), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(SliceAlongChannels, framework::DatasetMode::ALL)
+{
+    // The view keeps whole planes of the input, so it is used whatever the consumer
+    ARM_COMPUTE_EXPECT(run_slice(0, 6, 1, 3), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ConcatAlongWidthFromActivations, framework::DatasetMode::ALL)
+{
+    const TensorShape  shape0(2U, 4U, 3U);
+    const TensorShape  shape1(3U, 4U, 3U);
+    const TensorShape  output_shape(5U, 4U, 3U);
+    std::vector<float> input0 = make_values(shape0);
+    std::vector<float> input1 = make_values(shape1);
+    std::vector<float> output(output_shape.total_size());
+
+    GraphContext ctx;
+    GraphManager manager;
+    Graph        g(0, "Concat");
+
+    const NodeParams params{"", Target::NEON};
+
+    const NodeID input0_nid = GraphBuilder::add_input_node(g, params, TensorDescriptor(shape0, DataType::F32),
+                                                           std::make_unique<VectorAccessor>(input0, false));
+    const NodeID input1_nid = GraphBuilder::add_input_node(g, params, TensorDescriptor(shape1, DataType::F32),
+                                                           std::make_unique<VectorAccessor>(input1, false));
+    const NodeID act0_nid   = GraphBuilder::add_activation_node(g, params, {input0_nid, 0}, act_info);
+    const NodeID act1_nid   = GraphBuilder::add_activation_node(g, params, {input1_nid, 0}, act_info);
+    const NodeID concat_nid = GraphBuilder::add_concatenate_node(
+        g, params, {{act0_nid, 0}, {act1_nid, 0}}, descriptors::ConcatLayerDescriptor(DataLayoutDimension::WIDTH));
+    GraphBuilder::add_output_node(g, params, {concat_nid, 0}, std::make_unique<VectorAccessor>(output, true));
+
+    run_graph(g, ctx, manager);
+
+    // The activations write into views that split the rows of the output, so the concatenation is removed
+    ARM_COMPUTE_EXPECT(!utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(g.node(concat_nid))->is_enabled(),
+                       framework::LogLevel::ERRORS);
+
+    size_t index = 0;
+    for (size_t z = 0; z < output_shape[2]; ++z)
+    {
+        for (size_t y = 0; y < output_shape[1]; ++y)
+        {
+            for (size_t x = 0; x < output_shape[0]; ++x)
+            {
+                const float src      = x < shape0[0] ? input0[x + shape0[0] * (y + shape0[1] * z)]
+                                                     : input1[x - shape0[0] + shape1[0] * (y + shape1[1] * z)];
+                const float expected = activation(src);
+                ARM_COMPUTE_EXPECT_EQUAL(output[index++], expected, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+
+TEST_CASE(StackAlongNewOutermostDimension, framework::DatasetMode::ALL)
+{
+    // The inputs keep whole planes of the output
+    ARM_COMPUTE_EXPECT(run_stack(TensorShape(4U, 3U, 2U)), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(StackRowsFromActivations, framework::DatasetMode::ALL)
+{
+    // The inputs split the planes of the output, which the activations support
+    ARM_COMPUTE_EXPECT(run_stack(TensorShape(5U)), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // SubTensors
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/runtime/NEON/functions/NELSTMLayer.h"
 
+#include "src/cpu/kernels/CpuLSTMCellKernel.h"
 #include "tests/datasets/LSTMLayerDataset.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/datasets/Datasets.h"
@@ -42,6 +43,39 @@ namespace
 {
 RelativeTolerance<float> tolerance_f32(0.00001f);
 RelativeTolerance<half>  tolerance_f16(half(0.1));
+
+/** Check that a configuration meets the conditions of NELSTMLayer to take the fused cell path */
+bool takes_fused_cell(const TensorShape         &input_shape,
+                      const TensorShape         &cell_bias_shape,
+                      const TensorShape         &output_cell_shape,
+                      const TensorShape         &output_shape,
+                      const TensorShape         &scratch_shape,
+                      const ActivationLayerInfo &info,
+                      float                      cell_threshold,
+                      DataType                   data_type)
+{
+    LSTMCellKernelInfo cell_info{};
+    cell_info.act_info       = info;
+    cell_info.cell_threshold = cell_threshold;
+    cell_info.has_cifg_opt   = scratch_shape.x() != cell_bias_shape.x() * 4;
+
+    const unsigned int num_gates   = cell_info.has_cifg_opt ? 3 : 4;
+    const unsigned int num_units   = cell_bias_shape.x();
+    const unsigned int num_batches = input_shape.y();
+
+    const TensorInfo concat_input(TensorShape(input_shape.x() + output_shape.x(), num_batches), 1, data_type);
+    const TensorInfo gate_weights(TensorShape(concat_input.dimension(0), num_units * num_gates), 1, data_type);
+    const TensorInfo gates(TensorShape(num_units * num_gates, num_batches), 1, data_type);
+    const TensorInfo coefficients(TensorShape(num_units, static_cast<unsigned int>(LSTMCellCoefficient::Count)), 1,
+                                  data_type);
+    const TensorInfo state(output_cell_shape, 1, data_type);
+    const TensorInfo scratch(scratch_shape, 1, data_type);
+
+    return bool(NEFullyConnectedLayer::validate(&concat_input, &gate_weights, nullptr, &gates)) &&
+           output_shape == output_cell_shape &&
+           bool(cpu::kernels::CpuLSTMCellKernel::validate(&gates, &state, &coefficients, &state, &state, &scratch,
+                                                          cell_info));
+}
 } // namespace
 
 using framework::dataset::make;
@@ -182,6 +216,44 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     validate(Accessor(_target), _reference, tolerance_f32);
     validate(Accessor(_target_scratch), _reference_scratch, tolerance_f32);
 }
+
+TEST_SUITE(FusedCell)
+DATA_TEST_CASE(Supported,
+               framework::DatasetMode::ALL,
+               combine(datasets::FusedCellLSTMLayerDataset(), make("DataType", DataType::F32)),
+               input_shape,
+               input_weights_shape,
+               recurrent_weights_shape,
+               cell_bias_shape,
+               output_cell_shape,
+               output_shape,
+               scratch_shape,
+               info,
+               cell_threshold,
+               projection_threshold,
+               data_type)
+{
+    ARM_COMPUTE_UNUSED(input_weights_shape, recurrent_weights_shape, projection_threshold);
+    // Guarantee that RunSmall below exercises CpuLSTMCellKernel rather than the per-gate path
+    ARM_COMPUTE_EXPECT(takes_fused_cell(input_shape, cell_bias_shape, output_cell_shape, output_shape, scratch_shape,
+                                        info, cell_threshold, data_type),
+                       framework::LogLevel::ERRORS);
+}
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELSTMLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::FusedCellLSTMLayerDataset(),
+                               make("DataType", DataType::F32),
+                               make("ProjectionOpt", {true, false}),
+                               make("PeepholeOpt", {true, false}),
+                               make("UseLayerNorm", {true, false}),
+                               make("UseMemoryManager", {false})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    validate(Accessor(_target_scratch), _reference_scratch, tolerance_f32);
+}
+TEST_SUITE_END() // FusedCell
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
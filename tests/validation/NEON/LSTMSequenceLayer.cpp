@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELSTMSequenceLayer.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/LSTMSequenceLayerFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+RelativeTolerance<float> tolerance_f32(
+    0.001f); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType:F32 */
+constexpr float abs_tolerance_f32(
+    0.0001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType:F32 */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+RelativeTolerance<half> tolerance_f16(half(
+    0.1)); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType:F16 */
+constexpr float         abs_tolerance_f16(
+            0.02f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType:F16 */
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+/** Input size, number of units, batch size, number of steps, cell activation and cell clipping threshold */
+const auto SmallLSTMSequenceDataset =
+    zip(make("InputSize", {8U, 27U, 13U}),
+        make("NumUnits", {16U, 11U, 37U}),
+        make("NumBatches", {1U, 5U, 3U}),
+        make("NumSteps", {4U, 3U, 2U}),
+        make("ActivationInfo",
+             {ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+              ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+              ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 1.f, -1.f)}),
+        make("CellThreshold", {0.f, 0.5f, 0.f}));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LSTMSequenceLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(8U, 2U, 3U), 1, DataType::U8),      // Wrong data type
+                                   TensorInfo(TensorShape(8U, 2U, 3U), 1, DataType::F32),     // Wrong cell state size
+                                   TensorInfo(TensorShape(8U, 2U, 3U), 1, DataType::F32),     // Wrong output size
+                                   TensorInfo(TensorShape(8U, 2U, 3U), 1, DataType::F32),     // Unsupported activation
+                                   TensorInfo(TensorShape(8U, 2U, 3U), 1, DataType::F32),
+               }),
+               make("CellStateInfo", { TensorInfo(TensorShape(16U, 2U), 1, DataType::F32),
+                                       TensorInfo(TensorShape(16U, 3U), 1, DataType::F32),
+                                       TensorInfo(TensorShape(16U, 2U), 1, DataType::F32),
+                                       TensorInfo(TensorShape(16U, 2U), 1, DataType::F32),
+                                       TensorInfo(TensorShape(16U, 2U), 1, DataType::F32),
+               }),
+               make("OutputInfo", { TensorInfo(TensorShape(16U, 2U, 3U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 2U, 3U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 2U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 2U, 3U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 2U, 3U), 1, DataType::F32),
+               }),
+               make("ActivationInfo", { ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::SQRT),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+               }),
+               make("Expected", { false, false, false, false, true })
+               ),
+               input_info, cell_state_info, output_info, info, expected)
+{
+    const TensorInfo input_weights_info(TensorShape(8U, 16U), 1, DataType::F32);
+    const TensorInfo recurrent_weights_info(TensorShape(16U, 16U), 1, DataType::F32);
+    const TensorInfo bias_info(TensorShape(16U), 1, DataType::F32);
+    const TensorInfo state_info(TensorShape(16U, 2U), 1, DataType::F32);
+    LSTMParams<ITensorInfo> lstm_params_info;
+    ARM_COMPUTE_EXPECT(bool(NELSTMSequenceLayer::validate(&input_info.clone()->set_is_resizable(false), &input_weights_info, &input_weights_info, &input_weights_info,
+                                                          &recurrent_weights_info, &recurrent_weights_info, &recurrent_weights_info, &bias_info, &bias_info, &bias_info,
+                                                          &state_info, &cell_state_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false),
+                                                          &state_info, &state_info, lstm_params_info, info)) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NELSTMSequenceLayerFixture =
+    LSTMSequenceLayerValidationFixture<Tensor, Accessor, NELSTMSequenceLayer, LSTMParams<ITensor>, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELSTMSequenceLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallLSTMSequenceDataset,
+                               make("DataType", DataType::F32),
+                               make("CifgOpt", {true, false}),
+                               make("PeepholeOpt", {true, false})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NELSTMSequenceLayerFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallLSTMSequenceDataset,
+                               make("DataType", DataType::F16),
+                               make("CifgOpt", {true, false}),
+                               make("PeepholeOpt", {true, false})))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16, 0.02f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // LSTMSequenceLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
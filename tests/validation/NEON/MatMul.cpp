@@ -187,6 +187,10 @@ using NEMatMulDynamicTensorsFixture =
 template <typename T>
 using NEQuantizedMatMulFixture = QuantizedMatMulValidationFixture<Tensor, Accessor, NEMatMul, CpuMatMulSettings, T>;
 
+template <typename T>
+using NEMatMulDynamicQuantizationFixture =
+    MatMulDynamicQuantizationFixture<Tensor, Accessor, NEMatMul, CpuMatMulSettings, T>;
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall,
@@ -247,11 +251,45 @@ FIXTURE_DATA_TEST_CASE(RunStressDynamicTensors,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+
+#ifdef __aarch64__
+TEST_SUITE(DynamicQuantization)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NEMatMulDynamicQuantizationFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallMatMulDataset(),
+                               make("TransposeA", {false, true}),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::F32),
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH)})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge,
+                       NEMatMulDynamicQuantizationFixture<float>,
+                       framework::DatasetMode::NIGHTLY,
+                       combine(datasets::LargeMatMulDataset(),
+                               make("TransposeA", {false, true}),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::F32),
+                               make("ActivationInfo", ActivationLayerInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END() // DynamicQuantization
+#endif // __aarch64__
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_BF16
 /* Note : MatMul BF16 is enabled by specifying FP32 datatype and enabling the fast math setting */
 constexpr AbsoluteTolerance<float> tolerance_bf16(0.02f);
+constexpr RelativeTolerance<float> rel_tolerance_bf16(0.01f);
+constexpr float                    abs_tolerance_bf16 = 0.01f;
 TEST_SUITE(BF16)
 FIXTURE_DATA_TEST_CASE(RunSmall,
                        NEMatMulFastMathFixture<float>,
@@ -271,6 +309,32 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     validate(Accessor(_target), _reference, tolerance_bf16);
 }
 
+// BFLOAT16 destinations run the non fixed-format interleaved BFLOAT16 kernels, which need a reduction longer than 4
+FIXTURE_DATA_TEST_CASE(RunSmallBFloat16Output,
+                       NEMatMulFixture<bfloat16>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallerMatMulDataset(),
+                               make("TransposeA", {false, true}),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::BFLOAT16),
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+                                                         0.5f)})))
+{
+    if (CPUInfo::get().has_bf16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_bf16, 0.f, abs_tolerance_bf16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support bf16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
 FIXTURE_DATA_TEST_CASE(RunTinyFixedFormat,
                        NEMatMulFixedFormatFixture<bfloat16>,
@@ -66,8 +66,28 @@ const auto PermuteVectors4 =
           PermutationVector(1U, 3U, 2U, 0U), PermutationVector(3U, 1U, 2U, 0U), PermutationVector(3U, 0U, 2U, 1U),
           PermutationVector(0U, 3U, 2U, 1U)});
 const auto PermuteVectors = concat(PermuteVectors2, PermuteVectors3, PermuteVectors4);
-const auto PermuteParametersSmall =
-    concat(datasets::Small2DShapes(), datasets::Small3DShapes(), datasets::Small4DShapes()) * PermuteVectors;
+const auto PermuteVectors5 = make("PermutationVector",
+                                  {
+                                      PermutationVector(0U, 2U, 1U, 3U, 4U),
+                                      PermutationVector(2U, 0U, 3U, 1U, 4U),
+                                      PermutationVector(4U, 3U, 2U, 1U, 0U),
+                                      PermutationVector(1U, 2U, 3U, 4U, 0U),
+                                  });
+const auto PermuteVectors6 = make("PermutationVector",
+                                  {
+                                      PermutationVector(0U, 2U, 1U, 3U, 4U, 5U),
+                                      PermutationVector(5U, 3U, 1U, 0U, 2U, 4U),
+                                      PermutationVector(1U, 2U, 3U, 4U, 5U, 0U),
+                                  });
+const auto Small6DShapes = make("Shape",
+                                {
+                                    TensorShape(5U, 4U, 3U, 2U, 3U, 2U),
+                                    TensorShape(33U, 2U, 9U, 1U, 4U, 3U),
+                                });
+const auto PermuteParametersSmall = concat(
+    concat(datasets::Small2DShapes(), datasets::Small3DShapes(), datasets::Small4DShapes()) * PermuteVectors,
+    datasets::Small5dShapes() * PermuteVectors5,
+    Small6DShapes * PermuteVectors6);
 const auto PermuteParametersLarge = datasets::Large4DShapes() * PermuteVectors;
 } // namespace
 TEST_SUITE(NEON)
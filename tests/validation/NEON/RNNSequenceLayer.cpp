@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NERNNSequenceLayer.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/RNNSequenceLayerFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+RelativeTolerance<float> tolerance_f32(
+    0.001f); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType:F32 */
+constexpr float abs_tolerance_f32(
+    0.0001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType:F32 */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+RelativeTolerance<half> tolerance_f16(half(
+    0.1)); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType:F16 */
+constexpr float         abs_tolerance_f16(
+            0.02f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType:F16 */
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+/** Input size, number of units, batch size and number of steps */
+const auto SmallRNNSequenceDataset = zip(make("InputSize", {8U, 27U, 32U}),
+                                         make("NumUnits", {16U, 11U, 37U}),
+                                         make("NumBatches", {1U, 5U, 3U}),
+                                         make("NumSteps", {4U, 3U, 1U}));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(RNNSequenceLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(27U, 13U, 4U), 1, DataType::U8),      // Wrong data type
+                                   TensorInfo(TensorShape(27U, 13U, 4U, 2U), 1, DataType::F32), // Wrong input size
+                                   TensorInfo(TensorShape(27U, 13U, 4U), 1, DataType::F32),     // Wrong recurrent weights size
+                                   TensorInfo(TensorShape(27U, 13U, 4U), 1, DataType::F32),     // Wrong output size
+                                   TensorInfo(TensorShape(27U, 13U, 4U), 1, DataType::F32),     // Unsupported activation
+                                   TensorInfo(TensorShape(27U, 13U, 4U), 1, DataType::F32),
+               }),
+               make("RecurrentWeightsInfo", { TensorInfo(TensorShape(11U, 11U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(11U, 11U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(11U, 12U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(11U, 11U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(11U, 11U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(11U, 11U), 1, DataType::F32),
+               }),
+               make("OutputInfo", { TensorInfo(TensorShape(11U, 13U, 4U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(11U, 13U, 4U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(11U, 13U, 4U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(11U, 13U, 3U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(11U, 13U, 4U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(11U, 13U, 4U), 1, DataType::F32),
+               }),
+               make("ActivationInfo", { ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::SQRT),
+                                        ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+               }),
+               make("Expected", { false, false, false, false, false, true })
+               ),
+               input_info, recurrent_weights_info, output_info, info, expected)
+{
+    const TensorInfo weights_info(TensorShape(27U, 11U), 1, DataType::F32);
+    const TensorInfo bias_info(TensorShape(11U), 1, DataType::F32);
+    const TensorInfo hidden_state_info(TensorShape(11U, 13U), 1, DataType::F32);
+    ARM_COMPUTE_EXPECT(bool(NERNNSequenceLayer::validate(&input_info.clone()->set_is_resizable(false), &weights_info, &recurrent_weights_info.clone()->set_is_resizable(false), &bias_info, &hidden_state_info, &output_info.clone()->set_is_resizable(false), info)) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NERNNSequenceLayerFixture = RNNSequenceLayerValidationFixture<Tensor, Accessor, NERNNSequenceLayer, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NERNNSequenceLayerFixture<float>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallRNNSequenceDataset,
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f),
+                                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)}),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       NERNNSequenceLayerFixture<half>,
+                       framework::DatasetMode::ALL,
+                       combine(SmallRNNSequenceDataset,
+                               make("ActivationInfo",
+                                    {ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f)}),
+                               make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16, 0.02f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // RNNSequenceLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
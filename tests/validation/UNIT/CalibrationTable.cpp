@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/CalibrationTable.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Create an F32 tensor holding some values, with dimension 0 running fastest */
+void fill_tensor(Tensor &tensor, const TensorShape &shape, const std::vector<float> &values)
+{
+    tensor.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+    tensor.allocator()->allocate();
+
+    Window win;
+    win.use_tensor_dimensions(shape);
+
+    size_t index = 0;
+    execute_window_loop(win, [&](const Coordinates &id)
+                        { *reinterpret_cast<float *>(tensor.ptr_to_element(id)) = values[index++]; });
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(CalibrationTable)
+
+/** Validate that the min-max ranges cover every observed value */
+TEST_CASE(MinMaxRange, framework::DatasetMode::ALL)
+{
+    Tensor first;
+    Tensor second;
+    fill_tensor(first, TensorShape(3U, 2U), {-1.5f, 0.25f, 2.f, 0.f, -0.5f, 1.f});
+    fill_tensor(second, TensorShape(3U, 2U), {-0.5f, 3.5f, 1.f, 0.f, -2.f, 1.f});
+
+    graph::CalibrationTable table;
+    ARM_COMPUTE_EXPECT(!table.has_range(0), framework::LogLevel::ERRORS);
+
+    table.observe(0, first);
+    ARM_COMPUTE_EXPECT(table.has_range(0), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(table.range(0).first, -1.5f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(table.range(0).second, 2.f, framework::LogLevel::ERRORS);
+
+    // Ranges accumulate over the observations
+    table.observe(0, second);
+    ARM_COMPUTE_EXPECT_EQUAL(table.range(0).first, -2.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(table.range(0).second, 3.5f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(table.channel_ranges(0).empty(), framework::LogLevel::ERRORS);
+}
+
+/** Validate the absolute range of each channel along the innermost and an outer dimension */
+TEST_CASE(ChannelRanges, framework::DatasetMode::ALL)
+{
+    Tensor tensor;
+    fill_tensor(tensor, TensorShape(3U, 2U), {-1.5f, 0.25f, 2.f, 0.f, -0.5f, 1.f});
+
+    graph::CalibrationTable table;
+    table.observe_channels(0, tensor, 0);
+    table.observe_channels(1, tensor, 1);
+
+    const std::vector<float> x_ranges = table.channel_ranges(0);
+    ARM_COMPUTE_EXPECT_EQUAL(x_ranges.size(), 3U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(x_ranges[0], 1.5f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(x_ranges[1], 0.5f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(x_ranges[2], 2.f, framework::LogLevel::ERRORS);
+
+    const std::vector<float> y_ranges = table.channel_ranges(1);
+    ARM_COMPUTE_EXPECT_EQUAL(y_ranges.size(), 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(y_ranges[0], 2.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(y_ranges[1], 1.f, framework::LogLevel::ERRORS);
+
+    // The per-channel observations also record the range of the whole tensor
+    ARM_COMPUTE_EXPECT_EQUAL(table.range(1).first, -1.5f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(table.range(1).second, 2.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(table.channel_ranges(2).empty(), framework::LogLevel::ERRORS);
+}
+
+/** Validate that the percentile method clips a rare outlier */
+TEST_CASE(PercentileClipsOutliers, framework::DatasetMode::ALL)
+{
+    Tensor tensor;
+    fill_tensor(tensor, TensorShape(10U), {1.f, 1.f, 1.f, 1.f, 100.f, 1.f, 1.f, 1.f, 1.f, 1.f});
+
+    graph::CalibrationTable min_max;
+    graph::CalibrationTable percentile(graph::CalibrationMethod::Percentile, 50.f);
+    min_max.observe(0, tensor);
+    percentile.observe(0, tensor);
+
+    ARM_COMPUTE_EXPECT_EQUAL(min_max.range(0).second, 100.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(percentile.range(0).first, 1.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(percentile.range(0).second >= 1.f && percentile.range(0).second < 2.f,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Validate that a saved table loads back with the same ranges, already clipped */
+TEST_CASE(SaveLoadRoundTrip, framework::DatasetMode::ALL)
+{
+    Tensor activations;
+    Tensor outliers;
+    Tensor weights;
+    fill_tensor(activations, TensorShape(3U, 2U), {-1.5f, 0.25f, 2.f, 0.f, -0.5f, 1.f / 3.f});
+    fill_tensor(outliers, TensorShape(10U), {1.f, 1.f, 1.f, 1.f, 100.f, 1.f, 1.f, 1.f, 1.f, 1.f});
+    fill_tensor(weights, TensorShape(2U, 3U), {0.1f, -0.7f, 0.3f, 0.2f, -0.9f, 0.6f});
+
+    graph::CalibrationTable table(graph::CalibrationMethod::Percentile, 50.f);
+    table.observe(0, activations);
+    table.observe(4, outliers);
+    table.observe_channels(7, weights, 1);
+
+    const std::string filename = "calibration_table_round_trip.csv";
+    table.save_to_file(filename);
+
+    graph::CalibrationTable loaded;
+    loaded.load_from_file(filename);
+    std::remove(filename.c_str());
+
+    for (const graph::TensorID tid : {0U, 4U, 7U})
+    {
+        ARM_COMPUTE_EXPECT(loaded.has_range(tid), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(loaded.range(tid).first, table.range(tid).first, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(loaded.range(tid).second, table.range(tid).second, framework::LogLevel::ERRORS);
+
+        const std::vector<float> expected_channels = table.channel_ranges(tid);
+        const std::vector<float> loaded_channels   = loaded.channel_ranges(tid);
+        ARM_COMPUTE_EXPECT_EQUAL(loaded_channels.size(), expected_channels.size(), framework::LogLevel::ERRORS);
+        for (size_t i = 0; i < std::min(loaded_channels.size(), expected_channels.size()); ++i)
+        {
+            ARM_COMPUTE_EXPECT_EQUAL(loaded_channels[i], expected_channels[i], framework::LogLevel::ERRORS);
+        }
+    }
+    ARM_COMPUTE_EXPECT(!loaded.has_range(1), framework::LogLevel::ERRORS);
+
+    // The loaded table keeps the clipped range even though it does not use the percentile method
+    ARM_COMPUTE_EXPECT(loaded.range(4).second < 2.f, framework::LogLevel::ERRORS);
+}
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+/** Validate that a truncated calibration file is rejected in every build */
+TEST_CASE(MalformedFileThrows, framework::DatasetMode::ALL)
+{
+    const std::string filename = "calibration_table_malformed.csv";
+    {
+        // The row announces two channel ranges but only holds one
+        std::ofstream fs(filename);
+        fs << "3 -1.5 2 2 0.5" << std::endl;
+    }
+
+    bool                    caught = false;
+    graph::CalibrationTable table;
+    try
+    {
+        table.load_from_file(filename);
+    }
+    catch (...)
+    {
+        caught = true;
+    }
+    std::remove(filename.c_str());
+
+    ARM_COMPUTE_EXPECT(caught, framework::LogLevel::ERRORS);
+}
+#endif // ARM_COMPUTE_EXCEPTIONS_DISABLED
+
+TEST_SUITE_END() // CalibrationTable
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025 Arm Limited.
+ * Copyright (c) 2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IntervalLifetimeManager.h"
 #include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
@@ -120,6 +121,32 @@ TEST_CASE(MemoryGroupRelease, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(mg.mappings().size() == 0, framework::LogLevel::ERRORS);
 }
 
+/** Validate the offsets planned from the live intervals */
+TEST_CASE(IntervalMemoryGroupRegister, framework::DatasetMode::ALL)
+{
+    auto        lft_mgr  = std::make_shared<IntervalLifetimeManager>();
+    auto        pool_mgr = std::make_shared<PoolManager>();
+    auto        mm       = std::make_shared<MemoryManagerOnDemand>(lft_mgr, pool_mgr);
+    MemoryGroup mg(mm);
+
+    // Register group
+    lft_mgr->register_group(&mg);
+
+    // Generate lifetime information
+    generate_lifetime_info(mg);
+
+    // Objects a and c are never alive at the same time, so the blob only needs to hold b and c
+    ARM_COMPUTE_EXPECT(lft_mgr->info().size == 160, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->info().alignment == 16, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->stats().planned_size == 160, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lft_mgr->stats().lower_bound == 160, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mg.mappings().size() == 3, framework::LogLevel::ERRORS);
+
+    // Release group and validate its mappings
+    lft_mgr->release_group(&mg);
+    ARM_COMPUTE_EXPECT(mg.mappings().size() == 0, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END() // LifetimeManager
 TEST_SUITE_END()
 } // namespace validation
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/PoolManager.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Mock memory pool that tracks how many callers hold it at the same time */
+class MockMemoryPool : public IMemoryPool
+{
+public:
+    void acquire(MemoryMappings &handles) override
+    {
+        ARM_COMPUTE_UNUSED(handles);
+    }
+    void release(MemoryMappings &handles) override
+    {
+        ARM_COMPUTE_UNUSED(handles);
+    }
+    MappingType mapping_type() const override
+    {
+        return MappingType::OFFSETS;
+    }
+    std::unique_ptr<IMemoryPool> duplicate() override
+    {
+        return std::make_unique<MockMemoryPool>();
+    }
+
+    std::atomic<int> holders{0};
+};
+} // namespace
+TEST_SUITE(UNIT)
+TEST_SUITE(PoolManager)
+
+/** Validate that pools are reused and accounted for */
+TEST_CASE(LockUnlock, framework::DatasetMode::ALL)
+{
+    PoolManager pool_mgr;
+    pool_mgr.register_pool(std::make_unique<MockMemoryPool>());
+    pool_mgr.register_pool(std::make_unique<MockMemoryPool>());
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 2, framework::LogLevel::ERRORS);
+
+    IMemoryPool *pool_a = pool_mgr.lock_pool();
+    IMemoryPool *pool_b = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(pool_a != nullptr && pool_b != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_a != pool_b, framework::LogLevel::ERRORS);
+
+    // The most recently unlocked pool is handed out first
+    pool_mgr.unlock_pool(pool_b);
+    ARM_COMPUTE_EXPECT(pool_mgr.lock_pool() == pool_b, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool_b);
+    pool_mgr.unlock_pool(pool_a);
+
+    const PoolManager::Stats stats = pool_mgr.stats();
+    ARM_COMPUTE_EXPECT(stats.num_locks == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_contended_locks == 0, framework::LogLevel::ERRORS);
+
+    // All pools are free so they can be released
+    ARM_COMPUTE_EXPECT(pool_mgr.release_pool() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 1, framework::LogLevel::ERRORS);
+    pool_mgr.clear_pools();
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 0, framework::LogLevel::ERRORS);
+}
+
+#if !defined(NO_MULTI_THREADING) && !defined(BARE_METAL)
+/** Validate that a pool is never handed out to more than one caller with many concurrent callers */
+TEST_CASE(ConcurrentLocks, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_pools      = 3;
+    constexpr unsigned int num_threads    = 8;
+    constexpr unsigned int num_iterations = 2000;
+
+    PoolManager pool_mgr;
+    for (unsigned int i = 0; i < num_pools; ++i)
+    {
+        pool_mgr.register_pool(std::make_unique<MockMemoryPool>());
+    }
+
+    std::atomic<bool>        shared_pool{false};
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (unsigned int i = 0; i < num_iterations; ++i)
+                {
+                    auto *pool = static_cast<MockMemoryPool *>(pool_mgr.lock_pool());
+                    if (pool->holders.fetch_add(1) != 0)
+                    {
+                        shared_pool = true;
+                    }
+                    std::this_thread::yield();
+                    pool->holders.fetch_sub(1);
+                    pool_mgr.unlock_pool(pool);
+                }
+            });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    const PoolManager::Stats stats = pool_mgr.stats();
+    ARM_COMPUTE_EXPECT(!shared_pool, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_locks == num_threads * num_iterations, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.num_contended_locks <= stats.num_locks, framework::LogLevel::ERRORS);
+
+    // All pools must be free again
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == num_pools, framework::LogLevel::ERRORS);
+    pool_mgr.clear_pools();
+}
+#endif // !defined(NO_MULTI_THREADING) && !defined(BARE_METAL)
+
+TEST_SUITE_END() // PoolManager
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
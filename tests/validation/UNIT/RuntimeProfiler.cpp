@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/RuntimeProfiler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <sstream>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+class TestKernel : public ICPPKernel
+{
+public:
+    TestKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 16));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "TestKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+    }
+};
+
+class FlopKernel : public TestKernel
+{
+public:
+    const char *name() const override
+    {
+        return "FlopKernel";
+    }
+
+    void run_op(ITensorPack &, const Window &, const ThreadInfo &) override
+    {
+    }
+
+    uint64_t get_flop_count(const ITensorPack &) const override
+    {
+        return 4096;
+    }
+};
+
+class ConfiguredKernel : public TestKernel
+{
+public:
+    const char *name() const override
+    {
+        return "ConfiguredKernel";
+    }
+
+    size_t get_configured_tensors_size() const override
+    {
+        return 512;
+    }
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(RuntimeProfiler)
+TEST_CASE(RecordAndSummarize, framework::DatasetMode::ALL)
+{
+    RuntimeProfiler &profiler    = RuntimeProfiler::get();
+    const bool       was_enabled = profiler.is_enabled();
+    profiler.clear();
+
+    SingleThreadScheduler scheduler;
+    TestKernel            kernel;
+
+    // Nothing is recorded while the profiler is disabled
+    profiler.set_enabled(false);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    ARM_COMPUTE_EXPECT(profiler.events().empty(), framework::LogLevel::ERRORS);
+
+    profiler.set_enabled(true);
+    for (int i = 0; i < 3; ++i)
+    {
+        RuntimeProfiler::LayerScope layer("layer0", 1);
+        scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    }
+    {
+        RuntimeProfiler::LayerScope layer("layer1", 2);
+        scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    }
+    profiler.set_enabled(was_enabled);
+
+    // 4 layers, 4 kernels and 4 workloads
+    ARM_COMPUTE_EXPECT(profiler.events().size() == 12, framework::LogLevel::ERRORS);
+
+    const auto layers = profiler.summary(RuntimeProfiler::EventType::Layer, 1);
+    ARM_COMPUTE_ASSERT(layers.size() == 1);
+    ARM_COMPUTE_EXPECT(layers[0].name == "layer0", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(layers[0].count == 3, framework::LogLevel::ERRORS);
+
+    const auto kernels = profiler.summary(RuntimeProfiler::EventType::Kernel);
+    ARM_COMPUTE_ASSERT(kernels.size() == 1);
+    ARM_COMPUTE_EXPECT(kernels[0].name == "TestKernel", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernels[0].count == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernels[0].min_ns <= kernels[0].max_ns, framework::LogLevel::ERRORS);
+
+    const auto layer1_kernels =
+        profiler.summary(RuntimeProfiler::EventType::Kernel, RuntimeProfiler::no_group, "layer1");
+    ARM_COMPUTE_ASSERT(layer1_kernels.size() == 1);
+    ARM_COMPUTE_EXPECT(layer1_kernels[0].count == 1, framework::LogLevel::ERRORS);
+
+    std::stringstream trace;
+    profiler.write_chrome_trace(trace);
+    ARM_COMPUTE_EXPECT(trace.str().find("{\"traceEvents\":[") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(trace.str().find("\"name\":\"TestKernel\"") != std::string::npos, framework::LogLevel::ERRORS);
+
+    profiler.clear();
+    ARM_COMPUTE_EXPECT(profiler.events().empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(BytesOfKernelsScheduledWithoutPack, framework::DatasetMode::ALL)
+{
+    RuntimeProfiler &profiler    = RuntimeProfiler::get();
+    const bool       was_enabled = profiler.is_enabled();
+    profiler.clear();
+
+    SingleThreadScheduler scheduler;
+    ConfiguredKernel      kernel;
+
+    profiler.set_enabled(true);
+    {
+        RuntimeProfiler::LayerScope layer("layer0", 1);
+        scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    }
+    {
+        RuntimeProfiler::LayerScope layer("layer1", 2);
+        scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    }
+    profiler.set_enabled(was_enabled);
+
+    // The legacy schedule path has no tensor pack, the bytes are the ones the kernel was configured with
+    const auto kernels = profiler.summary(RuntimeProfiler::EventType::Kernel);
+    ARM_COMPUTE_ASSERT(kernels.size() == 1);
+    ARM_COMPUTE_EXPECT(kernels[0].bytes == 1024, framework::LogLevel::ERRORS);
+
+    // The utilization only accounts for the workloads of the filtered layer
+    const auto layer0_kernels = profiler.summary(RuntimeProfiler::EventType::Kernel, 1);
+    ARM_COMPUTE_ASSERT(layer0_kernels.size() == 1);
+    ARM_COMPUTE_EXPECT(layer0_kernels[0].bytes == 512, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(layer0_kernels[0].utilization <= 1.0, framework::LogLevel::ERRORS);
+
+    profiler.clear();
+}
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+TEST_CASE(AttributeWorkloadsOfWorkerThreads, framework::DatasetMode::ALL)
+{
+    RuntimeProfiler &profiler    = RuntimeProfiler::get();
+    const bool       was_enabled = profiler.is_enabled();
+    profiler.clear();
+
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(4);
+    TestKernel kernel;
+
+    profiler.set_enabled(true);
+    {
+        RuntimeProfiler::LayerScope layer("layer0", 3);
+        scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    }
+    profiler.set_enabled(was_enabled);
+
+    // Every slice of the kernel is attributed to the layer, whichever thread runs it
+    unsigned int num_workloads = 0;
+    for (const auto &event : profiler.events())
+    {
+        if (event.type == RuntimeProfiler::EventType::Workload)
+        {
+            ++num_workloads;
+            ARM_COMPUTE_EXPECT(event.group == 3, framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(std::string(event.layer) == "layer0", framework::LogLevel::ERRORS);
+        }
+    }
+    ARM_COMPUTE_EXPECT(num_workloads == 4, framework::LogLevel::ERRORS);
+
+    profiler.clear();
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+
+TEST_CASE(RingBufferOverwritesOldestEvents, framework::DatasetMode::ALL)
+{
+    RuntimeProfiler &profiler    = RuntimeProfiler::get();
+    const bool       was_enabled = profiler.is_enabled();
+    profiler.set_buffer_size(4);
+    profiler.clear();
+
+    profiler.set_enabled(true);
+    for (int i = 0; i < 10; ++i)
+    {
+        RuntimeProfiler::LayerScope layer(i < 6 ? "old" : "new");
+    }
+    profiler.set_enabled(was_enabled);
+
+    const auto events = profiler.events();
+    ARM_COMPUTE_EXPECT(events.size() == 4, framework::LogLevel::ERRORS);
+    for (const auto &event : events)
+    {
+        ARM_COMPUTE_EXPECT(std::string(event.name) == "new", framework::LogLevel::ERRORS);
+    }
+
+    profiler.set_buffer_size(8192);
+    profiler.clear();
+}
+
+TEST_CASE(Roofline, framework::DatasetMode::ALL)
+{
+    RuntimeProfiler &profiler    = RuntimeProfiler::get();
+    const bool       was_enabled = profiler.is_enabled();
+    profiler.clear();
+
+    Tensor tensor;
+    tensor.allocator()->init(TensorInfo(TensorShape(256U), 1, DataType::F32));
+    tensor.allocator()->allocate();
+    ITensorPack pack{{TensorType::ACL_DST, &tensor}};
+
+    SingleThreadScheduler scheduler;
+    FlopKernel            kernel;
+    TestKernel            unknown_flops_kernel;
+
+    profiler.set_enabled(true);
+    for (int i = 0; i < 2; ++i)
+    {
+        scheduler.schedule_op(&kernel, IScheduler::Hints(Window::DimX), kernel.window(), pack);
+        scheduler.schedule_op(&unknown_flops_kernel, IScheduler::Hints(Window::DimX), unknown_flops_kernel.window(),
+                              pack);
+    }
+    profiler.set_enabled(was_enabled);
+
+    // 4096 operations on 1024 bytes, i.e. 4 operations per byte
+    const auto memory_bound = profiler.roofline(RuntimeProfiler::RooflineInfo{100.0, 10.0});
+    ARM_COMPUTE_ASSERT(memory_bound.size() == 2);
+    const auto &flop_entry = memory_bound[0].name == "FlopKernel" ? memory_bound[0] : memory_bound[1];
+    ARM_COMPUTE_EXPECT(flop_entry.name == "FlopKernel", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(flop_entry.count == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(flop_entry.flops == 8192, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(flop_entry.bytes == 2048, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(flop_entry.intensity == 4.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(flop_entry.attainable_gflops == 40.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(flop_entry.bound == RuntimeProfiler::Bound::Memory, framework::LogLevel::ERRORS);
+
+    // Kernels which do not report their number of operations are listed without being classified
+    const auto &unknown_entry = memory_bound[0].name == "FlopKernel" ? memory_bound[1] : memory_bound[0];
+    ARM_COMPUTE_EXPECT(unknown_entry.name == "TestKernel", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(unknown_entry.count == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(unknown_entry.intensity == 0.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(unknown_entry.bound == RuntimeProfiler::Bound::Unknown, framework::LogLevel::ERRORS);
+
+    const auto compute_bound = profiler.roofline(RuntimeProfiler::RooflineInfo{10.0, 10.0});
+    ARM_COMPUTE_ASSERT(compute_bound.size() == 2);
+    const auto &compute_entry = compute_bound[0].name == "FlopKernel" ? compute_bound[0] : compute_bound[1];
+    ARM_COMPUTE_EXPECT(compute_entry.attainable_gflops == 10.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(compute_entry.bound == RuntimeProfiler::Bound::Compute, framework::LogLevel::ERRORS);
+
+    std::stringstream csv;
+    RuntimeProfiler::write_csv(csv, compute_bound);
+    ARM_COMPUTE_EXPECT(csv.str().find("FlopKernel,2,") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(csv.str().find("TestKernel,2,") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(csv.str().find(",unknown,") != std::string::npos, framework::LogLevel::ERRORS);
+
+    profiler.clear();
+}
+TEST_SUITE_END() // RuntimeProfiler
+TEST_SUITE_END() // UNIT
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuMwsTable.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(CPU)
+TEST_SUITE(UNIT)
+TEST_SUITE(MwsTable)
+
+/** Validate that the built-in entries are found and that unknown kernels are not */
+TEST_CASE(BuiltinEntries, framework::DatasetMode::ALL)
+{
+    const cpu::CpuMwsTable table{};
+
+    size_t elements = 0;
+    ARM_COMPUTE_EXPECT(table.find(CPUModel::N1, "CpuAddKernel/neon_fp32_add", elements), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(elements == 24536, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(table.find(CPUModel::V1, "CpuArithmeticKernel/neon_fp32_arithmetic:div", elements),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(elements == 25511, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!table.find(CPUModel::N1, "CpuAddKernel/neon_fp16_add", elements), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!table.find(CPUModel::A53, "CpuAddKernel/neon_fp32_add", elements),
+                       framework::LogLevel::ERRORS);
+
+    // Only measured values are built in, other cores fall back to the default
+    ARM_COMPUTE_EXPECT(!table.find(CPUModel::GENERIC_FP16_DOT, "CpuAddKernel/neon_fp32_add", elements),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!table.find(CPUModel::X1, "CpuAddKernel/neon_fp32_add", elements), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(elements == 25511, framework::LogLevel::ERRORS);
+
+    const cpu::CpuMwsTable empty_table(false);
+    ARM_COMPUTE_EXPECT(!empty_table.find(CPUModel::N1, "CpuAddKernel/neon_fp32_add", elements),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!table.calibrating() && !empty_table.calibrating(), framework::LogLevel::ERRORS);
+}
+
+/** Validate that a calibrated table overrides and extends the built-in entries */
+TEST_CASE(ParseTable, framework::DatasetMode::ALL)
+{
+    cpu::CpuMwsTable table{};
+    const Status     status = table.parse("# Minimum workload sizes calibrated on N1\n"
+                                          "N1,CpuAddKernel/neon_fp32_add,1000\n"
+                                          " GENERIC , CpuActivationKernel/neon_fp32_activation:relu , 2048 \n"
+                                          "\n");
+    ARM_COMPUTE_EXPECT(bool(status), framework::LogLevel::ERRORS);
+
+    size_t elements = 0;
+    ARM_COMPUTE_EXPECT(table.find(CPUModel::N1, "CpuAddKernel/neon_fp32_add", elements), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(elements == 1000, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(table.find(CPUModel::GENERIC, "CpuActivationKernel/neon_fp32_activation:relu", elements),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(elements == 2048, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(table.find(CPUModel::N1, "CpuSubKernel/neon_fp32_sub", elements), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(elements == 24385, framework::LogLevel::ERRORS);
+}
+
+/** Validate that malformed tables are rejected */
+TEST_CASE(ParseInvalidTable, framework::DatasetMode::ALL)
+{
+    cpu::CpuMwsTable table{};
+    ARM_COMPUTE_EXPECT(!bool(table.parse("N1,CpuAddKernel/neon_fp32_add\n")), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(table.parse("M1,CpuAddKernel/neon_fp32_add,1000\n")), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(table.parse("N1,,1000\n")), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(table.parse("N1,CpuAddKernel/neon_fp32_add,-1\n")), framework::LogLevel::ERRORS);
+}
+
+/** Validate the conversion from elements per thread to a minimum workload size */
+TEST_CASE(MwsFromElements, framework::DatasetMode::ALL)
+{
+    Window win_1d{};
+    win_1d.set(Window::DimX, Window::Dimension(0, 100000));
+    ARM_COMPUTE_EXPECT(cpu::mws_from_elements(24536, win_1d) == 24536, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpu::mws_from_elements(0, win_1d) == 1, framework::LogLevel::ERRORS);
+
+    // The elements along X are processed by the same thread, the workloads are split along Y
+    Window win_2d{};
+    win_2d.set(Window::DimX, Window::Dimension(0, 64));
+    win_2d.set(Window::DimY, Window::Dimension(0, 1000));
+    ARM_COMPUTE_EXPECT(cpu::mws_from_elements(24536, win_2d) == 383, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpu::mws_from_elements(32, win_2d) == 1, framework::LogLevel::ERRORS);
+}
+
+/** Validate that a resolved entry only applies to the CPU model it was resolved for */
+TEST_CASE(ResolvedEntry, framework::DatasetMode::ALL)
+{
+    Window win_1d{};
+    win_1d.set(Window::DimX, Window::Dimension(0, 100000));
+
+    cpu::CpuMwsEntry entry{};
+    entry.model    = CPUModel::N1;
+    entry.elements = 24536;
+    entry.found    = true;
+
+    const CPUModel model = CPUInfo::get().get_cpu_model();
+    size_t         mws   = 0;
+    ARM_COMPUTE_EXPECT(cpu::lookup_mws(entry, CPUInfo::get(), win_1d, mws) == (model == CPUModel::N1),
+                       framework::LogLevel::ERRORS);
+
+    entry.model = model;
+    ARM_COMPUTE_EXPECT(cpu::lookup_mws(entry, CPUInfo::get(), win_1d, mws), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mws == 24536, framework::LogLevel::ERRORS);
+
+    entry.found = false;
+    mws         = 0;
+    ARM_COMPUTE_EXPECT(!cpu::lookup_mws(entry, CPUInfo::get(), win_1d, mws), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mws == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // MwsTable
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,6 +62,7 @@ public:
         }
 
         ActivationLayerInfo info(function, alpha_beta, alpha_beta);
+        info.set_fast_math(_fast_math);
 
         _in_place                 = in_place;
         _data_type                = data_type;
@@ -162,6 +163,7 @@ protected:
     QuantizationInfo                        _output_quantization_info{};
     DataType                                _data_type{};
     ActivationLayerInfo::ActivationFunction _function{};
+    bool                                    _fast_math{false};
 };
 
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
@@ -179,6 +181,24 @@ public:
     }
 };
 
+/** Fixture allowing the floating-point kernels to use the fast accuracy tier */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ActivationFastMathValidationFixture
+    : public ActivationValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape                             shape,
+               bool                                    in_place,
+               ActivationLayerInfo::ActivationFunction function,
+               float                                   alpha_beta,
+               DataType                                data_type)
+    {
+        this->_fast_math = true;
+        ActivationValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            shape, in_place, function, alpha_beta, data_type, QuantizationInfo(), false /* padding_after_configure */);
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class ActivationWithPaddingValidationFixture
     : public ActivationValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,12 @@ public:
             return;
         }
 
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            (dt_in == DataType::BFLOAT16 || dt_out == DataType::BFLOAT16) && !CPUInfo::get().has_bf16())
+        {
+            return;
+        }
+
         _target    = compute_target(shape, dt_in, dt_out, policy);
         _reference = compute_reference(shape, dt_in, dt_out, policy);
     }
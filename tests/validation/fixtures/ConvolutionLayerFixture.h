@@ -201,7 +201,8 @@ public:
                PaddingList         pre_pad_layer                = PaddingList({}),
                bool                padded_weights               = false,
                bool                updated_sq_info_after_config = false,
-               bool                use_fp32_acc                 = false)
+               bool                use_fp32_acc                 = false,
+               bool                bf16_output                  = false)
     {
 #ifndef ARM_COMPUTE_CPU_ENABLED
         ARM_COMPUTE_UNUSED(updated_sq_info_after_config);
@@ -227,13 +228,21 @@ public:
         _weights_data_type      = weights_data_type;
         const bool is_quantized = is_data_type_quantized(weights_data_type);
 
-        _is_bfloat16      = data_type == DataType::BFLOAT16;
-        _output_data_type = (_is_bfloat16 || std::is_same<TO, float>::value) ? DataType::F32 : data_type;
+        _is_bfloat16        = data_type == DataType::BFLOAT16;
+        _is_bfloat16_output = _is_bfloat16 && bf16_output;
+        _output_data_type   = (_is_bfloat16 || std::is_same<TO, float>::value) ? DataType::F32 : data_type;
 
         const bool q_to_f32 = is_quantized && (_output_data_type == DataType::F32);
         _bias_data_type =
             q_to_f32 ? DataType::F32 : (is_quantized ? DataType::S32 : (_is_bfloat16 ? DataType::F32 : data_type));
 
+        // A BFLOAT16 destination takes a BFLOAT16 bias, as in the mixed precision graph mode
+        if (_is_bfloat16_output)
+        {
+            _output_data_type = DataType::BFLOAT16;
+            _bias_data_type   = DataType::BFLOAT16;
+        }
+
         _quantization_info        = quantization_info;
         _weight_quantization_info = weight_quantization_info;
         _data_layout              = data_layout;
@@ -494,6 +503,29 @@ protected:
             // Compute Convolution function
             conv.run();
         }
+
+        if (_is_bfloat16_output)
+        {
+            return widen_bfloat16(dst, output_shape);
+        }
+        return dst;
+    }
+
+    // Copy a BFLOAT16 tensor into a F32 one, so it can be validated against the F32 reference
+    TensorType widen_bfloat16(TensorType &src, const TensorShape &shape)
+    {
+        TensorType dst = create_tensor<TensorType>(shape, DataType::F32, 1, QuantizationInfo(), _data_layout);
+        dst.allocator()->allocate();
+        {
+            AccessorType src_accessor(src);
+            AccessorType dst_accessor(dst);
+            for (int i = 0; i < src_accessor.num_elements(); ++i)
+            {
+                const Coordinates id = index2coord(shape, i);
+                *reinterpret_cast<float *>(dst_accessor(id)) =
+                    float(*reinterpret_cast<const bfloat16 *>(src_accessor(id)));
+            }
+        }
         return dst;
     }
 
@@ -664,6 +696,10 @@ protected:
             regularize_values(static_cast<void *>(src.data()), src.num_elements());
             regularize_values(static_cast<void *>(weights.data()), weights.num_elements());
         }
+        if (_is_bfloat16_output)
+        {
+            regularize_values(static_cast<void *>(bias.data()), bias.num_elements());
+        }
         if (pre_pad_layer.size() > 0)
         {
             src = reference::pad_layer<T>(src, pre_pad_layer, PixelValue(0), PaddingMode::CONSTANT);
@@ -673,6 +709,12 @@ protected:
                                                                    num_groups, _dst_q_info);
         auto res  = (act_info.enabled()) ? reference::activation_layer<TO>(conv, act_info) : conv;
 
+        // The target rounds its F32 accumulators once, when it writes the BFLOAT16 destination
+        if (_is_bfloat16_output)
+        {
+            regularize_values(static_cast<void *>(res.data()), res.num_elements());
+        }
+
         return res;
     }
 
@@ -686,8 +728,9 @@ protected:
     QuantizationInfo _quantization_info{};
     QuantizationInfo _weight_quantization_info{};
     QuantizationInfo _dst_q_info{};
-    bool             _is_bfloat16  = false;
-    bool             _mixed_layout = false;
+    bool             _is_bfloat16        = false;
+    bool             _is_bfloat16_output = false;
+    bool             _mixed_layout       = false;
     bool             _use_dynamic_output_quant{false};
     int32_t          _hash{0};
     int32_t          _min_bias{-100};
@@ -717,6 +760,30 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ConvolutionValidationBFloat16OutputFixture
+    : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
+{
+public:
+    void setup(TensorShape         input_shape,
+               TensorShape         weights_shape,
+               TensorShape         bias_shape,
+               TensorShape         output_shape,
+               PadStrideInfo       info,
+               Size2D              dilation,
+               bool                reshape_weights,
+               DataType            data_type,
+               DataLayout          data_layout,
+               ActivationLayerInfo act_info)
+    {
+        ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>::setup(
+            input_shape, weights_shape, bias_shape, output_shape, info, dilation, reshape_weights, data_type, data_type,
+            data_layout, QuantizationInfo(), QuantizationInfo(), act_info, false /* mixed_layout */, PaddingList({}),
+            false /* padded_weights */, false /* updated_sq_info_after_config */, false /* use_fp32_acc */,
+            true /* bf16_output */);
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool mixed_layout = false>
 class NEDirectGEMMConv2dLayerFP16WithAccModeFixture
     : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_CPULAYERNORMFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_CPULAYERNORMFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/experimental/operators/CpuLayerNorm.h"
+#include "arm_compute/runtime/experimental/operators/CpuRMSNorm.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/LayerNorm.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+void configure_norm(experimental::op::CpuLayerNorm &norm,
+                    const ITensorInfo              *src,
+                    const ITensorInfo              *residual,
+                    const ITensorInfo              *gamma,
+                    const ITensorInfo              *beta,
+                    ITensorInfo                    *dst,
+                    ITensorInfo                    *residual_out,
+                    float                           epsilon)
+{
+    norm.configure(src, residual, gamma, beta, dst, residual_out, epsilon);
+}
+
+void configure_norm(experimental::op::CpuRMSNorm &norm,
+                    const ITensorInfo            *src,
+                    const ITensorInfo            *residual,
+                    const ITensorInfo            *gamma,
+                    const ITensorInfo            *beta,
+                    ITensorInfo                  *dst,
+                    ITensorInfo                  *residual_out,
+                    float                         epsilon)
+{
+    ARM_COMPUTE_UNUSED(beta);
+    norm.configure(src, residual, gamma, dst, residual_out, epsilon);
+}
+} // namespace
+
+/** Fixture shared by @ref experimental::op::CpuLayerNorm and @ref experimental::op::CpuRMSNorm
+ *
+ * The destination is QASYMM8_SIGNED when @p TOut is int8_t, and of the source data type otherwise.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TOut = T>
+class CpuLayerNormValidationGenericFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, bool has_residual, DataType data_type, QuantizationInfo dst_qinfo, bool padded)
+    {
+        if (std::is_same<TensorType, Tensor>::value && data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _rms_norm     = std::is_same<FunctionType, experimental::op::CpuRMSNorm>::value;
+        _has_residual = has_residual;
+        _data_type    = data_type;
+        _dst_qinfo    = dst_qinfo;
+        _padded       = padded;
+
+        compute_target(shape);
+        compute_reference(shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed_offset, float lo = -1.f, float hi = 1.f)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::BFLOAT16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<bfloat16> distribution{lo, hi};
+                library->fill(tensor, distribution, seed_offset);
+                break;
+            }
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{lo, hi};
+                library->fill(tensor, distribution, seed_offset);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution{lo, hi};
+                library->fill(tensor, distribution, seed_offset);
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unsupported data type");
+        }
+    }
+
+    void compute_target(const TensorShape &shape)
+    {
+        const TensorShape param_shape(shape[0]);
+        const DataType    dst_data_type = std::is_same<TOut, int8_t>::value ? DataType::QASYMM8_SIGNED : _data_type;
+
+        // Create tensors
+        TensorType src          = create_tensor<TensorType>(shape, _data_type);
+        TensorType residual     = create_tensor<TensorType>(shape, _data_type);
+        TensorType gamma        = create_tensor<TensorType>(param_shape, _data_type);
+        TensorType beta         = create_tensor<TensorType>(param_shape, _data_type);
+        TensorType residual_out = create_tensor<TensorType>(shape, _data_type);
+        _target                 = create_tensor<TensorType>(shape, dst_data_type, 1, _dst_qinfo);
+
+        if (_padded)
+        {
+            // Pad all the sides so that the rows of the higher dimensions are not contiguous
+            for (TensorType *tensor : {&src, &residual, &residual_out, &_target})
+            {
+                tensor->info()->extend_padding(PaddingSize(1, 3, 2, 1));
+            }
+        }
+
+        // Create and configure function
+        FunctionType norm;
+        configure_norm(norm, src.info(), _has_residual ? residual.info() : nullptr, gamma.info(),
+                       _rms_norm ? nullptr : beta.info(), _target.info(),
+                       _has_residual ? residual_out.info() : nullptr, _epsilon);
+
+        // Allocate and fill tensors
+        ITensorPack run_pack{{arm_compute::TensorType::ACL_SRC_0, &src},
+                             {arm_compute::TensorType::ACL_SRC_2, &gamma},
+                             {arm_compute::TensorType::ACL_DST_0, &_target}};
+        for (TensorType *tensor : {&src, &gamma, &_target})
+        {
+            tensor->allocator()->allocate();
+        }
+        fill(AccessorType(src), 0);
+        fill(AccessorType(gamma), 2, 0.5f, 1.5f);
+        if (!_rms_norm)
+        {
+            beta.allocator()->allocate();
+            fill(AccessorType(beta), 3);
+            run_pack.add_const_tensor(arm_compute::TensorType::ACL_SRC_3, &beta);
+        }
+        if (_has_residual)
+        {
+            residual.allocator()->allocate();
+            residual_out.allocator()->allocate();
+            fill(AccessorType(residual), 1);
+            run_pack.add_const_tensor(arm_compute::TensorType::ACL_SRC_1, &residual);
+            run_pack.add_tensor(arm_compute::TensorType::ACL_DST_1, &residual_out);
+        }
+
+        // Compute function
+        norm.run(run_pack);
+
+        _target_residual = std::move(residual_out);
+    }
+
+    void compute_reference(const TensorShape &shape)
+    {
+        const TensorShape param_shape(shape[0]);
+
+        // Create reference
+        SimpleTensor<T> src{shape, _data_type};
+        SimpleTensor<T> gamma{param_shape, _data_type};
+        SimpleTensor<T> residual{};
+        SimpleTensor<T> beta{};
+
+        // Fill reference
+        fill(src, 0);
+        fill(gamma, 2, 0.5f, 1.5f);
+        if (!_rms_norm)
+        {
+            beta = SimpleTensor<T>{param_shape, _data_type};
+            fill(beta, 3);
+        }
+        if (_has_residual)
+        {
+            residual = SimpleTensor<T>{shape, _data_type};
+            fill(residual, 1);
+        }
+
+        _reference = reference::layer_norm<T, TOut>(src, residual, gamma, beta, _reference_residual, _epsilon,
+                                                    _rms_norm, _dst_qinfo);
+    }
+
+    TensorType         _target{};
+    TensorType         _target_residual{};
+    SimpleTensor<TOut> _reference{};
+    SimpleTensor<T>    _reference_residual{};
+    bool               _rms_norm{false};
+    bool               _has_residual{false};
+    bool               _padded{false};
+    DataType           _data_type{};
+    QuantizationInfo   _dst_qinfo{};
+    const float        _epsilon{1e-5f};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class CpuLayerNormValidationFixture
+    : public CpuLayerNormValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape shape, bool has_residual, DataType data_type)
+    {
+        CpuLayerNormValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            shape, has_residual, data_type, QuantizationInfo(), false);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class CpuLayerNormPaddedValidationFixture
+    : public CpuLayerNormValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape shape, bool has_residual, DataType data_type)
+    {
+        CpuLayerNormValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            shape, has_residual, data_type, QuantizationInfo(), true);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class CpuLayerNormQuantizedValidationFixture
+    : public CpuLayerNormValidationGenericFixture<TensorType, AccessorType, FunctionType, T, int8_t>
+{
+public:
+    void setup(TensorShape shape, bool has_residual, DataType data_type, QuantizationInfo dst_qinfo)
+    {
+        CpuLayerNormValidationGenericFixture<TensorType, AccessorType, FunctionType, T, int8_t>::setup(
+            shape, has_residual, data_type, dst_qinfo, false);
+    }
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_CPULAYERNORMFIXTURE_H
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_CPUQKVROPEFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_CPUQKVROPEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+#include "arm_compute/runtime/experimental/operators/CpuQKVRoPE.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/QKVRoPE.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class CpuQKVRoPEValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int num_heads,
+               unsigned int num_kv_heads,
+               unsigned int head_dim,
+               unsigned int rotary_dim,
+               unsigned int seq_len,
+               unsigned int batch_size,
+               bool         interleaved,
+               bool         transpose_k,
+               bool         has_positions,
+               DataType     data_type)
+    {
+        if (std::is_same<TensorType, Tensor>::value && data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _info             = RoPEInfo(num_heads, num_kv_heads, head_dim, _max_position);
+        _info.rotary_dim  = rotary_dim;
+        _info.interleaved = interleaved;
+        _info.transpose_k = transpose_k;
+        _has_positions    = has_positions;
+        _data_type        = data_type;
+
+        const TensorShape qkv_shape((num_heads + 2 * num_kv_heads) * head_dim, seq_len, batch_size);
+        const TensorShape positions_shape(seq_len, batch_size);
+
+        compute_target(qkv_shape, positions_shape);
+        compute_reference(qkv_shape, positions_shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed_offset)
+    {
+        switch (tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{-1.0f, 1.0f};
+                library->fill(tensor, distribution, seed_offset);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution{-1.0f, 1.0f};
+                library->fill(tensor, distribution, seed_offset);
+                break;
+            }
+            case DataType::S32:
+            {
+                const auto last_position = static_cast<int32_t>(_max_position) - 1;
+                std::uniform_int_distribution<int32_t> distribution{_largest_position ? last_position : 0,
+                                                                    last_position};
+                library->fill(tensor, distribution, seed_offset);
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unsupported data type");
+        }
+    }
+
+    void compute_target(const TensorShape &qkv_shape, const TensorShape &positions_shape)
+    {
+        // Create tensors
+        TensorType qkv       = create_tensor<TensorType>(qkv_shape, _data_type);
+        TensorType positions = create_tensor<TensorType>(positions_shape, DataType::S32);
+
+        // Create and configure function
+        FunctionType rope;
+        rope.configure(qkv.info(), _has_positions ? positions.info() : nullptr, _target_q.info(), _target_k.info(),
+                       _target_v.info(), _info);
+
+        // Allocate and fill tensors
+        ITensorPack run_pack{{arm_compute::TensorType::ACL_SRC_0, &qkv},
+                             {arm_compute::TensorType::ACL_DST_0, &_target_q},
+                             {arm_compute::TensorType::ACL_DST_1, &_target_k},
+                             {arm_compute::TensorType::ACL_DST_2, &_target_v}};
+        for (TensorType *tensor : {&qkv, &_target_q, &_target_k, &_target_v})
+        {
+            tensor->allocator()->allocate();
+        }
+        fill(AccessorType(qkv), 0);
+        if (_has_positions)
+        {
+            positions.allocator()->allocate();
+            fill(AccessorType(positions), 1);
+            run_pack.add_const_tensor(arm_compute::TensorType::ACL_SRC_1, &positions);
+        }
+
+        // Compute function
+        rope.run(run_pack);
+    }
+
+    void compute_reference(const TensorShape &qkv_shape, const TensorShape &positions_shape)
+    {
+        // Create reference
+        SimpleTensor<T>       qkv{qkv_shape, _data_type};
+        SimpleTensor<int32_t> positions{};
+
+        // Fill reference
+        fill(qkv, 0);
+        if (_has_positions)
+        {
+            positions = SimpleTensor<int32_t>{positions_shape, DataType::S32};
+            fill(positions, 1);
+        }
+
+        _reference_q = reference::qkv_rope<T>(qkv, positions, _reference_k, _reference_v, _info);
+    }
+
+    TensorType         _target_q{};
+    TensorType         _target_k{};
+    TensorType         _target_v{};
+    SimpleTensor<T>    _reference_q{};
+    SimpleTensor<T>    _reference_k{};
+    SimpleTensor<T>    _reference_v{};
+    RoPEInfo           _info{};
+    bool               _has_positions{false};
+    bool               _largest_position{false};
+    DataType           _data_type{};
+    const unsigned int _max_position{64};
+};
+
+/** Fixture where all the tokens are at the last position of the sin/cos table */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class CpuQKVRoPELargestPositionValidationFixture
+    : public CpuQKVRoPEValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(unsigned int num_heads,
+               unsigned int num_kv_heads,
+               unsigned int head_dim,
+               unsigned int rotary_dim,
+               unsigned int seq_len,
+               unsigned int batch_size,
+               bool         interleaved,
+               bool         transpose_k,
+               DataType     data_type)
+    {
+        this->_largest_position = true;
+        CpuQKVRoPEValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            num_heads, num_kv_heads, head_dim, rotary_dim, seq_len, batch_size, interleaved, transpose_k, true,
+            data_type);
+    }
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_CPUQKVROPEFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, 2025 Arm Limited.
+ * Copyright (c) 2019-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -130,6 +130,94 @@ protected:
     SimpleTensor<T> _reference{};
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTRealValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, DataType data_type)
+    {
+        TensorShape spectrum_shape = shape;
+        spectrum_shape.set(0, shape.x() / 2 + 1);
+
+        compute_target(shape, spectrum_shape, data_type);
+        compute_reference(shape, data_type);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(_target_spectrum.info()->tensor_shape(),
+                                                    _reference_spectrum.shape());
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        std::uniform_real_distribution<float> distribution(-5.0f, 5.0f);
+        library->fill(tensor, distribution, 0);
+    }
+
+    void compute_target(const TensorShape &shape, const TensorShape &spectrum_shape, DataType data_type)
+    {
+        // Create tensors
+        TensorType src   = create_tensor<TensorType>(shape, data_type, 1);
+        _target_spectrum = create_tensor<TensorType>(spectrum_shape, data_type, 2);
+        _target          = create_tensor<TensorType>(shape, data_type, 1);
+
+        // Create and configure the forward transform, producing the half spectrum, and the inverse one
+        InfoType inverse_info;
+        inverse_info.direction = FFTDirection::Inverse;
+
+        FunctionType rfft;
+        FunctionType irfft;
+        rfft.configure(&src, &_target_spectrum, InfoType());
+        irfft.configure(&_target_spectrum, &_target, inverse_info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(_target_spectrum.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(_target.info()->is_resizable());
+
+        add_padding_x({&src, &_target_spectrum, &_target});
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        _target_spectrum.allocator()->allocate();
+        _target.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!_target_spectrum.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!_target.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute functions
+        rfft.run();
+        irfft.run();
+    }
+
+    void compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{shape, data_type, 1};
+
+        // Fill reference
+        fill(src);
+        if (std::is_same<InfoType, FFT1DInfo>::value)
+        {
+            _reference_spectrum = reference::rdft_1d(src);
+        }
+        else
+        {
+            _reference_spectrum = reference::rdft_2d(src);
+        }
+
+        // The inverse transform recovers the input
+        _reference = src;
+    }
+
+    TensorType      _target_spectrum{};
+    TensorType      _target{};
+    SimpleTensor<T> _reference_spectrum{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class FFTConvolutionValidationGenericFixture : public framework::Fixture
 {
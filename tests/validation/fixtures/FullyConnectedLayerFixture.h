@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,7 +36,9 @@
 #include "tests/RawTensor.h"
 #include "tests/validation/Helpers.h"
 #include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/DynamicQuantization.h"
 #include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/reference/ReshapeLayer.h"
 #include "tests/validation/reference/Utils.h"
 #include "tests/validation/Validation.h"
 
@@ -104,7 +106,8 @@ public:
                DataType            data_type,
                QuantizationInfo    quantization_info,
                ActivationLayerInfo activation_info,
-               bool                mixed_layout = false)
+               bool                mixed_layout         = false,
+               bool                dynamic_quantization = false)
     {
         if (std::is_same<TensorType, Tensor>::value && // Cpu
             data_type == DataType::F16 && !CPUInfo::get().has_fp16())
@@ -115,9 +118,10 @@ public:
         ARM_COMPUTE_UNUSED(weights_shape);
         ARM_COMPUTE_UNUSED(bias_shape);
 
-        _mixed_layout   = mixed_layout;
-        _data_type      = data_type;
-        _bias_data_type = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
+        _mixed_layout         = mixed_layout;
+        _dynamic_quantization = dynamic_quantization;
+        _data_type            = data_type;
+        _bias_data_type       = is_data_type_quantized_asymmetric(data_type) ? DataType::S32 : data_type;
 
         // Note : Quantization Info parameter from setup function is only used when quant datatype and activation function is not enabled or is identity.
         if (is_data_type_quantized(data_type) &&
@@ -227,6 +231,7 @@ protected:
         fc_info.transpose_weights    = transpose_weights;
         fc_info.are_weights_reshaped = !reshape_weights;
         fc_info.activation_info      = _activation_info;
+        fc_info.dynamic_quantization = _dynamic_quantization;
 
         // Create and configure function.
         FunctionType fc;
@@ -317,6 +322,7 @@ protected:
     DataType            _data_type{};
     DataType            _bias_data_type{};
     bool                _mixed_layout{false};
+    bool                _dynamic_quantization{false};
     QuantizationInfo    _input_q_info{};
     QuantizationInfo    _weight_q_info{};
     QuantizationInfo    _dst_q_info{};
@@ -376,6 +382,55 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FullyConnectedLayerDynamicQuantizationFixture
+    : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape         input_shape,
+               TensorShape         weights_shape,
+               TensorShape         bias_shape,
+               TensorShape         output_shape,
+               bool                transpose_weights,
+               bool                reshape_weights,
+               DataType            data_type,
+               ActivationLayerInfo activation_info)
+    {
+        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            input_shape, weights_shape, bias_shape, output_shape, transpose_weights, reshape_weights, data_type,
+            QuantizationInfo(), activation_info, false /* mixed_layout */, true /* dynamic_quantization */);
+
+        // Compare against the operands as quantized by the int8 path, so that a fallback to F32 is detected
+        this->_reference = compute_quantized_reference(input_shape, weights_shape, bias_shape, output_shape);
+    }
+
+protected:
+    SimpleTensor<T> compute_quantized_reference(const TensorShape &input_shape,
+                                                const TensorShape &weights_shape,
+                                                const TensorShape &bias_shape,
+                                                const TensorShape &output_shape)
+    {
+        // Create reference
+        SimpleTensor<T> src{input_shape, this->_data_type};
+        SimpleTensor<T> weights{weights_shape, this->_data_type};
+        SimpleTensor<T> bias{bias_shape, this->_data_type};
+
+        // Fill reference
+        this->fill(src, 0 + this->_hash);
+        this->fill(weights, 1 + this->_hash);
+        this->fill(bias, 2 + this->_hash);
+
+        // Each flattened input row, and the weights of each output, are quantized with their own scale
+        const TensorShape rows_shape(weights_shape.x(), input_shape.total_size() / weights_shape.x());
+        src     = reference::reshape_layer(
+            reference::dynamic_quantize_dequantize(reference::reshape_layer(src, rows_shape)), input_shape);
+        weights = reference::dynamic_quantize_dequantize(weights);
+
+        return reference::activation_layer(reference::fully_connected_layer<T>(src, weights, bias, output_shape),
+                                           this->_activation_info);
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class FullyConnectedWithDynamicTensorsFixture : public framework::Fixture
 {
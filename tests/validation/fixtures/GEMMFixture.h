@@ -59,30 +59,32 @@ template <typename TensorType,
 class GEMMGenericValidationFixture : public framework::Fixture
 {
 public:
-    void setup(TensorShape shape_a,
-               TensorShape shape_b,
-               TensorShape shape_c,
-               TensorShape output_shape,
-               float       alpha,
-               float       beta,
-               bool        pretranspose,
-               DataType    data_type,
-               bool        accumulate,
-               bool        dynamic,
-               bool        constant_b_and_c,
-               bool        vector_bias)
+    void setup(TensorShape                shape_a,
+               TensorShape                shape_b,
+               TensorShape                shape_c,
+               TensorShape                output_shape,
+               float                      alpha,
+               float                      beta,
+               bool                       pretranspose,
+               DataType                   data_type,
+               bool                       accumulate,
+               bool                       dynamic,
+               bool                       constant_b_and_c,
+               bool                       vector_bias,
+               const ActivationLayerInfo &act_info = ActivationLayerInfo())
     {
         if (std::is_same<TensorType, Tensor>::value && // Cpu
-            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+            ((data_type == DataType::F16 && !CPUInfo::get().has_fp16()) ||
+             (data_type == DataType::BFLOAT16 && !CPUInfo::get().has_bf16())))
         {
             return;
         }
 
         ARM_COMPUTE_UNUSED(pretranspose);
         _target = compute_target(shape_a, shape_b, shape_c, output_shape, alpha, beta, data_type, accumulate, dynamic,
-                                 constant_b_and_c);
+                                 constant_b_and_c, act_info);
         _reference = compute_reference(shape_a, shape_b, output_shape, alpha, beta, data_type, accumulate,
-                                       constant_b_and_c, vector_bias);
+                                       constant_b_and_c, vector_bias, act_info);
     }
 
 protected:
@@ -91,6 +93,12 @@ protected:
     {
         switch (tensor.data_type())
         {
+            case DataType::BFLOAT16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<bfloat16> distribution{float(lo), float(hi)};
+                library->fill(tensor, distribution, i);
+                break;
+            }
             case DataType::F16:
             {
                 arm_compute::utils::uniform_real_distribution_16bit<half> distribution{float(lo), float(hi)};
@@ -108,16 +116,17 @@ protected:
         }
     }
 
-    TensorType compute_target(const TensorShape &input_shape_a,
-                              const TensorShape &input_shape_b,
-                              const TensorShape &input_shape_c,
-                              const TensorShape &output_shape,
-                              float              alpha,
-                              float              beta,
-                              DataType           data_type,
-                              bool               accumulate,
-                              bool               dynamic,
-                              bool               constant_b_and_c)
+    TensorType compute_target(const TensorShape         &input_shape_a,
+                              const TensorShape         &input_shape_b,
+                              const TensorShape         &input_shape_c,
+                              const TensorShape         &output_shape,
+                              float                      alpha,
+                              float                      beta,
+                              DataType                   data_type,
+                              bool                       accumulate,
+                              bool                       dynamic,
+                              bool                       constant_b_and_c,
+                              const ActivationLayerInfo &act_info)
     {
         // Create tensors
         TensorType a   = create_tensor<TensorType>(input_shape_a, data_type, 1);
@@ -150,8 +159,8 @@ protected:
         gemm.configure(&a, &b, (disable_c) ? nullptr : &c, &dst, alpha, beta,
                        GEMMInfo(false, false, constant_b_and_c, (reinterpret_output_as_3d ? output_shape[2] : 0),
                                 reinterpret_input_as_3d, false, GEMMLowpOutputStageInfo(), false, false,
-                                (reinterpret_input_as_3d || reinterpret_output_as_3d),
-                                arm_compute::ActivationLayerInfo(), false /* fixed_format */,
+                                (reinterpret_input_as_3d || reinterpret_output_as_3d), act_info,
+                                false /* fixed_format */,
                                 arm_compute::WeightFormat::UNSPECIFIED, false /* pretranspose_B */, accumulate));
 
         if (dynamic)
@@ -218,15 +227,16 @@ protected:
         return dst;
     }
 
-    SimpleTensor<T> compute_reference(const TensorShape &shape_a,
-                                      const TensorShape &shape_b,
-                                      const TensorShape &output_shape,
-                                      float              alpha,
-                                      float              beta,
-                                      DataType           data_type,
-                                      bool               accumulate,
-                                      bool               constant_b_and_c,
-                                      bool               vector_bias)
+    SimpleTensor<T> compute_reference(const TensorShape         &shape_a,
+                                      const TensorShape         &shape_b,
+                                      const TensorShape         &output_shape,
+                                      float                      alpha,
+                                      float                      beta,
+                                      DataType                   data_type,
+                                      bool                       accumulate,
+                                      bool                       constant_b_and_c,
+                                      bool                       vector_bias,
+                                      const ActivationLayerInfo &act_info)
     {
         TensorShape shape_a_to_use = shape_a;
         if (reinterpret_input_as_3d)
@@ -330,8 +340,10 @@ protected:
         }
         else
         {
-            return reference::gemm<T>((pretranspose_a) ? a_transposed : a, (pretranspose_b) ? b_transposed : b, c,
-                                      alpha, disable_c ? 0.f : beta);
+            const SimpleTensor<T> result = reference::gemm<T>((pretranspose_a) ? a_transposed : a,
+                                                              (pretranspose_b) ? b_transposed : b, c, alpha,
+                                                              disable_c ? 0.f : beta);
+            return act_info.enabled() ? reference::activation_layer<T>(result, act_info) : result;
         }
     }
 
@@ -424,6 +436,31 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMBiasActivationValidationFixture
+    : protected GEMMGenericValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape         shape_a,
+               TensorShape         shape_b,
+               TensorShape         shape_c,
+               TensorShape         output_shape,
+               float               alpha,
+               float               beta,
+               bool                pretranspose,
+               DataType            data_type,
+               ActivationLayerInfo act_info)
+    {
+        bool accumulate       = false;
+        bool dynamic          = false;
+        bool constant_b_and_c = true;
+        bool vector_bias      = true;
+        GEMMGenericValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(
+            shape_a, shape_b, shape_c, output_shape, alpha, beta, pretranspose, data_type, accumulate, dynamic,
+            constant_b_and_c, vector_bias, act_info);
+    }
+};
+
 template <typename TensorType,
           typename AccessorType,
           typename FunctionType,
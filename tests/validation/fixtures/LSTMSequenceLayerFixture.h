@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_LSTMSEQUENCELAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_LSTMSEQUENCELAYERFIXTURE_H
+
+#include "arm_compute/runtime/common/LSTMParams.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/validation/reference/ActivationLayer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename FunctionParams, typename T>
+class LSTMSequenceLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int        input_size,
+               unsigned int        num_units,
+               unsigned int        num_batches,
+               unsigned int        num_steps,
+               ActivationLayerInfo info,
+               float               cell_threshold,
+               DataType            data_type,
+               bool                cifg_opt,
+               bool                peephole_opt)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _input_size  = input_size;
+        _num_units   = num_units;
+        _num_batches = num_batches;
+        _num_steps   = num_steps;
+
+        _target    = compute_target(info, cell_threshold, data_type, cifg_opt, peephole_opt);
+        _reference = compute_reference(info, cell_threshold, data_type, cifg_opt, peephole_opt);
+    }
+
+protected:
+    /** Weights, biases and states of the layer, in the order they are filled */
+    enum Param
+    {
+        InputToInput,
+        InputToForget,
+        InputToCell,
+        InputToOutput,
+        RecurrentToInput,
+        RecurrentToForget,
+        RecurrentToCell,
+        RecurrentToOutput,
+        InputGateBias,
+        ForgetGateBias,
+        CellBias,
+        OutputGateBias,
+        CellToInput,
+        CellToForget,
+        CellToOutput,
+        OutputStateIn,
+        CellStateIn,
+        NumParams
+    };
+
+    TensorShape param_shape(int param) const
+    {
+        if (param <= InputToOutput)
+        {
+            return TensorShape(_input_size, _num_units);
+        }
+        if (param <= RecurrentToOutput)
+        {
+            return TensorShape(_num_units, _num_units);
+        }
+        if (param <= CellToOutput)
+        {
+            return TensorShape(_num_units);
+        }
+        return TensorShape(_num_units, _num_batches);
+    }
+
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        static_assert(std::is_floating_point<T>::value || std::is_same<T, half>::value,
+                      "Only floating point data types supported.");
+        using DistributionType = typename std::conditional<std::is_same<T, half>::value,
+                                                           arm_compute::utils::uniform_real_distribution_16bit<T>,
+                                                           std::uniform_real_distribution<T>>::type;
+
+        DistributionType distribution{T(-1.0f), T(1.0f)};
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType
+    compute_target(ActivationLayerInfo info, float cell_threshold, DataType data_type, bool cifg_opt, bool peephole_opt)
+    {
+        // Create tensors
+        std::array<TensorType, NumParams> params{};
+        for (int p = 0; p < NumParams; ++p)
+        {
+            params[p] = create_tensor<TensorType>(param_shape(p), data_type);
+        }
+        TensorType input  = create_tensor<TensorType>(TensorShape(_input_size, _num_batches, _num_steps), data_type);
+        TensorType output = create_tensor<TensorType>(TensorShape(_num_units, _num_batches, _num_steps), data_type);
+        TensorType output_state_out = create_tensor<TensorType>(param_shape(OutputStateIn), data_type);
+        TensorType cell_state_out   = create_tensor<TensorType>(param_shape(CellStateIn), data_type);
+
+        FunctionParams lstm_params;
+        if (!cifg_opt)
+        {
+            lstm_params.set_cifg_params(&params[InputToInput], &params[RecurrentToInput],
+                                        peephole_opt ? &params[CellToInput] : nullptr, &params[InputGateBias]);
+        }
+        if (peephole_opt)
+        {
+            lstm_params.set_peephole_params(&params[CellToForget], &params[CellToOutput]);
+        }
+
+        // Create and configure function
+        FunctionType lstm;
+        lstm.configure(&input, &params[InputToForget], &params[InputToCell], &params[InputToOutput],
+                       &params[RecurrentToForget], &params[RecurrentToCell], &params[RecurrentToOutput],
+                       &params[ForgetGateBias], &params[CellBias], &params[OutputGateBias], &params[OutputStateIn],
+                       &params[CellStateIn], &output, &output_state_out, &cell_state_out, lstm_params, info,
+                       cell_threshold);
+
+        ARM_COMPUTE_ASSERT(input.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(output.info()->is_resizable());
+
+        // Allocate tensors
+        input.allocator()->allocate();
+        output.allocator()->allocate();
+        output_state_out.allocator()->allocate();
+        cell_state_out.allocator()->allocate();
+        for (auto &param : params)
+        {
+            param.allocator()->allocate();
+        }
+
+        ARM_COMPUTE_ASSERT(!input.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!output.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(input), NumParams);
+        for (int p = 0; p < NumParams; ++p)
+        {
+            fill(AccessorType(params[p]), p);
+        }
+
+        // Compute function
+        lstm.run();
+
+        return output;
+    }
+
+    SimpleTensor<T> compute_reference(
+        ActivationLayerInfo info, float cell_threshold, DataType data_type, bool cifg_opt, bool peephole_opt)
+    {
+        // Create and fill reference
+        std::vector<SimpleTensor<T>> params;
+        for (int p = 0; p < NumParams; ++p)
+        {
+            params.emplace_back(param_shape(p), data_type);
+            fill(params.back(), p);
+        }
+        SimpleTensor<T> input{TensorShape(_input_size, _num_batches, _num_steps), data_type};
+        SimpleTensor<T> output{TensorShape(_num_units, _num_batches, _num_steps), data_type};
+        fill(input, NumParams);
+
+        const auto activate = [&](float x)
+        { return reference::activate_float<float>(x, info.a(), info.b(), info.activation()); };
+        const auto sigmoid = [](float x) { return 1.f / (1.f + std::exp(-x)); };
+
+        std::vector<float> output_state(params[OutputStateIn].data(),
+                                        params[OutputStateIn].data() + params[OutputStateIn].num_elements());
+        std::vector<float> cell_state(params[CellStateIn].data(),
+                                      params[CellStateIn].data() + params[CellStateIn].num_elements());
+        std::vector<float> next_output_state(output_state.size());
+
+        for (unsigned int t = 0; t < _num_steps; ++t)
+        {
+            for (unsigned int b = 0; b < _num_batches; ++b)
+            {
+                const T     *x = input.data() + (t * _num_batches + b) * _input_size;
+                const float *h = output_state.data() + b * _num_units;
+                for (unsigned int u = 0; u < _num_units; ++u)
+                {
+                    // Pre-activation of a gate: bias + input * input_weights + output_state * recurrent_weights
+                    const auto gate = [&](int input_weights, int recurrent_weights, int bias)
+                    {
+                        float acc = static_cast<float>(params[bias][u]);
+                        for (unsigned int k = 0; k < _input_size; ++k)
+                        {
+                            acc += static_cast<float>(x[k]) *
+                                   static_cast<float>(params[input_weights][u * _input_size + k]);
+                        }
+                        for (unsigned int k = 0; k < _num_units; ++k)
+                        {
+                            acc += h[k] * static_cast<float>(params[recurrent_weights][u * _num_units + k]);
+                        }
+                        return acc;
+                    };
+
+                    float &cell = cell_state[b * _num_units + u];
+
+                    float forget_gate = gate(InputToForget, RecurrentToForget, ForgetGateBias);
+                    float input_gate  = cifg_opt ? 0.f : gate(InputToInput, RecurrentToInput, InputGateBias);
+                    float output_gate = gate(InputToOutput, RecurrentToOutput, OutputGateBias);
+                    if (peephole_opt)
+                    {
+                        forget_gate += static_cast<float>(params[CellToForget][u]) * cell;
+                        input_gate += cifg_opt ? 0.f : static_cast<float>(params[CellToInput][u]) * cell;
+                    }
+                    forget_gate = sigmoid(forget_gate);
+                    input_gate  = cifg_opt ? 1.f - forget_gate : sigmoid(input_gate);
+
+                    cell = forget_gate * cell + input_gate * activate(gate(InputToCell, RecurrentToCell, CellBias));
+                    if (cell_threshold != 0.f)
+                    {
+                        cell = std::min(std::max(cell, -cell_threshold), cell_threshold);
+                    }
+                    if (peephole_opt)
+                    {
+                        output_gate += static_cast<float>(params[CellToOutput][u]) * cell;
+                    }
+                    next_output_state[b * _num_units + u] = sigmoid(output_gate) * activate(cell);
+                }
+            }
+            output_state = next_output_state;
+            std::transform(output_state.begin(), output_state.end(), output.data() + t * output_state.size(),
+                           [](float v) { return static_cast<T>(v); });
+        }
+        return output;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    unsigned int    _input_size{0};
+    unsigned int    _num_units{0};
+    unsigned int    _num_batches{0};
+    unsigned int    _num_steps{0};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_LSTMSEQUENCELAYERFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "tests/framework/Asserts.h" // Required for ARM_COMPUTE_ASSERT
 #include "tests/framework/Fixture.h"
 #include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/DynamicQuantization.h"
 #include "tests/validation/reference/GEMM.h"
 #include "tests/validation/reference/GEMMLowp.h"
 #include "tests/validation/reference/Permute.h"
@@ -66,7 +67,8 @@ public:
                QuantizationInfo    o_qinfo = QuantizationInfo())
     {
         if (std::is_same<TensorType, Tensor>::value && // Cpu
-            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+            ((data_type == DataType::F16 && !CPUInfo::get().has_fp16()) ||
+             (data_type == DataType::BFLOAT16 && !CPUInfo::get().has_bf16())))
         {
             return;
         }
@@ -612,6 +614,83 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename Settings, typename T>
+class MatMulDynamicQuantizationFixture
+    : public MatMulGenericValidationFixture<TensorType, AccessorType, FunctionType, Settings, T>
+{
+public:
+    void setup(TensorShape         shape_a,
+               TensorShape         shape_b,
+               TensorShape         output_shape,
+               bool                transpose_a,
+               bool                transpose_b,
+               DataType            data_type,
+               ActivationLayerInfo act_info)
+    {
+        MatMulGenericValidationFixture<TensorType, AccessorType, FunctionType, Settings, T>::setup(
+            shape_a, shape_b, output_shape, transpose_a, transpose_b, data_type, act_info, 0,
+            Settings().dynamic_quantization(true));
+
+        // Compare against the operands as quantized by the int8 path, so that a fallback to F32 is detected
+        this->_reference =
+            compute_quantized_reference(shape_a, shape_b, output_shape, transpose_a, transpose_b, data_type, act_info);
+    }
+
+protected:
+    SimpleTensor<T> compute_quantized_reference(TensorShape         a_shape,
+                                                TensorShape         b_shape,
+                                                const TensorShape  &output_shape,
+                                                bool                transpose_a,
+                                                bool                transpose_b,
+                                                DataType            data_type,
+                                                ActivationLayerInfo act_info)
+    {
+        // The operands are filled in the shapes given to the target, as in the generic fixture
+        if (transpose_a)
+        {
+            permute(a_shape, PermutationVector(1U, 0U));
+        }
+        if (transpose_b)
+        {
+            permute(b_shape, PermutationVector(1U, 0U));
+        }
+
+        const TensorShape output_shape_collapsed = output_shape.collapsed_from(Window::DimZ);
+
+        // Create reference
+        SimpleTensor<T> a{a_shape.collapsed_from(Window::DimZ), data_type};
+        SimpleTensor<T> b{b_shape.collapsed_from(Window::DimZ), data_type};
+        SimpleTensor<T> c{output_shape_collapsed, data_type};
+
+        // Fill reference
+        this->fill(a, 2);
+        this->fill(b, 3);
+
+        if (transpose_a)
+        {
+            a = reference::permute<T>(a, PermutationVector(1U, 0U));
+        }
+        if (transpose_b)
+        {
+            b = reference::permute<T>(b, PermutationVector(1U, 0U));
+        }
+
+        // Each row of a and each column of b are quantized with their own scale
+        a = reference::dynamic_quantize_dequantize(a);
+        b = reference::dynamic_quantize_dequantize(b, true);
+
+        auto result = reference::activation_layer<T>(reference::gemm<T>(a, b, c, 1.0f, 0.f), act_info);
+
+        // We reshape the gemm output back if the tensor is high dimensional
+        if (output_shape_collapsed != output_shape)
+        {
+            result = reference::reshape_layer(result, output_shape);
+        }
+
+        return result;
+    }
+};
+
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_RNNSEQUENCELAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_RNNSEQUENCELAYERFIXTURE_H
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/reference/GEMM.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RNNSequenceLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int        input_size,
+               unsigned int        num_units,
+               unsigned int        num_batches,
+               unsigned int        num_steps,
+               ActivationLayerInfo info,
+               DataType            data_type)
+    {
+        if (std::is_same<TensorType, Tensor>::value && // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _target    = compute_target(input_size, num_units, num_batches, num_steps, info, data_type);
+        _reference = compute_reference(input_size, num_units, num_batches, num_steps, info, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        static_assert(std::is_floating_point<T>::value || std::is_same<T, half>::value,
+                      "Only floating point data types supported.");
+        using DistributionType = typename std::conditional<std::is_same<T, half>::value,
+                                                           arm_compute::utils::uniform_real_distribution_16bit<T>,
+                                                           std::uniform_real_distribution<T>>::type;
+
+        DistributionType distribution{T(-1.0f), T(1.0f)};
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(unsigned int        input_size,
+                              unsigned int        num_units,
+                              unsigned int        num_batches,
+                              unsigned int        num_steps,
+                              ActivationLayerInfo info,
+                              DataType            data_type)
+    {
+        const TensorShape input_shape(input_size, num_batches, num_steps);
+        const TensorShape state_shape(num_units, num_batches);
+        const TensorShape output_shape(num_units, num_batches, num_steps);
+
+        // Create tensors
+        TensorType input             = create_tensor<TensorType>(input_shape, data_type);
+        TensorType weights           = create_tensor<TensorType>(TensorShape(input_size, num_units), data_type);
+        TensorType recurrent_weights = create_tensor<TensorType>(TensorShape(num_units, num_units), data_type);
+        TensorType bias              = create_tensor<TensorType>(TensorShape(num_units), data_type);
+        TensorType hidden_state      = create_tensor<TensorType>(state_shape, data_type);
+        TensorType output            = create_tensor<TensorType>(output_shape, data_type);
+
+        // Create and configure function
+        FunctionType rnn;
+        rnn.configure(&input, &weights, &recurrent_weights, &bias, &hidden_state, &output, info);
+
+        ARM_COMPUTE_ASSERT(input.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(recurrent_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(hidden_state.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(output.info()->is_resizable());
+
+        // Allocate tensors
+        input.allocator()->allocate();
+        weights.allocator()->allocate();
+        recurrent_weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        hidden_state.allocator()->allocate();
+        output.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!input.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!recurrent_weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!hidden_state.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!output.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(input), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(recurrent_weights), 2);
+        fill(AccessorType(bias), 3);
+        fill(AccessorType(hidden_state), 4);
+
+        // Compute function
+        rnn.run();
+
+        return output;
+    }
+
+    SimpleTensor<T> compute_reference(unsigned int        input_size,
+                                      unsigned int        num_units,
+                                      unsigned int        num_batches,
+                                      unsigned int        num_steps,
+                                      ActivationLayerInfo info,
+                                      DataType            data_type)
+    {
+        // Create reference
+        SimpleTensor<T> input{TensorShape(input_size, num_batches, num_steps), data_type};
+        SimpleTensor<T> weights{TensorShape(input_size, num_units), data_type};
+        SimpleTensor<T> recurrent_weights{TensorShape(num_units, num_units), data_type};
+        SimpleTensor<T> bias{TensorShape(num_units), data_type};
+        SimpleTensor<T> hidden_state{TensorShape(num_units, num_batches), data_type};
+        SimpleTensor<T> output{TensorShape(num_units, num_batches, num_steps), data_type};
+
+        // Fill reference
+        fill(input, 0);
+        fill(weights, 1);
+        fill(recurrent_weights, 2);
+        fill(bias, 3);
+        fill(hidden_state, 4);
+
+        // Compute reference by running a basic RNN step for every timestep
+        const TensorShape step_shape(num_units, num_batches);
+        SimpleTensor<T>   input_step{TensorShape(input_size, num_batches), data_type};
+        SimpleTensor<T>   out_w{step_shape, data_type};
+        for (unsigned int t = 0; t < num_steps; ++t)
+        {
+            std::copy_n(input.data() + t * input_step.num_elements(), input_step.num_elements(), input_step.data());
+
+            SimpleTensor<T> fully_connected = reference::fully_connected_layer(input_step, weights, bias, step_shape);
+            SimpleTensor<T> gemm            = reference::gemm(hidden_state, recurrent_weights, out_w, 1.f, 0.f);
+            SimpleTensor<T> add_res         = reference::arithmetic_operation(
+                reference::ArithmeticOperation::ADD, fully_connected, gemm, data_type, ConvertPolicy::SATURATE);
+            hidden_state = reference::activation_layer(add_res, info);
+
+            std::copy_n(hidden_state.data(), hidden_state.num_elements(),
+                        output.data() + t * hidden_state.num_elements());
+        }
+        return output;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_RNNSEQUENCELAYERFIXTURE_H
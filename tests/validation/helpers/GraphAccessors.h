@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_HELPERS_GRAPHACCESSORS_H
+#define ACL_TESTS_VALIDATION_HELPERS_GRAPHACCESSORS_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace helper
+{
+/** Graph accessor filling an F32 tensor from a vector, or reading an F32 tensor into it, with dimension 0 running
+ *  fastest
+ */
+class VectorAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in, out] values Values to fill the tensor with, or to read the tensor into. Must outlive the accessor
+     * @param[in]      read   Read the tensor into @p values instead of filling it
+     */
+    VectorAccessor(std::vector<float> &values, bool read) : _values(values), _read(read)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        Window win;
+        win.use_tensor_dimensions(tensor.info()->tensor_shape());
+
+        size_t index = 0;
+        execute_window_loop(win,
+                            [&](const Coordinates &id)
+                            {
+                                float *ptr = reinterpret_cast<float *>(tensor.ptr_to_element(id));
+                                if (_read)
+                                {
+                                    _values[index++] = *ptr;
+                                }
+                                else
+                                {
+                                    *ptr = _values[index++];
+                                }
+                            });
+        return true;
+    }
+
+private:
+    std::vector<float> &_values;
+    bool                _read;
+};
+} // namespace helper
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_HELPERS_GRAPHACCESSORS_H
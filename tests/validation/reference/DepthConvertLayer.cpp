@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2020, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,7 +72,7 @@ SimpleTensor<T2> depth_convert(const SimpleTensor<T1> &src, DataType dt_out, Con
 
 template <typename T1,
           typename T2,
-          typename std::enable_if<is_floating_point<T1>::value &&
+          typename std::enable_if<is_floating_point<T1>::value && !std::is_same<T1, bfloat16>::value &&
                                       (!std::is_same<T1, T2>::value && !std::is_same<T2, bfloat16>::value),
                                   int>::type>
 SimpleTensor<T2> depth_convert(const SimpleTensor<T1> &src, DataType dt_out, ConvertPolicy policy, uint32_t shift)
@@ -216,6 +216,8 @@ depth_convert(const SimpleTensor<int32_t> &src, DataType dt_out, ConvertPolicy p
 // BFLOAT16
 template SimpleTensor<bfloat16>
 depth_convert(const SimpleTensor<bfloat16> &src, DataType dt_out, ConvertPolicy policy, uint32_t shift);
+template SimpleTensor<float>
+depth_convert(const SimpleTensor<bfloat16> &src, DataType dt_out, ConvertPolicy policy, uint32_t shift);
 
 // F16
 template SimpleTensor<uint8_t>
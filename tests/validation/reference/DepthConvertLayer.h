@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2025 Arm Limited.
+ * Copyright (c) 2017-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,7 +42,7 @@ SimpleTensor<T2> depth_convert(const SimpleTensor<T1> &src, DataType dt_out, Con
 
 template <typename T1,
           typename T2,
-          typename std::enable_if<is_floating_point<T1>::value &&
+          typename std::enable_if<is_floating_point<T1>::value && !std::is_same<T1, bfloat16>::value &&
                                       (!std::is_same<T1, T2>::value && !std::is_same<T2, bfloat16>::value),
                                   int>::type = 0>
 SimpleTensor<T2> depth_convert(const SimpleTensor<T1> &src, DataType dt_out, ConvertPolicy policy, uint32_t shift);
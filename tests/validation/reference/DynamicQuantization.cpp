@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "DynamicQuantization.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> dynamic_quantize_dequantize(const SimpleTensor<T> &src, bool per_column)
+{
+    SimpleTensor<T> dst{src.shape(), src.data_type()};
+
+    const int width      = src.shape().x();
+    const int height     = src.shape().y();
+    const int num_slices = src.shape().total_size_upper(2);
+
+    // Lines are the rows, or the columns, of each slice
+    const int num_lines   = per_column ? width : height;
+    const int line_length = per_column ? height : width;
+    const int line_step   = per_column ? width : 1;
+
+    for (int slice = 0; slice < num_slices; ++slice)
+    {
+        for (int line = 0; line < num_lines; ++line)
+        {
+            const int offset = slice * width * height + (per_column ? line : line * width);
+
+            T absmax = 0;
+            for (int i = 0; i < line_length; ++i)
+            {
+                absmax = std::max(absmax, static_cast<T>(std::abs(src[offset + i * line_step])));
+            }
+
+            // Lines of zeros get a unit scale, as in the quantization kernel
+            const T scale     = absmax > 0 ? absmax / static_cast<T>(127) : static_cast<T>(1);
+            const T inv_scale = static_cast<T>(1) / scale;
+            for (int i = 0; i < line_length; ++i)
+            {
+                const int index     = offset + i * line_step;
+                const int quantized = utility::clamp<int>(
+                    static_cast<int>(support::cpp11::nearbyint(src[index] * inv_scale)), -128, 127);
+                dst[index] = static_cast<T>(quantized) * scale;
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> dynamic_quantize_dequantize(const SimpleTensor<float> &src, bool per_column);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_DYNAMICQUANTIZATION_H
+#define ACL_TESTS_VALIDATION_REFERENCE_DYNAMICQUANTIZATION_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Quantize a tensor to int8 and dequantize it back, as the operands of the dynamically quantized GEMMs
+ *
+ * Each row, or each column of each 2D slice, is quantized symmetrically with the scale that maps its largest
+ * absolute value to 127. Computing a floating-point reference on the result gives the output of the int8 GEMM up to
+ * the rounding of the accumulation.
+ *
+ * @param[in] src        Tensor to quantize
+ * @param[in] per_column (Optional) Use one scale per column instead of one scale per row. Defaults to false.
+ *
+ * @return The dequantized tensor
+ */
+template <typename T>
+SimpleTensor<T> dynamic_quantize_dequantize(const SimpleTensor<T> &src, bool per_column = false);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_DYNAMICQUANTIZATION_H
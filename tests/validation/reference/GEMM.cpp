@@ -80,6 +80,9 @@ SimpleTensor<T> gemm(const SimpleTensor<T> &a,
     const int c_stride_z = N * M;
     const int c_stride_w = N * M * D;
 
+    // BFLOAT16 kernels accumulate in F32 and only round the result
+    using TAcc = typename std::conditional<std::is_same<T, bfloat16>::value, float, T>::type;
+
 #if defined(_OPENMP) && !(defined(__arm__) && defined(__ANDROID__))
 #pragma omp parallel for collapse(2)
 #endif /* _OPENMP */
@@ -95,7 +98,7 @@ SimpleTensor<T> gemm(const SimpleTensor<T> &a,
             {
                 for (int col = 0; col < N; ++col)
                 {
-                    T acc(0);
+                    TAcc acc(0);
 
                     for (int k = 0; k < K; ++k)
                     {
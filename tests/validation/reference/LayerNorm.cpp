@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "LayerNorm.h"
+
+#include "arm_compute/core/QuantizationInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+template <typename TOut>
+TOut convert_output(float value, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return static_cast<TOut>(value);
+}
+
+template <>
+int8_t convert_output(float value, const UniformQuantizationInfo &qinfo)
+{
+    return quantize_qasymm8_signed(value, qinfo);
+}
+} // namespace
+
+template <typename T, typename TOut>
+SimpleTensor<TOut> layer_norm(const SimpleTensor<T>  &src,
+                              const SimpleTensor<T>  &residual,
+                              const SimpleTensor<T>  &gamma,
+                              const SimpleTensor<T>  &beta,
+                              SimpleTensor<T>        &residual_out,
+                              float                   epsilon,
+                              bool                    rms_norm,
+                              const QuantizationInfo &oq_info)
+{
+    const bool     has_residual  = residual.num_elements() != 0;
+    const bool     has_beta      = beta.num_elements() != 0;
+    const bool     is_quantized  = std::is_same<TOut, int8_t>::value;
+    const DataType dst_data_type = is_quantized ? DataType::QASYMM8_SIGNED : src.data_type();
+
+    SimpleTensor<TOut> dst{src.shape(), dst_data_type, 1, oq_info};
+    if (has_residual)
+    {
+        residual_out = SimpleTensor<T>{src.shape(), src.data_type(), 1};
+    }
+
+    const UniformQuantizationInfo qinfo = oq_info.uniform();
+    const int                     cols  = src.shape()[0];
+    const int                     rows  = src.num_elements() / cols;
+    std::vector<float>            x(cols);
+    for (int i = 0; i < rows; ++i)
+    {
+        float sum    = 0.f;
+        float sum_sq = 0.f;
+        for (int j = 0; j < cols; ++j)
+        {
+            const int idx = j + i * cols;
+            x[j]          = static_cast<float>(src[idx]);
+            if (has_residual)
+            {
+                x[j] += static_cast<float>(residual[idx]);
+                residual_out[idx] = static_cast<T>(x[j]);
+            }
+            sum += x[j];
+            sum_sq += x[j] * x[j];
+        }
+        const float mean       = rms_norm ? 0.f : sum / cols;
+        const float var        = std::max(sum_sq / cols - mean * mean, 0.f);
+        const float stddev_inv = 1.f / std::sqrt(var + epsilon);
+        for (int j = 0; j < cols; ++j)
+        {
+            float res = (x[j] - mean) * stddev_inv * static_cast<float>(gamma[j]);
+            if (has_beta)
+            {
+                res += static_cast<float>(beta[j]);
+            }
+            dst[j + i * cols] = convert_output<TOut>(res, qinfo);
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> layer_norm(const SimpleTensor<float> &src,
+                                        const SimpleTensor<float> &residual,
+                                        const SimpleTensor<float> &gamma,
+                                        const SimpleTensor<float> &beta,
+                                        SimpleTensor<float>       &residual_out,
+                                        float                      epsilon,
+                                        bool                       rms_norm,
+                                        const QuantizationInfo    &oq_info);
+template SimpleTensor<half> layer_norm(const SimpleTensor<half> &src,
+                                       const SimpleTensor<half> &residual,
+                                       const SimpleTensor<half> &gamma,
+                                       const SimpleTensor<half> &beta,
+                                       SimpleTensor<half>       &residual_out,
+                                       float                     epsilon,
+                                       bool                      rms_norm,
+                                       const QuantizationInfo   &oq_info);
+template SimpleTensor<bfloat16> layer_norm(const SimpleTensor<bfloat16> &src,
+                                           const SimpleTensor<bfloat16> &residual,
+                                           const SimpleTensor<bfloat16> &gamma,
+                                           const SimpleTensor<bfloat16> &beta,
+                                           SimpleTensor<bfloat16>       &residual_out,
+                                           float                         epsilon,
+                                           bool                          rms_norm,
+                                           const QuantizationInfo       &oq_info);
+template SimpleTensor<int8_t> layer_norm(const SimpleTensor<float> &src,
+                                         const SimpleTensor<float> &residual,
+                                         const SimpleTensor<float> &gamma,
+                                         const SimpleTensor<float> &beta,
+                                         SimpleTensor<float>       &residual_out,
+                                         float                      epsilon,
+                                         bool                       rms_norm,
+                                         const QuantizationInfo    &oq_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_LAYERNORM_H
+#define ACL_TESTS_VALIDATION_REFERENCE_LAYERNORM_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Reference implementation of the layer and RMS normalizations with a fused residual addition
+ *
+ * @param[in]  src          Source tensor. Rows are normalized along the X axis.
+ * @param[in]  residual     Tensor added to @p src before the normalization. Ignored if empty.
+ * @param[in]  gamma        1D tensor with the scale of each element of a row.
+ * @param[in]  beta         1D tensor with the bias of each element of a row. Ignored if empty.
+ * @param[out] residual_out Sum of @p src and @p residual. Only written if @p residual is not empty.
+ * @param[in]  epsilon      Value added to the variance to avoid divisions by zero.
+ * @param[in]  rms_norm     True to normalize by the root mean square, without centering.
+ * @param[in]  oq_info      (Optional) Quantization info of the destination when @p TOut is int8_t.
+ *
+ * @return the normalized tensor, computed in F32 and converted to @p TOut. An int8_t destination is QASYMM8_SIGNED.
+ */
+template <typename T, typename TOut = T>
+SimpleTensor<TOut> layer_norm(const SimpleTensor<T>  &src,
+                              const SimpleTensor<T>  &residual,
+                              const SimpleTensor<T>  &gamma,
+                              const SimpleTensor<T>  &beta,
+                              SimpleTensor<T>        &residual_out,
+                              float                   epsilon,
+                              bool                    rms_norm,
+                              const QuantizationInfo &oq_info = QuantizationInfo());
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_LAYERNORM_H
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "QKVRoPE.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Rotate a head of @p head_dim elements in double precision. The result is written with a stride of @p dst_stride. */
+template <typename T>
+void rotate(const T *src, T *dst, int dst_stride, int position, int head_dim, const RoPEInfo &info)
+{
+    const int rotary_dim = info.rotary_dim == 0 ? head_dim : static_cast<int>(info.rotary_dim);
+    const int half       = rotary_dim / 2;
+    for (int i = 0; i < half; ++i)
+    {
+        const int    i0    = info.interleaved ? 2 * i : i;
+        const int    i1    = info.interleaved ? 2 * i + 1 : i + half;
+        const double angle = position * std::pow(static_cast<double>(info.base), -2.0 * i / rotary_dim);
+        const double c     = std::cos(angle);
+        const double s     = std::sin(angle);
+        const double x0    = static_cast<double>(src[i0]);
+        const double x1    = static_cast<double>(src[i1]);
+
+        dst[i0 * dst_stride] = static_cast<T>(x0 * c - x1 * s);
+        dst[i1 * dst_stride] = static_cast<T>(x1 * c + x0 * s);
+    }
+    for (int i = rotary_dim; i < head_dim; ++i)
+    {
+        dst[i * dst_stride] = src[i];
+    }
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> qkv_rope(const SimpleTensor<T>       &qkv,
+                         const SimpleTensor<int32_t> &positions,
+                         SimpleTensor<T>             &k,
+                         SimpleTensor<T>             &v,
+                         const RoPEInfo              &info)
+{
+    const int head_dim     = info.head_dim;
+    const int num_heads    = info.num_heads;
+    const int num_kv_heads = info.num_kv_heads;
+    const int seq_len      = qkv.shape()[1];
+    const int batch_size   = qkv.shape()[2];
+    const int row_size     = qkv.shape()[0];
+
+    SimpleTensor<T> q{TensorShape(head_dim, seq_len, num_heads, batch_size), qkv.data_type()};
+    k = SimpleTensor<T>{info.transpose_k ? TensorShape(seq_len, head_dim, num_kv_heads, batch_size)
+                                         : TensorShape(head_dim, seq_len, num_kv_heads, batch_size),
+                        qkv.data_type()};
+    v = SimpleTensor<T>{TensorShape(head_dim, seq_len, num_kv_heads, batch_size), qkv.data_type()};
+
+    const bool per_batch_positions = positions.num_elements() > static_cast<size_t>(seq_len);
+    for (int b = 0; b < batch_size; ++b)
+    {
+        for (int s = 0; s < seq_len; ++s)
+        {
+            int position = s;
+            if (positions.num_elements() != 0)
+            {
+                position = positions[per_batch_positions ? b * seq_len + s : s];
+            }
+
+            const T *row = qkv.data() + (b * seq_len + s) * row_size;
+            for (int h = 0; h < num_heads; ++h)
+            {
+                T *dst = q.data() + ((b * num_heads + h) * seq_len + s) * head_dim;
+                rotate(row + h * head_dim, dst, 1, position, head_dim, info);
+            }
+            for (int h = 0; h < num_kv_heads; ++h)
+            {
+                const size_t head = b * num_kv_heads + h;
+                if (info.transpose_k)
+                {
+                    T *dst = k.data() + head * head_dim * seq_len + s;
+                    rotate(row + (num_heads + h) * head_dim, dst, seq_len, position, head_dim, info);
+                }
+                else
+                {
+                    T *dst = k.data() + (head * seq_len + s) * head_dim;
+                    rotate(row + (num_heads + h) * head_dim, dst, 1, position, head_dim, info);
+                }
+
+                const T *src = row + (num_heads + num_kv_heads + h) * head_dim;
+                std::copy(src, src + head_dim, v.data() + (head * seq_len + s) * head_dim);
+            }
+        }
+    }
+    return q;
+}
+
+template SimpleTensor<float> qkv_rope(const SimpleTensor<float>   &qkv,
+                                      const SimpleTensor<int32_t> &positions,
+                                      SimpleTensor<float>         &k,
+                                      SimpleTensor<float>         &v,
+                                      const RoPEInfo              &info);
+template SimpleTensor<half> qkv_rope(const SimpleTensor<half>    &qkv,
+                                     const SimpleTensor<int32_t> &positions,
+                                     SimpleTensor<half>          &k,
+                                     SimpleTensor<half>          &v,
+                                     const RoPEInfo              &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_QKVROPE_H
+#define ACL_TESTS_VALIDATION_REFERENCE_QKVROPE_H
+
+#include "arm_compute/function_info/RoPEInfo.h"
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Reference implementation of the QKV split with rotary position embedding
+ *
+ * @param[in]  qkv       Output of the fused QKV projection with dimensions [(H + 2 * Hkv) * D, S, B].
+ * @param[in]  positions Position of each token, with dimensions [S] or [S, B]. Ignored if empty.
+ * @param[out] k         Key heads, with dimensions [S, D, Hkv, B], or [D, S, Hkv, B] without @ref RoPEInfo::transpose_k.
+ * @param[out] v         Value heads, with dimensions [D, S, Hkv, B].
+ * @param[in]  info      Rotary position embedding information.
+ *
+ * @return the query heads, with dimensions [D, S, H, B].
+ */
+template <typename T>
+SimpleTensor<T> qkv_rope(const SimpleTensor<T>       &qkv,
+                         const SimpleTensor<int32_t> &positions,
+                         SimpleTensor<T>             &k,
+                         SimpleTensor<T>             &v,
+                         const RoPEInfo              &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_QKVROPE_H
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/operators/CpuLayerNorm.h"
+
+#include "arm_compute/runtime/experimental/operators/CpuRMSNorm.h"
+
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/CpuLayerNormFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+namespace
+{
+/** Tolerance for float operations */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-4f);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<float> tolerance_f16(0.02f);
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+#ifdef ARM_COMPUTE_ENABLE_BF16
+/* One BF16 unit in the last place for values up to 4 */
+constexpr AbsoluteTolerance<float> tolerance_bf16(0.04f);
+#endif /* ARM_COMPUTE_ENABLE_BF16 */
+constexpr AbsoluteTolerance<int8_t> tolerance_qasymm8_signed(1);
+
+const auto residual_dataset = make("Residual", {false, true});
+} // namespace
+
+template <typename T>
+using CpuLayerNormFixture = CpuLayerNormValidationFixture<Tensor, Accessor, experimental::op::CpuLayerNorm, T>;
+template <typename T>
+using CpuLayerNormPaddedFixture =
+    CpuLayerNormPaddedValidationFixture<Tensor, Accessor, experimental::op::CpuLayerNorm, T>;
+template <typename T>
+using CpuLayerNormQuantizedFixture =
+    CpuLayerNormQuantizedValidationFixture<Tensor, Accessor, experimental::op::CpuLayerNorm, T>;
+template <typename T>
+using CpuRMSNormFixture = CpuLayerNormValidationFixture<Tensor, Accessor, experimental::op::CpuRMSNorm, T>;
+template <typename T>
+using CpuRMSNormQuantizedFixture =
+    CpuLayerNormQuantizedValidationFixture<Tensor, Accessor, experimental::op::CpuRMSNorm, T>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(OPERATORS)
+TEST_SUITE(CpuLayerNorm)
+
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("InputInfo", { TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                        TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Gamma of the wrong size
+                        TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Mismatching residual shape
+                        TensorInfo(TensorShape(32U, 13U), 1, DataType::F32), // Unsupported destination data type
+                        TensorInfo(TensorShape(32U, 13U), 1, DataType::S32), // Unsupported source data type
+                        TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                      }),
+    make("GammaInfo", { TensorInfo(TensorShape(32U), 1, DataType::F32),
+                        TensorInfo(TensorShape(31U), 1, DataType::F32),
+                        TensorInfo(TensorShape(32U), 1, DataType::F32),
+                        TensorInfo(TensorShape(32U), 1, DataType::F32),
+                        TensorInfo(TensorShape(32U), 1, DataType::S32),
+                        TensorInfo(TensorShape(32U), 1, DataType::F32),
+                      }),
+    make("ResidualInfo", { TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                           TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                           TensorInfo(TensorShape(32U, 12U), 1, DataType::F32),
+                           TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                           TensorInfo(TensorShape(32U, 13U), 1, DataType::S32),
+                           TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                         }),
+    make("OutputInfo", { TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                         TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                         TensorInfo(TensorShape(32U, 13U), 1, DataType::F32),
+                         TensorInfo(TensorShape(32U, 13U), 1, DataType::QASYMM8),
+                         TensorInfo(TensorShape(32U, 13U), 1, DataType::S32),
+                         TensorInfo(TensorShape(32U, 13U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.05f, 3)),
+                       }),
+    make("Expected", { true, false, false, false, false, true })),
+    input_info, gamma_info, residual_info, output_info, expected)
+{
+    const TensorInfo residual_out_info = input_info;
+    const Status     status            = experimental::op::CpuLayerNorm::validate(&input_info, &residual_info,
+                                                                                  &gamma_info, &gamma_info,
+                                                                                  &output_info, &residual_out_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuLayerNormFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(), residual_dataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    if (_has_residual)
+    {
+        validate(Accessor(_target_residual), _reference_residual, tolerance_f32);
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunPadded,
+                       CpuLayerNormPaddedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::Small4DShapes(), residual_dataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    if (_has_residual)
+    {
+        validate(Accessor(_target_residual), _reference_residual, tolerance_f32);
+    }
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuLayerNormFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(), residual_dataset, make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+        if (_has_residual)
+        {
+            validate(Accessor(_target_residual), _reference_residual, tolerance_f16);
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+
+#ifdef ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE(BF16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuLayerNormFixture<bfloat16>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(), residual_dataset, make("DataType", DataType::BFLOAT16)))
+{
+    // BF16 values are converted with integer instructions, so FEAT_BF16 is not required
+    validate(Accessor(_target), _reference, tolerance_bf16);
+    if (_has_residual)
+    {
+        validate(Accessor(_target_residual), _reference_residual, tolerance_bf16);
+    }
+}
+TEST_SUITE_END() // BF16
+#endif           // ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuLayerNormQuantizedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               residual_dataset,
+                               make("DataType", DataType::F32),
+                               make("QuantizationInfo", {QuantizationInfo(0.05f, 3)})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+TEST_SUITE_END() // CpuLayerNorm
+
+TEST_SUITE(CpuRMSNorm)
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuRMSNormFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(), residual_dataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    if (_has_residual)
+    {
+        validate(Accessor(_target_residual), _reference_residual, tolerance_f32);
+    }
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuRMSNormFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(), residual_dataset, make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+        if (_has_residual)
+        {
+            validate(Accessor(_target_residual), _reference_residual, tolerance_f16);
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+
+#ifdef ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE(BF16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuRMSNormFixture<bfloat16>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(), residual_dataset, make("DataType", DataType::BFLOAT16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_bf16);
+    if (_has_residual)
+    {
+        validate(Accessor(_target_residual), _reference_residual, tolerance_bf16);
+    }
+}
+TEST_SUITE_END() // BF16
+#endif           // ARM_COMPUTE_ENABLE_BF16
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuRMSNormQuantizedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallShapes(),
+                               residual_dataset,
+                               make("DataType", DataType::F32),
+                               make("QuantizationInfo", {QuantizationInfo(0.05f, 3)})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+TEST_SUITE_END() // CpuRMSNorm
+
+TEST_SUITE_END() // OPERATORS
+TEST_SUITE_END() // NEON
+
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
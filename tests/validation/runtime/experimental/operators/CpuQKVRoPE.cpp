@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/operators/CpuQKVRoPE.h"
+
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/validation/fixtures/CpuQKVRoPEFixture.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+namespace
+{
+/** Tolerance for float operations */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-5f);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<float> tolerance_f16(0.002f);
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+/** Multi-head, grouped-query and multi-query attention, with a partially rotated head and a single decoded token */
+const auto heads_dataset = zip(make("NumHeads", {4U, 8U, 4U, 2U}),
+                               make("NumKVHeads", {4U, 2U, 1U, 2U}),
+                               make("HeadDim", {16U, 32U, 22U, 8U}),
+                               make("RotaryDim", {0U, 0U, 10U, 4U}),
+                               make("SeqLen", {7U, 5U, 3U, 1U}),
+                               make("BatchSize", {1U, 2U, 1U, 3U}));
+const auto layout_dataset =
+    combine(make("Interleaved", {false, true}), make("TransposeK", {true, false}), make("Positions", {false, true}));
+} // namespace
+
+template <typename T>
+using CpuQKVRoPEFixture = CpuQKVRoPEValidationFixture<Tensor, Accessor, experimental::op::CpuQKVRoPE, T>;
+template <typename T>
+using CpuQKVRoPELargestPositionFixture =
+    CpuQKVRoPELargestPositionValidationFixture<Tensor, Accessor, experimental::op::CpuQKVRoPE, T>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(OPERATORS)
+TEST_SUITE(CpuQKVRoPE)
+
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("QKVInfo", { TensorInfo(TensorShape(96U, 7U, 2U), 1, DataType::F32),
+                      TensorInfo(TensorShape(96U, 7U, 2U), 1, DataType::F32), // Heads not divisible by KV heads
+                      TensorInfo(TensorShape(90U, 7U, 2U), 1, DataType::F32), // Mismatching QKV row size
+                      TensorInfo(TensorShape(96U, 7U, 2U), 1, DataType::F32), // Positions with the wrong length
+                      TensorInfo(TensorShape(96U, 7U, 2U), 1, DataType::S32), // Unsupported data type
+                      TensorInfo(TensorShape(96U, 7U, 2U), 1, DataType::F32), // Sequence longer than max position
+                    }),
+    make("PositionsInfo", { TensorInfo(TensorShape(7U, 2U), 1, DataType::S32),
+                            TensorInfo(TensorShape(7U, 2U), 1, DataType::S32),
+                            TensorInfo(TensorShape(7U, 2U), 1, DataType::S32),
+                            TensorInfo(TensorShape(6U, 2U), 1, DataType::S32),
+                            TensorInfo(TensorShape(7U, 2U), 1, DataType::S32),
+                            TensorInfo(),
+                          }),
+    make("NumKVHeads", { 2U, 3U, 2U, 2U, 2U, 2U }),
+    make("MaxPosition", { 16U, 16U, 16U, 16U, 16U, 4U }),
+    make("Expected", { true, false, false, false, false, false })),
+    qkv_info, positions_info, num_kv_heads, max_position, expected)
+{
+    // 4 query heads of 12 elements, with 2 KV heads: (4 + 2 * 2) * 12 = 96
+    const RoPEInfo info(4U, num_kv_heads, 12U, max_position);
+    TensorInfo     q_info{};
+    TensorInfo     k_info{};
+    TensorInfo     v_info{};
+    const Status   status = experimental::op::CpuQKVRoPE::validate(&qkv_info,
+                                                                   positions_info.total_size() != 0 ? &positions_info : nullptr,
+                                                                   &q_info, &k_info, &v_info, info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+TEST_CASE(PositionOutOfRange, framework::DatasetMode::ALL)
+{
+    const RoPEInfo info(4U, 2U, 12U, 16U);
+
+    Tensor qkv       = create_tensor<Tensor>(TensorShape(96U, 7U), DataType::F32);
+    Tensor positions = create_tensor<Tensor>(TensorShape(7U), DataType::S32);
+    Tensor q{};
+    Tensor k{};
+    Tensor v{};
+
+    experimental::op::CpuQKVRoPE rope;
+    rope.configure(qkv.info(), positions.info(), q.info(), k.info(), v.info(), info);
+
+    for (Tensor *tensor : {&qkv, &positions, &q, &k, &v})
+    {
+        tensor->allocator()->allocate();
+    }
+    // All the tokens are within the table but the last one
+    for (int s = 0; s < 7; ++s)
+    {
+        *reinterpret_cast<int32_t *>(positions.ptr_to_element(Coordinates(s))) = s == 6 ? 16 : s;
+    }
+
+    ITensorPack run_pack{{arm_compute::TensorType::ACL_SRC_0, &qkv},
+                         {arm_compute::TensorType::ACL_SRC_1, &positions},
+                         {arm_compute::TensorType::ACL_DST_0, &q},
+                         {arm_compute::TensorType::ACL_DST_1, &k},
+                         {arm_compute::TensorType::ACL_DST_2, &v}};
+    bool thrown = false;
+    try
+    {
+        rope.run(run_pack);
+    }
+    catch (const std::exception &)
+    {
+        thrown = true;
+    }
+    ARM_COMPUTE_EXPECT(thrown, framework::LogLevel::ERRORS);
+}
+#endif // ARM_COMPUTE_EXCEPTIONS_DISABLED
+
+TEST_SUITE(Float)
+TEST_SUITE(F32)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuQKVRoPEFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(heads_dataset, layout_dataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target_q), _reference_q, tolerance_f32);
+    validate(Accessor(_target_k), _reference_k, tolerance_f32);
+    validate(Accessor(_target_v), _reference_v);
+}
+FIXTURE_DATA_TEST_CASE(RunLargestPosition,
+                       CpuQKVRoPELargestPositionFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(heads_dataset,
+                               make("Interleaved", {false, true}),
+                               make("TransposeK", {false}),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target_q), _reference_q, tolerance_f32);
+    validate(Accessor(_target_k), _reference_k, tolerance_f32);
+    validate(Accessor(_target_v), _reference_v);
+}
+TEST_SUITE_END() // F32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(F16)
+FIXTURE_DATA_TEST_CASE(RunSmall,
+                       CpuQKVRoPEFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(heads_dataset, layout_dataset, make("DataType", DataType::F16)))
+{
+    if (CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target_q), _reference_q, tolerance_f16);
+        validate(Accessor(_target_k), _reference_k, tolerance_f16);
+        validate(Accessor(_target_v), _reference_v);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_WARNING("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_WARNING();
+    }
+}
+TEST_SUITE_END() // F16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // CpuQKVRoPE
+TEST_SUITE_END() // OPERATORS
+TEST_SUITE_END() // NEON
+
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
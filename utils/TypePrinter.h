@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -2623,7 +2623,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const FullyConnectedLayerI
        << "transpose_weights=" << layer_info.transpose_weights << ", "
        << "are_weights_reshaped=" << layer_info.are_weights_reshaped << ", "
        << "retain_internal_weights=" << layer_info.retain_internal_weights << ", "
-       << "fp_mixed_precision=" << layer_info.fp_mixed_precision << "}";
+       << "fp_mixed_precision=" << layer_info.fp_mixed_precision << ", "
+       << "dynamic_quantization=" << layer_info.dynamic_quantization << "}";
     return os;
 }
 
@@ -3360,7 +3361,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::CpuMatM
 {
     os << "CpuMatMulSettings="
        << "["
-       << "fast_math=" << settings.fast_math() << ",fixed_format=" << settings.fixed_format() << "]";
+       << "fast_math=" << settings.fast_math() << ",fixed_format=" << settings.fixed_format()
+       << ",dynamic_quantization=" << settings.dynamic_quantization() << "]";
 
     return os;
 }